@@ -12,6 +12,7 @@
 #ifndef DJINTERP_TEST_ASSERT_
 #define	DJINTERP_TEST_ASSERT_ 1
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,7 +22,7 @@
 // D_INTERNAL_TEST_ASSERT_BOOLEAN_FN_BODY
 //   macro (internal) 
 #define D_INTERNAL_TEST_ASSERT_FN_BODY(fn_body)                              \
-	struct d_assert* new_assertion = malloc(sizeof(struct d_assert));  \
+	struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));  \
                                                                              \
     if (!new_assertion)                                                      \
     {                                                                        \
@@ -45,20 +46,232 @@
     )
 
 
+// D_ASSERT_LIKELY / D_ASSERT_UNLIKELY
+//   macro: branch prediction hints for assertion pass/fail paths.
+// D_ASSERT_COLD
+//   macro: marks an out-of-line failure handler so the compiler keeps it
+// away from the pass path of the caller.
+#if defined(__GNUC__) || defined(__clang__)
+    #define D_ASSERT_LIKELY(x)   __builtin_expect(!!(x), 1)
+    #define D_ASSERT_UNLIKELY(x) __builtin_expect(!!(x), 0)
+    #define D_ASSERT_COLD        __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+    #define D_ASSERT_LIKELY(x)   (x)
+    #define D_ASSERT_UNLIKELY(x) (x)
+    #define D_ASSERT_COLD        __declspec(noinline)
+#else
+    #define D_ASSERT_LIKELY(x)   (x)
+    #define D_ASSERT_UNLIKELY(x) (x)
+    #define D_ASSERT_COLD
+#endif
+
+// D_ASSERT_ARRAY_BLOCK_SIZE
+//   constant: bytes compared per step when locating the first difference
+// between two arrays compared bitwise.
+#define D_ASSERT_ARRAY_BLOCK_SIZE 64
+
+// D_ASSERT_STR_CONTEXT
+//   constant: bytes of context shown on each side of the first difference
+// in a failed string assertion's detail.
+#define D_ASSERT_STR_CONTEXT 16
+
+// D_ASSERT_MEM_CHUNK_SIZE
+//   constant: bytes compared per memcmp call by d_assert_mem_eq.  Large or
+// file-backed buffers are streamed sequentially in chunks of this size and
+// comparison stops at the first differing chunk.
+#define D_ASSERT_MEM_CHUNK_SIZE 65536
+
+// D_ASSERT_MEM_ROW_SIZE
+//   constant: bytes per row of a d_assert_mem_eq hex diff.
+#define D_ASSERT_MEM_ROW_SIZE 16
+
+// D_ASSERT_MEM_MAX_ROWS
+//   constant: maximum number of differing rows shown in a d_assert_mem_eq
+// hex diff, bounding the size of the failure detail.
+#define D_ASSERT_MEM_MAX_ROWS 8
+
+// D_ASSERT_AT
+//   macro: records the calling file and line and the expression text on
+// `assertion`.  Only pointers are stored; nothing is formatted until
+// d_assert_describe is called on a failed assertion.
+#define D_ASSERT_AT(assertion, expression)                                   \
+    d_assert_at((assertion), __FILE__, __LINE__, (expression))
+
+// D_ASSERT_MEM_EQ
+//   macro: asserts that `size` bytes at `expected` and `actual` are equal,
+// with default messages.
+#define D_ASSERT_MEM_EQ(expected, actual, size)                              \
+    D_ASSERT_AT(d_assert_mem_eq((expected),                                  \
+                                (actual),                                    \
+                                (size),                                      \
+                                #expected " == " #actual,                    \
+                                #expected " != " #actual),                   \
+                #expected " == " #actual)
+
+
 /******************************************************************************
  * ASSERTION STRUCTURE
  *****************************************************************************/
 
+// d_assert_mismatch
+//   struct: the first differing element found by an array or string
+// assertion.  The element pointers refer to copies owned by the assertion,
+// not into the caller's data, and are NULL if the copies could not be made.
+// String assertions record the byte offset as `index` (element size 1) along
+// with its 1-based line and column; a string that ended first contributes a
+// zero byte.
+struct d_assert_mismatch
+{
+    size_t      index;         // index of the first differing element
+    size_t      element_size;  // element size in bytes; 0 if no mismatch
+    const void* expected;      // copy of the element in the first array
+    const void* actual;        // copy of the element in the second array
+    size_t      line;          // line of a string difference; 0 otherwise
+    size_t      column;        // column of a string difference; 0 otherwise
+};
+
+// DAssertFloatFlag
+//   enum: NaN/Inf policy for approximate floating-point array assertions.
+// By default a NaN never matches, and an infinity matches only an infinity
+// of the same sign.
+enum DAssertFloatFlag
+{
+    D_ASSERT_FLOAT_DEFAULT     = 0,
+    D_ASSERT_FLOAT_NAN_EQUAL   = (1 << 0),  // NaN matches NaN
+    D_ASSERT_FLOAT_FINITE_ONLY = (1 << 1)   // any NaN or infinity violates
+};
+
+// d_assert_tolerance
+//   struct: tolerances for approximate floating-point comparison.  An
+// element is within tolerance if it is equal, or if it satisfies ANY of the
+// non-zero tolerances below.  A zero tolerance is not applied.
+struct d_assert_tolerance
+{
+    double   absolute;  // |expected - actual| <= absolute
+    double   relative;  // |expected - actual| <= relative * max(|e|, |a|)
+    uint64_t ulps;      // units in the last place of the element type
+};
+
+// d_assert_approx
+//   struct: summary of an approximate floating-point array assertion.
+// Non-finite violations count as an infinite error.
+struct d_assert_approx
+{
+    size_t violations;   // elements outside tolerance
+    size_t worst_index;  // index of the largest absolute error
+    double worst_error;  // largest absolute error; 0 if no violation
+};
+
+// DAssertOp
+//   enum: relational operator applied by the typed (d_assert_cmp_*)
+// assertions.
+enum DAssertOp
+{
+    D_ASSERT_OP_EQ    = 0,
+    D_ASSERT_OP_NEQ   = 1,
+    D_ASSERT_OP_LT    = 2,
+    D_ASSERT_OP_LT_EQ = 3,
+    D_ASSERT_OP_GT    = 4,
+    D_ASSERT_OP_GT_EQ = 5
+};
+
+// DAssertOperandType
+//   enum: which member of d_assert_value a typed assertion stored.
+enum DAssertOperandType
+{
+    D_ASSERT_OPERAND_NONE     = 0,
+    D_ASSERT_OPERAND_SIGNED   = 1,
+    D_ASSERT_OPERAND_UNSIGNED = 2,
+    D_ASSERT_OPERAND_FLOAT    = 3,
+    D_ASSERT_OPERAND_POINTER  = 4,
+    D_ASSERT_OPERAND_STRING   = 5
+};
+
+// d_assert_value
+//   union: one operand of a typed assertion, kept by value.
+union d_assert_value
+{
+    intmax_t    i;
+    uintmax_t   u;
+    long double f;
+    const void* p;
+    const char* s;  // borrowed until a failure captures a copy
+};
+
+// d_assert_operands
+//   struct: both operands of a typed assertion and the operator applied.
+// When a string comparison fails, both strings are copied (as far as a
+// description shows them) into `storage` and `lhs.s`/`rhs.s` point there, so
+// the assertion can be described after the caller's strings are gone.
+struct d_assert_operands
+{
+    enum DAssertOperandType type;
+    enum DAssertOp          op;
+    union d_assert_value    lhs;
+    union d_assert_value    rhs;
+    char*                   storage;  // owned string copies, or NULL
+};
+
+// d_assert_failure
+//   struct: what a failed assertion keeps for its description.  Allocated by
+// the failure path that first needs it and released by d_assert_free, so
+// passing assertions carry only a NULL pointer.
+struct d_assert_failure
+{
+    struct d_assert_mismatch mismatch;   // set by array/string assertions
+    struct d_assert_approx   approx;     // set by approximate float array assertions
+    struct d_assert_operands operands;   // set by typed (d_assert_cmp_*) assertions
+    char*                    detail;     // owned description of the failure, or NULL
+    bool                     described;  // `detail` holds the full description
+};
+
  // d_assert
  //   struct: a type representing the result of a boolean condition, with the
  // message corresponding to its value. Used for unit testing; one or more 
  // assertions can be used to compose a thorough unit test function.
 struct d_assert
 {
-    bool        result;
-    const char* message;
+    bool                     result;
+    const char*              message;
+    const char*              file;        // source file, set by D_ASSERT_AT
+    int                      line;        // source line, set by D_ASSERT_AT
+    const char*              expression;  // asserted expression text, or NULL
+    struct d_assert_failure* failure;     // owned; NULL until a failure is recorded
+};
+
+// d_assert_tally
+//   struct: pass/fail counts for D_ASSERT_CHECK.  Passing checks only
+// increment `passed`; the first failure is kept as a full d_assert (with
+// file, line and expression) for d_assert_describe.
+struct d_assert_tally
+{
+    size_t           passed;
+    size_t           failed;
+    struct d_assert* first_failure;  // owned; NULL until a check fails
 };
 
+// D_ASSERT_TALLY_INIT
+//   macro: initializer for an empty d_assert_tally.
+#define D_ASSERT_TALLY_INIT { 0, 0, NULL }
+
+// D_ASSERT_CHECK
+//   macro: checks `condition` against `tally`.  The pass path is the
+// compare, predicted taken, and one increment; failures are recorded by the
+// out-of-line d_assert_tally_fail so assertion-dense code stays small.
+#define D_ASSERT_CHECK(tally, condition)                                     \
+    do                                                                       \
+    {                                                                        \
+        if (D_ASSERT_LIKELY(condition))                                      \
+        {                                                                    \
+            (tally)->passed++;                                               \
+        }                                                                    \
+        else                                                                 \
+        {                                                                    \
+            d_assert_tally_fail((tally), __FILE__, __LINE__, #condition);    \
+        }                                                                    \
+    }                                                                        \
+    while (0)
+
 
 /******************************************************************************
  * FUNCTION DECLARATIONS
@@ -107,6 +320,31 @@ struct d_assert* d_assert_gt_eq(const void*   _a,
                                 fn_comparator _comparator,
                                 const char*   _message_true,
                                 const char*   _message_false);
+struct d_assert* d_assert_cmp_signed(intmax_t       _a,
+                                     intmax_t       _b,
+                                     enum DAssertOp _op,
+                                     const char*    _message_true,
+                                     const char*    _message_false);
+struct d_assert* d_assert_cmp_unsigned(uintmax_t      _a,
+                                       uintmax_t      _b,
+                                       enum DAssertOp _op,
+                                       const char*    _message_true,
+                                       const char*    _message_false);
+struct d_assert* d_assert_cmp_float(long double    _a,
+                                    long double    _b,
+                                    enum DAssertOp _op,
+                                    const char*    _message_true,
+                                    const char*    _message_false);
+struct d_assert* d_assert_cmp_ptr(const void*    _a,
+                                  const void*    _b,
+                                  enum DAssertOp _op,
+                                  const char*    _message_true,
+                                  const char*    _message_false);
+struct d_assert* d_assert_cmp_str(const char*    _a,
+                                  const char*    _b,
+                                  enum DAssertOp _op,
+                                  const char*    _message_true,
+                                  const char*    _message_false);
 struct d_assert* d_assert_str_eq(const char* _str1,
 	                             size_t      _str1_length,
                                  const char* _str2,
@@ -119,6 +357,18 @@ struct d_assert* d_assert_str_neq(const char* _str1,
                                   size_t      _str2_length,
                                   const char* _message_true,
                                   const char* _message_false);
+struct d_assert* d_assert_str_eq_len(const char* _str1,
+                                     size_t      _str1_length,
+                                     const char* _str2,
+                                     size_t      _str2_length,
+                                     const char* _message_true,
+                                     const char* _message_false);
+struct d_assert* d_assert_str_neq_len(const char* _str1,
+                                      size_t      _str1_length,
+                                      const char* _str2,
+                                      size_t      _str2_length,
+                                      const char* _message_true,
+                                      const char* _message_false);
 struct d_assert* d_assert_null(const void* _expression,
                                const char* _message_true,
                                const char* _message_false);
@@ -136,8 +386,111 @@ struct d_assert* d_assert_arrays_eq(const void*   _arr1,
                                     fn_comparator _comparator,
                                     const char*   _message_pass,
                                     const char*   _message_fail);
+struct d_assert* d_assert_floats_near(const float*                     _expected,
+                                      const float*                     _actual,
+                                      size_t                           _count,
+                                      const struct d_assert_tolerance* _tolerance,
+                                      unsigned int                     _flags,
+                                      const char*                      _message_true,
+                                      const char*                      _message_false);
+struct d_assert* d_assert_doubles_near(const double*                    _expected,
+                                       const double*                    _actual,
+                                       size_t                           _count,
+                                       const struct d_assert_tolerance* _tolerance,
+                                       unsigned int                     _flags,
+                                       const char*                      _message_true,
+                                       const char*                      _message_false);
+struct d_assert* d_assert_mem_eq(const void* _expected,
+                                 const void* _actual,
+                                 size_t      _size,
+                                 const char* _message_true,
+                                 const char* _message_false);
+
+struct d_assert* d_assert_at(struct d_assert* _assertion,
+                             const char*      _file,
+                             int              _line,
+                             const char*      _expression);
+const char*      d_assert_describe(struct d_assert* _assertion);
+
+D_ASSERT_COLD void d_assert_tally_fail(struct d_assert_tally* _tally,
+                                       const char*            _file,
+                                       int                    _line,
+                                       const char*            _expression);
+void               d_assert_tally_free(struct d_assert_tally* _tally);
 
 void d_assert_free(struct d_assert* _assertion);
 
 
+/******************************************************************************
+ * TYPED ASSERTION MACROS
+ *****************************************************************************/
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+
+// D_INTERNAL_ASSERT_CMP_FN
+//   macro (internal): selects the d_assert_cmp_* function for the common
+// type of `a` and `b` (the type of `1 ? a : b`), so mixed operands compare
+// under the usual arithmetic conversions, types narrower than int arrive
+// promoted, and strings compare by content.
+#define D_INTERNAL_ASSERT_CMP_FN(a, b)                                       \
+    _Generic((1 ? (a) : (b)),                                                \
+        int:                d_assert_cmp_signed,                             \
+        long:               d_assert_cmp_signed,                             \
+        long long:          d_assert_cmp_signed,                             \
+        unsigned int:       d_assert_cmp_unsigned,                           \
+        unsigned long:      d_assert_cmp_unsigned,                           \
+        unsigned long long: d_assert_cmp_unsigned,                           \
+        float:              d_assert_cmp_float,                              \
+        double:             d_assert_cmp_float,                              \
+        long double:        d_assert_cmp_float,                              \
+        char*:              d_assert_cmp_str,                                \
+        const char*:        d_assert_cmp_str,                                \
+        default:            d_assert_cmp_ptr)
+
+// D_INTERNAL_ASSERT_CMP
+//   macro (internal): typed comparison of `a` and `b` under `op`, with the
+// stringified expression as the pass message and its negation on failure.
+// The first operand is the expected value, and the call site is recorded.
+#define D_INTERNAL_ASSERT_CMP(a, b, op, oper, negated)                       \
+    D_ASSERT_AT(D_INTERNAL_ASSERT_CMP_FN(a, b)((a),                          \
+                                               (b),                          \
+                                               (op),                         \
+                                               #a " " #oper " " #b,          \
+                                               #a " " #negated " " #b),      \
+                #a " " #oper " " #b)
+
+// D_ASSERT_VALUE_EQ
+//   macro: asserts `a == b`, dispatched on operand type; no comparator
+// call is made and both operand values are kept on the assertion.
+#define D_ASSERT_VALUE_EQ(a, b)                                              \
+    D_INTERNAL_ASSERT_CMP(a, b, D_ASSERT_OP_EQ, ==, !=)
+
+// D_ASSERT_VALUE_NEQ
+//   macro: asserts `a != b`, dispatched on operand type.
+#define D_ASSERT_VALUE_NEQ(a, b)                                             \
+    D_INTERNAL_ASSERT_CMP(a, b, D_ASSERT_OP_NEQ, !=, ==)
+
+// D_ASSERT_VALUE_LT
+//   macro: asserts `a < b`, dispatched on operand type.
+#define D_ASSERT_VALUE_LT(a, b)                                              \
+    D_INTERNAL_ASSERT_CMP(a, b, D_ASSERT_OP_LT, <, >=)
+
+// D_ASSERT_VALUE_LT_EQ
+//   macro: asserts `a <= b`, dispatched on operand type.
+#define D_ASSERT_VALUE_LT_EQ(a, b)                                           \
+    D_INTERNAL_ASSERT_CMP(a, b, D_ASSERT_OP_LT_EQ, <=, >)
+
+// D_ASSERT_VALUE_GT
+//   macro: asserts `a > b`, dispatched on operand type.
+#define D_ASSERT_VALUE_GT(a, b)                                              \
+    D_INTERNAL_ASSERT_CMP(a, b, D_ASSERT_OP_GT, >, <=)
+
+// D_ASSERT_VALUE_GT_EQ
+//   macro: asserts `a >= b`, dispatched on operand type.
+#define D_ASSERT_VALUE_GT_EQ(a, b)                                           \
+    D_INTERNAL_ASSERT_CMP(a, b, D_ASSERT_OP_GT_EQ, >=, <)
+
+#endif  // C11 _Generic
+
+
 #endif	// DJINTERP_TEST_ASSERT_
\ No newline at end of file
@@ -0,0 +1,720 @@
+/******************************************************************************
+* djinterp [test]                                                    dtest.hpp
+*
+*   C++17 layer over the DTest C API (test.h, test_block.h, test_module.h and
+* test_session.h).  It adds:
+*   - typed checks (D_TEST_EXPECT_EQ, ...) that compile to an inline compare;
+*     only a failure builds a d_assert, through the cold session recorder
+*   - RAII fixtures: a fixture type's constructor and destructor are bound
+*     to the D_TEST_STAGE_SETUP and D_TEST_STAGE_TEAR_DOWN hooks of each test
+*   - static registration: blocks and modules are types whose test lists are
+*     constexpr arrays, so nothing is appended to at runtime; make() hands the
+*     whole tree to the C constructors in one call per node
+*
+*   Execution stays with the C runner:
+*
+*     using math = djinterp::test::module<
+*         djinterp::test::tests<test_add, test_sub>,
+*         djinterp::test::block<vec_fixture, test_push, test_pop>>;
+*
+*     struct d_test_session* s = djinterp::test::make_session<math>();
+*     d_test_session_run(s);
+*     djinterp::test::destroy_session(s);
+*
+*
+* path:      \inc\test\dtest.hpp
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TEST_DTEST_HPP_
+#define DJINTERP_TEST_DTEST_HPP_ 1
+
+#if defined(_MSVC_LANG)
+    #define D_TEST_INTERNAL_CPLUSPLUS _MSVC_LANG
+#elif defined(__cplusplus)
+    #define D_TEST_INTERNAL_CPLUSPLUS __cplusplus
+#else
+    #define D_TEST_INTERNAL_CPLUSPLUS 0L
+#endif
+
+#if (D_TEST_INTERNAL_CPLUSPLUS < 201703L)
+    #error "dtest.hpp requires C++17"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+extern "C"
+{
+#include ".\dtest"
+#include ".\test_block.h"
+#include ".\test_module.h"
+#include ".\test_session.h"
+}
+
+
+/******************************************************************************
+ * EXPECTATION MACROS
+ *****************************************************************************/
+
+// D_TEST_EXPECT
+//   macro: checks a boolean condition against the running session.
+#define D_TEST_EXPECT(condition)                                             \
+    D_TEST_SESSION_CHECK(condition)
+
+// D_INTERNAL_TEST_EXPECT_OP
+//   macro: runs a typed check for `op`, capturing the call site.
+#define D_INTERNAL_TEST_EXPECT_OP(op, a, b, text)                            \
+    ::djinterp::test::check<(op)>((a), (b), __FILE__, __LINE__, (text))
+
+// D_TEST_EXPECT_EQ
+//   macro: checks a == b.
+#define D_TEST_EXPECT_EQ(a, b)                                               \
+    D_INTERNAL_TEST_EXPECT_OP(D_ASSERT_OP_EQ, a, b, #a " == " #b)
+
+// D_TEST_EXPECT_NEQ
+//   macro: checks a != b.
+#define D_TEST_EXPECT_NEQ(a, b)                                              \
+    D_INTERNAL_TEST_EXPECT_OP(D_ASSERT_OP_NEQ, a, b, #a " != " #b)
+
+// D_TEST_EXPECT_LT
+//   macro: checks a < b.
+#define D_TEST_EXPECT_LT(a, b)                                               \
+    D_INTERNAL_TEST_EXPECT_OP(D_ASSERT_OP_LT, a, b, #a " < " #b)
+
+// D_TEST_EXPECT_LT_EQ
+//   macro: checks a <= b.
+#define D_TEST_EXPECT_LT_EQ(a, b)                                            \
+    D_INTERNAL_TEST_EXPECT_OP(D_ASSERT_OP_LT_EQ, a, b, #a " <= " #b)
+
+// D_TEST_EXPECT_GT
+//   macro: checks a > b.
+#define D_TEST_EXPECT_GT(a, b)                                               \
+    D_INTERNAL_TEST_EXPECT_OP(D_ASSERT_OP_GT, a, b, #a " > " #b)
+
+// D_TEST_EXPECT_GT_EQ
+//   macro: checks a >= b.
+#define D_TEST_EXPECT_GT_EQ(a, b)                                            \
+    D_INTERNAL_TEST_EXPECT_OP(D_ASSERT_OP_GT_EQ, a, b, #a " >= " #b)
+
+
+namespace djinterp {
+namespace test {
+
+/******************************************************************************
+ * INTERNAL HELPERS
+ *****************************************************************************/
+
+namespace internal {
+
+// is_c_string
+//   constant: true for (const) char pointers and char arrays, which compare
+// by content rather than by address.
+template<typename T>
+inline constexpr bool is_c_string =
+    std::is_same_v<std::decay_t<T>, const char*> ||
+    std::is_same_v<std::decay_t<T>, char*>;
+
+// is_integer
+//   constant: true for integral types other than bool.
+template<typename T>
+inline constexpr bool is_integer =
+    std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+/*
+order
+  Three-way compares two operands.  Strings compare by content, mixed-sign
+  integers by value (a negative signed operand is below every unsigned one),
+  and same-sign integers with the built-in operators.
+
+Parameter(s):
+  _lhs: left operand
+  _rhs: right operand
+Return:
+  A negative value, zero, or a positive value as _lhs is below, equal to, or
+  above _rhs.
+*/
+template<typename L, typename R>
+constexpr int
+order
+(
+    const L& _lhs,
+    const R& _rhs
+)
+{
+    if constexpr (is_c_string<L> && is_c_string<R>)
+    {
+        const char* lhs = _lhs;
+        const char* rhs = _rhs;
+
+        if ( (!lhs) || (!rhs) )
+        {
+            return (lhs == rhs) ? 0 : ((!lhs) ? -1 : 1);
+        }
+
+        return std::strcmp(lhs, rhs);
+    }
+    else if constexpr ( is_integer<L> && is_integer<R> &&
+                        (std::is_signed_v<L> != std::is_signed_v<R>) )
+    {
+        if constexpr (std::is_signed_v<L>)
+        {
+            if (_lhs < 0)
+            {
+                return -1;
+            }
+
+            return order(static_cast<std::make_unsigned_t<L>>(_lhs), _rhs);
+        }
+        else
+        {
+            return -order(_rhs, _lhs);
+        }
+    }
+    else
+    {
+        return (_lhs < _rhs) ? -1 : ((_rhs < _lhs) ? 1 : 0);
+    }
+}
+
+/*
+holds
+  Evaluates `Op` on two operands.  Strings and integer pairs go through
+  order; other types use only their own == and <, so floating-point NaN
+  semantics are preserved and user types need no further operators.
+
+Parameter(s):
+  _lhs: left operand
+  _rhs: right operand
+Return:
+  true if `_lhs Op _rhs` holds.
+*/
+template<DAssertOp Op, typename L, typename R>
+constexpr bool
+holds
+(
+    const L& _lhs,
+    const R& _rhs
+)
+{
+    if constexpr ( (is_c_string<L> && is_c_string<R>) ||
+                   (is_integer<L>  && is_integer<R>) )
+    {
+        const int result = order(_lhs, _rhs);
+
+        switch (Op)
+        {
+            case D_ASSERT_OP_EQ:    return result == 0;
+            case D_ASSERT_OP_NEQ:   return result != 0;
+            case D_ASSERT_OP_LT:    return result <  0;
+            case D_ASSERT_OP_LT_EQ: return result <= 0;
+            case D_ASSERT_OP_GT:    return result >  0;
+            case D_ASSERT_OP_GT_EQ: return result >= 0;
+        }
+
+        return false;
+    }
+    else if constexpr (Op == D_ASSERT_OP_EQ)
+    {
+        return _lhs == _rhs;
+    }
+    else if constexpr (Op == D_ASSERT_OP_NEQ)
+    {
+        return !(_lhs == _rhs);
+    }
+    else if constexpr (Op == D_ASSERT_OP_LT)
+    {
+        return _lhs < _rhs;
+    }
+    else if constexpr (Op == D_ASSERT_OP_LT_EQ)
+    {
+        return (_lhs < _rhs) || (_lhs == _rhs);
+    }
+    else if constexpr (Op == D_ASSERT_OP_GT)
+    {
+        return _rhs < _lhs;
+    }
+    else
+    {
+        return (_rhs < _lhs) || (_lhs == _rhs);
+    }
+}
+
+/*
+materialize
+  Builds the d_assert for a failed typed check, choosing the d_assert_cmp_*
+  constructor the C11 _Generic dispatch would pick so the operands show up in
+  d_assert_describe.  Operand types the C layer cannot format produce a plain
+  failed d_assert.  A failing d_assert_cmp_* copies string operands into the
+  assertion, so the result may outlive the caller's strings once the session
+  keeps it as a failure record.
+
+Parameter(s):
+  _lhs: left operand
+  _rhs: right operand
+  _op:  comparison that failed
+Return:
+  A new d_assert, or NULL if allocation failed.
+*/
+template<typename L, typename R>
+D_ASSERT_COLD struct d_assert*
+materialize
+(
+    const L&       _lhs,
+    const R&       _rhs,
+    enum DAssertOp _op
+)
+{
+    if constexpr (is_c_string<L> && is_c_string<R>)
+    {
+        return d_assert_cmp_str(_lhs, _rhs, _op, nullptr, nullptr);
+    }
+    else if constexpr ( std::is_floating_point_v<L> ||
+                        std::is_floating_point_v<R> )
+    {
+        return d_assert_cmp_float(static_cast<long double>(_lhs),
+                                  static_cast<long double>(_rhs),
+                                  _op,
+                                  nullptr,
+                                  nullptr);
+    }
+    else if constexpr ( is_integer<L> && is_integer<R> &&
+                        std::is_unsigned_v<L> && std::is_unsigned_v<R> )
+    {
+        return d_assert_cmp_unsigned(static_cast<uintmax_t>(_lhs),
+                                     static_cast<uintmax_t>(_rhs),
+                                     _op,
+                                     nullptr,
+                                     nullptr);
+    }
+    else if constexpr ( (std::is_integral_v<L> || std::is_enum_v<L>) &&
+                        (std::is_integral_v<R> || std::is_enum_v<R>) )
+    {
+        return d_assert_cmp_signed(static_cast<intmax_t>(_lhs),
+                                   static_cast<intmax_t>(_rhs),
+                                   _op,
+                                   nullptr,
+                                   nullptr);
+    }
+    else if constexpr ( std::is_pointer_v<L> && std::is_pointer_v<R> )
+    {
+        return d_assert_cmp_ptr(static_cast<const void*>(_lhs),
+                                static_cast<const void*>(_rhs),
+                                _op,
+                                nullptr,
+                                nullptr);
+    }
+    else
+    {
+        return d_assert_new(false, nullptr, nullptr);
+    }
+}
+
+/*
+release
+  Frees the element held by a tree node and, recursively, every element
+  below it.  The node's own d_test_type is left alone: containers store their
+  children by value, and the caller owns a wrapper it was handed.
+
+Parameter(s):
+  _node: node whose element is released; may be NULL
+Return:
+  none.
+*/
+inline void
+release
+(
+    const struct d_test_type* _node
+)
+{
+    std::size_t i;
+
+    if (!_node)
+    {
+        return;
+    }
+
+    switch (_node->type)
+    {
+        case D_TEST_TYPE_TEST_FN:
+            d_test_fn_free(_node->D_KEYWORD_TEST_TEST_FN);
+            break;
+
+        case D_TEST_TYPE_TEST:
+            for (i = 0; i < d_test_child_count(_node->D_KEYWORD_TEST_TEST); i++)
+            {
+                release(d_test_get_child_at(_node->D_KEYWORD_TEST_TEST, i));
+            }
+
+            d_test_free(_node->D_KEYWORD_TEST_TEST);
+            break;
+
+        case D_TEST_TYPE_TEST_BLOCK:
+            for (i = 0;
+                 i < d_test_block_child_count(_node->D_KEYWORD_TEST_BLOCK);
+                 i++)
+            {
+                release(d_test_block_get_child_at(_node->D_KEYWORD_TEST_BLOCK,
+                                                  i));
+            }
+
+            d_test_block_free(_node->D_KEYWORD_TEST_BLOCK);
+            break;
+
+        case D_TEST_TYPE_MODULE:
+            for (i = 0;
+                 i < d_test_module_child_count(_node->D_KEYWORD_TEST_MODULE);
+                 i++)
+            {
+                release(d_test_module_get_child_at(_node->D_KEYWORD_TEST_MODULE,
+                                                   i));
+            }
+
+            d_test_module_free(_node->D_KEYWORD_TEST_MODULE);
+            break;
+
+        default:
+            break;
+    }
+
+    return;
+}
+
+}  // namespace internal
+
+
+/******************************************************************************
+ * TYPED CHECKS
+ *****************************************************************************/
+
+/*
+check
+  Checks `_lhs Op _rhs` against the session running on this thread.  The
+  comparison is inlined at the call site; a pass costs one call to
+  d_test_session_check_pass, and only a failure builds a d_assert (handed to
+  d_test_session_record_fail).  Used through the D_TEST_EXPECT_* macros.
+
+Parameter(s):
+  _lhs:        left operand
+  _rhs:        right operand
+  _file:       source file of the check
+  _line:       source line of the check
+  _expression: text of the check
+Return:
+  true if the comparison held.
+*/
+template<DAssertOp Op, typename L, typename R>
+inline bool
+check
+(
+    const L&    _lhs,
+    const R&    _rhs,
+    const char* _file,
+    int         _line,
+    const char* _expression
+)
+{
+    if (D_ASSERT_LIKELY(internal::holds<Op>(_lhs, _rhs)))
+    {
+        return d_test_session_check_pass(_file, _line, _expression);
+    }
+
+    return d_test_session_record_fail(
+               d_assert_at(internal::materialize(_lhs, _rhs, Op),
+                           _file,
+                           _line,
+                           _expression));
+}
+
+
+/******************************************************************************
+ * FIXTURES
+ *****************************************************************************/
+
+// no_fixture
+//   struct: placeholder fixture for blocks whose tests need no setup.
+struct no_fixture
+{
+};
+
+/*
+fixture_hooks
+  Binds a fixture type's lifetime to the DTest stage hooks.  setup constructs
+  a fresh Fixture before each test and tear_down destroys it afterwards, so
+  the fixture's constructor and destructor act as SETUP and TEAR_DOWN.  The
+  instance lives in per-thread storage because fn_stage carries no context.
+*/
+template<typename Fixture>
+class fixture_hooks
+{
+public:
+    static bool
+    setup
+    (
+        struct d_test* _test
+    ) noexcept
+    {
+        (void)_test;
+
+        try
+        {
+            slot().emplace();
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    static bool
+    tear_down
+    (
+        struct d_test* _test
+    ) noexcept
+    {
+        (void)_test;
+
+        slot().reset();
+
+        return true;
+    }
+
+    static Fixture&
+    get
+    (
+        void
+    )
+    {
+        return *slot();
+    }
+
+private:
+    static std::optional<Fixture>&
+    slot
+    (
+        void
+    )
+    {
+        static thread_local std::optional<Fixture> instance;
+
+        return instance;
+    }
+};
+
+/*
+fixture
+  Returns the fixture instance for the test currently running on this
+  thread.  Only valid inside a test of a block<Fixture, ...>.
+*/
+template<typename Fixture>
+inline Fixture&
+fixture
+(
+    void
+)
+{
+    return fixture_hooks<Fixture>::get();
+}
+
+
+/******************************************************************************
+ * STATIC REGISTRATION
+ *****************************************************************************/
+
+/*
+block
+  A test block whose tests are fixed at compile time.  With a real fixture
+  every function becomes its own d_test carrying the fixture's SETUP and
+  TEAR_DOWN hooks; with no_fixture the functions are added as plain d_test_fn
+  children.
+*/
+template<typename Fixture, fn_test... Tests>
+struct block
+{
+    static constexpr std::array<fn_test, sizeof...(Tests)> functions{
+        Tests...
+    };
+
+    static struct d_test_type*
+    make
+    (
+        void
+    )
+    {
+        std::array<struct d_test_type*, sizeof...(Tests)> children{};
+        std::size_t                                       i;
+
+        for (i = 0; i < functions.size(); i++)
+        {
+            children[i] = make_child(functions[i]);
+        }
+
+        return d_test_type_new(D_TEST_TYPE_TEST_BLOCK,
+                               d_test_block_new(children.data(),
+                                                children.size()));
+    }
+
+private:
+    static struct d_test_type*
+    make_child
+    (
+        fn_test _fn
+    )
+    {
+        struct d_test_type* fn_node;
+        struct d_test*      test;
+
+        fn_node = d_test_type_new(D_TEST_TYPE_TEST_FN, d_test_fn_new(_fn));
+
+        if constexpr (std::is_same_v<Fixture, no_fixture>)
+        {
+            return fn_node;
+        }
+        else
+        {
+            // the test stores a copy of the node; the wrapper stays ours
+            test = d_test_new(&fn_node, 1);
+
+            if (!test)
+            {
+                internal::release(fn_node);
+            }
+
+            d_test_type_free(fn_node);
+
+            if (test)
+            {
+                d_test_set_stage_hook(test,
+                                      D_TEST_STAGE_SETUP,
+                                      &fixture_hooks<Fixture>::setup);
+                d_test_set_stage_hook(test,
+                                      D_TEST_STAGE_TEAR_DOWN,
+                                      &fixture_hooks<Fixture>::tear_down);
+            }
+
+            return d_test_type_new(D_TEST_TYPE_TEST, test);
+        }
+    }
+};
+
+// tests
+//   alias: a block of fixture-less tests.
+template<fn_test... Tests>
+using tests = block<no_fixture, Tests...>;
+
+/*
+module
+  A test module made of the given block types.
+*/
+template<typename... Blocks>
+struct module
+{
+    static struct d_test_type*
+    make
+    (
+        void
+    )
+    {
+        std::array<struct d_test_type*, sizeof...(Blocks)> children{
+            Blocks::make()...
+        };
+        struct d_test_module* module;
+
+        module = d_test_module_new(children.data(), children.size());
+
+        // the module stores copies of the block nodes; the wrappers stay ours
+        for (struct d_test_type* child : children)
+        {
+            if (!module)
+            {
+                internal::release(child);
+            }
+
+            d_test_type_free(child);
+        }
+
+        return d_test_type_new(D_TEST_TYPE_MODULE, module);
+    }
+};
+
+/*
+make_session
+  Creates a session holding the given module types.  Run it with
+  d_test_session_run and release it, tree included, with destroy_session.
+*/
+template<typename... Modules>
+inline struct d_test_session*
+make_session
+(
+    void
+)
+{
+    std::array<struct d_test_type*, sizeof...(Modules)> modules{
+        Modules::make()...
+    };
+    struct d_test_session* session;
+
+    session = d_test_session_new_with_modules(modules.data(), modules.size());
+
+    if (!session)
+    {
+        for (struct d_test_type* module : modules)
+        {
+            internal::release(module);
+            d_test_type_free(module);
+        }
+    }
+
+    return session;
+}
+
+/*
+destroy_session
+  Frees a session from make_session along with its whole test tree.
+  d_test_session_free releases only the session; the module nodes it holds,
+  and everything below them, belong to whoever built the tree.
+
+Parameter(s):
+  _session: session to free; may be NULL
+Return:
+  none.
+*/
+inline void
+destroy_session
+(
+    struct d_test_session* _session
+)
+{
+    struct d_test_type* module;
+    std::size_t         i;
+
+    if (!_session)
+    {
+        return;
+    }
+
+    for (i = 0; i < d_test_session_child_count(_session); i++)
+    {
+        module = d_test_session_get_child_at(_session, i);
+
+        internal::release(module);
+        d_test_type_free(module);
+    }
+
+    d_test_session_free(_session);
+
+    return;
+}
+
+}  // namespace test
+}  // namespace djinterp
+
+
+#endif  // DJINTERP_TEST_DTEST_HPP_
@@ -8,6 +8,7 @@
 * A test can contain only:
 *   - d_assertion (assertions)
 *   - d_test_fn (test functions)
+*   - d_test_property (property-based tests, see test_property.h)
 *
 * Configuration is resolved at runtime by combining the test's own config with
 * the run config passed to d_test_run(). Parent types pass their resolved
@@ -34,6 +35,14 @@
 #include ".\test_common.h"
 
 
+/******************************************************************************
+ * FORWARD DECLARATIONS
+ *****************************************************************************/
+
+struct d_test_config;
+struct d_test_resolved_config;
+
+
 /******************************************************************************
  * D_TEST MACRO
  *****************************************************************************/
@@ -169,79 +178,67 @@
  * AUTO-MESSAGE ASSERTION MACROS
  *****************************************************************************/
 
-// D_INTERNAL_ASSERT_MSG_PASS
-//   macro (internal): generates a pass message from expression.
-#define D_INTERNAL_ASSERT_MSG_PASS(expr)                                     \
-    "PASS: " D_STRINGIFY(expr)
-
-// D_INTERNAL_ASSERT_MSG_FAIL
-//   macro (internal): generates a fail message from expression.
-#define D_INTERNAL_ASSERT_MSG_FAIL(expr)                                     \
-    "FAIL: " D_STRINGIFY(expr)
+// These capture the expression text, __FILE__ and __LINE__ as raw fields
+// (see D_ASSERT_AT) instead of baking messages into every assertion; a
+// failure's message is built on demand by d_assert_describe.  Each node is
+// evaluated where the tree is built, so a count-only session cannot fold these
+// into its counters; use D_TEST_SESSION_CHECK inside test functions for that.
 
 // D_ASSERTION_TRUE
-//   macro: asserts condition is true with auto-generated messages.
+//   macro: asserts condition is true with an on-demand failure message.
 #define D_ASSERTION_TRUE(condition)                                          \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert((condition),                                                \
-                 D_INTERNAL_ASSERT_MSG_PASS(condition),                      \
-                 D_INTERNAL_ASSERT_MSG_FAIL(condition)))
+        D_ASSERT_AT(d_assert((condition), NULL, NULL),                       \
+                    D_STRINGIFY(condition)))
 
 // D_ASSERTION_FALSE
-//   macro: asserts condition is false with auto-generated messages.
+//   macro: asserts condition is false with an on-demand failure message.
 #define D_ASSERTION_FALSE(condition)                                         \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_false((condition),                                          \
-                       D_INTERNAL_ASSERT_MSG_PASS(!(condition)),             \
-                       D_INTERNAL_ASSERT_MSG_FAIL(!(condition))))
+        D_ASSERT_AT(d_assert_false((condition), NULL, NULL),                 \
+                    D_STRINGIFY(!(condition))))
 
 // D_ASSERTION_EQ
-//   macro: asserts equality with auto-generated messages.
+//   macro: asserts equality with an on-demand failure message.
 #define D_ASSERTION_EQ(a, b, cmp)                                            \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_eq((a), (b), (cmp),                                         \
-                    D_INTERNAL_ASSERT_MSG_PASS((a) == (b)),                  \
-                    D_INTERNAL_ASSERT_MSG_FAIL((a) == (b))))
+        D_ASSERT_AT(d_assert_eq((a), (b), (cmp), NULL, NULL),                \
+                    D_STRINGIFY((a) == (b))))
 
 // D_ASSERTION_NEQ
-//   macro: asserts inequality with auto-generated messages.
+//   macro: asserts inequality with an on-demand failure message.
 #define D_ASSERTION_NEQ(a, b, cmp)                                           \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_neq((a), (b), (cmp),                                        \
-                     D_INTERNAL_ASSERT_MSG_PASS((a) != (b)),                 \
-                     D_INTERNAL_ASSERT_MSG_FAIL((a) != (b))))
+        D_ASSERT_AT(d_assert_neq((a), (b), (cmp), NULL, NULL),               \
+                    D_STRINGIFY((a) != (b))))
 
 // D_ASSERTION_LT
-//   macro: asserts less-than with auto-generated messages.
+//   macro: asserts less-than with an on-demand failure message.
 #define D_ASSERTION_LT(a, b, cmp)                                            \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_lt((a), (b), (cmp),                                         \
-                    D_INTERNAL_ASSERT_MSG_PASS((a) < (b)),                   \
-                    D_INTERNAL_ASSERT_MSG_FAIL((a) < (b))))
+        D_ASSERT_AT(d_assert_lt((a), (b), (cmp), NULL, NULL),                \
+                    D_STRINGIFY((a) < (b))))
 
 // D_ASSERTION_GT
-//   macro: asserts greater-than with auto-generated messages.
+//   macro: asserts greater-than with an on-demand failure message.
 #define D_ASSERTION_GT(a, b, cmp)                                            \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_gt((a), (b), (cmp),                                         \
-                    D_INTERNAL_ASSERT_MSG_PASS((a) > (b)),                   \
-                    D_INTERNAL_ASSERT_MSG_FAIL((a) > (b))))
+        D_ASSERT_AT(d_assert_gt((a), (b), (cmp), NULL, NULL),                \
+                    D_STRINGIFY((a) > (b))))
 
 // D_ASSERTION_NULL
-//   macro: asserts NULL with auto-generated messages.
+//   macro: asserts NULL with an on-demand failure message.
 #define D_ASSERTION_NULL(ptr)                                                \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_null((ptr),                                                 \
-                      D_INTERNAL_ASSERT_MSG_PASS((ptr) == NULL),             \
-                      D_INTERNAL_ASSERT_MSG_FAIL((ptr) == NULL)))
+        D_ASSERT_AT(d_assert_null((ptr), NULL, NULL),                        \
+                    D_STRINGIFY((ptr) == NULL)))
 
 // D_ASSERTION_NONNULL
-//   macro: asserts non-NULL with auto-generated messages.
+//   macro: asserts non-NULL with an on-demand failure message.
 #define D_ASSERTION_NONNULL(ptr)                                             \
     D_TEST_TYPE_FROM_ASSERT(                                                 \
-        d_assert_nonnull((ptr),                                              \
-                         D_INTERNAL_ASSERT_MSG_PASS((ptr) != NULL),          \
-                         D_INTERNAL_ASSERT_MSG_FAIL((ptr) != NULL)))
+        D_ASSERT_AT(d_assert_nonnull((ptr), NULL, NULL),                     \
+                    D_STRINGIFY((ptr) != NULL)))
 
 
 /******************************************************************************
@@ -250,10 +247,10 @@
 
 // d_test
 //   struct: individual test containing configuration, lifecycle hooks, and
-// a vector of child items (assertions and/or test functions).
+// its child items (assertions and/or test functions), stored inline.
 struct d_test
 {
-    struct d_ptr_vector*   children;       // child test types (assertions/fns)
+    struct d_test_children children;       // child test types (assertions/fns)
 };
 
 
@@ -319,6 +316,8 @@ fn_stage d_test_get_stage_hook(const struct d_test* _test,
 
 bool d_test_run(struct d_test*              _test,
                 const struct d_test_config* _run_config);
+bool d_test_run_resolved(struct d_test*                       _test,
+                         const struct d_test_resolved_config* _resolved);
 
 
 /******************************************************************************
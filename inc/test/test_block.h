@@ -30,6 +30,7 @@
 
 struct d_test;
 struct d_test_module;
+struct d_test_resolved_config;
 
 
 /******************************************************************************
@@ -77,7 +78,7 @@ struct d_test_module;
 // Children can be sub-blocks, tests, assertions, or test functions.
 struct d_test_block
 {
-    struct d_ptr_vector*   children;       // child tree nodes
+    struct d_test_children children;       // child tree nodes, stored inline
 };
 
 
@@ -129,6 +130,8 @@ fn_stage d_test_block_get_stage_hook(const struct d_test_block* _block,
 
 bool d_test_block_run(struct d_test_block*  _block,
                       struct d_test_config* _run_config);
+bool d_test_block_run_resolved(struct d_test_block*                 _block,
+                               const struct d_test_resolved_config* _resolved);
 
 
 /******************************************************************************
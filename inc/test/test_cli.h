@@ -12,184 +12,1228 @@
 #ifndef DJINTERP_TEST_CLI_H_
 #define	DJINTERP_TEST_CLI_H_ 1
 
+#include <errno.h>
+#include <limits.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "..\djinterp.h"
+#include "..\dmemory.h"
 #include ".\test_common.h"
+#include ".\test_module.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <poll.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
 
 
 // forward declaration
 struct d_test_counter;
 
-// ============================================================================
-// CONFIGURATION CONSTANTS
-// ============================================================================
+// ============================================================================
+// CONFIGURATION CONSTANTS
+// ============================================================================
+
+#define D_TEST_MAX_MODULES        64    // initial registry capacity
+#define D_TEST_MAX_MODULE_NAME    32    // command-line module name length
+#define D_TEST_MAX_INCLUDES       16
+#define D_TEST_MAX_EXCLUDES       16
+
+// ============================================================================
+// COMMAND TYPES
+// ============================================================================
+
+typedef enum
+{
+    D_TEST_CMD_NONE,
+    D_TEST_CMD_RUN_ALL,
+    D_TEST_CMD_RUN_MODULE,
+    D_TEST_CMD_HELP,
+    D_TEST_CMD_LIST
+} d_test_command_t;
+
+// ============================================================================
+// MODULE REGISTRY
+// ============================================================================
+
+// Test module registration info
+typedef struct
+{
+    char*  name;                  // owned copy of the module name
+    char** dependencies;          // owned copies of dependency names
+    int    dependency_count;
+    int*   dependency_indices;    // resolved adjacency list (-1 = unknown)
+    bool   available;
+    const struct d_test_module_metadata* metadata;
+} d_test_module_info_t;
+
+// Global module registry
+//   Modules live in a growable array. `index` is an open-addressing hash
+// table (linear probing, power-of-two capacity) mapping names to module
+// indices, and each module's dependency names are resolved to indices once
+// per batch of registrations so dependency walks never compare strings.
+struct d_test_registry_t
+{
+    d_test_module_info_t* modules;
+    int   count;
+    int   capacity;
+    bool* enabled;                // which modules to run
+    int*  index;                  // hash slots holding module indices or -1
+    int   index_capacity;
+    bool  resolved;               // dependency_indices are current
+};
+
+// ============================================================================
+// PARSED ARGUMENTS STRUCTURE
+// ============================================================================
+
+typedef struct
+{
+    d_test_command_t command;
+    char target_module[D_TEST_MAX_MODULE_NAME];
+    char includes[D_TEST_MAX_INCLUDES][D_TEST_MAX_MODULE_NAME];
+    int  include_count;
+    char excludes[D_TEST_MAX_EXCLUDES][D_TEST_MAX_MODULE_NAME];
+    int  exclude_count;
+    bool verbose;
+    bool dry_run;  // Show what would run without running it
+    int  jobs;     // Modules run concurrently (default 1)
+    const char* filter;  // Module name globs (-filter), or NULL
+} d_test_args_t;
+
+// ============================================================================
+// MODULE REGISTRY FUNCTIONS
+// ============================================================================
+
+// Initialize the test registry
+static struct d_test_registry_t g_test_registry = {0};
+
+// FNV-1a hash of a module name
+static size_t
+d_test_internal_registry_hash
+(
+    const char* _name
+)
+{
+    size_t hash = (size_t)2166136261u;
+
+    while (*_name)
+    {
+        hash ^= (unsigned char)*_name++;
+        hash *= (size_t)16777619u;
+    }
+
+    return hash;
+}
+
+// Find the hash slot for a name: either the slot holding it or the empty
+// slot where it would be inserted
+static int
+d_test_internal_registry_slot
+(
+    const char* _name
+)
+{
+    size_t mask = (size_t)g_test_registry.index_capacity - 1;
+    size_t slot = d_test_internal_registry_hash(_name) & mask;
+
+    while (g_test_registry.index[slot] != -1)
+    {
+        int idx = g_test_registry.index[slot];
+
+        if (strcmp(g_test_registry.modules[idx].name, _name) == 0)
+        {
+            break;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    return (int)slot;
+}
+
+// Grow the hash index so it stays at most half full, rehashing all names
+static bool
+d_test_internal_registry_reserve_index
+(
+    int _module_count
+)
+{
+    if ( (g_test_registry.index) &&
+         (_module_count * 2 <= g_test_registry.index_capacity) )
+    {
+        return D_SUCCESS;
+    }
+
+    int new_capacity = (g_test_registry.index_capacity > 0)
+                           ? g_test_registry.index_capacity
+                           : 16;
+
+    while (_module_count * 2 > new_capacity)
+    {
+        new_capacity *= 2;
+    }
+
+    int* new_index = malloc((size_t)new_capacity * sizeof(int));
+
+    if (!new_index)
+    {
+        return D_FAILURE;
+    }
+
+    for (int i = 0; i < new_capacity; i++)
+    {
+        new_index[i] = -1;
+    }
+
+    free(g_test_registry.index);
+    g_test_registry.index          = new_index;
+    g_test_registry.index_capacity = new_capacity;
+
+    for (int i = 0; i < g_test_registry.count; i++)
+    {
+        int slot = d_test_internal_registry_slot(g_test_registry.modules[i].name);
+        g_test_registry.index[slot] = i;
+    }
+
+    return D_SUCCESS;
+}
+
+// Grow the module and enabled arrays geometrically
+static bool
+d_test_internal_registry_reserve_modules
+(
+    int _module_count
+)
+{
+    if (_module_count <= g_test_registry.capacity)
+    {
+        return D_SUCCESS;
+    }
+
+    int new_capacity = (g_test_registry.capacity > 0)
+                           ? g_test_registry.capacity * 2
+                           : D_TEST_MAX_MODULES;
+
+    while (new_capacity < _module_count)
+    {
+        new_capacity *= 2;
+    }
+
+    d_test_module_info_t* modules = realloc(g_test_registry.modules,
+                                            (size_t)new_capacity *
+                                                sizeof(d_test_module_info_t));
+
+    if (!modules)
+    {
+        return D_FAILURE;
+    }
+
+    g_test_registry.modules = modules;
+
+    bool* enabled = realloc(g_test_registry.enabled,
+                            (size_t)new_capacity * sizeof(bool));
+
+    if (!enabled)
+    {
+        return D_FAILURE;
+    }
+
+    for (int i = g_test_registry.capacity; i < new_capacity; i++)
+    {
+        enabled[i] = D_FALSE;
+    }
+
+    g_test_registry.enabled  = enabled;
+    g_test_registry.capacity = new_capacity;
+
+    return D_SUCCESS;
+}
+
+// Copy a string into newly allocated memory
+static char*
+d_test_internal_registry_strdup
+(
+    const char* _string
+)
+{
+    size_t length = strlen(_string);
+    char*  copy   = malloc(length + 1);
+
+    if (copy)
+    {
+        d_memcpy(copy, _string, length + 1);
+    }
+
+    return copy;
+}
+
+// Free one module's owned strings and adjacency list
+static void
+d_test_internal_registry_free_module
+(
+    d_test_module_info_t* _module
+)
+{
+    for (int i = 0; i < _module->dependency_count; i++)
+    {
+        free(_module->dependencies[i]);
+    }
+
+    free(_module->dependencies);
+    free(_module->dependency_indices);
+    free(_module->name);
+
+    return;
+}
+
+// Find module index by name (O(1) average)
+int d_test_find_module_index(const char* name)
+{
+    if ( (!name) ||
+         (!g_test_registry.index) )
+    {
+        return -1;
+    }
+
+    return g_test_registry.index[d_test_internal_registry_slot(name)];
+}
+
+// Resolve every module's dependency names to indices (O(V+E)); runs once
+// after each batch of registrations
+static void
+d_test_internal_registry_resolve(void)
+{
+    if (g_test_registry.resolved)
+    {
+        return;
+    }
+
+    for (int i = 0; i < g_test_registry.count; i++)
+    {
+        d_test_module_info_t* module = &g_test_registry.modules[i];
+
+        for (int j = 0; j < module->dependency_count; j++)
+        {
+            module->dependency_indices[j] =
+                d_test_find_module_index(module->dependencies[j]);
+        }
+    }
+
+    g_test_registry.resolved = D_TRUE;
+
+    return;
+}
+
+// Register a test module
+bool 
+d_test_register_module
+(
+    const char*                          name, 
+    const struct d_test_module_metadata* metadata,
+    const char*                          dependencies[], 
+    int                                  dep_count
+)
+{
+    if ( (!name) ||
+         (dep_count < 0) ||
+         ( (dep_count > 0) && (!dependencies) ) )
+    {
+        return D_FAILURE;
+    }
+
+    // names are unique; re-registering a name is an error
+    if (d_test_find_module_index(name) != -1)
+    {
+        return D_FAILURE;
+    }
+
+    if ( (d_test_internal_registry_reserve_modules(g_test_registry.count + 1)
+              != D_SUCCESS) ||
+         (d_test_internal_registry_reserve_index(g_test_registry.count + 1)
+              != D_SUCCESS) )
+    {
+        return D_FAILURE;
+    }
+
+    d_test_module_info_t* module = &g_test_registry.modules[g_test_registry.count];
+
+    module->name               = d_test_internal_registry_strdup(name);
+    module->dependency_count   = 0;
+    module->dependencies       = (dep_count > 0)
+                                     ? calloc((size_t)dep_count, sizeof(char*))
+                                     : NULL;
+    module->dependency_indices = (dep_count > 0)
+                                     ? malloc((size_t)dep_count * sizeof(int))
+                                     : NULL;
+
+    if ( (!module->name) ||
+         ( (dep_count > 0) &&
+           ( (!module->dependencies) || (!module->dependency_indices) ) ) )
+    {
+        d_test_internal_registry_free_module(module);
+
+        return D_FAILURE;
+    }
+
+    // Copy dependencies
+    for (int i = 0; i < dep_count; i++)
+    {
+        module->dependencies[i] = d_test_internal_registry_strdup(dependencies[i]);
+
+        if (!module->dependencies[i])
+        {
+            d_test_internal_registry_free_module(module);
+
+            return D_FAILURE;
+        }
+
+        module->dependency_indices[i] = -1;
+        module->dependency_count++;
+    }
+    
+    module->available = D_TRUE;
+    module->metadata  = metadata;
+
+    g_test_registry.enabled[g_test_registry.count] = D_FALSE;
+    g_test_registry.index[d_test_internal_registry_slot(name)] = g_test_registry.count;
+    g_test_registry.count++;
+    g_test_registry.resolved = D_FALSE;
+
+    return D_SUCCESS;
+}
+
+// Free all registered modules and the registry's storage
+void d_test_registry_clear(void)
+{
+    for (int i = 0; i < g_test_registry.count; i++)
+    {
+        d_test_internal_registry_free_module(&g_test_registry.modules[i]);
+    }
+
+    free(g_test_registry.modules);
+    free(g_test_registry.enabled);
+    free(g_test_registry.index);
+
+    g_test_registry.modules        = NULL;
+    g_test_registry.enabled        = NULL;
+    g_test_registry.index          = NULL;
+    g_test_registry.count          = 0;
+    g_test_registry.capacity       = 0;
+    g_test_registry.index_capacity = 0;
+    g_test_registry.resolved       = D_FALSE;
+}
+
+// Enable a module and all its dependencies (iterative walk over the resolved
+// adjacency lists; each module and edge is visited at most once)
+void d_test_enable_module_with_deps(int module_idx)
+{
+    if (module_idx < 0 || module_idx >= g_test_registry.count)
+        return;
+        
+    if (g_test_registry.enabled[module_idx])
+        return;  // Already enabled
+
+    d_test_internal_registry_resolve();
+
+    // every module is pushed at most once, since it is enabled when pushed
+    int* stack = malloc((size_t)g_test_registry.count * sizeof(int));
+
+    if (!stack)
+    {
+        return;
+    }
+
+    int depth = 0;
+
+    g_test_registry.enabled[module_idx] = D_TRUE;
+    stack[depth++] = module_idx;
+
+    while (depth > 0)
+    {
+        d_test_module_info_t* module = &g_test_registry.modules[stack[--depth]];
+
+        for (int i = 0; i < module->dependency_count; i++)
+        {
+            int dep_idx = module->dependency_indices[i];
+
+            if ( (dep_idx != -1) &&
+                 (!g_test_registry.enabled[dep_idx]) )
+            {
+                g_test_registry.enabled[dep_idx] = D_TRUE;
+                stack[depth++] = dep_idx;
+            }
+        }
+    }
+
+    free(stack);
+}
+
+// Disable a module (but don't touch dependencies)
+void d_test_disable_module(int module_idx)
+{
+    if (module_idx >= 0 && module_idx < g_test_registry.count)
+    {
+        g_test_registry.enabled[module_idx] = D_FALSE;
+    }
+}
+
+// Enable all available modules
+void d_test_enable_all_modules(void)
+{
+    for (int i = 0; i < g_test_registry.count; i++)
+    {
+        if (g_test_registry.modules[i].available)
+        {
+            d_test_enable_module_with_deps(i);
+        }
+    }
+}
+
+// Reset all modules to disabled
+void d_test_reset_modules(void)
+{
+    for (int i = 0; i < g_test_registry.count; i++)
+    {
+        g_test_registry.enabled[i] = D_FALSE;
+    }
+}
+
+// Keep only the enabled modules a name filter selects, plus their
+// dependencies.  `patterns` is a comma-separated list of globs (see
+// d_test_filter_new), compiled once for the whole registry.
+bool d_test_filter_modules(const char* patterns)
+{
+    int count = g_test_registry.count;
+
+    if ( (!patterns) || (count == 0) )
+    {
+        return D_SUCCESS;
+    }
+
+    struct d_test_filter* filter   = d_test_filter_new(patterns, NULL);
+    bool*                 selected = malloc((size_t)count * sizeof(bool));
+
+    if ( (!filter) || (!selected) )
+    {
+        d_test_filter_free(filter);
+        free(selected);
+        return D_FAILURE;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        selected[i] = g_test_registry.enabled[i] &&
+                      d_test_filter_selects(filter, g_test_registry.modules[i].name);
+    }
+
+    d_test_reset_modules();
+
+    for (int i = 0; i < count; i++)
+    {
+        if (selected[i])
+        {
+            d_test_enable_module_with_deps(i);
+        }
+    }
+
+    free(selected);
+    d_test_filter_free(filter);
+
+    return D_SUCCESS;
+}
+
+// ============================================================================
+// DEPENDENCY SCHEDULER
+// ============================================================================
+
+// Module state during scheduled execution
+typedef enum
+{
+    D_TEST_SCHED_WAITING,     // dependencies still running
+    D_TEST_SCHED_RUNNING,
+    D_TEST_SCHED_PASSED,
+    D_TEST_SCHED_FAILED,
+    D_TEST_SCHED_SKIPPED      // a dependency failed or was skipped
+} d_test_sched_state_t;
+
+// Per-module scheduling record
+typedef struct
+{
+    d_test_sched_state_t state;
+    int   pending;            // enabled dependencies not yet finished
+    int   blocked_by;         // failed/skipped dependency, or -1
+    int   dependents_start;   // range in the reverse adjacency array
+    int   dependents_end;
+#if !defined(_WIN32) && !defined(_WIN64)
+    pid_t pid;
+    int   done_fd;            // read end of a pipe that closes when it exits
+    FILE* output;             // captured output of a forked module
+#endif
+} d_test_sched_entry_t;
+
+// Scheduler totals
+typedef struct
+{
+    int run;
+    int passed;
+    int failed;               // failed runs plus modules caught in a cycle
+    int skipped;
+} d_test_sched_totals_t;
+
+// Run one module in the current process, printing its header and verdict
+static bool
+d_test_internal_sched_run_module
+(
+    int _module_idx
+)
+{
+    d_test_module_info_t* module = &g_test_registry.modules[_module_idx];
+    struct d_test_counter test_info = {0};
+
+    printf("--- Testing %s ---\n", module->name);
+
+    bool result = module->metadata->fn_test_all(&test_info);
+
+    printf("%s: %s\n", (result == D_SUCCESS) ? "PASS" : "FAIL", module->name);
+
+    return (result == D_SUCCESS);
+}
+
+// Record a finished module and release the modules that depend on it; any
+// dependent that becomes ready is pushed onto the ready stack
+static void
+d_test_internal_sched_finish
+(
+    d_test_sched_entry_t*  _entries,
+    const int*             _dependents,
+    int*                   _ready,
+    int*                   _ready_count,
+    d_test_sched_totals_t* _totals,
+    int                    _module_idx,
+    d_test_sched_state_t   _state
+)
+{
+    d_test_sched_entry_t* entry = &_entries[_module_idx];
+
+    entry->state = _state;
+
+    if (_state == D_TEST_SCHED_PASSED)
+    {
+        _totals->run++;
+        _totals->passed++;
+    }
+    else if (_state == D_TEST_SCHED_FAILED)
+    {
+        _totals->run++;
+        _totals->failed++;
+    }
+    else
+    {
+        _totals->skipped++;
+    }
+
+    for (int i = entry->dependents_start; i < entry->dependents_end; i++)
+    {
+        d_test_sched_entry_t* dependent = &_entries[_dependents[i]];
+
+        if ( (_state != D_TEST_SCHED_PASSED) &&
+             (dependent->blocked_by == -1) )
+        {
+            dependent->blocked_by = _module_idx;
+        }
+
+        if (--dependent->pending == 0)
+        {
+            _ready[(*_ready_count)++] = _dependents[i];
+        }
+    }
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+// Fork a child that runs one module with its output captured to a temp file.
+// The child holds the write end of a pipe until it exits, so the parent can
+// wait on that child alone
+static bool
+d_test_internal_sched_start
+(
+    d_test_sched_entry_t* _entry,
+    int                   _module_idx
+)
+{
+    int   done[2];
+    FILE* output = tmpfile();
+
+    if (!output)
+    {
+        return D_FAILURE;
+    }
+
+    if (pipe(done) != 0)
+    {
+        fclose(output);
+
+        return D_FAILURE;
+    }
+
+    // anything still buffered would otherwise be printed by the child too
+    fflush(stdout);
+
+    pid_t pid = fork();
+
+    if (pid < 0)
+    {
+        close(done[0]);
+        close(done[1]);
+        fclose(output);
+
+        return D_FAILURE;
+    }
+
+    if (pid == 0)
+    {
+        close(done[0]);
+
+        if (dup2(fileno(output), STDOUT_FILENO) < 0)
+        {
+            _exit(2);
+        }
+
+        bool passed = d_test_internal_sched_run_module(_module_idx);
+        fflush(stdout);
+
+        _exit(passed ? 0 : 1);
+    }
+
+    close(done[1]);
+
+    _entry->pid     = pid;
+    _entry->done_fd = done[0];
+    _entry->output  = output;
+    _entry->state   = D_TEST_SCHED_RUNNING;
+
+    return D_SUCCESS;
+}
+
+// Print a finished child's captured output
+static void
+d_test_internal_sched_flush
+(
+    d_test_sched_entry_t* _entry
+)
+{
+    char   chunk[4096];
+    size_t read_count;
+
+    rewind(_entry->output);
+
+    while ((read_count = fread(chunk, 1, sizeof(chunk), _entry->output)) > 0)
+    {
+        fwrite(chunk, 1, read_count, stdout);
+    }
+
+    fclose(_entry->output);
+    _entry->output = NULL;
+}
+
+// Reap one finished child by its own pid, print its output, and record it
+static void
+d_test_internal_sched_reap
+(
+    d_test_sched_entry_t*  _entries,
+    const int*             _dependents,
+    int*                   _ready,
+    int*                   _ready_count,
+    d_test_sched_totals_t* _totals,
+    int                    _module_idx
+)
+{
+    d_test_sched_entry_t* entry = &_entries[_module_idx];
+    const char*           name  = g_test_registry.modules[_module_idx].name;
+    int                   status;
+    pid_t                 reaped;
+
+    close(entry->done_fd);
+    entry->done_fd = -1;
+
+    do
+    {
+        reaped = waitpid(entry->pid, &status, 0);
+    } while ( (reaped < 0) &&
+              (errno == EINTR) );
+
+    d_test_internal_sched_flush(entry);
+
+    // without its exit status (e.g. SIGCHLD ignored) the verdict is unknown
+    if (reaped != entry->pid)
+    {
+        printf("FAIL: %s (worker lost)\n", name);
+        d_test_internal_sched_finish(_entries, _dependents, _ready,
+                                     _ready_count, _totals, _module_idx,
+                                     D_TEST_SCHED_FAILED);
+
+        return;
+    }
+
+    bool passed = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+
+    if ( (!WIFEXITED(status)) ||
+         (WEXITSTATUS(status) > 1) )
+    {
+        printf("FAIL: %s (worker terminated abnormally)\n", name);
+    }
+
+    d_test_internal_sched_finish(_entries, _dependents, _ready,
+                                 _ready_count, _totals, _module_idx,
+                                 passed ? D_TEST_SCHED_PASSED
+                                        : D_TEST_SCHED_FAILED);
+}
+
+// Block until at least one running child exits, then reap every child that
+// has. Children are watched through their own pipes and reaped by pid, never
+// with waitpid(-1), so processes the host program started are left alone.
+// Returns the number of children reaped (0 if the wait was interrupted)
+static int
+d_test_internal_sched_wait
+(
+    d_test_sched_entry_t*  _entries,
+    const int*             _dependents,
+    int*                   _ready,
+    int*                   _ready_count,
+    d_test_sched_totals_t* _totals,
+    struct pollfd*         _polls,
+    int                    _count
+)
+{
+    int polled = 0;
+
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].state == D_TEST_SCHED_RUNNING)
+        {
+            _polls[polled].fd      = _entries[i].done_fd;
+            _polls[polled].events  = POLLIN;
+            _polls[polled].revents = 0;
+            polled++;
+        }
+    }
+
+    if (polled == 0)
+    {
+        return 0;
+    }
+
+    bool failed = (poll(_polls, (nfds_t)polled, -1) < 0);
+
+    if ( (failed) &&
+         (errno == EINTR) )
+    {
+        return 0;
+    }
+
+    // `_polls` follows the running entries in order; if poll itself failed,
+    // reap every child with blocking waits instead. Finishing a module only
+    // changes the state of the module itself, so the order still holds
+    int reaped = 0;
+
+    polled = 0;
+
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].state != D_TEST_SCHED_RUNNING)
+        {
+            continue;
+        }
+
+        if ( (failed) ||
+             (_polls[polled].revents != 0) )
+        {
+            d_test_internal_sched_reap(_entries, _dependents, _ready,
+                                       _ready_count, _totals, i);
+            reaped++;
+        }
+
+        polled++;
+    }
 
-#define D_TEST_MAX_MODULES        64
-#define D_TEST_MAX_MODULE_NAME    32
-#define D_TEST_MAX_DEPENDENCIES   8
-#define D_TEST_MAX_INCLUDES       16
-#define D_TEST_MAX_EXCLUDES       16
+    return reaped;
+}
 
-// ============================================================================
-// COMMAND TYPES
-// ============================================================================
+#endif
 
-typedef enum
+// Whether waiting module `_start` lies on a dependency cycle, i.e. can reach
+// itself through dependents that are also still waiting. `_stack` and
+// `_seen` are scratch space for `_count` modules
+static bool
+d_test_internal_sched_on_cycle
+(
+    const d_test_sched_entry_t* _entries,
+    const int*                  _dependents,
+    int*                        _stack,
+    char*                       _seen,
+    int                         _count,
+    int                         _start
+)
 {
-    D_TEST_CMD_NONE,
-    D_TEST_CMD_RUN_ALL,
-    D_TEST_CMD_RUN_MODULE,
-    D_TEST_CMD_HELP,
-    D_TEST_CMD_LIST
-} d_test_command_t;
+    int top = 0;
 
-// ============================================================================
-// MODULE REGISTRY
-// ============================================================================
+    memset(_seen, 0, (size_t)_count);
+    _stack[top++] = _start;
 
-// Test module registration info
-typedef struct
-{
-    char name[D_TEST_MAX_MODULE_NAME];
-    char dependencies[D_TEST_MAX_DEPENDENCIES][D_TEST_MAX_MODULE_NAME];
-    int  dependency_count;
-    bool available;
-    const struct d_test_module_metadata* metadata;
-} d_test_module_info_t;
+    while (top > 0)
+    {
+        int idx = _stack[--top];
 
-// Global module registry
-struct d_test_registry_t
-{
-    d_test_module_info_t modules[D_TEST_MAX_MODULES];
-    int count;
-    bool enabled[D_TEST_MAX_MODULES];  // Bitfield for which modules to run
-};
+        for (int i = _entries[idx].dependents_start;
+             i < _entries[idx].dependents_end;
+             i++)
+        {
+            int next = _dependents[i];
 
-// ============================================================================
-// PARSED ARGUMENTS STRUCTURE
-// ============================================================================
+            if (_entries[next].state != D_TEST_SCHED_WAITING)
+            {
+                continue;
+            }
 
-typedef struct
-{
-    d_test_command_t command;
-    char target_module[D_TEST_MAX_MODULE_NAME];
-    char includes[D_TEST_MAX_INCLUDES][D_TEST_MAX_MODULE_NAME];
-    int  include_count;
-    char excludes[D_TEST_MAX_EXCLUDES][D_TEST_MAX_MODULE_NAME];
-    int  exclude_count;
-    bool verbose;
-    bool dry_run;  // Show what would run without running it
-} d_test_args_t;
+            if (next == _start)
+            {
+                return true;
+            }
 
-// ============================================================================
-// MODULE REGISTRY FUNCTIONS
-// ============================================================================
+            if (!_seen[next])
+            {
+                _seen[next]   = 1;
+                _stack[top++] = next;
+            }
+        }
+    }
 
-// Initialize the test registry
-static struct d_test_registry_t g_test_registry = {0};
+    return false;
+}
 
-// Register a test module
-bool 
-d_test_register_module
+// Run all enabled modules in dependency order. A module starts as soon as
+// every enabled dependency has passed, with up to `jobs` modules running at
+// once in separate processes (POSIX only; elsewhere modules run one at a
+// time). A module whose dependency failed or was skipped is skipped without
+// being run. Modules on a dependency cycle never run and are counted as
+// failed; modules that only wait on a cycle are skipped. Disabled
+// dependencies are treated as satisfied.
+d_test_sched_totals_t
+d_test_run_enabled_modules
 (
-    const char*                          name, 
-    const struct d_test_module_metadata* metadata,
-    const char*                          dependencies[], 
-    int                                  dep_count
+    int  _jobs,
+    bool _verbose
 )
 {
-    if (g_test_registry.count >= D_TEST_MAX_MODULES)
+    d_test_sched_totals_t totals = {0};
+    int count = g_test_registry.count;
+
+    if (count == 0)
     {
-        return D_FAILURE;
+        return totals;
     }
 
-    int idx = g_test_registry.count++;
-    d_test_module_info_t* module = &g_test_registry.modules[idx];
-    
-    // Copy name
-    strncpy(module->name, name, D_TEST_MAX_MODULE_NAME - 1);
-    module->name[D_TEST_MAX_MODULE_NAME - 1] = '\0';
-    
-    // Copy dependencies
-    module->dependency_count = (dep_count > D_TEST_MAX_DEPENDENCIES) ? 
-                              D_TEST_MAX_DEPENDENCIES : dep_count;
-    
-    for (int i = 0; i < module->dependency_count; i++)
+    d_test_internal_registry_resolve();
+
+    d_test_sched_entry_t* entries    = calloc((size_t)count, sizeof(d_test_sched_entry_t));
+    int*                  offsets    = calloc((size_t)count + 1, sizeof(int));
+    int*                  ready      = malloc((size_t)count * sizeof(int));
+    int*                  dependents = NULL;
+    int                   edge_count = 0;
+#if !defined(_WIN32) && !defined(_WIN64)
+    struct pollfd*        polls      = calloc((size_t)count, sizeof(struct pollfd));
+    bool                  watchable  = (polls != NULL);
+#else
+    bool                  watchable  = true;
+#endif
+
+    if ( (!entries) || (!offsets) || (!ready) || (!watchable) )
     {
-        strncpy(module->dependencies[i], dependencies[i], D_TEST_MAX_MODULE_NAME - 1);
-        module->dependencies[i][D_TEST_MAX_MODULE_NAME - 1] = '\0';
+#if !defined(_WIN32) && !defined(_WIN64)
+        free(polls);
+#endif
+        free(entries);
+        free(offsets);
+        free(ready);
+        printf("Error: Unable to allocate scheduler state\n");
+
+        return totals;
     }
-    
-    module->available = D_TRUE;
-    module->metadata = metadata;
-    
-    return D_SUCCESS;
-}
 
-// Find module index by name
-int d_test_find_module_index(const char* name)
-{
-    for (int i = 0; i < g_test_registry.count; i++)
+    // count enabled edges per dependency, then build the reverse adjacency
+    // (dependency -> dependents) as a compressed array: O(V+E)
+    for (int i = 0; i < count; i++)
     {
-        if (strcmp(g_test_registry.modules[i].name, name) == 0)
+        d_test_module_info_t* module = &g_test_registry.modules[i];
+
+        entries[i].blocked_by = -1;
+
+        if (!g_test_registry.enabled[i])
         {
-            return i;
+            continue;
+        }
+
+        for (int j = 0; j < module->dependency_count; j++)
+        {
+            int dep_idx = module->dependency_indices[j];
+
+            if ( (dep_idx != -1) &&
+                 (g_test_registry.enabled[dep_idx]) )
+            {
+                offsets[dep_idx + 1]++;
+                entries[i].pending++;
+                edge_count++;
+            }
         }
     }
-    return -1;
-}
 
-// Enable a module and all its dependencies recursively
-void d_test_enable_module_with_deps(int module_idx)
-{
-    if (module_idx < 0 || module_idx >= g_test_registry.count)
-        return;
-        
-    if (g_test_registry.enabled[module_idx])
-        return;  // Already enabled
-    
-    g_test_registry.enabled[module_idx] = D_TRUE;
-    
-    // Enable all dependencies
-    d_test_module_info_t* module = &g_test_registry.modules[module_idx];
-    for (int i = 0; i < module->dependency_count; i++)
+    for (int i = 0; i < count; i++)
+    {
+        offsets[i + 1] += offsets[i];
+        entries[i].dependents_start = offsets[i];
+        entries[i].dependents_end   = offsets[i];
+    }
+
+    if (edge_count > 0)
     {
-        int dep_idx = d_test_find_module_index(module->dependencies[i]);
-        if (dep_idx != -1)
+        dependents = malloc((size_t)edge_count * sizeof(int));
+
+        if (!dependents)
         {
-            d_test_enable_module_with_deps(dep_idx);
+#if !defined(_WIN32) && !defined(_WIN64)
+            free(polls);
+#endif
+            free(entries);
+            free(offsets);
+            free(ready);
+            printf("Error: Unable to allocate scheduler state\n");
+
+            return totals;
         }
     }
-}
 
-// Disable a module (but don't touch dependencies)
-void d_test_disable_module(int module_idx)
-{
-    if (module_idx >= 0 && module_idx < g_test_registry.count)
+    for (int i = 0; i < count; i++)
     {
-        g_test_registry.enabled[module_idx] = D_FALSE;
+        d_test_module_info_t* module = &g_test_registry.modules[i];
+
+        if (!g_test_registry.enabled[i])
+        {
+            continue;
+        }
+
+        for (int j = 0; j < module->dependency_count; j++)
+        {
+            int dep_idx = module->dependency_indices[j];
+
+            if ( (dep_idx != -1) &&
+                 (g_test_registry.enabled[dep_idx]) )
+            {
+                dependents[entries[dep_idx].dependents_end++] = i;
+            }
+        }
     }
-}
 
-// Enable all available modules
-void d_test_enable_all_modules(void)
-{
-    for (int i = 0; i < g_test_registry.count; i++)
+    // seed the ready stack in reverse so modules start in registration order
+    int ready_count = 0;
+    int remaining   = 0;
+
+    for (int i = count - 1; i >= 0; i--)
     {
-        if (g_test_registry.modules[i].available)
+        if (!g_test_registry.enabled[i])
         {
-            d_test_enable_module_with_deps(i);
+            continue;
+        }
+
+        remaining++;
+
+        if (entries[i].pending == 0)
+        {
+            ready[ready_count++] = i;
+        }
+    }
+
+    int running = 0;
+
+    if (_jobs < 1)
+    {
+        _jobs = 1;
+    }
+
+    printf("Executing tests:\n");
+
+    while (remaining > 0)
+    {
+        // start (or skip) ready modules while workers are free
+        while ( (ready_count > 0) &&
+                (running < _jobs) )
+        {
+            int                   idx    = ready[--ready_count];
+            d_test_module_info_t* module = &g_test_registry.modules[idx];
+
+            if (entries[idx].blocked_by != -1)
+            {
+                printf("SKIP: %s (dependency '%s' did not pass)\n",
+                       module->name,
+                       g_test_registry.modules[entries[idx].blocked_by].name);
+
+                d_test_internal_sched_finish(entries, dependents, ready,
+                                             &ready_count, &totals, idx,
+                                             D_TEST_SCHED_SKIPPED);
+                remaining--;
+
+                continue;
+            }
+
+            if ( (!module->metadata) ||
+                 (!module->metadata->fn_test_all) )
+            {
+                printf("SKIP: %s (no test function)\n", module->name);
+
+                // nothing to run; dependents are not held back by it
+                entries[idx].state = D_TEST_SCHED_SKIPPED;
+                totals.skipped++;
+
+                for (int i = entries[idx].dependents_start;
+                     i < entries[idx].dependents_end;
+                     i++)
+                {
+                    if (--entries[dependents[i]].pending == 0)
+                    {
+                        ready[ready_count++] = dependents[i];
+                    }
+                }
+
+                remaining--;
+
+                continue;
+            }
+
+            if (_verbose)
+            {
+                printf("Starting: %s\n", module->name);
+            }
+
+#if !defined(_WIN32) && !defined(_WIN64)
+            if ( (_jobs > 1) &&
+                 (d_test_internal_sched_start(&entries[idx], idx) == D_SUCCESS) )
+            {
+                running++;
+
+                continue;
+            }
+#endif
+
+            d_test_internal_sched_finish(entries, dependents, ready,
+                                         &ready_count, &totals, idx,
+                                         d_test_internal_sched_run_module(idx)
+                                             ? D_TEST_SCHED_PASSED
+                                             : D_TEST_SCHED_FAILED);
+            remaining--;
+        }
+
+        // nothing running and nothing ready: the rest form a cycle
+        if (running == 0)
+        {
+            break;
+        }
+
+#if !defined(_WIN32) && !defined(_WIN64)
+        // wait for any worker to finish
+        int reaped = d_test_internal_sched_wait(entries, dependents, ready,
+                                                &ready_count, &totals, polls,
+                                                count);
+
+        running   -= reaped;
+        remaining -= reaped;
+#endif
+    }
+
+    // anything left waiting is on a dependency cycle or waits on one; the
+    // ready stack is empty here and serves as the search stack
+    char* seen = (remaining > 0) ? calloc((size_t)count, 1) : NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ( (!g_test_registry.enabled[i]) ||
+             (entries[i].state != D_TEST_SCHED_WAITING) ||
+             (entries[i].pending == 0) )
+        {
+            continue;
+        }
+
+        d_test_module_info_t* module  = &g_test_registry.modules[i];
+        int                   waiting = -1;
+
+        if ( (seen) &&
+             (!d_test_internal_sched_on_cycle(entries, dependents, ready,
+                                              seen, count, i)) )
+        {
+            for (int j = 0; (waiting == -1) && (j < module->dependency_count); j++)
+            {
+                int dep_idx = module->dependency_indices[j];
+
+                if ( (dep_idx != -1) &&
+                     (g_test_registry.enabled[dep_idx]) &&
+                     (entries[dep_idx].state == D_TEST_SCHED_WAITING) )
+                {
+                    waiting = dep_idx;
+                }
+            }
+        }
+
+        if (waiting != -1)
+        {
+            printf("SKIP: %s (dependency '%s' did not pass)\n",
+                   module->name,
+                   g_test_registry.modules[waiting].name);
+            totals.skipped++;
+        }
+        else
+        {
+            printf("FAIL: %s (dependency cycle)\n", module->name);
+            totals.failed++;
         }
     }
+
+    free(seen);
+    fflush(stdout);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    free(polls);
+#endif
+    free(dependents);
+    free(ready);
+    free(offsets);
+    free(entries);
+
+    return totals;
 }
 
-// Reset all modules to disabled
-void d_test_reset_modules(void)
+// Register a tree-based module using its D_TEST_METADATA_NAME and
+// D_TEST_METADATA_DEPENDENCIES settings
+bool
+d_test_register_tree_module
+(
+    const struct d_test_module*          _module,
+    const struct d_test_module_metadata* _metadata
+)
 {
-    for (int i = 0; i < g_test_registry.count; i++)
+    const char* name = d_test_module_get_name(_module);
+
+    if (!name)
     {
-        g_test_registry.enabled[i] = D_FALSE;
+        return D_FAILURE;
     }
+
+    return d_test_register_module(name,
+                                  _metadata,
+                                  (const char**)d_test_module_get_dependencies(_module),
+                                  (int)d_test_module_dependency_count(_module));
 }
 
 // ============================================================================
@@ -209,7 +1253,10 @@ void d_test_print_usage(const char* program_name)
     printf("  -include <module>     Force include module (with dependencies)\n");
     printf("  -exclude <module>     Exclude specific module\n");
     printf("  -verbose              Show detailed output\n");
-    printf("  -dry-run              Show what would run without running\n\n");
+    printf("  -dry-run              Show what would run without running\n");
+    printf("  -jobs <n>             Run up to n modules at once (dependencies first)\n");
+    printf("  -filter <globs>       Run only modules matching comma-separated globs,\n");
+    printf("                        e.g. 'alloc*,string' (dependencies still run)\n\n");
     printf("Available modules:\n");
     
     for (int i = 0; i < g_test_registry.count; i++)
@@ -231,6 +1278,35 @@ void d_test_print_usage(const char* program_name)
     }
 }
 
+// Parse a positive integer option value into `_value`. Rejects empty or
+// partly numeric text ("4x"), values below 1 and values that overflow an int
+static bool
+d_test_internal_parse_count
+(
+    const char* _text,
+    int*        _value
+)
+{
+    char* end = NULL;
+    long  parsed;
+
+    errno  = 0;
+    parsed = strtol(_text, &end, 10);
+
+    if ( (end == _text) ||
+         (*end != '\0') ||
+         (errno == ERANGE) ||
+         (parsed < 1) ||
+         (parsed > INT_MAX) )
+    {
+        return false;
+    }
+
+    *_value = (int)parsed;
+
+    return true;
+}
+
 // Parse command line arguments
 d_test_args_t
 d_test_parse_args
@@ -241,6 +1317,7 @@ d_test_parse_args
 {
     d_test_args_t args = {0};
     args.command = D_TEST_CMD_NONE;
+    args.jobs    = 1;
     
     if (_argc < 2)
     {
@@ -317,6 +1394,25 @@ d_test_parse_args
         {
             args.dry_run = D_TRUE;
         }
+        else if (strcmp(_argv[i], "-jobs") == 0 && i + 1 < _argc)
+        {
+            i++;
+
+            if (!d_test_internal_parse_count(_argv[i], &args.jobs))
+            {
+                printf("Error: -jobs expects a positive integer, got '%s'\n",
+                       _argv[i]);
+                args.command = D_TEST_CMD_NONE;
+
+                return args;
+            }
+        }
+        else if ( (strcmp(_argv[i], "-filter") == 0 ||
+                   strcmp(_argv[i], "--filter") == 0) && i + 1 < _argc)
+        {
+            i++;
+            args.filter = _argv[i];
+        }
 
         i++;
     }
@@ -365,6 +1461,18 @@ int d_test_execute_command(d_test_args_t args)
             return args.command == D_TEST_CMD_HELP ? 0 : 1;
     }
     
+    // Narrow the selection by name before anything runs
+    if (args.filter)
+    {
+        if (args.verbose) printf("Filtering modules: %s\n", args.filter);
+
+        if (d_test_filter_modules(args.filter) != D_SUCCESS)
+        {
+            printf("Error: Unable to compile filter '%s'\n", args.filter);
+            return 1;
+        }
+    }
+    
     // Process includes (force enable modules)
     for (int i = 0; i < args.include_count; i++)
     {
@@ -414,47 +1522,16 @@ int d_test_execute_command(d_test_args_t args)
         return 0;  // Don't actually run tests
     }
     
-    // Run enabled tests
-    int total_run = 0;
-    int total_passed = 0;
-    
-    printf("Executing tests:\n");
-    for (int i = 0; i < g_test_registry.count; i++)
-    {
-        if (g_test_registry.enabled[i])
-        {
-            d_test_module_info_t* module = &g_test_registry.modules[i];
-            printf("--- Testing %s ---\n", module->name);
-            
-            if (module->metadata && module->metadata->fn_test_all)
-            {
-                struct d_test_counter test_info = {0};
-                bool result = module->metadata->fn_test_all(&test_info);
-                total_run++;
-                
-                if (result == D_SUCCESS)
-                {
-                    total_passed++;
-                    printf("PASS: %s\n", module->name);
-                }
-                else
-                {
-                    printf("FAIL: %s\n", module->name);
-                }
-            }
-            else
-            {
-                printf("SKIP: %s (no test function)\n", module->name);
-            }
-        }
-    }
+    // Run enabled tests, dependencies first
+    d_test_sched_totals_t totals = d_test_run_enabled_modules(args.jobs, args.verbose);
     
     printf("\n=== Results ===\n");
-    printf("Tests run: %d\n", total_run);
-    printf("Passed: %d\n", total_passed);
-    printf("Failed: %d\n", total_run - total_passed);
+    printf("Tests run: %d\n", totals.run);
+    printf("Passed: %d\n", totals.passed);
+    printf("Failed: %d\n", totals.failed);
+    printf("Skipped: %d\n", totals.skipped);
     
-    return (total_run - total_passed) > 0 ? 1 : 0;
+    return (totals.failed > 0) ? 1 : 0;
 }
 
 // ============================================================================
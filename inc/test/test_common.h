@@ -26,6 +26,7 @@
 #define D_KEYWORD_TEST_TEST        test
 #define D_KEYWORD_TEST_BLOCK       block
 #define D_KEYWORD_TEST_MODULE      module
+#define D_KEYWORD_TEST_PROPERTY    property
 
 // D_TEST_PASS
 //   definition: evaluates in an evaluation, assertion, test, etc. passing
@@ -46,6 +47,8 @@ typedef unsigned long long d_test_id;
 // D_TEST_PASS or D_TEST_FAIL.
 typedef bool (*fn_test)();
 
+struct d_test;
+
 // fn_stage
 //   function pointer: function pointer for test lifecycle stage hooks.
 // takes a test pointer and returns success/failure.
@@ -147,6 +150,10 @@ enum DTestStage
     D_TEST_STAGE_AFTER      = 5
 };
 
+// D_TEST_STAGE_COUNT
+//   constant: number of DTestStage values; sizes per-stage slot arrays.
+#define D_TEST_STAGE_COUNT ((size_t)D_TEST_STAGE_AFTER + 1)
+
 
 /******************************************************************************
  * TEST TYPE DISCRIMINATOR
@@ -162,8 +169,150 @@ enum DTestTypeFlag
     D_TEST_TYPE_TEST_FN    = 2,
     D_TEST_TYPE_TEST       = 3,
     D_TEST_TYPE_TEST_BLOCK = 4,
-    D_TEST_TYPE_MODULE     = 5
+    D_TEST_TYPE_MODULE     = 5,
+    D_TEST_TYPE_PROPERTY   = 6
+};
+
+struct d_assertion;
+struct d_test_fn;
+struct d_test_block;
+struct d_test_module;
+struct d_test_property;
+struct d_test_config;
+
+// d_test_type
+//   struct: discriminated union for test tree nodes. Can represent a test
+// function, assertion, individual test, test block, module, or property.
+struct d_test_type
+{
+    enum DTestTypeFlag    type;
+    struct d_test_config* config;
+
+    union
+    {
+        struct d_assertion*     D_KEYWORD_TEST_ASSERTION;
+        struct d_test_fn*       D_KEYWORD_TEST_TEST_FN;
+        struct d_test*          D_KEYWORD_TEST_TEST;
+        struct d_test_block*    D_KEYWORD_TEST_BLOCK;
+        struct d_test_module*   D_KEYWORD_TEST_MODULE;
+        struct d_test_property* D_KEYWORD_TEST_PROPERTY;
+    };
+};
+
+
+/******************************************************************************
+ * CHILD STORAGE
+ *****************************************************************************/
+
+// D_TEST_CHILDREN_INLINE_CAPACITY
+//   constant: number of children a test, block or module stores inline
+// before spilling to the heap.  Most nodes have 1-8 children.
+#ifndef D_TEST_CHILDREN_INLINE_CAPACITY
+    #define D_TEST_CHILDREN_INLINE_CAPACITY 8
+#endif
+
+// the inline array cannot be empty, and spilling doubles the inline count
+#if (D_TEST_CHILDREN_INLINE_CAPACITY < 1)
+    #error "D_TEST_CHILDREN_INLINE_CAPACITY must be at least 1"
+#endif
+
+// d_test_children
+//   struct: small-buffer vector of `d_test_type` values, embedded in each
+// test tree node.  Children are stored by value, in place, until the inline
+// capacity is exceeded; they then move to one heap array that grows
+// geometrically.  Pointers returned by d_test_children_at stay valid until
+// the next push.
+struct d_test_children
+{
+    size_t              count;     // number of children
+    size_t              capacity;  // heap capacity; 0 while inline
+    struct d_test_type* heap;      // spilled children, or NULL while inline
+    struct d_test_type  inline_items[D_TEST_CHILDREN_INLINE_CAPACITY];
+};
+
+void                d_test_children_init(struct d_test_children* _children);
+bool                d_test_children_push(struct d_test_children*   _children,
+                                         const struct d_test_type* _child);
+struct d_test_type* d_test_children_at(const struct d_test_children* _children,
+                                       size_t                        _index);
+void                d_test_children_clear(struct d_test_children* _children);
+
+
+/******************************************************************************
+ * NAME FILTER
+ *****************************************************************************/
+
+// D_TEST_FILTER_PATH_SEPARATOR
+//   constant: separates module, block and test names in a filter pattern,
+// e.g. "alloc/*/resize*".
+#define D_TEST_FILTER_PATH_SEPARATOR '/'
+
+// D_TEST_FILTER_LIST_SEPARATOR
+//   constant: separates alternative patterns in one filter string, e.g.
+// "alloc/*,string/**".
+#define D_TEST_FILTER_LIST_SEPARATOR ','
+
+// D_TEST_FILTER_ANY_DEPTH
+//   constant: pattern segment that matches zero or more path components.
+#define D_TEST_FILTER_ANY_DEPTH "**"
+
+// DTestFilterMatch
+//   enum: result of matching a (possibly partial) path against a filter.
+// PARTIAL means the path itself is not selected but some descendant may be,
+// so its subtree must still be visited; NONE means the whole subtree can be
+// skipped without being built or evaluated.
+enum DTestFilterMatch
+{
+    D_TEST_FILTER_MATCH_NONE    = 0,
+    D_TEST_FILTER_MATCH_PARTIAL = 1,
+    D_TEST_FILTER_MATCH_FULL    = 2
 };
 
+// d_test_filter_segment
+//   struct: one compiled path component of a pattern.  The literal prefix
+// (text before the first wildcard) is compared first so most mismatches are
+// rejected without running the wildcard matcher.
+struct d_test_filter_segment
+{
+    char*  glob;            // segment text, NUL-terminated
+    size_t length;          // length of glob
+    size_t prefix_length;   // characters before the first wildcard
+    bool   literal;         // no wildcards; compared with strcmp
+    bool   any_depth;       // "**" segment
+};
+
+// d_test_filter_pattern
+//   struct: one compiled pattern, split on D_TEST_FILTER_PATH_SEPARATOR.
+struct d_test_filter_pattern
+{
+    size_t                        count;     // number of segments
+    struct d_test_filter_segment* segments;  // compiled segments
+    bool                          exclude;   // pattern removes matches
+};
+
+// d_test_filter
+//   struct: a compiled set of include and exclude patterns.  A path is
+// selected when it matches any include pattern (or there are none) and no
+// exclude pattern.
+struct d_test_filter
+{
+    size_t                        count;          // number of patterns
+    size_t                        include_count;  // of which include
+    struct d_test_filter_pattern* patterns;       // compiled patterns
+};
+
+
+struct d_test_filter* d_test_filter_new(const char* _include,
+                                        const char* _exclude);
+bool                  d_test_filter_add(struct d_test_filter* _filter,
+                                        const char*           _patterns,
+                                        bool                  _exclude);
+enum DTestFilterMatch d_test_filter_match(const struct d_test_filter* _filter,
+                                          const char* const*          _path,
+                                          size_t                      _depth);
+bool                  d_test_filter_selects(const struct d_test_filter* _filter,
+                                            const char*                 _name);
+void                  d_test_filter_free(struct d_test_filter* _filter);
+
 
 #endif  // DJINTERP_TEST_COMMON_
\ No newline at end of file
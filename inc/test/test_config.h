@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include "..\djinterp.h"
 #include "..\container\map\min_enum_map.h"
+#include ".\test_common.h"
 #include ".\test_cvar.h"
 #include ".\test_stats.h"
 
@@ -130,6 +131,17 @@ enum DTestConfigKey
     D_TEST_CONFIG_TIMEOUT_MS        // size_t      - test timeout in milliseconds
 };
 
+// D_TEST_CONFIG_KEY_COUNT
+//   constant: number of DTestConfigKey values; sizes the config slot array.
+#define D_TEST_CONFIG_KEY_COUNT ((size_t)D_TEST_CONFIG_TIMEOUT_MS + 1)
+
+// d_internal_test_config_key_count_check
+//   typedef: compile-time check that every DTestConfigKey has a bit in the
+// 32-bit `present` mask of d_test_config; the array size is negative, and
+// the build fails, once the keys outgrow it.
+typedef char d_internal_test_config_key_count_check
+    [(D_TEST_CONFIG_KEY_COUNT <= 32) ? 1 : -1];
+
 // DTestMetadataFlag
 //   enum: common enum types for test tree metadata
 enum DTestMetadataFlag
@@ -141,7 +153,7 @@ enum DTestMetadataFlag
     D_TEST_METADATA_DATE_CREATED,       // char*  - creation date
     D_TEST_METADATA_DATE_MODIFIED,      // char*  - modification date
     D_TEST_METADATA_DESCRIPTION,        // char*  - node description
-    D_TEST_METADATA_DEPENDENCIES,       // char** - array of dependencies
+    D_TEST_METADATA_DEPENDENCIES,       // char** - NULL-terminated module names
     D_TEST_METADATA_FRAMEWORK_NAME,     // char*  - name of framework
     D_TEST_METADATA_MODULE_NAME,        // char*  - name of module
     D_TEST_METADATA_SUBMODULE_NAME,     // char*  - name of submodule
@@ -225,6 +237,14 @@ enum DTestEvent
     (D_TEST_MSG_COUNT_ALL |                     \
      D_TEST_MSG_PRINT_ALL)
 
+// D_TEST_MSG_IS_COUNT_ONLY
+//   macro: true when `flags` ask for counters but no printed messages.  A
+// session with such flags runs in count-only mode, which only changes how
+// D_TEST_SESSION_CHECK records a pass; tree-built assertions are unaffected.
+#define D_TEST_MSG_IS_COUNT_ONLY(flags)                 \
+    ( (((flags) & D_TEST_MSG_COUNT_ALL) != 0) &&        \
+      (((flags) & D_TEST_MSG_PRINT_ALL) == 0) )
+
 
 /******************************************************************************
  * CATEGORY-SPECIFIC MESSAGE COMBINATIONS
@@ -481,12 +501,40 @@ enum DTestEvent
 
 // d_test_config
 //   struct: configuration settings for individual customizations of 
-// `d_test_element`s.
+// `d_test_element`s.  DTestConfigKey values and stage hooks live in fixed
+// slots indexed by their enum, so the struct is self-contained and copies
+// with a single memcpy; `settings` holds only metadata and other non-config
+// keys and is not allocated until one is set.
+//   Configs are reference counted and copy-on-write: presets and copies share
+// one object, and the d_test_config_set_* functions (which take the holder's
+// pointer by address) give the writer a private copy while it is shared.
+// Reference counts are not atomic; share configs while building the tree,
+// not from concurrently running tests.
 struct d_test_config
 {
-    uint32_t               flags;        // packed message and settings flags
-    struct d_min_enum_map* settings;     // key-value configuration map
-    struct d_min_enum_map* stage_hooks;  // stage hooks
+    size_t                 ref_count;                          // holders sharing this config
+    uint32_t               flags;                              // packed message and settings flags
+    uint32_t               present;                            // bit per DTestConfigKey slot that is set
+    void*                  values[D_TEST_CONFIG_KEY_COUNT];    // overrides, indexed by DTestConfigKey
+    fn_stage               stage_hooks[D_TEST_STAGE_COUNT];    // stage hooks, indexed by DTestStage
+    struct d_min_enum_map* settings;                           // metadata/other keys; NULL until used
+};
+
+// d_test_resolved_config
+//   struct: immutable snapshot of the settings a node runs with.  Built once
+// per node by d_test_config_resolve and passed to children by pointer, so
+// reads during a run are field loads rather than map and registry lookups.
+struct d_test_resolved_config
+{
+    const struct d_test_config* source;            // config it was taken from
+    size_t                      timeout_ms;        // D_TEST_CONFIG_TIMEOUT_MS
+    size_t                      max_failures;      // D_TEST_CONFIG_MAX_FAILURES
+    uint32_t                    message_flags;     // D_TEST_CONFIG_MESSAGE_FLAGS
+    int32_t                     priority;          // D_TEST_CONFIG_PRIORITY
+    const char*                 indent_str;        // D_TEST_CONFIG_INDENT_STR
+    uint16_t                    indent_max_level;  // D_TEST_CONFIG_INDENT_MAX_LEVEL
+    bool                        enabled;           // D_TEST_CONFIG_ENABLED
+    bool                        skip;              // D_TEST_CONFIG_SKIP
 };
 
 
@@ -494,10 +542,13 @@ struct d_test_config
  * FUNCTION DECLARATIONS
  *****************************************************************************/
 
+struct d_test_registry_row;
+
 // creation/destruction
 struct d_test_config* d_test_config_new(uint32_t _flags);
 struct d_test_config* d_test_config_new_preset(uint32_t _preset);
 struct d_test_config* d_test_config_new_copy(const struct d_test_config* _other);
+bool                  d_test_config_unshare(struct d_test_config** _config);
 
 // config value accessors
 bool        d_test_config_get_bool(const struct d_test_config* _config, uint32_t _key);
@@ -507,13 +558,28 @@ uint32_t    d_test_config_get_uint32(const struct d_test_config* _config, uint32
 const char* d_test_config_get_string(const struct d_test_config* _config, uint32_t _key);
 void*       d_test_config_get_ptr(const struct d_test_config* _config, uint32_t _key);
 
-// config value setters
-bool d_test_config_set_bool(struct d_test_config* _config, uint32_t _key, bool _value);
-bool d_test_config_set_size_t(struct d_test_config* _config, uint32_t _key, size_t _value);
-bool d_test_config_set_int32(struct d_test_config* _config, uint32_t _key, int32_t _value);
-bool d_test_config_set_uint32(struct d_test_config* _config, uint32_t _key, uint32_t _value);
-bool d_test_config_set_string(struct d_test_config* _config, uint32_t _key, const char* _value);
-bool d_test_config_set_ptr(struct d_test_config* _config, uint32_t _key, void* _value);
+// config value setters (copy-on-write: may replace *_config)
+bool d_test_config_set_bool(struct d_test_config** _config, uint32_t _key, bool _value);
+bool d_test_config_set_size_t(struct d_test_config** _config, uint32_t _key, size_t _value);
+bool d_test_config_set_int32(struct d_test_config** _config, uint32_t _key, int32_t _value);
+bool d_test_config_set_uint32(struct d_test_config** _config, uint32_t _key, uint32_t _value);
+bool d_test_config_set_string(struct d_test_config** _config, uint32_t _key, const char* _value);
+bool d_test_config_set_ptr(struct d_test_config** _config, uint32_t _key, void* _value);
+
+// registry-keyed entries (config slots or the settings map)
+bool d_test_config_put(struct d_test_config** _config, const struct d_test_registry_row* _row, void* _value);
+
+// stage hooks
+bool     d_test_config_set_stage_hook(struct d_test_config** _config, enum DTestStage _stage, fn_stage _hook);
+fn_stage d_test_config_get_stage_hook(const struct d_test_config* _config, enum DTestStage _stage);
+
+// resolved snapshots
+void d_test_config_resolve(struct d_test_resolved_config* _resolved,
+                           const struct d_test_config*    _config);
+const struct d_test_resolved_config* d_test_config_resolve_inherited(
+                                         struct d_test_resolved_config*       _storage,
+                                         const struct d_test_resolved_config* _parent,
+                                         const struct d_test_config*          _own);
 
 // key lookup from string
 enum DTestConfigKey d_test_config_key_from_string(const char* _key);
@@ -92,6 +92,8 @@ struct d_registry* d_test_registry_registry(void);
 // row access
 struct d_test_registry_row* d_test_registry_find(const char* _key);
 struct d_test_registry_row* d_test_registry_find_by_flag(uint32_t _flag);
+struct d_test_registry_row* d_test_registry_find_config(uint32_t _flag);
+struct d_test_registry_row* d_test_registry_find_metadata(uint32_t _flag);
 
 // value access
 bool               d_test_registry_set(uint32_t _flag, union d_test_value _value);
@@ -113,7 +113,7 @@ struct d_test_module_result
 //   struct: a module containing related test blocks.
 struct d_test_module
 {
-    struct d_ptr_vector*         children;
+    struct d_test_children       children;        // child blocks, stored inline
     struct d_test_config*        config;          // module-level configuration
     struct d_test_module_result* result;          // results from last run
     enum DTestModuleStatus       status;          // current status
@@ -138,8 +138,8 @@ struct d_test_config* d_test_module_validate_args(struct d_test_arg* _args,
  * CHILD MANAGEMENT FUNCTIONS
  *****************************************************************************/
 
-bool                d_test_module_add_child(struct d_test_module*          _module,
-                                            const struct d_test_tree_node* _child);
+bool                d_test_module_add_child(struct d_test_module*     _module,
+                                            const struct d_test_type* _child);
 size_t              d_test_module_child_count(const struct d_test_module* _module);
 struct d_test_type* d_test_module_get_child_at(const struct d_test_module* _module,
                                                size_t                      _index);
@@ -154,7 +154,9 @@ struct d_test_config* d_test_module_get_effective_settings(
                           struct d_test_config*       _parent_settings,
                           struct d_min_enum_map*      _node_config);
 
-const char* d_test_module_get_name(const struct d_test_module* _module);
+const char*        d_test_module_get_name(const struct d_test_module* _module);
+const char* const* d_test_module_get_dependencies(const struct d_test_module* _module);
+size_t             d_test_module_dependency_count(const struct d_test_module* _module);
 
 
 /******************************************************************************
@@ -174,6 +176,8 @@ fn_stage d_test_module_get_stage_hook(const struct d_test_module* _module,
 
 bool d_test_module_run(struct d_test_module* _module,
                        struct d_test_config* _parent_settings);
+bool d_test_module_run_resolved(struct d_test_module*                _module,
+                                const struct d_test_resolved_config* _parent);
 bool d_test_module_run_child(struct d_test_module* _module,
                              size_t                _child_index,
                              struct d_test_config* _parent_settings);
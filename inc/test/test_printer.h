@@ -14,6 +14,7 @@
 #define	DJINTERP_TEST_PRINTER_ 1
 
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include "..\djinterp.h"
 #include "..\dmemory.h"
@@ -46,6 +47,23 @@
 //   constant: initial buffer size for string generation
 #define D_TEST_PRINT_INITIAL_BUFFER_SIZE 4096
 
+// D_TEST_PRINT_COPY_CHUNK_SIZE
+//   constant: buffer size for user-space file copies (prepend fallback)
+#define D_TEST_PRINT_COPY_CHUNK_SIZE     65536
+
+// D_TEST_PRINT_KERNEL_COPY_SIZE
+//   constant: maximum bytes requested per in-kernel copy call
+#define D_TEST_PRINT_KERNEL_COPY_SIZE    0x40000000
+
+// D_TEST_PRINT_TEMP_SUFFIX
+//   constant: suffix (mkstemp template) for temporary files used by prepend
+#define D_TEST_PRINT_TEMP_SUFFIX         ".XXXXXX"
+
+// D_TEST_PRINT_TEMP_ATTEMPTS
+//   constant: temporary file names tried before a prepend gives up (Windows,
+// where the name is chosen separately from the exclusive create)
+#define D_TEST_PRINT_TEMP_ATTEMPTS       16
+
 //=============================================================================
 // PRINT STYLE FLAGS
 //=============================================================================
@@ -95,6 +113,20 @@ bool                         d_test_string_buffer_append_format(struct d_test_st
 char*                        d_test_string_buffer_finalize(struct d_test_string_buffer* _buffer);
 void                         d_test_string_buffer_free(struct d_test_string_buffer* _buffer);
 
+// Caller-owned buffer functions (storage is reused across render calls)
+bool                         d_test_string_buffer_init(struct d_test_string_buffer* _buffer,
+                                                       size_t _initial_capacity);
+bool                         d_test_string_buffer_reserve(struct d_test_string_buffer* _buffer,
+                                                          size_t _additional);
+void                         d_test_string_buffer_clear(struct d_test_string_buffer* _buffer);
+bool                         d_test_string_buffer_flush(struct d_test_string_buffer* _buffer,
+                                                        FILE* _file);
+void                         d_test_string_buffer_release(struct d_test_string_buffer* _buffer);
+
+// Per-thread scratch buffer behind the stdout printers
+void                         d_test_print_scratch_release(void);
+size_t                       d_test_print_scratch_capacity(void);
+
 //=============================================================================
 // FRAMEWORK HEADER FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -121,6 +153,21 @@ char* d_test_print_framework_header_custom_to_string(const char* _framework_name
                                                      const char* _platform);
 char* d_test_print_testing_approach_to_string(void);
 
+//=============================================================================
+// FRAMEWORK HEADER FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_framework_header_to_buffer(struct d_test_string_buffer* _buffer,
+                                             const char* _framework_name,
+                                             const char* _framework_desc);
+bool d_test_print_framework_header_custom_to_buffer(struct d_test_string_buffer* _buffer,
+                                                    const char* _framework_name,
+                                                    const char* _framework_desc,
+                                                    const char* _version,
+                                                    const char* _test_framework,
+                                                    const char* _platform);
+bool d_test_print_testing_approach_to_buffer(struct d_test_string_buffer* _buffer);
+
 //=============================================================================
 // MODULE HEADER FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -143,6 +190,19 @@ char* d_test_print_module_header_detailed_to_string(const char* _module_name,
                                                      const char* _file_path,
                                                      size_t      _test_count);
 
+//=============================================================================
+// MODULE HEADER FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_module_header_to_buffer(struct d_test_string_buffer* _buffer,
+                                          const char* _module_name,
+                                          const char* _description);
+bool d_test_print_module_header_detailed_to_buffer(struct d_test_string_buffer* _buffer,
+                                                   const char* _module_name,
+                                                   const char* _description,
+                                                   const char* _file_path,
+                                                   size_t      _test_count);
+
 //=============================================================================
 // PROGRESS AND STATUS FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -159,6 +219,19 @@ char* d_test_print_test_start_to_string(const char* _test_name);
 char* d_test_print_test_result_to_string(const char* _test_name, bool _passed);
 char* d_test_print_progress_to_string(size_t _current, size_t _total);
 
+//=============================================================================
+// PROGRESS AND STATUS FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_test_start_to_buffer(struct d_test_string_buffer* _buffer,
+                                       const char* _test_name);
+bool d_test_print_test_result_to_buffer(struct d_test_string_buffer* _buffer,
+                                        const char* _test_name,
+                                        bool        _passed);
+bool d_test_print_progress_to_buffer(struct d_test_string_buffer* _buffer,
+                                     size_t _current,
+                                     size_t _total);
+
 //=============================================================================
 // RESULT SUMMARY FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -183,6 +256,20 @@ char* d_test_print_comprehensive_results_to_string(const struct d_test_counter*
                                                     size_t _modules_tested,
                                                     size_t _modules_passed);
 
+//=============================================================================
+// RESULT SUMMARY FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_module_results_to_buffer(struct d_test_string_buffer* _buffer,
+                                           const char* _module_name,
+                                           const struct d_test_counter* _module_counter,
+                                           bool                         _module_result);
+bool d_test_print_comprehensive_results_to_buffer(struct d_test_string_buffer* _buffer,
+                                                  const struct d_test_counter* _overall_counter,
+                                                  bool   _overall_result,
+                                                  size_t _modules_tested,
+                                                  size_t _modules_passed);
+
 //=============================================================================
 // STATISTICS AND ANALYSIS FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -197,6 +284,17 @@ void d_test_print_success_rate(size_t _passed, size_t _total, const char* _item_
 char* d_test_print_statistics_table_to_string(const struct d_test_counter* _counter);
 char* d_test_print_success_rate_to_string(size_t _passed, size_t _total, const char* _item_name);
 
+//=============================================================================
+// STATISTICS AND ANALYSIS FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_statistics_table_to_buffer(struct d_test_string_buffer* _buffer,
+                                             const struct d_test_counter* _counter);
+bool d_test_print_success_rate_to_buffer(struct d_test_string_buffer* _buffer,
+                                         size_t _passed,
+                                         size_t _total,
+                                         const char* _item_name);
+
 //=============================================================================
 // SEPARATOR AND FORMATTING FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -213,6 +311,18 @@ char* d_test_print_separator_to_string(char _char, size_t _width);
 char* d_test_print_section_header_to_string(const char* _title);
 char* d_test_print_subsection_header_to_string(const char* _title);
 
+//=============================================================================
+// SEPARATOR AND FORMATTING FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_separator_to_buffer(struct d_test_string_buffer* _buffer,
+                                      char   _char,
+                                      size_t _width);
+bool d_test_print_section_header_to_buffer(struct d_test_string_buffer* _buffer,
+                                           const char* _title);
+bool d_test_print_subsection_header_to_buffer(struct d_test_string_buffer* _buffer,
+                                              const char* _title);
+
 //=============================================================================
 // INFORMATION AND NOTES FUNCTIONS - PRINT TO STDOUT
 //=============================================================================
@@ -237,6 +347,22 @@ char* d_test_print_info_line_to_string(const char* _message);
 char* d_test_print_warning_line_to_string(const char* _message);
 char* d_test_print_error_line_to_string(const char* _message);
 
+//=============================================================================
+// INFORMATION AND NOTES FUNCTIONS - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_implementation_notes_to_buffer(struct d_test_string_buffer* _buffer);
+bool d_test_print_custom_notes_to_buffer(struct d_test_string_buffer* _buffer,
+                                         const char*  _title,
+                                         size_t       _note_count,
+                                         const char** _notes);
+bool d_test_print_info_line_to_buffer(struct d_test_string_buffer* _buffer,
+                                      const char* _message);
+bool d_test_print_warning_line_to_buffer(struct d_test_string_buffer* _buffer,
+                                         const char* _message);
+bool d_test_print_error_line_to_buffer(struct d_test_string_buffer* _buffer,
+                                       const char* _message);
+
 //=============================================================================
 // SUMMARY AND FINAL MESSAGES - PRINT TO STDOUT
 //=============================================================================
@@ -251,6 +377,16 @@ void d_test_print_recommendations(bool _overall_result);
 char* d_test_print_final_summary_to_string(bool _passed, const char* _framework_name);
 char* d_test_print_recommendations_to_string(bool _overall_result);
 
+//=============================================================================
+// SUMMARY AND FINAL MESSAGES - RENDER TO CALLER BUFFER
+//=============================================================================
+
+bool d_test_print_final_summary_to_buffer(struct d_test_string_buffer* _buffer,
+                                          bool        _passed,
+                                          const char* _framework_name);
+bool d_test_print_recommendations_to_buffer(struct d_test_string_buffer* _buffer,
+                                            bool _overall_result);
+
 //=============================================================================
 // FILE I/O FUNCTIONS
 //=============================================================================
@@ -266,7 +402,7 @@ bool d_test_append_to_file(const char* _filename,
                            const char* _content);
 
 // d_test_prepend_to_file
-//   Prepend string to beginning of file
+//   Prepend string to beginning of file (via temp file and atomic rename)
 bool d_test_prepend_to_file(const char* _filename, 
                             const char* _content);
 
@@ -289,8 +425,28 @@ char* d_test_generate_full_report_to_string(const char* _framework_name,
                                             size_t _modules_tested,
                                             size_t _modules_passed);
 
+// d_test_generate_full_report_to_buffer
+//   Append a complete test report to a caller-owned buffer
+bool d_test_generate_full_report_to_buffer(struct d_test_string_buffer* _buffer,
+                                           const char* _framework_name,
+                                           const char* _framework_desc,
+                                           const struct d_test_counter* _overall_counter,
+                                           bool _overall_result,
+                                           size_t _modules_tested,
+                                           size_t _modules_passed);
+
+// d_test_generate_full_report_to_stream
+//   Write a complete test report to an open stream, one section at a time
+bool d_test_generate_full_report_to_stream(FILE*       _file,
+                                           const char* _framework_name,
+                                           const char* _framework_desc,
+                                           const struct d_test_counter* _overall_counter,
+                                           bool _overall_result,
+                                           size_t _modules_tested,
+                                           size_t _modules_passed);
+
 // d_test_generate_full_report_to_file
-//   Generate a complete test report and write to file
+//   Generate a complete test report and write to file (streamed per section)
 bool d_test_generate_full_report_to_file(const char*  _filename,
                                          const char* _framework_name,
                                          const char* _framework_desc,
@@ -0,0 +1,263 @@
+/******************************************************************************
+* djinterp [test]                                              test_property.h
+*
+*   Property-based tests: a property is a predicate over generated inputs.
+*   A d_test_property node runs the predicate against `case_count` inputs
+* drawn from a typed generator and a seeded PRNG; on failure the input is
+* shrunk to a minimal counterexample.
+*
+*   Every generated value is a pure function of a sequence of "choices"
+* (bounded draws).  Cases are seeded from (seed, case index), and shrinking
+* edits the failing choice sequence - deleting, zeroing and lowering draws -
+* then rebuilds the value, so ints, byte buffers, strings and composite
+* structs all shrink the same way.
+*
+*   With `workers` > 1 the cases, and each round of shrink candidates, are
+* split across forked worker processes (POSIX only; elsewhere they run
+* in-process).  The result is the lowest failing case / candidate index, so
+* the reported counterexample does not depend on the worker count.  An
+* input that crashes a worker counts as a failure, and the property is never
+* rerun in the calling process.
+*
+*
+* path:      \inc\test\test_property.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TEST_PROPERTY_
+#define DJINTERP_TEST_PROPERTY_ 1
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "..\djinterp.h"
+#include ".\test_common.h"
+
+
+/******************************************************************************
+ * DEFAULT VALUES
+ *****************************************************************************/
+
+// D_TEST_PROPERTY_DEFAULT_CASES
+//   constant: number of generated cases per run.
+#define D_TEST_PROPERTY_DEFAULT_CASES        100
+
+// D_TEST_PROPERTY_DEFAULT_SEED
+//   constant: seed used until one is set, so runs are reproducible.
+#define D_TEST_PROPERTY_DEFAULT_SEED         0x9E3779B97F4A7C15ULL
+
+// D_TEST_PROPERTY_DEFAULT_MAX_SHRINKS
+//   constant: maximum accepted shrink steps per failure.
+#define D_TEST_PROPERTY_DEFAULT_MAX_SHRINKS  1000
+
+// D_TEST_PROPERTY_DEFAULT_WORKERS
+//   constant: worker processes; 0 or 1 runs in-process.
+#define D_TEST_PROPERTY_DEFAULT_WORKERS      0
+
+// D_TEST_PROPERTY_DEFAULT_TIMEOUT_MS
+//   constant: milliseconds a worker may spend on one case before it is
+// killed and the case counts as failed; matches D_TEST_DEFAULT_TIMEOUT.
+#define D_TEST_PROPERTY_DEFAULT_TIMEOUT_MS   1000
+
+// D_TEST_GEN_DEFAULT_ALPHABET
+//   constant: characters drawn by string generators without an alphabet
+// (printable ASCII, ordered so shrinking tends toward "a", "0" and " ").
+#define D_TEST_GEN_DEFAULT_ALPHABET                                          \
+    "a0 bcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ123456789"         \
+    "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"
+
+
+/******************************************************************************
+ * PRNG
+ *****************************************************************************/
+
+// d_test_prng
+//   struct: xoshiro256** generator state, seeded through splitmix64.
+struct d_test_prng
+{
+    uint64_t state[4];
+};
+
+void     d_test_prng_seed(struct d_test_prng* _prng,
+                          uint64_t            _seed);
+uint64_t d_test_prng_next(struct d_test_prng* _prng);
+uint64_t d_test_prng_below(struct d_test_prng* _prng,
+                           uint64_t            _bound);
+
+
+/******************************************************************************
+ * GENERATORS
+ *****************************************************************************/
+
+// DTestGenType
+//   enum: kind of value a d_test_gen produces.
+enum DTestGenType
+{
+    D_TEST_GEN_TYPE_INT    = 0,   // signed integer of `size` bytes
+    D_TEST_GEN_TYPE_UINT   = 1,   // unsigned integer of `size` bytes
+    D_TEST_GEN_TYPE_BYTES  = 2,   // struct d_test_bytes
+    D_TEST_GEN_TYPE_STRING = 3,   // const char* (NUL-terminated)
+    D_TEST_GEN_TYPE_STRUCT = 4    // caller struct filled field by field
+};
+
+// d_test_bytes
+//   struct: value produced by a D_TEST_GEN_BYTES generator.  `data` stays
+// valid until the property returns.
+struct d_test_bytes
+{
+    const unsigned char* data;
+    size_t               length;
+};
+
+struct d_test_gen;
+
+// d_test_gen_field
+//   struct: one member of a D_TEST_GEN_STRUCT generator.
+struct d_test_gen_field
+{
+    const char*              name;     // member name, used when printing
+    size_t                   offset;   // offsetof the member
+    const struct d_test_gen* gen;      // generator for the member
+};
+
+// d_test_gen
+//   struct: typed value generator.  Generators are plain data and are
+// normally defined as static constants with the D_TEST_GEN_* macros.
+struct d_test_gen
+{
+    enum DTestGenType type;
+    size_t            size;            // bytes written for the value
+
+    union
+    {
+        struct
+        {
+            int64_t  min;
+            int64_t  max;
+        } int_range;
+
+        struct
+        {
+            uint64_t min;
+            uint64_t max;
+        } uint_range;
+
+        struct
+        {
+            size_t      min_length;
+            size_t      max_length;
+            const char* alphabet;      // strings only; NULL for the default
+        } sequence;
+
+        struct
+        {
+            const struct d_test_gen_field* fields;
+            size_t                         count;
+        } composite;
+    };
+};
+
+// D_TEST_GEN_INT
+//   macro: initializer for a signed integer generator writing `value_type`
+// values in [min, max].  Shrinks toward the value in range nearest zero.
+#define D_TEST_GEN_INT(value_type, min_value, max_value)                     \
+    { .type      = D_TEST_GEN_TYPE_INT,                                      \
+      .size      = sizeof(value_type),                                       \
+      .int_range = { (int64_t)(min_value), (int64_t)(max_value) } }
+
+// D_TEST_GEN_UINT
+//   macro: initializer for an unsigned integer generator writing `value_type`
+// values in [min, max].  Shrinks toward `min`.
+#define D_TEST_GEN_UINT(value_type, min_value, max_value)                    \
+    { .type       = D_TEST_GEN_TYPE_UINT,                                    \
+      .size       = sizeof(value_type),                                      \
+      .uint_range = { (uint64_t)(min_value), (uint64_t)(max_value) } }
+
+// D_TEST_GEN_BYTES
+//   macro: initializer for a byte buffer generator (struct d_test_bytes).
+#define D_TEST_GEN_BYTES(min_length, max_length)                             \
+    { .type     = D_TEST_GEN_TYPE_BYTES,                                     \
+      .size     = sizeof(struct d_test_bytes),                               \
+      .sequence = { (min_length), (max_length), NULL } }
+
+// D_TEST_GEN_STRING
+//   macro: initializer for a string generator (const char*) drawing from
+// `alphabet`, or D_TEST_GEN_DEFAULT_ALPHABET when it is NULL.
+#define D_TEST_GEN_STRING(min_length, max_length, alphabet)                  \
+    { .type     = D_TEST_GEN_TYPE_STRING,                                    \
+      .size     = sizeof(const char*),                                       \
+      .sequence = { (min_length), (max_length), (alphabet) } }
+
+// D_TEST_GEN_FIELD
+//   macro: initializer for a d_test_gen_field of `member` in `value_type`.
+#define D_TEST_GEN_FIELD(value_type, member, gen_ptr)                        \
+    { #member, offsetof(value_type, member), (gen_ptr) }
+
+// D_TEST_GEN_STRUCT
+//   macro: initializer for a generator filling a `value_type` from an array
+// of d_test_gen_field.
+#define D_TEST_GEN_STRUCT(value_type, field_array)                           \
+    { .type      = D_TEST_GEN_TYPE_STRUCT,                                   \
+      .size      = sizeof(value_type),                                       \
+      .composite = { (field_array),                                          \
+                     sizeof(field_array) / sizeof((field_array)[0]) } }
+
+size_t d_test_gen_max_choices(const struct d_test_gen* _gen);
+size_t d_test_gen_arena_size(const struct d_test_gen* _gen);
+size_t d_test_gen_format(const struct d_test_gen* _gen,
+                         const void*              _value,
+                         char*                    _buffer,
+                         size_t                   _size);
+
+
+/******************************************************************************
+ * PROPERTY NODE
+ *****************************************************************************/
+
+// fn_test_property
+//   function pointer: property over one generated input; returns true when
+// the property holds.
+typedef bool (*fn_test_property)(const void* _input,
+                                 void*       _context);
+
+// d_test_property
+//   struct: property-based test node (D_TEST_TYPE_PROPERTY).  The settings
+// may be changed between runs; the result fields describe the last run.
+struct d_test_property
+{
+    // settings
+    fn_test_property         property;        // predicate under test
+    void*                    context;         // passed to every call
+    const struct d_test_gen* generator;       // input generator
+    size_t                   case_count;      // cases per run
+    uint64_t                 seed;            // base seed
+    size_t                   workers;         // worker processes
+    size_t                   max_shrinks;     // shrink step limit
+    size_t                   timeout_ms;      // per-case worker limit (0 = none)
+
+    // results
+    bool                     falsified;       // a case failed
+    size_t                   failing_case;    // index of the first failure
+    size_t                   shrink_steps;    // accepted shrink steps
+    size_t                   choice_count;    // length of `choices`
+    uint64_t*                choices;         // shrunk choice sequence
+    void*                    counterexample;  // value built from `choices`
+    unsigned char*           arena;           // storage for its buffers
+};
+
+struct d_test_property* d_test_property_new(fn_test_property         _property,
+                                            const struct d_test_gen* _generator,
+                                            void*                    _context);
+bool        d_test_property_run(struct d_test_property* _property);
+const void* d_test_property_counterexample(const struct d_test_property* _property);
+size_t      d_test_property_format(const struct d_test_property* _property,
+                                   char*                         _buffer,
+                                   size_t                        _size);
+size_t      d_test_property_describe(const struct d_test_property* _property,
+                                     char*                         _buffer,
+                                     size_t                        _size);
+void        d_test_property_free(struct d_test_property* _property);
+
+
+#endif  // DJINTERP_TEST_PROPERTY_
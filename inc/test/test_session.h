@@ -39,6 +39,7 @@
 #include ".\test_config.h"
 #include ".\test_stats.h"
 #include ".\test_module.h"
+#include ".\test_property.h"
 
 
 /******************************************************************************
@@ -96,6 +97,24 @@
     (struct d_test_type*[]){ __VA_ARGS__ }
 
 
+/******************************************************************************
+ * D_TEST_SESSION_CHECK MACRO
+ *****************************************************************************/
+
+// D_TEST_SESSION_CHECK
+//   macro: checks `condition` against the session running on this thread and
+// evaluates to the result.  In count-only sessions a pass is a counter
+// increment, and in other sessions it is at most one printed line; only
+// failures are materialized as a d_assert, by the out-of-line recorder.
+//   Count-only mode applies to this macro alone: D_ASSERTION_* and D_ASSERT_*
+// build their d_assert when the test tree is constructed, before any session
+// runs, so they always allocate and are never reduced to a counter.
+#define D_TEST_SESSION_CHECK(condition)                                      \
+    ( D_ASSERT_LIKELY(condition)                                             \
+        ? d_test_session_check_pass(__FILE__, __LINE__, #condition)          \
+        : d_test_session_check_fail(__FILE__, __LINE__, #condition) )
+
+
 /******************************************************************************
  * SESSION STATUS
  *****************************************************************************/
@@ -241,7 +260,10 @@ struct d_test_session
     size_t                      current_index;  // current test index
     size_t                      failure_count;  // failures so far
     size_t                      repeat_current; // current repeat iteration
-    
+    uint32_t                    message_flags;  // resolved DTestMessageFlag
+    bool                        count_only;     // passes counted, not built
+    struct d_ptr_vector*        failures;       // failed d_assert records
+
     // timing
     double                      start_time_ms;  // session start time
     double                      end_time_ms;    // session end time
@@ -313,6 +335,27 @@ bool d_test_session_abort(struct d_test_session* _session);
 bool d_test_session_reset(struct d_test_session* _session);
 
 
+/******************************************************************************
+ * ASSERTION RECORDING FUNCTIONS
+ *****************************************************************************/
+
+struct d_test_session* d_test_session_active(void);
+bool d_test_session_is_count_only(const struct d_test_session* _session);
+
+bool d_test_session_check_pass(const char* _file,
+                               int         _line,
+                               const char* _expression);
+D_ASSERT_COLD bool d_test_session_check_fail(const char* _file,
+                                             int         _line,
+                                             const char* _expression);
+D_ASSERT_COLD bool d_test_session_record_fail(struct d_assert* _assertion);
+D_ASSERT_COLD void d_test_session_report_property(const struct d_test_property* _property);
+
+size_t d_test_session_failure_record_count(const struct d_test_session* _session);
+const struct d_assert* d_test_session_get_failure_at(const struct d_test_session* _session,
+                                                     size_t                       _index);
+
+
 /******************************************************************************
  * OUTPUT FUNCTIONS
  *****************************************************************************/
@@ -15,6 +15,7 @@
 #define DJINTERP_TEST_STANDALONE_ 1
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include "..\djinterp.h"
@@ -63,6 +64,44 @@
           (strcmp(_str1, _str2) == 0)) )
 
 
+/******************************************************************************
+ * STREAMING ASSERTION MACROS
+ *****************************************************************************/
+
+// D_STREAM_ASSERT_TRUE
+//   macro: emits a leaf event asserting that a condition is true.
+#define D_STREAM_ASSERT_TRUE(_stream, _name, _condition, _message)          \
+    d_test_stream_leaf(_stream, _name, _message, (_condition))
+
+// D_STREAM_ASSERT_FALSE
+//   macro: emits a leaf event asserting that a condition is false.
+#define D_STREAM_ASSERT_FALSE(_stream, _name, _condition, _message)         \
+    d_test_stream_leaf(_stream, _name, _message, !(_condition))
+
+// D_STREAM_ASSERT_NULL
+//   macro: emits a leaf event asserting that a pointer is NULL.
+#define D_STREAM_ASSERT_NULL(_stream, _name, _ptr, _message)                \
+    d_test_stream_leaf(_stream, _name, _message, (_ptr) == NULL)
+
+// D_STREAM_ASSERT_NOT_NULL
+//   macro: emits a leaf event asserting that a pointer is not NULL.
+#define D_STREAM_ASSERT_NOT_NULL(_stream, _name, _ptr, _message)            \
+    d_test_stream_leaf(_stream, _name, _message, (_ptr) != NULL)
+
+// D_STREAM_ASSERT_EQUAL
+//   macro: emits a leaf event asserting two values are equal.
+#define D_STREAM_ASSERT_EQUAL(_stream, _name, _val1, _val2, _message)       \
+    d_test_stream_leaf(_stream, _name, _message, (_val1) == (_val2))
+
+// D_STREAM_ASSERT_STR_EQUAL
+//   macro: emits a leaf event asserting two strings are equal.
+#define D_STREAM_ASSERT_STR_EQUAL(_stream, _name, _str1, _str2, _message)   \
+    d_test_stream_leaf(_stream, _name, _message,                            \
+        ( (_str1) &&                                                        \
+          (_str2) &&                                                        \
+          (strcmp(_str1, _str2) == 0)) )
+
+
 /******************************************************************************
  * TEST OBJECT CONSTANTS
  *****************************************************************************/
@@ -93,6 +132,15 @@
 //   constant: maximum number of modules that can be registered in a runner.
 #define D_TEST_SA_MAX_MODULES 64
 
+// D_TEST_OBJECT_POOL_CHUNK_SIZE
+//   constant: bytes per chunk in a d_test_object_pool; larger requests get a
+// chunk of their own.
+#define D_TEST_OBJECT_POOL_CHUNK_SIZE 65536
+
+// D_TEST_STREAM_MAX_DEPTH
+//   constant: maximum nesting of open groups tracked by a d_test_stream.
+#define D_TEST_STREAM_MAX_DEPTH 32
+
 
 /******************************************************************************
  * TEST COUNTER
@@ -122,6 +170,7 @@ struct d_test_object
     const char*             name;       // test/assertion name
     const char*             message;    // result message
     bool                    result;     // pass/fail (for leaves)
+    bool                    pooled;     // owned by a d_test_object_pool
     
     struct d_test_arg_list* args;       // optional arguments
     size_t                  count;      // number of children
@@ -129,6 +178,27 @@ struct d_test_object
 };
 
 
+// d_test_object_pool_chunk
+//   struct: header of one block of pool memory; objects follow it.
+struct d_test_object_pool_chunk
+{
+    struct d_test_object_pool_chunk* next;       // previously filled chunk
+    size_t                           used;       // bytes handed out
+    size_t                           capacity;   // usable bytes
+};
+
+// d_test_object_pool
+//   struct: bump allocator for d_test_object nodes and their element arrays.
+// while a pool is active (see d_test_object_pool_begin), the object
+// constructors allocate from it, and d_test_object_pool_release frees every
+// object it holds at once.
+struct d_test_object_pool
+{
+    struct d_test_object_pool_chunk* chunks;         // newest chunk first
+    size_t                           object_count;   // objects allocated
+};
+
+
 /******************************************************************************
  * MODULE RESULTS STRUCTURES
  *****************************************************************************/
@@ -141,7 +211,8 @@ struct d_test_sa_module_results
     const char*            description;    // module description
     struct d_test_counter  counter;        // assertion/test counters
     bool                   passed;         // overall pass/fail
-    double                 elapsed_time;   // execution time in seconds
+    double                 elapsed_time;   // wall-clock time in seconds
+    double                 cpu_time;       // thread CPU time in seconds
 };
 
 // d_test_sa_suite_results
@@ -152,7 +223,17 @@ struct d_test_sa_suite_results
     size_t                           modules_passed;
     struct d_test_counter            totals;        // aggregated counters
     struct d_test_sa_module_results* modules;       // array of module results
-    double                           total_time;    // total execution time
+    double                           total_time;    // wall-clock seconds
+    double                           cpu_time;      // CPU seconds (modules)
+};
+
+// d_test_sa_timing
+//   struct: wall-clock and CPU time measured over the same span. the
+// difference is time spent off-CPU (blocked on I/O, sleeping, preempted).
+struct d_test_sa_timing
+{
+    double wall_time;   // monotonic wall-clock seconds
+    double cpu_time;    // calling thread's CPU seconds
 };
 
 
@@ -178,6 +259,95 @@ struct d_test_sa_note_section
 };
 
 
+/******************************************************************************
+ * COMPILED TEMPLATE STRUCTURES
+ *****************************************************************************/
+
+// d_test_template_segment
+//   struct: one piece of a compiled template; either a run of literal text or
+// a slot that is filled from the value at `key_index` when rendered.
+struct d_test_template_segment
+{
+    bool        is_slot;      // slot (true) or literal text (false)
+    size_t      key_index;    // index into the render values (slots only)
+    const char* text;         // literal text, not null-terminated
+    size_t      length;       // literal length in bytes
+};
+
+// d_test_template
+//   struct: a template parsed once into literal and slot segments, with each
+// placeholder's key already resolved to an index. owns a copy of the template
+// text, so the source string need not outlive it.
+struct d_test_template
+{
+    size_t                          key_count;       // keys compiled against
+    size_t                          literal_length;  // total literal bytes
+    size_t                          segment_count;   // number of segments
+    struct d_test_template_segment* segments;        // segment array
+};
+
+
+/******************************************************************************
+ * STREAMING STRUCTURES
+ *****************************************************************************/
+
+// fn_test_stream_open
+//   function pointer: called when a group is opened at nesting `_depth`.
+typedef void (*fn_test_stream_open)(void*       _context,
+                                    const char* _name,
+                                    size_t      _depth);
+
+// fn_test_stream_leaf
+//   function pointer: called for each assertion as it is produced.
+typedef void (*fn_test_stream_leaf)(void*       _context,
+                                    const char* _name,
+                                    const char* _message,
+                                    bool        _result,
+                                    size_t      _depth);
+
+// fn_test_stream_close
+//   function pointer: called when a group is closed; `_passed` is true if
+// every assertion directly inside the group passed.  Groups nested deeper
+// than D_TEST_STREAM_MAX_DEPTH are closed with a NULL `_name`.
+typedef void (*fn_test_stream_close)(void*       _context,
+                                     const char* _name,
+                                     bool        _passed,
+                                     size_t      _depth);
+
+// d_test_stream_sink
+//   struct: receivers for stream events. any member may be NULL.
+struct d_test_stream_sink
+{
+    fn_test_stream_open  on_open;
+    fn_test_stream_leaf  on_leaf;
+    fn_test_stream_close on_close;
+    void*                context;     // passed to every callback
+};
+
+// d_test_stream_group
+//   struct: bookkeeping for one open group on a stream's stack.
+struct d_test_stream_group
+{
+    const char* name;
+    bool        passed;     // all direct leaves passed so far
+};
+
+// d_test_stream
+//   struct: event-based alternative to building a d_test_object tree. leaves
+// are counted and forwarded to the sink as they are produced and groups are
+// reported as open/close events, so memory use does not grow with the module.
+struct d_test_stream
+{
+    struct d_test_counter*      counter;    // counter updated by events
+    struct d_test_stream_sink   sink;       // event receivers
+    size_t                      depth;      // currently open groups
+    struct d_test_stream_group  groups[D_TEST_STREAM_MAX_DEPTH];
+    bool                        overflow_passed;  // untracked groups passed
+    const struct d_test_filter* filter;     // name filter (can be NULL)
+    const char*                 root;       // module name prefixed to paths
+};
+
+
 /******************************************************************************
  * TEST MODULE REGISTRATION STRUCTURE
  *****************************************************************************/
@@ -192,6 +362,11 @@ typedef struct d_test_object* (*fn_test_module)(void);
 // directly, returning pass/fail status.
 typedef bool (*fn_test_module_counter)(struct d_test_counter* _counter);
 
+// fn_test_module_stream
+//   function pointer: function that runs a test module by emitting events to
+// a d_test_stream, returning pass/fail status.
+typedef bool (*fn_test_module_stream)(struct d_test_stream* _stream);
+
 // d_test_sa_module_entry
 //   struct: registration entry for a test module.
 struct d_test_sa_module_entry
@@ -200,6 +375,7 @@ struct d_test_sa_module_entry
     const char*                       description;   // module description
     fn_test_module                    run_fn;        // test function (tree)
     fn_test_module_counter            run_counter;   // test function (counter)
+    fn_test_module_stream             run_stream;    // test function (stream)
     size_t                            note_count;    // implementation notes
     const struct d_test_sa_note_section* notes;      // note sections array
 };
@@ -221,6 +397,8 @@ struct d_test_sa_runner
     struct d_test_sa_suite_results results;          // aggregated results
     bool                          wait_for_input;    // pause before exit
     bool                          show_notes;        // display impl. notes
+    size_t                        parallel_jobs;     // concurrent modules
+    struct d_test_filter*         filter;            // module name filter
 };
 
 
@@ -257,6 +435,12 @@ void                  d_test_object_add_child(struct d_test_object* _parent,
                                               struct d_test_object* _child,
                                               size_t                _index);
 
+// I.a   test object pools
+void                       d_test_object_pool_init(struct d_test_object_pool* _pool);
+struct d_test_object_pool* d_test_object_pool_begin(struct d_test_object_pool* _pool);
+void                       d_test_object_pool_end(struct d_test_object_pool* _previous);
+void                       d_test_object_pool_release(struct d_test_object_pool* _pool);
+
 
 /******************************************************************************
  * TEST COUNTER FUNCTIONS
@@ -289,6 +473,43 @@ char* d_test_substitute_template(const char* _template,
                                  size_t      _kv_count,
                                  const char* _key_values[][2]);
 
+// IV.a compiled templates
+struct d_test_template* d_test_template_compile(const char*        _template,
+                                                const char*        _delimiters[2],
+                                                size_t             _key_count,
+                                                const char* const* _keys);
+size_t                  d_test_template_render_length(const struct d_test_template* _template,
+                                                      const char* const*            _values);
+size_t                  d_test_template_render(const struct d_test_template* _template,
+                                               const char* const*            _values,
+                                               char*                         _buffer,
+                                               size_t                        _buffer_size);
+char*                   d_test_template_render_to_string(const struct d_test_template* _template,
+                                                         const char* const*            _values);
+void                    d_test_template_free(struct d_test_template* _template);
+
+
+/******************************************************************************
+ * STREAMING FUNCTIONS
+ *****************************************************************************/
+
+// IV.b  streaming test events
+void d_test_stream_init(struct d_test_stream*            _stream,
+                        struct d_test_counter*           _counter,
+                        const struct d_test_stream_sink* _sink);
+void d_test_stream_open(struct d_test_stream* _stream,
+                        const char*           _name);
+bool d_test_stream_leaf(struct d_test_stream* _stream,
+                        const char*           _name,
+                        const char*           _message,
+                        bool                  _result);
+bool d_test_stream_close(struct d_test_stream* _stream);
+void d_test_stream_set_filter(struct d_test_stream*       _stream,
+                              const struct d_test_filter* _filter,
+                              const char*                 _root);
+bool d_test_stream_selects(const struct d_test_stream* _stream,
+                           const char*                 _name);
+
 
 /******************************************************************************
  * DEFAULT PRINT FUNCTIONS
@@ -335,6 +556,9 @@ void d_test_sa_create_module_test_header(const char* _module_name,
                                          const char* _description);
 void d_test_sa_create_module_test_results(const char*                  _module_name,
                                           const struct d_test_counter* _counter);
+void d_test_sa_create_module_test_results_timed(const char*                    _module_name,
+                                                const struct d_test_counter*   _counter,
+                                                const struct d_test_sa_timing* _timing);
 void d_test_sa_create_comprehensive_results(const struct d_test_sa_suite_results* _suite);
 void d_test_sa_create_implementation_notes(size_t                               _section_count,
                                            const struct d_test_sa_note_section* _sections);
@@ -362,11 +586,22 @@ void d_test_sa_runner_add_module_counter(struct d_test_sa_runner*             _r
                                          fn_test_module_counter               _run_fn,
                                          size_t                               _note_count,
                                          const struct d_test_sa_note_section* _notes);
+void d_test_sa_runner_add_module_stream(struct d_test_sa_runner*             _runner,
+                                        const char*                          _name,
+                                        const char*                          _description,
+                                        fn_test_module_stream                _run_fn,
+                                        size_t                               _note_count,
+                                        const struct d_test_sa_note_section* _notes);
 int  d_test_sa_runner_execute(struct d_test_sa_runner* _runner);
 void d_test_sa_runner_set_wait_for_input(struct d_test_sa_runner* _runner,
                                          bool                     _wait);
 void d_test_sa_runner_set_show_notes(struct d_test_sa_runner* _runner,
                                      bool                     _show);
+void d_test_sa_runner_set_parallel(struct d_test_sa_runner* _runner,
+                                   size_t                   _jobs);
+bool d_test_sa_runner_set_filter(struct d_test_sa_runner* _runner,
+                                 const char*              _include,
+                                 const char*              _exclude);
 void d_test_sa_runner_cleanup(struct d_test_sa_runner* _runner);
 
 
@@ -377,6 +612,8 @@ void d_test_sa_runner_cleanup(struct d_test_sa_runner* _runner);
 // IX.   utility functions
 void   d_test_sa_print_timestamp(void);
 double d_test_sa_get_elapsed_time(clock_t _start, clock_t _end);
+double d_test_sa_get_wall_time(void);
+double d_test_sa_get_thread_cpu_time(void);
 
 
 #endif  // DJINTERP_TEST_STANDALONE_
\ No newline at end of file
@@ -9,6 +9,7 @@
 * author(s): Samuel 'teer' Neal-Blim                          date: 2023.04.29
 ******************************************************************************/
 
+#include <math.h>
 #include "..\..\inc\test\assert.h"
 
 
@@ -39,6 +40,1052 @@ d_assert_default_compare
 }
 
 
+/******************************************************************************
+ * INTERNAL HELPERS
+ *****************************************************************************/
+
+/*
+d_internal_assert_first_byte_mismatch
+  Finds the offset of the first differing byte between two buffers already
+known to differ.  Whole D_ASSERT_ARRAY_BLOCK_SIZE blocks are skipped with
+memcmp, which the C library vectorizes, before the differing block is
+scanned byte by byte.
+
+Parameter(s):
+  _a:      first buffer
+  _b:      second buffer
+  _length: length of both buffers in bytes
+Return:
+  The offset of the first differing byte, or _length if none differs.
+*/
+static size_t
+d_internal_assert_first_byte_mismatch
+(
+    const unsigned char* _a,
+    const unsigned char* _b,
+    size_t               _length
+)
+{
+    size_t offset;
+
+    offset = 0;
+
+    while ( ((_length - offset) >= D_ASSERT_ARRAY_BLOCK_SIZE) &&
+            (memcmp(_a + offset, _b + offset, D_ASSERT_ARRAY_BLOCK_SIZE) == 0) )
+    {
+        offset += D_ASSERT_ARRAY_BLOCK_SIZE;
+    }
+
+    while ( (offset < _length) &&
+            (_a[offset] == _b[offset]) )
+    {
+        offset++;
+    }
+
+    return offset;
+}
+
+/*
+d_internal_assert_copy_context
+  Copies up to `_length` bytes of string context, replacing control
+characters so the detail stays on one line.
+
+Parameter(s):
+  _dest:   destination buffer, at least `_length` + 1 bytes
+  _src:    context start
+  _length: number of bytes to copy
+Return:
+  none.
+*/
+static void
+d_internal_assert_copy_context
+(
+    char*       _dest,
+    const char* _src,
+    size_t      _length
+)
+{
+    size_t i;
+
+    for (i = 0; i < _length; i++)
+    {
+        _dest[i] = ( ((unsigned char)_src[i] < 0x20) ||
+                     (_src[i] == 0x7F) )
+                   ? '.'
+                   : _src[i];
+    }
+
+    _dest[_length] = '\0';
+
+    return;
+}
+
+/*
+d_internal_assert_failure
+  Returns the failure record of an assertion, allocating it on first use.
+
+Parameter(s):
+  _assertion: the failing assertion
+Return:
+  The assertion's failure record, or NULL if it could not be allocated.
+*/
+static D_ASSERT_COLD struct d_assert_failure*
+d_internal_assert_failure
+(
+    struct d_assert* _assertion
+)
+{
+    if (!_assertion->failure)
+    {
+        _assertion->failure = calloc(1, sizeof(struct d_assert_failure));
+    }
+
+    return _assertion->failure;
+}
+
+/*
+d_internal_assert_set_mismatch
+  Records the first differing element of a failed assertion.  Both elements
+are copied into one buffer owned by the assertion and released by
+d_assert_free, so the mismatch stays valid after the caller's data changes
+or is freed.  If the buffer cannot be allocated, only the index and element
+size are recorded, and nothing is if the failure record cannot be.
+
+Parameter(s):
+  _assertion:    the failing assertion
+  _index:        index of the first differing element
+  _element_size: element size in bytes
+  _expected:     the element in the first array, or NULL if it has none
+  _actual:       the element in the second array, or NULL if it has none
+Return:
+  none.
+*/
+static D_ASSERT_COLD void
+d_internal_assert_set_mismatch
+(
+    struct d_assert* _assertion,
+    size_t           _index,
+    size_t           _element_size,
+    const void*      _expected,
+    const void*      _actual
+)
+{
+    struct d_assert_failure* failure;
+    unsigned char*           copy;
+
+    failure = d_internal_assert_failure(_assertion);
+
+    if (!failure)
+    {
+        return;
+    }
+
+    failure->mismatch.index        = _index;
+    failure->mismatch.element_size = _element_size;
+
+    // a missing element (one string ended first) is recorded as zero bytes
+    copy = calloc(2, _element_size);
+
+    if (!copy)
+    {
+        return;
+    }
+
+    if (_expected)
+    {
+        memcpy(copy, _expected, _element_size);
+    }
+
+    if (_actual)
+    {
+        memcpy(copy + _element_size, _actual, _element_size);
+    }
+
+    failure->mismatch.expected = copy;
+    failure->mismatch.actual   = copy + _element_size;
+
+    return;
+}
+
+/*
+d_internal_assert_str_mismatch
+  Records the first difference between two strings known to differ: byte
+offset, 1-based line and column, and an owned `detail` string showing up to
+D_ASSERT_STR_CONTEXT bytes of context around it in both strings.
+
+Parameter(s):
+  _assertion:   the failing assertion
+  _str1:        first (expected) string
+  _str1_length: number of bytes of the first string being compared
+  _str2:        second (actual) string
+  _str2_length: number of bytes of the second string being compared
+Return:
+  none.
+*/
+static D_ASSERT_COLD void
+d_internal_assert_str_mismatch
+(
+    struct d_assert* _assertion,
+    const char*      _str1,
+    size_t           _str1_length,
+    const char*      _str2,
+    size_t           _str2_length
+)
+{
+    struct d_assert_failure* failure;
+    size_t                   offset;
+    size_t                   line;
+    size_t                   line_start;
+    size_t                   start;
+    size_t                   end1;
+    size_t                   end2;
+    size_t                   size;
+    const char*              newline;
+    char                     context1[(D_ASSERT_STR_CONTEXT * 2) + 1];
+    char                     context2[(D_ASSERT_STR_CONTEXT * 2) + 1];
+
+    offset = d_internal_assert_first_byte_mismatch(
+                 (const unsigned char*)_str1,
+                 (const unsigned char*)_str2,
+                 (_str1_length < _str2_length) ? _str1_length : _str2_length);
+
+    // line and column of the difference, counted in the first string
+    line       = 1;
+    line_start = 0;
+
+    while ( (line_start < offset) &&
+            ((newline = memchr(_str1 + line_start,
+                               '\n',
+                               offset - line_start)) != NULL) )
+    {
+        line++;
+        line_start = (size_t)(newline - _str1) + 1;
+    }
+
+    d_internal_assert_set_mismatch(_assertion,
+                                   offset,
+                                   1,
+                                   (offset < _str1_length) ? _str1 + offset
+                                                           : NULL,
+                                   (offset < _str2_length) ? _str2 + offset
+                                                           : NULL);
+    failure = _assertion->failure;
+
+    if (!failure)
+    {
+        return;
+    }
+
+    failure->mismatch.line   = line;
+    failure->mismatch.column = offset - line_start + 1;
+
+    // context window around the difference
+    start = (offset > D_ASSERT_STR_CONTEXT) ? offset - D_ASSERT_STR_CONTEXT : 0;
+    end1  = ((_str1_length - offset) > D_ASSERT_STR_CONTEXT)
+            ? offset + D_ASSERT_STR_CONTEXT
+            : _str1_length;
+    end2  = ((_str2_length - offset) > D_ASSERT_STR_CONTEXT)
+            ? offset + D_ASSERT_STR_CONTEXT
+            : _str2_length;
+
+    d_internal_assert_copy_context(context1, _str1 + start, end1 - start);
+    d_internal_assert_copy_context(context2, _str2 + start, end2 - start);
+
+    size = (size_t)snprintf(NULL, 0,
+                            "first difference at byte %zu (line %zu, "
+                            "column %zu): expected \"%s\" but was \"%s\"",
+                            offset,
+                            line,
+                            failure->mismatch.column,
+                            context1,
+                            context2) + 1;
+
+    failure->detail = malloc(size);
+
+    if (failure->detail)
+    {
+        snprintf(failure->detail, size,
+                 "first difference at byte %zu (line %zu, "
+                 "column %zu): expected \"%s\" but was \"%s\"",
+                 offset,
+                 line,
+                 failure->mismatch.column,
+                 context1,
+                 context2);
+    }
+
+    return;
+}
+
+/*
+d_internal_assert_str_compare
+  Compares two strings and, if they differ, records where on `_assertion`.
+Both NULL compares equal; exactly one NULL compares unequal without a
+recorded difference.
+
+Parameter(s):
+  _assertion:      assertion receiving the difference (may be NULL)
+  _str1:           first string
+  _str1_length:    maximum length of the first string
+  _str2:           second string
+  _str2_length:    maximum length of the second string
+  _nul_terminated: stop each string at its first NUL within its length
+Return:
+  true if the strings are equal.
+*/
+static bool
+d_internal_assert_str_compare
+(
+    struct d_assert* _assertion,
+    const char*      _str1,
+    size_t           _str1_length,
+    const char*      _str2,
+    size_t           _str2_length,
+    bool             _nul_terminated
+)
+{
+    const char* end;
+    bool        same_length;
+
+    if ( (_str1 == NULL) || (_str2 == NULL) )
+    {
+        return (_str1 == _str2);
+    }
+
+    // the declared lengths must match, as before
+    same_length = (_str1_length == _str2_length);
+
+    if (_nul_terminated)
+    {
+        end          = memchr(_str1, '\0', _str1_length);
+        _str1_length = end ? (size_t)(end - _str1) : _str1_length;
+        end          = memchr(_str2, '\0', _str2_length);
+        _str2_length = end ? (size_t)(end - _str2) : _str2_length;
+    }
+
+    if (D_ASSERT_LIKELY( (same_length) &&
+                         (_str1_length == _str2_length) &&
+                         ( (_str1 == _str2) ||
+                           (memcmp(_str1, _str2, _str1_length) == 0) ) ))
+    {
+        return true;
+    }
+
+    if (_assertion)
+    {
+        d_internal_assert_str_mismatch(_assertion,
+                                       _str1,
+                                       _str1_length,
+                                       _str2,
+                                       _str2_length);
+    }
+
+    return false;
+}
+
+
+
+/*
+d_internal_assert_mem_find
+  Finds the first differing byte at or after `_start`.  The range is
+streamed in D_ASSERT_MEM_CHUNK_SIZE chunks so a file-backed mapping is
+touched sequentially and only up to the first differing chunk.
+
+Parameter(s):
+  _a:     first buffer
+  _b:     second buffer
+  _start: offset to start searching from
+  _size:  size of both buffers in bytes
+Return:
+  The offset of the first differing byte, or `_size` if none differs.
+*/
+static size_t
+d_internal_assert_mem_find
+(
+    const unsigned char* _a,
+    const unsigned char* _b,
+    size_t               _start,
+    size_t               _size
+)
+{
+    size_t offset;
+    size_t chunk;
+
+    offset = _start;
+
+    while (offset < _size)
+    {
+        chunk = ((_size - offset) < D_ASSERT_MEM_CHUNK_SIZE)
+                ? (_size - offset)
+                : D_ASSERT_MEM_CHUNK_SIZE;
+
+        if (memcmp(_a + offset, _b + offset, chunk) != 0)
+        {
+            return offset + d_internal_assert_first_byte_mismatch(_a + offset,
+                                                                  _b + offset,
+                                                                  chunk);
+        }
+
+        offset += chunk;
+    }
+
+    return _size;
+}
+
+/*
+d_internal_assert_mem_row
+  Writes one hex+ASCII dump row, prefixed with `_marker`, into `_dest`.
+
+Parameter(s):
+  _dest:   destination buffer
+  _room:   bytes available in `_dest`
+  _marker: '-' for the expected side, '+' for the actual side
+  _offset: offset of the row within the buffer
+  _bytes:  row contents
+  _length: number of bytes in the row (at most D_ASSERT_MEM_ROW_SIZE)
+Return:
+  The number of characters written, excluding the terminator.
+*/
+static D_ASSERT_COLD size_t
+d_internal_assert_mem_row
+(
+    char*                _dest,
+    size_t               _room,
+    char                 _marker,
+    size_t               _offset,
+    const unsigned char* _bytes,
+    size_t               _length
+)
+{
+    size_t written;
+    size_t i;
+
+    written = (size_t)snprintf(_dest, _room, "%c%08zx ", _marker, _offset);
+
+    for (i = 0; i < D_ASSERT_MEM_ROW_SIZE; i++)
+    {
+        written += (i < _length)
+            ? (size_t)snprintf(_dest + written, _room - written,
+                               " %02x", _bytes[i])
+            : (size_t)snprintf(_dest + written, _room - written, "   ");
+    }
+
+    written += (size_t)snprintf(_dest + written, _room - written, "  |");
+
+    for (i = 0; i < _length; i++)
+    {
+        _dest[written++] = ( (_bytes[i] >= 0x20) && (_bytes[i] < 0x7F) )
+                           ? (char)_bytes[i]
+                           : '.';
+    }
+
+    written += (size_t)snprintf(_dest + written, _room - written, "|\n");
+
+    return written;
+}
+
+/*
+d_internal_assert_mem_diff
+  Builds the failure detail for d_assert_mem_eq: a hex+ASCII dump of at
+most D_ASSERT_MEM_MAX_ROWS differing rows, expected ('-') above actual
+('+').  Equal regions between them are skipped, so the detail stays small
+however large the buffers are.
+
+Parameter(s):
+  _expected: expected buffer
+  _actual:   actual buffer
+  _first:    offset of the first differing byte
+  _size:     size of both buffers in bytes
+Return:
+  A newly-allocated string, or NULL if allocation failed.
+*/
+static D_ASSERT_COLD char*
+d_internal_assert_mem_diff
+(
+    const unsigned char* _expected,
+    const unsigned char* _actual,
+    size_t               _first,
+    size_t               _size
+)
+{
+    // header, two lines per row, and the truncation note
+    const size_t line_size = 2 + 16 + 1 + (D_ASSERT_MEM_ROW_SIZE * 4) + 4;
+    size_t       room;
+    size_t       written;
+    size_t       offset;
+    size_t       row_start;
+    size_t       row_length;
+    size_t       rows;
+    char*        detail;
+
+    room   = 128 + (D_ASSERT_MEM_MAX_ROWS * 2 * line_size);
+    detail = malloc(room);
+
+    if (!detail)
+    {
+        return NULL;
+    }
+
+    written = (size_t)snprintf(detail, room,
+                               "first difference at byte %zu of %zu:\n",
+                               _first,
+                               _size);
+    offset  = _first;
+    rows    = 0;
+
+    while ( (offset < _size) &&
+            (rows < D_ASSERT_MEM_MAX_ROWS) )
+    {
+        row_start  = offset - (offset % D_ASSERT_MEM_ROW_SIZE);
+        row_length = ((_size - row_start) < D_ASSERT_MEM_ROW_SIZE)
+                     ? (_size - row_start)
+                     : D_ASSERT_MEM_ROW_SIZE;
+
+        written += d_internal_assert_mem_row(detail + written,
+                                             room - written,
+                                             '-',
+                                             row_start,
+                                             _expected + row_start,
+                                             row_length);
+        written += d_internal_assert_mem_row(detail + written,
+                                             room - written,
+                                             '+',
+                                             row_start,
+                                             _actual + row_start,
+                                             row_length);
+        rows++;
+
+        offset = d_internal_assert_mem_find(_expected,
+                                            _actual,
+                                            row_start + row_length,
+                                            _size);
+    }
+
+    if (offset < _size)
+    {
+        snprintf(detail + written, room - written,
+                 "... further differences from byte %zu not shown\n",
+                 offset);
+    }
+
+    return detail;
+}
+
+
+/*
+d_internal_assert_ulp_distance
+  Returns the distance in units in the last place between two values given
+as the raw bits of a float or double of `_bits` width.  The bits are mapped
+onto an unsigned scale that is ordered like the values themselves.
+
+Parameter(s):
+  _a:    raw bits of the first value
+  _b:    raw bits of the second value
+  _bits: width of the floating-point type (32 or 64)
+Return:
+  The number of representable values between `_a` and `_b`.
+*/
+static uint64_t
+d_internal_assert_ulp_distance
+(
+    uint64_t _a,
+    uint64_t _b,
+    unsigned _bits
+)
+{
+    uint64_t         sign;
+    uint64_t         mask;
+
+    sign = (uint64_t)1 << (_bits - 1);
+    mask = (_bits == 64) ? UINT64_MAX : ((sign << 1) - 1);
+
+    _a = (_a & sign) ? (~_a & mask) : (_a | sign);
+    _b = (_b & sign) ? (~_b & mask) : (_b | sign);
+
+    return (_a > _b) ? (_a - _b) : (_b - _a);
+}
+
+/*
+d_internal_assert_approx_violates
+  Checks one element pair against the tolerance and NaN/Inf policy.
+
+Parameter(s):
+  _expected:  expected value
+  _actual:    actual value
+  _ulps:      ULP distance between the two, in the element type
+  _tolerance: tolerances to apply
+  _flags:     DAssertFloatFlag policy bits
+  _error:     receives the absolute error (INFINITY for non-finite cases)
+Return:
+  true if the element is outside tolerance.
+*/
+static bool
+d_internal_assert_approx_violates
+(
+    double                           _expected,
+    double                           _actual,
+    uint64_t                         _ulps,
+    const struct d_assert_tolerance* _tolerance,
+    unsigned int                     _flags,
+    double*                          _error
+)
+{
+    double           scale;
+
+    *_error = 0.0;
+
+    if ( (!isfinite(_expected)) || (!isfinite(_actual)) )
+    {
+        if ( (!(_flags & D_ASSERT_FLOAT_FINITE_ONLY)) &&
+             ( (_expected == _actual) ||
+               ( (_flags & D_ASSERT_FLOAT_NAN_EQUAL) &&
+                 isnan(_expected) &&
+                 isnan(_actual) ) ) )
+        {
+            return false;
+        }
+
+        *_error = INFINITY;
+
+        return true;
+    }
+
+    if (_expected == _actual)
+    {
+        return false;
+    }
+
+    *_error = fabs(_expected - _actual);
+    scale   = (fabs(_expected) > fabs(_actual))
+              ? fabs(_expected)
+              : fabs(_actual);
+
+    return !( ( (_tolerance->absolute > 0.0) &&
+                (*_error <= _tolerance->absolute) ) ||
+              ( (_tolerance->relative > 0.0) &&
+                (*_error <= _tolerance->relative * scale) ) ||
+              ( (_tolerance->ulps > 0) &&
+                (_ulps <= _tolerance->ulps) ) );
+}
+
+/*
+d_internal_assert_approx_report
+  Fills the result of an approximate array assertion once its violations
+have been tallied and, if any were found, its failure record's `approx`,
+`mismatch` and `detail`.
+
+Parameter(s):
+  _assertion:    the assertion to complete
+  _approx:       the tallied violations
+  _count:        number of elements compared
+  _first:        index of the first violation (ignored if none)
+  _element_size: sizeof the element type
+  _expected:     expected array
+  _actual:       actual array
+  _worst_e:      expected value at the worst index
+  _worst_a:      actual value at the worst index
+Return:
+  none.
+*/
+static D_ASSERT_COLD void
+d_internal_assert_approx_report
+(
+    struct d_assert*              _assertion,
+    const struct d_assert_approx* _approx,
+    size_t                        _count,
+    size_t                        _first,
+    size_t                        _element_size,
+    const void*                   _expected,
+    const void*                   _actual,
+    double                        _worst_e,
+    double                        _worst_a
+)
+{
+    struct d_assert_failure* failure;
+    int                      size;
+
+    _assertion->result = (_approx->violations == 0);
+
+    if (_assertion->result)
+    {
+        return;
+    }
+
+    d_internal_assert_set_mismatch(_assertion,
+                                   _first,
+                                   _element_size,
+                                   (const char*)_expected +
+                                       (_first * _element_size),
+                                   (const char*)_actual +
+                                       (_first * _element_size));
+    failure = _assertion->failure;
+
+    if (!failure)
+    {
+        return;
+    }
+
+    failure->approx = *_approx;
+
+    size = snprintf(NULL, 0,
+                    "%zu of %zu elements outside tolerance; worst error %g "
+                    "at index %zu (expected %.17g but was %.17g)",
+                    _approx->violations,
+                    _count,
+                    _approx->worst_error,
+                    _approx->worst_index,
+                    _worst_e,
+                    _worst_a);
+
+    failure->detail = malloc((size_t)size + 1);
+
+    if (failure->detail)
+    {
+        snprintf(failure->detail, (size_t)size + 1,
+                 "%zu of %zu elements outside tolerance; worst error %g "
+                 "at index %zu (expected %.17g but was %.17g)",
+                 _approx->violations,
+                 _count,
+                 _approx->worst_error,
+                 _approx->worst_index,
+                 _worst_e,
+                 _worst_a);
+    }
+
+    return;
+}
+
+
+/*
+d_internal_assert_op_holds
+  Applies a relational operator to the result of a three-way comparison.
+
+Parameter(s):
+  _order: negative, zero or positive as the left operand is less than,
+          equal to or greater than the right
+  _op:    operator to apply
+Return:
+  true if `lhs _op rhs` holds.
+*/
+static bool
+d_internal_assert_op_holds
+(
+    int            _order,
+    enum DAssertOp _op
+)
+{
+    switch (_op)
+    {
+        case D_ASSERT_OP_EQ:
+            return (_order == 0);
+        case D_ASSERT_OP_NEQ:
+            return (_order != 0);
+        case D_ASSERT_OP_LT:
+            return (_order < 0);
+        case D_ASSERT_OP_LT_EQ:
+            return (_order <= 0);
+        case D_ASSERT_OP_GT:
+            return (_order > 0);
+        case D_ASSERT_OP_GT_EQ:
+            return (_order >= 0);
+        default:
+            return false;
+    }
+}
+
+/*
+d_internal_assert_operand_format
+  Writes one typed-assertion operand as text.
+
+Parameter(s):
+  _dest:  destination buffer
+  _size:  size of `_dest`
+  _type:  which member of `_value` is set
+  _value: the operand
+Return:
+  none.
+*/
+static D_ASSERT_COLD void
+d_internal_assert_operand_format
+(
+    char*                       _dest,
+    size_t                      _size,
+    enum DAssertOperandType     _type,
+    const union d_assert_value* _value
+)
+{
+    switch (_type)
+    {
+        case D_ASSERT_OPERAND_SIGNED:
+            snprintf(_dest, _size, "%jd", _value->i);
+            break;
+        case D_ASSERT_OPERAND_UNSIGNED:
+            snprintf(_dest, _size, "%ju", _value->u);
+            break;
+        case D_ASSERT_OPERAND_FLOAT:
+            snprintf(_dest, _size, "%.21Lg", _value->f);
+            break;
+        case D_ASSERT_OPERAND_POINTER:
+            snprintf(_dest, _size, "%p", _value->p);
+            break;
+        case D_ASSERT_OPERAND_STRING:
+            if (_value->s)
+            {
+                snprintf(_dest, _size, "\"%.*s\"%s",
+                         (int)(D_ASSERT_STR_CONTEXT * 4),
+                         _value->s,
+                         (strlen(_value->s) > (D_ASSERT_STR_CONTEXT * 4))
+                             ? "..."
+                             : "");
+            }
+            else
+            {
+                snprintf(_dest, _size, "NULL");
+            }
+            break;
+        default:
+            snprintf(_dest, _size, "?");
+            break;
+    }
+
+    return;
+}
+
+/*
+d_internal_assert_bounded_length
+  Returns the length of a string, or `_max` if it is at least that long.
+Bytes past the terminator are never read.
+
+Parameter(s):
+  _str: the string
+  _max: the largest length of interest
+Return:
+  the length of `_str`, capped at `_max`.
+*/
+static size_t
+d_internal_assert_bounded_length
+(
+    const char* _str,
+    size_t      _max
+)
+{
+    const char* end;
+
+    end = memchr(_str, '\0', _max);
+
+    return (end) ? (size_t)(end - _str) : _max;
+}
+
+/*
+d_internal_assert_cmp_capture
+  Makes a failed typed assertion independent of its caller: string operands
+are copied into `operands.storage`, up to one byte past what a description
+shows, so truncation is still detected.  Nothing is formatted here;
+d_assert_describe builds the text from the operands when it is asked for.
+
+Parameter(s):
+  _failure: the failure record, with its operands stored
+Return:
+  none.
+*/
+static D_ASSERT_COLD void
+d_internal_assert_cmp_capture
+(
+    struct d_assert_failure* _failure
+)
+{
+    struct d_assert_operands* operands;
+    size_t                    lhs_length;
+    size_t                    rhs_length;
+
+    operands = &_failure->operands;
+
+    if (operands->type != D_ASSERT_OPERAND_STRING)
+    {
+        return;
+    }
+
+    lhs_length = (operands->lhs.s)
+                 ? d_internal_assert_bounded_length(
+                       operands->lhs.s, (D_ASSERT_STR_CONTEXT * 4) + 1)
+                 : 0;
+    rhs_length = (operands->rhs.s)
+                 ? d_internal_assert_bounded_length(
+                       operands->rhs.s, (D_ASSERT_STR_CONTEXT * 4) + 1)
+                 : 0;
+
+    operands->storage = malloc(lhs_length + rhs_length + 2);
+
+    if (!operands->storage)
+    {
+        return;
+    }
+
+    memcpy(operands->storage,
+           operands->lhs.s ? operands->lhs.s : "",
+           lhs_length);
+    operands->storage[lhs_length] = '\0';
+    memcpy(operands->storage + lhs_length + 1,
+           operands->rhs.s ? operands->rhs.s : "",
+           rhs_length);
+    operands->storage[lhs_length + 1 + rhs_length] = '\0';
+
+    // NULL operands stay NULL
+    if (operands->lhs.s)
+    {
+        operands->lhs.s = operands->storage;
+    }
+
+    if (operands->rhs.s)
+    {
+        operands->rhs.s = operands->storage + lhs_length + 1;
+    }
+
+    return;
+}
+
+/*
+d_internal_assert_cmp_finish
+  Completes a typed assertion by storing the result and message.  Only a
+failed assertion keeps its operands, in its failure record; see
+d_internal_assert_cmp_capture.
+
+Parameter(s):
+  _assertion:     the assertion to complete
+  _result:        whether the comparison held
+  _operands:      operands and operator compared
+  _message_true:  message to use if the comparison held
+  _message_false: message to use if it did not
+Return:
+  none.
+*/
+static void
+d_internal_assert_cmp_finish
+(
+    struct d_assert*                _assertion,
+    bool                            _result,
+    const struct d_assert_operands* _operands,
+    const char*                     _message_true,
+    const char*                     _message_false
+)
+{
+    struct d_assert_failure* failure;
+
+    _assertion->result  = _result;
+    _assertion->message = _result ? _message_true : _message_false;
+
+    if ( (D_ASSERT_UNLIKELY(!_result)) &&
+         ((failure = d_internal_assert_failure(_assertion)) != NULL) )
+    {
+        failure->operands = *_operands;
+
+        // callers leave `storage` unset; only the capture fills it
+        failure->operands.storage = NULL;
+
+        d_internal_assert_cmp_capture(failure);
+    }
+
+    return;
+}
+
+/*
+d_internal_assert_describe_write
+  Writes the description of a failed assertion with snprintf semantics:
+the failure body (captured operands, existing `detail`, expression or
+message) followed by the source location, if one was recorded.
+
+Parameter(s):
+  _assertion: the failed assertion
+  _dest:      destination buffer (may be NULL if `_size` is 0)
+  _size:      size of `_dest`
+Return:
+  The length of the full description, excluding the terminator.
+*/
+static D_ASSERT_COLD int
+d_internal_assert_describe_write
+(
+    const struct d_assert* _assertion,
+    char*                  _dest,
+    size_t                 _size
+)
+{
+    static const char* const       op_text[] = { "==", "!=", "<", "<=", ">", ">=" };
+    char                           lhs[(D_ASSERT_STR_CONTEXT * 4) + 8];
+    char                           rhs[(D_ASSERT_STR_CONTEXT * 4) + 8];
+    const struct d_assert_failure* failure;
+    const char*                    file;
+    const char*                    separator;
+    int                            written;
+
+    failure = _assertion->failure;
+
+    // only the last path component of the source file is shown
+    file = _assertion->file;
+
+    if ( (file) &&
+         ((separator = strrchr(file, '/')) != NULL) )
+    {
+        file = separator + 1;
+    }
+
+    if ( (file) &&
+         ((separator = strrchr(file, '\\')) != NULL) )
+    {
+        file = separator + 1;
+    }
+
+    if ( (failure) &&
+         (failure->operands.type != D_ASSERT_OPERAND_NONE) )
+    {
+        d_internal_assert_operand_format(lhs,
+                                         sizeof(lhs),
+                                         failure->operands.type,
+                                         &failure->operands.lhs);
+        d_internal_assert_operand_format(rhs,
+                                         sizeof(rhs),
+                                         failure->operands.type,
+                                         &failure->operands.rhs);
+
+        // the first operand is the expected value
+        written = (failure->operands.op == D_ASSERT_OP_EQ)
+            ? snprintf(_dest, _size, "expected %s, got %s", lhs, rhs)
+            : snprintf(_dest, _size, "expected %s, got %s %s %s",
+                       _assertion->expression
+                           ? _assertion->expression
+                           : "lhs <op> rhs",
+                       lhs,
+                       op_text[failure->operands.op],
+                       rhs);
+    }
+    else if ( (failure) &&
+              (failure->detail) )
+    {
+        written = snprintf(_dest, _size, "%s", failure->detail);
+    }
+    else if (_assertion->expression)
+    {
+        written = snprintf(_dest, _size, "expected %s", _assertion->expression);
+    }
+    else
+    {
+        written = snprintf(_dest, _size, "%s",
+                           _assertion->message
+                               ? _assertion->message
+                               : "assertion failed");
+    }
+
+    if (file)
+    {
+        written += snprintf( (_size > (size_t)written) ? _dest + written : NULL,
+                             (_size > (size_t)written) ? _size - written : 0,
+                             " at %s:%d",
+                             file,
+                             _assertion->line);
+    }
+
+    return written;
+}
+
 /******************************************************************************
  * ASSERTION CREATION FUNCTIONS
  *****************************************************************************/
@@ -64,7 +1111,7 @@ d_assert_new
     const char* _message_false
 )
 {
-    struct d_assert* new_assertion = malloc(sizeof(struct d_assert));
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
 
     if (new_assertion)
     {
@@ -103,7 +1150,7 @@ d_assert_true
     const char* _message_false
 )
 {
-    struct d_assert* new_assertion = malloc(sizeof(struct d_assert));
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
 
     if (new_assertion)
     {
@@ -137,7 +1184,7 @@ d_assert_false
     const char* _message_false
 )
 {
-    struct d_assert* new_assertion = malloc(sizeof(struct d_assert));
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
 
     if (new_assertion)
     {
@@ -181,7 +1228,7 @@ d_assert_eq
     const char*   _message_false
 )
 {
-    struct d_assert* new_assertion = malloc(sizeof(struct d_assert));
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
 
     if (new_assertion)
     {
@@ -343,6 +1390,279 @@ d_assert_gt_eq
 }
 
 
+/*
+d_assert_cmp_signed
+  Asserts that `_a _op _b` holds for two signed integers.  The comparison is
+  made inline, without a comparator call.  A failure keeps both operands in
+  its failure record; they are formatted only by d_assert_describe.
+
+Parameter(s):
+  _a:             left operand
+  _b:             right operand
+  _op:            relational operator to apply
+  _message_true:  message to use if the comparison holds
+  _message_false: message to use if it does not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_cmp_signed
+(
+    intmax_t       _a,
+    intmax_t       _b,
+    enum DAssertOp _op,
+    const char*    _message_true,
+    const char*    _message_false
+)
+{
+    struct d_assert*         new_assertion;
+    struct d_assert_operands operands;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    operands.type  = D_ASSERT_OPERAND_SIGNED;
+    operands.op    = _op;
+    operands.lhs.i = _a;
+    operands.rhs.i = _b;
+
+    d_internal_assert_cmp_finish(new_assertion,
+                                 d_internal_assert_op_holds(
+                                     (_a > _b) - (_a < _b),
+                                     _op),
+                                 &operands,
+                                 _message_true,
+                                 _message_false);
+
+    return new_assertion;
+}
+
+/*
+d_assert_cmp_unsigned
+  Asserts that `_a _op _b` holds for two unsigned integers.  The comparison
+  is made inline, without a comparator call.  A failure keeps both operands
+  in its failure record; they are formatted only by d_assert_describe.
+
+Parameter(s):
+  _a:             left operand
+  _b:             right operand
+  _op:            relational operator to apply
+  _message_true:  message to use if the comparison holds
+  _message_false: message to use if it does not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_cmp_unsigned
+(
+    uintmax_t      _a,
+    uintmax_t      _b,
+    enum DAssertOp _op,
+    const char*    _message_true,
+    const char*    _message_false
+)
+{
+    struct d_assert*         new_assertion;
+    struct d_assert_operands operands;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    operands.type  = D_ASSERT_OPERAND_UNSIGNED;
+    operands.op    = _op;
+    operands.lhs.u = _a;
+    operands.rhs.u = _b;
+
+    d_internal_assert_cmp_finish(new_assertion,
+                                 d_internal_assert_op_holds(
+                                     (_a > _b) - (_a < _b),
+                                     _op),
+                                 &operands,
+                                 _message_true,
+                                 _message_false);
+
+    return new_assertion;
+}
+
+/*
+d_assert_cmp_float
+  Asserts that `_a _op _b` holds for two floating-point values.  The
+  comparison is made inline, without a comparator call.  A failure keeps
+  both operands in its failure record; they are formatted only by
+  d_assert_describe.
+  NaN is unordered, so only D_ASSERT_OP_NEQ holds when either operand is
+  NaN.
+
+Parameter(s):
+  _a:             left operand
+  _b:             right operand
+  _op:            relational operator to apply
+  _message_true:  message to use if the comparison holds
+  _message_false: message to use if it does not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_cmp_float
+(
+    long double    _a,
+    long double    _b,
+    enum DAssertOp _op,
+    const char*    _message_true,
+    const char*    _message_false
+)
+{
+    struct d_assert*         new_assertion;
+    struct d_assert_operands operands;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    operands.type  = D_ASSERT_OPERAND_FLOAT;
+    operands.op    = _op;
+    operands.lhs.f = _a;
+    operands.rhs.f = _b;
+
+    // NaN is unordered: only != holds
+    d_internal_assert_cmp_finish(new_assertion,
+                                 (isnan(_a) || isnan(_b))
+                                     ? (_op == D_ASSERT_OP_NEQ)
+                                     : d_internal_assert_op_holds(
+                                           (_a > _b) - (_a < _b),
+                                           _op),
+                                 &operands,
+                                 _message_true,
+                                 _message_false);
+
+    return new_assertion;
+}
+
+/*
+d_assert_cmp_ptr
+  Asserts that `_a _op _b` holds for two pointers.  The comparison is made
+  inline, without a comparator call.  A failure keeps both operands in its
+  failure record; they are formatted only by d_assert_describe.  Pointers
+  are ordered by address.
+
+Parameter(s):
+  _a:             left operand
+  _b:             right operand
+  _op:            relational operator to apply
+  _message_true:  message to use if the comparison holds
+  _message_false: message to use if it does not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_cmp_ptr
+(
+    const void*    _a,
+    const void*    _b,
+    enum DAssertOp _op,
+    const char*    _message_true,
+    const char*    _message_false
+)
+{
+    struct d_assert*         new_assertion;
+    struct d_assert_operands operands;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    operands.type  = D_ASSERT_OPERAND_POINTER;
+    operands.op    = _op;
+    operands.lhs.p = _a;
+    operands.rhs.p = _b;
+
+    d_internal_assert_cmp_finish(new_assertion,
+                                 d_internal_assert_op_holds(
+                                     ((uintptr_t)_a > (uintptr_t)_b) -
+                                     ((uintptr_t)_a < (uintptr_t)_b),
+                                     _op),
+                                 &operands,
+                                 _message_true,
+                                 _message_false);
+
+    return new_assertion;
+}
+
+/*
+d_assert_cmp_str
+  Asserts that `_a _op _b` holds for two strings.  The comparison is made
+  inline, without a comparator call.  A failure keeps both operands in its
+  failure record; they are formatted only by d_assert_describe.  Strings are
+  ordered by strcmp; NULL orders before any string and equals only NULL.  A passing
+  assertion only borrows the strings; a failing one copies them.
+
+Parameter(s):
+  _a:             left operand
+  _b:             right operand
+  _op:            relational operator to apply
+  _message_true:  message to use if the comparison holds
+  _message_false: message to use if it does not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_cmp_str
+(
+    const char*    _a,
+    const char*    _b,
+    enum DAssertOp _op,
+    const char*    _message_true,
+    const char*    _message_false
+)
+{
+    struct d_assert*         new_assertion;
+    struct d_assert_operands operands;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    operands.type  = D_ASSERT_OPERAND_STRING;
+    operands.op    = _op;
+    operands.lhs.s = _a;
+    operands.rhs.s = _b;
+
+    d_internal_assert_cmp_finish(new_assertion,
+                                 d_internal_assert_op_holds(
+                                     (_a && _b)
+                                         ? strcmp(_a, _b)
+                                         : ((_a != NULL) - (_b != NULL)),
+                                     _op),
+                                 &operands,
+                                 _message_true,
+                                 _message_false);
+
+    return new_assertion;
+}
+
+
 /******************************************************************************
  * STRING ASSERTION FUNCTIONS
  *****************************************************************************/
@@ -351,7 +1671,9 @@ d_assert_gt_eq
 d_assert_str_eq
   Asserts that two strings are EQUAL, comparing up to the minimum of the two
   specified lengths.  If both strings are NULL, they are considered equal.
-  If only one is NULL, they are not equal.
+  If only one is NULL, they are not equal.  Each string ends at its first
+  NUL within its length.  On failure, the first difference is recorded in
+  `mismatch` and described in `detail`.
 
 Parameter(s):
   _str1:          first string to compare
@@ -375,60 +1697,135 @@ d_assert_str_eq
     const char* _message_false
 )
 {
-    struct d_assert* new_assertion = malloc(sizeof(struct d_assert));
-    size_t           compare_length;
-    bool             result;
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
 
     if (!new_assertion)
     {
         return NULL;
     }
 
-    // handle NULL cases
-    if (_str1 == NULL && _str2 == NULL)
-    {
-        result = true;
-    }
-    else if (_str1 == NULL || _str2 == NULL)
+    new_assertion->result  = d_internal_assert_str_compare(new_assertion,
+                                                           _str1,
+                                                           _str1_length,
+                                                           _str2,
+                                                           _str2_length,
+                                                           true);
+    new_assertion->message = new_assertion->result 
+                             ? _message_true 
+                             : _message_false;
+
+    return new_assertion;
+}
+
+/*
+d_assert_str_neq
+  Asserts that two strings are NOT EQUAL, comparing up to the minimum of the
+  two specified lengths.  If both strings are NULL, they are considered equal
+  (assertion fails).  If only one is NULL, they are not equal (assertion 
+  passes).  Each string ends at its first NUL within its length.
+
+Parameter(s):
+  _str1:          first string to compare
+  _str1_length:   maximum length to consider for first string
+  _str2:          second string to compare
+  _str2_length:   maximum length to consider for second string
+  _message_true:  message to use if strings are not equal
+  _message_false: message to use if strings are equal
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_str_neq
+(
+    const char* _str1,
+    size_t      _str1_length,
+    const char* _str2,
+    size_t      _str2_length,
+    const char* _message_true,
+    const char* _message_false
+)
+{
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
     {
-        result = false;
+        return NULL;
     }
-    else
-    {
-        // compare up to the minimum of both lengths
-        compare_length = (_str1_length < _str2_length) 
-                         ? _str1_length 
-                         : _str2_length;
-        
-        // strings must match and have the same effective length to be equal
-        if (_str1_length != _str2_length)
-        {
-            result = false;
-        }
-        else
-        {
-            result = (strncmp(_str1, _str2, compare_length) == 0);
-        }
+
+    // a passing neq has nothing to report, so no difference is recorded
+    new_assertion->result  = !d_internal_assert_str_compare(NULL,
+                                                            _str1,
+                                                            _str1_length,
+                                                            _str2,
+                                                            _str2_length,
+                                                            true);
+    new_assertion->message = new_assertion->result 
+                             ? _message_true 
+                             : _message_false;
+
+    return new_assertion;
+}
+
+/*
+d_assert_str_eq_len
+  Asserts that two length-delimited strings are EQUAL.  Exactly `_length`
+  bytes of each are compared, so the strings need not be NUL-terminated and
+  may contain embedded NULs.  NULL handling and failure reporting match
+  d_assert_str_eq.
+
+Parameter(s):
+  _str1:          first string to compare
+  _str1_length:   length of the first string in bytes
+  _str2:          second string to compare
+  _str2_length:   length of the second string in bytes
+  _message_true:  message to use if strings are equal
+  _message_false: message to use if strings are not equal
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_str_eq_len
+(
+    const char* _str1,
+    size_t      _str1_length,
+    const char* _str2,
+    size_t      _str2_length,
+    const char* _message_true,
+    const char* _message_false
+)
+{
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
     }
 
-    new_assertion->result  = result;
-    new_assertion->message = result ? _message_true : _message_false;
+    new_assertion->result  = d_internal_assert_str_compare(new_assertion,
+                                                           _str1,
+                                                           _str1_length,
+                                                           _str2,
+                                                           _str2_length,
+                                                           false);
+    new_assertion->message = new_assertion->result 
+                             ? _message_true 
+                             : _message_false;
 
     return new_assertion;
 }
 
 /*
-d_assert_str_neq
-  Asserts that two strings are NOT EQUAL, comparing up to the minimum of the
-  two specified lengths.  If both strings are NULL, they are considered equal
-  (assertion fails).  If only one is NULL, they are not equal (assertion 
-  passes).
+d_assert_str_neq_len
+  Asserts that two length-delimited strings are NOT EQUAL.  Exactly
+  `_length` bytes of each are compared; NUL termination is not required.
 
 Parameter(s):
   _str1:          first string to compare
-  _str1_length:   maximum length to consider for first string
+  _str1_length:   length of the first string in bytes
   _str2:          second string to compare
-  _str2_length:   maximum length to consider for second string
+  _str2_length:   length of the second string in bytes
   _message_true:  message to use if strings are not equal
   _message_false: message to use if strings are equal
 
@@ -436,7 +1833,7 @@ Return:
   A pointer to the newly-allocated d_assert, or NULL if allocation failed.
 */
 struct d_assert*
-d_assert_str_neq
+d_assert_str_neq_len
 (
     const char* _str1,
     size_t      _str1_length,
@@ -446,45 +1843,22 @@ d_assert_str_neq
     const char* _message_false
 )
 {
-    struct d_assert* new_assertion = malloc(sizeof(struct d_assert));
-    size_t           compare_length;
-    bool             strings_equal;
+    struct d_assert* new_assertion = calloc(1, sizeof(struct d_assert));
 
     if (!new_assertion)
     {
         return NULL;
     }
 
-    // handle NULL cases
-    if (_str1 == NULL && _str2 == NULL)
-    {
-        strings_equal = true;
-    }
-    else if (_str1 == NULL || _str2 == NULL)
-    {
-        strings_equal = false;
-    }
-    else
-    {
-        // compare up to the minimum of both lengths
-        compare_length = (_str1_length < _str2_length) 
-                         ? _str1_length 
-                         : _str2_length;
-        
-        // strings are equal only if lengths match and content matches
-        if (_str1_length != _str2_length)
-        {
-            strings_equal = false;
-        }
-        else
-        {
-            strings_equal = (strncmp(_str1, _str2, compare_length) == 0);
-        }
-    }
-
-    // for neq, we want result to be true when strings are NOT equal
-    new_assertion->result  = !strings_equal;
-    new_assertion->message = !strings_equal ? _message_true : _message_false;
+    new_assertion->result  = !d_internal_assert_str_compare(NULL,
+                                                            _str1,
+                                                            _str1_length,
+                                                            _str2,
+                                                            _str2_length,
+                                                            false);
+    new_assertion->message = new_assertion->result 
+                             ? _message_true 
+                             : _message_false;
 
     return new_assertion;
 }
@@ -578,14 +1952,18 @@ d_assert_array_is_valid
 /*
 d_assert_arrays_eq
   Asserts that two arrays are equal by comparing each element using the
-  provided comparator function.  Both arrays must be non-NULL.
+  provided comparator function.  If no comparator is provided, the arrays are
+  compared bitwise with memcmp, which suits arrays of plain data without
+  padding.  Both arrays must be non-NULL.  On failure, the first differing
+  element is recorded in the assertion's `mismatch`.
 
 Parameter(s):
   _arr1:          pointer to the first array
   _arr2:          pointer to the second array
   _arr_size:      number of elements in each array
   _element_size:  size of each element in bytes
-  _comparator:    function used to compare elements
+  _comparator:    function used to compare elements (may be NULL for a
+                  bitwise comparison)
   _message_true:  message to use if arrays are equal
   _message_false: message to use if arrays are not equal
 
@@ -604,11 +1982,11 @@ d_assert_arrays_eq
     const char*   _message_false
 )
 {
-    const char* arr1_ptr;
-    const char* arr2_ptr;
-    const void* element1;
-    const void* element2;
-    size_t      i;
+    struct d_assert* new_assertion;
+    const char*      arr1_ptr;
+    const char*      arr2_ptr;
+    size_t           length;
+    size_t           i;
 
     // check if either array is NULL
     if ( (_arr1 == NULL) || 
@@ -616,25 +1994,611 @@ d_assert_arrays_eq
     {
         return d_assert_new(false, _message_true, _message_false);
     }
-    
-    // compare each element of the arrays
+
     arr1_ptr = (const char*)_arr1;
     arr2_ptr = (const char*)_arr2;
-    
-    for (i = 0; i < _arr_size; i++)
-    {
-        element1 = (const void*)(arr1_ptr + i * _element_size);
-        element2 = (const void*)(arr2_ptr + i * _element_size);
-        
-        // use the comparator to check for equality
-        if (_comparator(element1, element2) != 0)
+    i        = _arr_size;
+
+    if (!_comparator)
+    {
+        // bitwise fast path; only locate the difference on failure
+        length = _arr_size * _element_size;
+
+        if (D_ASSERT_UNLIKELY( (arr1_ptr != arr2_ptr) &&
+                               (length > 0)           &&
+                               (memcmp(arr1_ptr, arr2_ptr, length) != 0) ))
+        {
+            i = d_internal_assert_first_byte_mismatch(
+                    (const unsigned char*)arr1_ptr,
+                    (const unsigned char*)arr2_ptr,
+                    length) / _element_size;
+        }
+    }
+    else
+    {
+        // compare each element of the arrays
+        for (i = 0; i < _arr_size; i++)
+        {
+            if (D_ASSERT_UNLIKELY(_comparator(arr1_ptr + i * _element_size,
+                                              arr2_ptr + i * _element_size) != 0))
+            {
+                break;
+            }
+        }
+    }
+
+    new_assertion = d_assert_new(i == _arr_size, _message_true, _message_false);
+
+    if (D_ASSERT_UNLIKELY( (new_assertion) &&
+                           (i < _arr_size) ))
+    {
+        d_internal_assert_set_mismatch(new_assertion,
+                                       i,
+                                       _element_size,
+                                       arr1_ptr + i * _element_size,
+                                       arr2_ptr + i * _element_size);
+    }
+
+    return new_assertion;
+}
+
+
+/*
+d_assert_floats_near
+  Asserts that two float arrays are equal within `_tolerance`, producing a
+  single assertion for the whole array.  Passing arrays are confirmed by a
+  branch-free loop over absolute and relative tolerances that the compiler
+  can vectorize; only if it finds a candidate violation is each element
+  re-checked with ULP tolerance and the NaN/Inf policy.  On failure,
+  `approx` holds the violation count and the worst error and its index,
+  `mismatch` the first violation, and `detail` a summary.
+
+Parameter(s):
+  _expected:      expected values
+  _actual:        actual values
+  _count:         number of elements in each array
+  _tolerance:     tolerances to apply, or NULL for exact comparison
+  _flags:         DAssertFloatFlag NaN/Inf policy bits
+  _message_true:  message to use if all elements are within tolerance
+  _message_false: message to use if any element is not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_floats_near
+(
+    const float*                     _expected,
+    const float*                     _actual,
+    size_t                           _count,
+    const struct d_assert_tolerance* _tolerance,
+    unsigned int                     _flags,
+    const char*                      _message_true,
+    const char*                      _message_false
+)
+{
+    static const struct d_assert_tolerance exact = { 0.0, 0.0, 0 };
+    struct d_assert*       new_assertion;
+    struct d_assert_approx approx;
+    size_t                 within;
+    size_t                 first;
+    size_t                 i;
+    double                 diff;
+    double                 scale;
+    double                 absolute;
+    double                 relative;
+    double                 value_e;
+    double                 value_a;
+    double                 error;
+    uint32_t               bits_e;
+    uint32_t               bits_a;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    if ( (_expected == NULL) || (_actual == NULL) )
+    {
+        new_assertion->result  = (_expected == _actual);
+        new_assertion->message = new_assertion->result
+                                 ? _message_true
+                                 : _message_false;
+
+        return new_assertion;
+    }
+
+    _tolerance = _tolerance ? _tolerance : &exact;
+    absolute   = _tolerance->absolute;
+    relative   = _tolerance->relative;
+    within     = 0;
+
+    // fast pass: no early exit or branches, so it vectorizes
+    for (i = 0; i < _count; i++)
+    {
+        value_e = (double)_expected[i];
+        value_a = (double)_actual[i];
+        diff    = fabs(value_e - value_a);
+        scale   = (fabs(value_e) > fabs(value_a))
+                  ? fabs(value_e)
+                  : fabs(value_a);
+        within += (size_t)( (value_e == value_a) |
+                            (diff <= absolute)       |
+                            (diff <= relative * scale) );
+    }
+
+    if (D_ASSERT_LIKELY( (within == _count) &&
+                         (!(_flags & D_ASSERT_FLOAT_FINITE_ONLY)) ))
+    {
+        new_assertion->result  = true;
+        new_assertion->message = _message_true;
+
+        return new_assertion;
+    }
+
+    // slow pass: exact per-element accounting
+    first = 0;
+    memset(&approx, 0, sizeof(approx));
+
+    for (i = 0; i < _count; i++)
+    {
+        memcpy(&bits_e, &_expected[i], sizeof(bits_e));
+        memcpy(&bits_a, &_actual[i], sizeof(bits_a));
+
+        if (d_internal_assert_approx_violates(_expected[i],
+                                              _actual[i],
+                                              d_internal_assert_ulp_distance(
+                                                  bits_e,
+                                                  bits_a,
+                                                  32),
+                                              _tolerance,
+                                              _flags,
+                                              &error))
+        {
+            if (approx.violations++ == 0)
+            {
+                first = i;
+            }
+
+            if ( (approx.violations == 1) ||
+                 (error > approx.worst_error) )
+            {
+                approx.worst_error = error;
+                approx.worst_index = i;
+            }
+        }
+    }
+
+    d_internal_assert_approx_report(
+        new_assertion,
+        &approx,
+        _count,
+        first,
+        sizeof(float),
+        _expected,
+        _actual,
+        _expected[approx.worst_index],
+        _actual[approx.worst_index]);
+
+    new_assertion->message = new_assertion->result
+                             ? _message_true
+                             : _message_false;
+
+    return new_assertion;
+}
+
+/*
+d_assert_doubles_near
+  Asserts that two double arrays are equal within `_tolerance`, producing a
+  single assertion for the whole array.  Passing arrays are confirmed by a
+  branch-free loop over absolute and relative tolerances that the compiler
+  can vectorize; only if it finds a candidate violation is each element
+  re-checked with ULP tolerance and the NaN/Inf policy.  On failure,
+  `approx` holds the violation count and the worst error and its index,
+  `mismatch` the first violation, and `detail` a summary.
+
+Parameter(s):
+  _expected:      expected values
+  _actual:        actual values
+  _count:         number of elements in each array
+  _tolerance:     tolerances to apply, or NULL for exact comparison
+  _flags:         DAssertFloatFlag NaN/Inf policy bits
+  _message_true:  message to use if all elements are within tolerance
+  _message_false: message to use if any element is not
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_doubles_near
+(
+    const double*                    _expected,
+    const double*                    _actual,
+    size_t                           _count,
+    const struct d_assert_tolerance* _tolerance,
+    unsigned int                     _flags,
+    const char*                      _message_true,
+    const char*                      _message_false
+)
+{
+    static const struct d_assert_tolerance exact = { 0.0, 0.0, 0 };
+    struct d_assert*       new_assertion;
+    struct d_assert_approx approx;
+    size_t                 within;
+    size_t                 first;
+    size_t                 i;
+    double                 diff;
+    double                 scale;
+    double                 absolute;
+    double                 relative;
+    double                 value_e;
+    double                 value_a;
+    double                 error;
+    uint64_t               bits_e;
+    uint64_t               bits_a;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    if ( (_expected == NULL) || (_actual == NULL) )
+    {
+        new_assertion->result  = (_expected == _actual);
+        new_assertion->message = new_assertion->result
+                                 ? _message_true
+                                 : _message_false;
+
+        return new_assertion;
+    }
+
+    _tolerance = _tolerance ? _tolerance : &exact;
+    absolute   = (double)_tolerance->absolute;
+    relative   = (double)_tolerance->relative;
+    within     = 0;
+
+    // fast pass: no early exit or branches, so it vectorizes
+    for (i = 0; i < _count; i++)
+    {
+        value_e = (double)_expected[i];
+        value_a = (double)_actual[i];
+        diff    = fabs(value_e - value_a);
+        scale   = (fabs(value_e) > fabs(value_a))
+                  ? fabs(value_e)
+                  : fabs(value_a);
+        within += (size_t)( (value_e == value_a) |
+                            (diff <= absolute)       |
+                            (diff <= relative * scale) );
+    }
+
+    if (D_ASSERT_LIKELY( (within == _count) &&
+                         (!(_flags & D_ASSERT_FLOAT_FINITE_ONLY)) ))
+    {
+        new_assertion->result  = true;
+        new_assertion->message = _message_true;
+
+        return new_assertion;
+    }
+
+    // slow pass: exact per-element accounting
+    first = 0;
+    memset(&approx, 0, sizeof(approx));
+
+    for (i = 0; i < _count; i++)
+    {
+        memcpy(&bits_e, &_expected[i], sizeof(bits_e));
+        memcpy(&bits_a, &_actual[i], sizeof(bits_a));
+
+        if (d_internal_assert_approx_violates(_expected[i],
+                                              _actual[i],
+                                              d_internal_assert_ulp_distance(
+                                                  bits_e,
+                                                  bits_a,
+                                                  64),
+                                              _tolerance,
+                                              _flags,
+                                              &error))
+        {
+            if (approx.violations++ == 0)
+            {
+                first = i;
+            }
+
+            if ( (approx.violations == 1) ||
+                 (error > approx.worst_error) )
+            {
+                approx.worst_error = error;
+                approx.worst_index = i;
+            }
+        }
+    }
+
+    d_internal_assert_approx_report(
+        new_assertion,
+        &approx,
+        _count,
+        first,
+        sizeof(double),
+        _expected,
+        _actual,
+        _expected[approx.worst_index],
+        _actual[approx.worst_index]);
+
+    new_assertion->message = new_assertion->result
+                             ? _message_true
+                             : _message_false;
+
+    return new_assertion;
+}
+
+/*
+d_assert_mem_eq
+  Asserts that two raw memory regions of `_size` bytes are EQUAL.  Unlike
+  d_assert_arrays_eq this never calls a comparator: the regions are streamed
+  through memcmp in D_ASSERT_MEM_CHUNK_SIZE chunks.  If both pointers are
+  NULL they are considered equal; if only one is NULL, they are not.  On
+  failure, the first difference is recorded in `mismatch` and `detail`
+  holds a bounded hex+ASCII diff of the differing rows.
+
+Parameter(s):
+  _expected:      expected memory region
+  _actual:        actual memory region
+  _size:          size of both regions in bytes
+  _message_true:  message to use if the regions are equal
+  _message_false: message to use if the regions differ
+
+Return:
+  A pointer to the newly-allocated d_assert, or NULL if allocation failed.
+*/
+struct d_assert*
+d_assert_mem_eq
+(
+    const void* _expected,
+    const void* _actual,
+    size_t      _size,
+    const char* _message_true,
+    const char* _message_false
+)
+{
+    struct d_assert*     new_assertion;
+    const unsigned char* expected;
+    const unsigned char* actual;
+    size_t               offset;
+
+    new_assertion = calloc(1, sizeof(struct d_assert));
+
+    if (!new_assertion)
+    {
+        return NULL;
+    }
+
+    expected = (const unsigned char*)_expected;
+    actual   = (const unsigned char*)_actual;
+
+    if ( (expected == NULL) || (actual == NULL) )
+    {
+        new_assertion->result = (expected == actual);
+    }
+    else if (expected == actual)
+    {
+        new_assertion->result = true;
+    }
+    else
+    {
+        offset                = d_internal_assert_mem_find(expected,
+                                                           actual,
+                                                           0,
+                                                           _size);
+        new_assertion->result = (offset == _size);
+
+        if (D_ASSERT_UNLIKELY(!new_assertion->result))
         {
-            return d_assert_new(false, _message_true, _message_false);
+            d_internal_assert_set_mismatch(new_assertion,
+                                           offset,
+                                           1,
+                                           expected + offset,
+                                           actual + offset);
+
+            if (new_assertion->failure)
+            {
+                new_assertion->failure->detail =
+                    d_internal_assert_mem_diff(expected,
+                                               actual,
+                                               offset,
+                                               _size);
+            }
         }
     }
-    
-    // all elements are equal
-    return d_assert_new(true, _message_true, _message_false);
+
+    new_assertion->message = new_assertion->result 
+                             ? _message_true 
+                             : _message_false;
+
+    return new_assertion;
+}
+
+
+/******************************************************************************
+ * FAILURE DESCRIPTION FUNCTIONS
+ *****************************************************************************/
+
+/*
+d_assert_at
+  Records the source location and expression text of an assertion.  Only
+  the pointers are stored, so this adds no formatting cost to assertions
+  that pass.  Normally called through D_ASSERT_AT.
+
+Parameter(s):
+  _assertion:  the assertion to annotate (may be NULL)
+  _file:       source file, typically __FILE__; must outlive the assertion
+  _line:       source line, typically __LINE__
+  _expression: asserted expression text, or NULL; must outlive the assertion
+
+Return:
+  `_assertion`, so that calls can be nested.
+*/
+struct d_assert*
+d_assert_at
+(
+    struct d_assert* _assertion,
+    const char*      _file,
+    int              _line,
+    const char*      _expression
+)
+{
+    if (_assertion)
+    {
+        _assertion->file       = _file;
+        _assertion->line       = _line;
+        _assertion->expression = _expression;
+    }
+
+    return _assertion;
+}
+
+/*
+d_assert_describe
+  Returns a human-readable description of a failed assertion, e.g.
+  "expected 3, got 5 at foo.c:120".  The description is built on the first
+  call, from the raw operands, expression and location captured when the
+  assertion was made, and cached in the failure record's `detail`; callers
+  should only ask for it
+  when their verbosity requires it.  Typed string operands must still be
+  valid when this is first called.
+
+Parameter(s):
+  _assertion: the assertion to describe
+
+Return:
+  The description, owned by the assertion, or NULL if the assertion passed
+  or the description could not be allocated.
+*/
+const char*
+d_assert_describe
+(
+    struct d_assert* _assertion
+)
+{
+    struct d_assert_failure* failure;
+    char*                    description;
+    int                      size;
+
+    if ( (!_assertion) ||
+         (_assertion->result) )
+    {
+        return NULL;
+    }
+
+    if ( (_assertion->failure) &&
+         (_assertion->failure->described) )
+    {
+        return _assertion->failure->detail;
+    }
+
+    size        = d_internal_assert_describe_write(_assertion, NULL, 0);
+    description = malloc((size_t)size + 1);
+
+    if (!description)
+    {
+        return NULL;
+    }
+
+    d_internal_assert_describe_write(_assertion, description, (size_t)size + 1);
+
+    failure = d_internal_assert_failure(_assertion);
+
+    if (!failure)
+    {
+        free(description);
+
+        return NULL;
+    }
+
+    free(failure->detail);
+    failure->detail    = description;
+    failure->described = true;
+
+    return failure->detail;
+}
+
+
+/******************************************************************************
+ * TALLY FUNCTIONS
+ *****************************************************************************/
+
+/*
+d_assert_tally_fail
+  Records a failed D_ASSERT_CHECK.  Kept out of line and marked cold so the
+  checking code only carries the compare and the pass-count increment.  The
+  first failure is kept as a d_assert annotated with its source location;
+  later failures are only counted.
+
+Parameter(s):
+  _tally:      tally to update
+  _file:       source file of the check
+  _line:       source line of the check
+  _expression: text of the checked condition
+
+Return:
+  None.
+*/
+D_ASSERT_COLD void
+d_assert_tally_fail
+(
+    struct d_assert_tally* _tally,
+    const char*            _file,
+    int                    _line,
+    const char*            _expression
+)
+{
+    if (!_tally)
+    {
+        return;
+    }
+
+    _tally->failed++;
+
+    if (!_tally->first_failure)
+    {
+        _tally->first_failure = d_assert_at(d_assert_new(false, NULL, NULL),
+                                            _file,
+                                            _line,
+                                            _expression);
+    }
+
+    return;
+}
+
+/*
+d_assert_tally_free
+  Frees the first failure held by a tally and resets its counts.
+
+Parameter(s):
+  _tally: tally to reset (may be NULL)
+
+Return:
+  None.
+*/
+void
+d_assert_tally_free
+(
+    struct d_assert_tally* _tally
+)
+{
+    if (_tally)
+    {
+        d_assert_free(_tally->first_failure);
+
+        _tally->passed        = 0;
+        _tally->failed        = 0;
+        _tally->first_failure = NULL;
+    }
+
+    return;
 }
 
 
@@ -660,6 +2624,15 @@ d_assert_free
 {
     if (_assertion)
     {
+        if (_assertion->failure)
+        {
+            // both mismatch elements share the buffer `expected` points to
+            free((void*)_assertion->failure->mismatch.expected);
+            free(_assertion->failure->operands.storage);
+            free(_assertion->failure->detail);
+            free(_assertion->failure);
+        }
+
         free(_assertion);
     }
 
@@ -57,6 +57,10 @@ d_test_type_new
             result->D_KEYWORD_TEST_MODULE = (struct d_test_module*)_element;
             break;
 
+        case D_TEST_TYPE_PROPERTY:
+            result->D_KEYWORD_TEST_PROPERTY = (struct d_test_property*)_element;
+            break;
+
         case D_TEST_TYPE_UNKNOWN:
         default:
             result->D_KEYWORD_TEST_TEST_FN = NULL;
@@ -158,6 +162,9 @@ d_test_type_to_string
         case D_TEST_TYPE_MODULE:
             return "MODULE";
 
+        case D_TEST_TYPE_PROPERTY:
+            return "PROPERTY";
+
         case D_TEST_TYPE_UNKNOWN:
         default:
             return "UNKNOWN";
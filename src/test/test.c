@@ -1,4 +1,7 @@
 #include "..\..\inc\test\test.h"
+#include "..\..\inc\test\test_config.h"
+#include "..\..\inc\test\test_property.h"
+#include "..\..\inc\test\test_session.h"
 
 
 /******************************************************************************
@@ -45,11 +48,9 @@ d_internal_test_process_args
         }
 
         // apply the value based on row type
-        if (_test->config && _test->config->settings)
+        if (_test->config)
         {
-            d_min_enum_map_put(_test->config->settings,
-                               (int)row->flag,
-                               (void*)_args[i].value);
+            d_test_config_put(&_test->config, row, (void*)_args[i].value);
         }
     }   
 
@@ -78,8 +79,7 @@ d_internal_test_add_children
 {
     size_t i;
 
-    if ( (!_test)                    ||
-         (!_test->children)          ||
+    if ( (!_test) ||
          (!_children && _child_count > 0) )
     {
         return false;
@@ -92,15 +92,17 @@ d_internal_test_add_children
             continue;
         }
 
-        // tests can only contain assertions and test functions
-        if ( (_children[i]->type != D_TEST_TYPE_ASSERT) &&
-             (_children[i]->type != D_TEST_TYPE_TEST_FN) )
+        // tests can only contain assertions, test functions and properties
+        if ( (_children[i]->type != D_TEST_TYPE_ASSERT)  &&
+             (_children[i]->type != D_TEST_TYPE_TEST_FN) &&
+             (_children[i]->type != D_TEST_TYPE_PROPERTY) )
         {
             // skip invalid child types
             continue;
         }
 
-        if (!d_ptr_vector_push_back(_test->children, _children[i]))
+        // copied in; the caller keeps ownership of the wrapper
+        if (!d_test_children_push(&_test->children, _children[i]))
         {
             return false;
         }
@@ -110,41 +112,6 @@ d_internal_test_add_children
 }
 
 
-/*
-d_internal_test_resolve_config
-  Resolves effective configuration by merging test's own config with run config.
-  The run config takes precedence for overridable settings.
-
-Parameter(s):
-  _test:       the test whose config to resolve.
-  _run_config: the runtime configuration passed from parent.
-Return:
-  Pointer to the resolved config (may be test's own config or run config).
-  Does not allocate new memory - returns one of the input configs.
-*/
-static const struct d_test_config*
-d_internal_test_resolve_config
-(
-    const struct d_test*        _test,
-    const struct d_test_config* _run_config
-)
-{
-    // If run config provided, it takes precedence
-    if (_run_config)
-    {
-        return _run_config;
-    }
-
-    // Fall back to test's own config
-    if (_test && _test->config)
-    {
-        return _test->config;
-    }
-
-    return NULL;
-}
-
-
 /******************************************************************************
  * VALIDATE_ARGS FUNCTIONS
  *****************************************************************************/
@@ -175,25 +142,13 @@ d_test_validate_args
         return NULL;
     }
 
-    config = d_test_config_new(D_TEST_MODE_NORMAL);
+    config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!config)
     {
         return NULL;
     }
 
-    if (!config->settings)
-    {
-        config->settings = d_min_enum_map_new();
-
-        if (!config->settings)
-        {
-            d_test_config_free(config);
-
-            return NULL;
-        }
-    }
-
     for (i = 0; i < _arg_count; i++)
     {
         if (!_args[i].key)
@@ -212,7 +167,7 @@ d_test_validate_args
         }
 
         // store with the registry flag as the key
-        d_min_enum_map_put(config->settings, (int)row->flag, (void*)_args[i].value);
+        d_test_config_put(&config, row, (void*)_args[i].value);
     }
 
     return config;
@@ -245,25 +200,13 @@ d_test_fn_validate_args
         return NULL;
     }
 
-    config = d_test_config_new(D_TEST_MODE_NORMAL);
+    config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!config)
     {
         return NULL;
     }
 
-    if (!config->settings)
-    {
-        config->settings = d_min_enum_map_new();
-
-        if (!config->settings)
-        {
-            d_test_config_free(config);
-
-            return NULL;
-        }
-    }
-
     for (i = 0; i < _arg_count; i++)
     {
         if (!_args[i].key)
@@ -282,7 +225,7 @@ d_test_fn_validate_args
         }
 
         // store with the registry flag as the key
-        d_min_enum_map_put(config->settings, (int)row->flag, (void*)_args[i].value);
+        d_test_config_put(&config, row, (void*)_args[i].value);
     }
 
     for (i = 0; i < _arg_count; i++)
@@ -298,7 +241,7 @@ d_test_fn_validate_args
         if (row)
         {
             // store with the registry flag as the key
-            d_min_enum_map_put(config->settings, (int)row->flag, (void*)_args[i].value);
+            d_test_config_put(&config, row, (void*)_args[i].value);
         }
     }
 
@@ -336,22 +279,14 @@ d_test_new
         return NULL;
     }
 
-    // create children vector
-    test->children = d_ptr_vector_new_default();
-
-    if (!test->children)
-    {
-        free(test);
-
-        return NULL;
-    }
+    // children are stored inline until they outgrow the small buffer
+    d_test_children_init(&test->children);
 
     // create default config
-    test->config = d_test_config_new(D_TEST_MODE_NORMAL);
+    test->config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!test->config)
     {
-        d_ptr_vector_free(test->children);
         free(test);
 
         return NULL;
@@ -404,40 +339,19 @@ d_test_new_args
         return NULL;
     }
 
-    // create children vector
-    test->children = d_ptr_vector_new_default();
+    // children are stored inline until they outgrow the small buffer
+    d_test_children_init(&test->children);
 
-    if (!test->children)
-    {
-        free(test);
-
-        return NULL;
-    }
-
-    // create config with settings map
-    test->config = d_test_config_new(D_TEST_MODE_NORMAL);
+    // share the default preset; the first override takes a private copy
+    test->config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!test->config)
     {
-        d_ptr_vector_free(test->children);
         free(test);
 
         return NULL;
     }
 
-    // ensure the config has a settings map
-    if (!test->config->settings)
-    {
-        test->config->settings = d_min_enum_map_new();
-
-        if (!test->config->settings)
-        {
-            d_test_free(test);
-
-            return NULL;
-        }
-    }
-
     test->stage_hooks = NULL;
 
     // process configuration arguments
@@ -516,11 +430,8 @@ d_test_free
         return;
     }
 
-    if (_test->children)
-    {
-        // Note: children should be freed by caller or via d_test_type_free
-        d_ptr_vector_free(_test->children);
-    }
+    // Note: child elements should be freed by caller
+    d_test_children_clear(&_test->children);
 
     if (_test->config)
     {
@@ -595,21 +506,22 @@ d_test_add_child
     struct d_test_type* _child
 )
 {
-    if ( (!_test)           ||
-         (!_test->children) ||
+    if ( (!_test) ||
          (!_child) )
     {
         return false;
     }
 
-    // tests can only contain assertions and test functions
-    if ( (_child->type != D_TEST_TYPE_ASSERT) &&
-         (_child->type != D_TEST_TYPE_TEST_FN) )
+    // tests can only contain assertions, test functions and properties
+    if ( (_child->type != D_TEST_TYPE_ASSERT)  &&
+         (_child->type != D_TEST_TYPE_TEST_FN) &&
+         (_child->type != D_TEST_TYPE_PROPERTY) )
     {
         return false;
     }
 
-    return d_ptr_vector_push_back(_test->children, _child);
+    // stored by value; the caller keeps ownership of `_child`
+    return d_test_children_push(&_test->children, _child);
 }
 
 
@@ -630,7 +542,7 @@ d_test_add_assertion
     struct d_assertion* _assertion
 )
 {
-    struct d_test_type* test_type;
+    struct d_test_type test_type;
 
     if ( (!_test) ||
          (!_assertion) )
@@ -638,14 +550,12 @@ d_test_add_assertion
         return false;
     }
 
-    test_type = d_test_type_new(D_TEST_TYPE_ASSERT, _assertion);
-
-    if (!test_type)
-    {
-        return false;
-    }
+    // stored in place; no wrapper allocation
+    test_type.type                     = D_TEST_TYPE_ASSERT;
+    test_type.config                   = NULL;
+    test_type.D_KEYWORD_TEST_ASSERTION = _assertion;
 
-    return d_test_add_child(_test, test_type);
+    return d_test_add_child(_test, &test_type);
 }
 
 
@@ -666,8 +576,8 @@ d_test_add_function
     fn_test        _fn
 )
 {
-    struct d_test_fn*   test_fn;
-    struct d_test_type* test_type;
+    struct d_test_fn*  test_fn;
+    struct d_test_type test_type;
 
     if ( (!_test) ||
          (!_fn) )
@@ -682,16 +592,19 @@ d_test_add_function
         return false;
     }
 
-    test_type = d_test_type_new(D_TEST_TYPE_TEST_FN, test_fn);
+    // stored in place; no wrapper allocation
+    test_type.type                   = D_TEST_TYPE_TEST_FN;
+    test_type.config                 = NULL;
+    test_type.D_KEYWORD_TEST_TEST_FN = test_fn;
 
-    if (!test_type)
+    if (!d_test_add_child(_test, &test_type))
     {
         d_test_fn_free(test_fn);
 
         return false;
     }
 
-    return d_test_add_child(_test, test_type);
+    return true;
 }
 
 
@@ -710,13 +623,12 @@ d_test_child_count
     const struct d_test* _test
 )
 {
-    if ( (!_test) ||
-         (!_test->children) )
+    if (!_test)
     {
         return 0;
     }
 
-    return d_ptr_vector_size(_test->children);
+    return _test->children.count;
 }
 
 
@@ -728,7 +640,8 @@ Parameter(s):
   _test:  the test to query.
   _index: the index of the child to get.
 Return:
-  Pointer to the child's test type, or NULL if invalid.
+  Pointer to the child's test type (valid until the next child is added),
+  or NULL if invalid.
 */
 struct d_test_type*
 d_test_get_child_at
@@ -737,13 +650,12 @@ d_test_get_child_at
     size_t               _index
 )
 {
-    if ( (!_test) ||
-         (!_test->children) )
+    if (!_test)
     {
         return NULL;
     }
 
-    return (struct d_test_type*)d_ptr_vector_at(_test->children, (d_index)_index);
+    return d_test_children_at(&_test->children, _index);
 }
 
 
@@ -823,7 +735,8 @@ d_test_get_stage_hook
 
 /*
 d_test_run
-  Runs all children in the test.
+  Runs all children in the test.  The effective configuration is resolved
+  once into a snapshot; see d_test_run_resolved.
 
 Parameter(s):
   _test:       the test to run.
@@ -838,16 +751,58 @@ d_test_run
     const struct d_test_config* _run_config
 )
 {
-    size_t                      i;
-    size_t                      count;
-    struct d_test_type*         child;
-    const struct d_test_config* effective_config;
-    fn_stage                    setup_hook;
-    fn_stage                    teardown_hook;
-    fn_stage                    success_hook;
-    fn_stage                    failure_hook;
-    bool                        all_passed;
-    bool                        child_result;
+    struct d_test_resolved_config resolved;
+
+    if (!_test)
+    {
+        return false;
+    }
+
+    // run config takes precedence over the test's own config
+    if (_run_config)
+    {
+        d_test_config_resolve(&resolved, _run_config);
+
+        return d_test_run_resolved(_test, &resolved);
+    }
+
+    return d_test_run_resolved(_test, NULL);
+}
+
+/*
+d_test_run_resolved
+  Runs all children in the test with an already-resolved configuration.
+  A test whose snapshot has `skip` set is not run and counts as passed; with
+a non-zero `max_failures`, the remaining children are not run once that
+many have failed.  Property children take the snapshot's `timeout_ms` as
+the limit for each case their workers check.
+
+Parameter(s):
+  _test:     the test to run.
+  _resolved: the parent's snapshot (takes precedence), or NULL to resolve
+             the test's own config.
+Return:
+  true if all children passed, false otherwise.
+*/
+bool
+d_test_run_resolved
+(
+    struct d_test*                       _test,
+    const struct d_test_resolved_config* _resolved
+)
+{
+    size_t                               i;
+    size_t                               count;
+    size_t                               failures;
+    struct d_test_type*                  child;
+    struct d_test_resolved_config        storage;
+    const struct d_test_resolved_config* effective_config;
+    fn_stage                             setup_hook;
+    fn_stage                             teardown_hook;
+    fn_stage                             success_hook;
+    fn_stage                             failure_hook;
+    bool                                 all_passed;
+    bool                                 child_result;
 
     if (!_test)
     {
@@ -855,10 +810,19 @@ d_test_run
     }
 
     // resolve effective configuration
-    effective_config = d_internal_test_resolve_config(_test, _run_config);
-    (void)effective_config;  // may be used for future config-based behavior
+    effective_config = d_test_config_resolve_inherited(&storage,
+                                                       _resolved,
+                                                       _test->config);
+
+    // a skipped test runs nothing, hooks included, and does not fail
+    if ( (effective_config) &&
+         (effective_config->skip) )
+    {
+        return true;
+    }
 
     all_passed = true;
+    failures   = 0;
 
     // get stage hooks from test's own hooks only
     setup_hook    = d_test_get_stage_hook(_test, D_TEST_STAGE_SETUP);
@@ -910,14 +874,44 @@ d_test_run
                 }
                 break;
 
+            case D_TEST_TYPE_PROPERTY:
+                // the configured timeout bounds each case a worker checks
+                if ( (effective_config) &&
+                     (child->D_KEYWORD_TEST_PROPERTY) )
+                {
+                    child->D_KEYWORD_TEST_PROPERTY->timeout_ms =
+                        effective_config->timeout_ms;
+                }
+
+                child_result = d_test_property_run(
+                                   child->D_KEYWORD_TEST_PROPERTY);
+
+                // a falsified property reports what falsified it
+                if (!child_result)
+                {
+                    d_test_session_report_property(
+                        child->D_KEYWORD_TEST_PROPERTY);
+                }
+                break;
+
             default:
-                // tests can only contain assertions and test functions
+                // tests can only contain assertions, test functions and
+                // properties
                 break;
         }
 
         if (!child_result)
         {
             all_passed = false;
+            failures++;
+
+            // stop once the configured failure limit (0 = none) is reached
+            if ( (effective_config)                 &&
+                 (effective_config->max_failures)   &&
+                 (failures >= effective_config->max_failures) )
+            {
+                break;
+            }
         }
     }
 
@@ -1022,6 +1016,9 @@ d_test_type_flag_to_string
         case D_TEST_TYPE_MODULE:
             return "MODULE";
 
+        case D_TEST_TYPE_PROPERTY:
+            return "PROPERTY";
+
         case D_TEST_TYPE_UNKNOWN:
         default:
             return "UNKNOWN";
@@ -1,4 +1,7 @@
 #include "..\..\inc\test\test_block.h"
+#include "..\..\inc\test\test_config.h"
+#include "..\..\inc\test\test_property.h"
+#include "..\..\inc\test\test_session.h"
 
 
 /******************************************************************************
@@ -45,11 +48,9 @@ d_internal_test_block_process_args
         }
 
         // apply the value based on row type
-        if (_block->config && _block->config->settings)
+        if (_block->config)
         {
-            d_min_enum_map_put(_block->config->settings,
-                               (int)row->flag,
-                               (void*)_args[i].value);
+            d_test_config_put(&_block->config, row, (void*)_args[i].value);
         }
     }
 
@@ -78,8 +79,7 @@ d_internal_test_block_add_children
 {
     size_t i;
 
-    if ( (!_block)                   ||
-         (!_block->children)         ||
+    if ( (!_block) ||
          (!_children && _child_count > 0) )
     {
         return false;
@@ -93,7 +93,7 @@ d_internal_test_block_add_children
         }
 
         // blocks can contain: sub-blocks, tests, assertions, test_fns
-        if (!d_ptr_vector_push_back(_block->children, _children[i]))
+        if (!d_test_block_add_child(_block, _children[i]))
         {
             return false;
         }
@@ -133,25 +133,13 @@ d_test_block_validate_args
         return NULL;
     }
 
-    config = d_test_config_new(D_TEST_MODE_NORMAL);
+    config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!config)
     {
         return NULL;
     }
 
-    if (!config->settings)
-    {
-        config->settings = d_min_enum_map_new();
-
-        if (!config->settings)
-        {
-            d_test_config_free(config);
-
-            return NULL;
-        }
-    }
-
     for (i = 0; i < _arg_count; i++)
     {
         if (!_args[i].key)
@@ -170,7 +158,7 @@ d_test_block_validate_args
         }
 
         // store with the registry flag as the key
-        d_min_enum_map_put(config->settings, (int)row->flag, (void*)_args[i].value);
+        d_test_config_put(&config, row, (void*)_args[i].value);
     }
 
     return config;
@@ -207,22 +195,14 @@ d_test_block_new
         return NULL;
     }
 
-    // create children vector
-    block->children = d_ptr_vector_new_default();
-
-    if (!block->children)
-    {
-        free(block);
-
-        return NULL;
-    }
+    // children are stored inline until they outgrow the small buffer
+    d_test_children_init(&block->children);
 
     // create default config
-    block->config = d_test_config_new(D_TEST_MODE_NORMAL);
+    block->config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!block->config)
     {
-        d_ptr_vector_free(block->children);
         free(block);
 
         return NULL;
@@ -275,40 +255,19 @@ d_test_block_new_args
         return NULL;
     }
 
-    // create children vector
-    block->children = d_ptr_vector_new_default();
+    // children are stored inline until they outgrow the small buffer
+    d_test_children_init(&block->children);
 
-    if (!block->children)
-    {
-        free(block);
-
-        return NULL;
-    }
-
-    // create config with settings map
-    block->config = d_test_config_new(D_TEST_MODE_NORMAL);
+    // share the default preset; the first override takes a private copy
+    block->config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!block->config)
     {
-        d_ptr_vector_free(block->children);
         free(block);
 
         return NULL;
     }
 
-    // ensure the config has a settings map
-    if (!block->config->settings)
-    {
-        block->config->settings = d_min_enum_map_new();
-
-        if (!block->config->settings)
-        {
-            d_test_block_free(block);
-
-            return NULL;
-        }
-    }
-
     block->stage_hooks = NULL;
 
     // process configuration arguments
@@ -349,33 +308,13 @@ d_test_block_free
     struct d_test_block* _block
 )
 {
-    size_t              i;
-    size_t              count;
-    struct d_test_type* child;
-
     if (!_block)
     {
         return;
     }
 
-    // free children
-    if (_block->children)
-    {
-        count = d_ptr_vector_size(_block->children);
-
-        for (i = 0; i < count; i++)
-        {
-            child = (struct d_test_type*)d_ptr_vector_at(_block->children,
-                                                         (d_index)i);
-
-            if (child)
-            {
-                d_test_type_free(child);
-            }
-        }
-
-        d_ptr_vector_free(_block->children);
-    }
+    // free children; their wrappers were released when they were added
+    d_test_children_clear(&_block->children);
 
     // free config
     if (_block->config)
@@ -405,7 +344,8 @@ d_test_block_add_child
 
 Parameter(s):
   _block: the block to add to.
-  _child: the child to add.
+  _child: the child to add; the block takes ownership of the wrapper, which
+          is copied into the block's child storage and freed.
 Return:
   true if the child was added successfully.
 */
@@ -416,14 +356,20 @@ d_test_block_add_child
     struct d_test_type*  _child
 )
 {
-    if ( (!_block)           ||
-         (!_block->children) ||
+    if ( (!_block) ||
          (!_child) )
     {
         return false;
     }
 
-    return d_ptr_vector_push_back(_block->children, _child);
+    if (!d_test_children_push(&_block->children, _child))
+    {
+        return false;
+    }
+
+    d_test_type_free(_child);
+
+    return true;
 }
 
 
@@ -444,23 +390,20 @@ d_test_block_add_test
     struct d_test*       _test
 )
 {
-    struct d_test_type* test_type;
+    struct d_test_type test_type;
 
-    if ( (!_block)           ||
-         (!_block->children) ||
+    if ( (!_block) ||
          (!_test) )
     {
         return false;
     }
 
-    test_type = d_test_type_new(D_TEST_TYPE_TEST, _test);
+    // stored in place; no wrapper allocation
+    test_type.type                = D_TEST_TYPE_TEST;
+    test_type.config              = NULL;
+    test_type.D_KEYWORD_TEST_TEST = _test;
 
-    if (!test_type)
-    {
-        return false;
-    }
-
-    return d_test_block_add_child(_block, test_type);
+    return d_test_children_push(&_block->children, &test_type);
 }
 
 
@@ -481,23 +424,20 @@ d_test_block_add_block
     struct d_test_block* _child
 )
 {
-    struct d_test_type* test_type;
+    struct d_test_type test_type;
 
-    if ( (!_parent)           ||
-         (!_parent->children) ||
+    if ( (!_parent) ||
          (!_child) )
     {
         return false;
     }
 
-    test_type = d_test_type_new(D_TEST_TYPE_TEST_BLOCK, _child);
-
-    if (!test_type)
-    {
-        return false;
-    }
+    // stored in place; no wrapper allocation
+    test_type.type                 = D_TEST_TYPE_TEST_BLOCK;
+    test_type.config               = NULL;
+    test_type.D_KEYWORD_TEST_BLOCK = _child;
 
-    return d_test_block_add_child(_parent, test_type);
+    return d_test_children_push(&_parent->children, &test_type);
 }
 
 
@@ -516,13 +456,12 @@ d_test_block_child_count
     const struct d_test_block* _block
 )
 {
-    if ( (!_block) ||
-         (!_block->children) )
+    if (!_block)
     {
         return 0;
     }
 
-    return d_ptr_vector_size(_block->children);
+    return _block->children.count;
 }
 
 
@@ -534,7 +473,8 @@ Parameter(s):
   _block: the block to query.
   _index: the index of the child to get.
 Return:
-  Pointer to the child's test type, or NULL if invalid.
+  Pointer to the child's test type (valid until the next child is added),
+  or NULL if invalid.
 */
 struct d_test_type*
 d_test_block_get_child_at
@@ -543,13 +483,12 @@ d_test_block_get_child_at
     size_t                     _index
 )
 {
-    if ( (!_block)           ||
-         (!_block->children) )
+    if (!_block)
     {
         return NULL;
     }
 
-    return (struct d_test_type*)d_ptr_vector_at(_block->children, (d_index)_index);
+    return d_test_children_at(&_block->children, _index);
 }
 
 
@@ -629,7 +568,8 @@ d_test_block_get_stage_hook
 
 /*
 d_test_block_run
-  Runs all children in the block.
+  Runs all children in the block.  The run configuration is resolved once
+  into a snapshot shared by every descendant; see d_test_block_run_resolved.
 
 Parameter(s):
   _block:      the block to run.
@@ -643,6 +583,36 @@ d_test_block_run
     struct d_test_block*  _block,
     struct d_test_config* _run_config
 )
+{
+    struct d_test_resolved_config resolved;
+
+    if (!_run_config)
+    {
+        return d_test_block_run_resolved(_block, NULL);
+    }
+
+    d_test_config_resolve(&resolved, _run_config);
+
+    return d_test_block_run_resolved(_block, &resolved);
+}
+
+/*
+d_test_block_run_resolved
+  Runs all children in the block with an already-resolved configuration,
+  which is passed to children by pointer.
+
+Parameter(s):
+  _block:    the block to run.
+  _resolved: runtime snapshot, or NULL to let each test use its own config.
+Return:
+  true if all children passed, false otherwise.
+*/
+bool
+d_test_block_run_resolved
+(
+    struct d_test_block*                 _block,
+    const struct d_test_resolved_config* _resolved
+)
 {
     size_t              i;
     size_t              count;
@@ -689,15 +659,16 @@ d_test_block_run
             case D_TEST_TYPE_TEST:
                 if (child->D_KEYWORD_TEST_TEST)
                 {
-                    child_result = d_test_run(child->D_KEYWORD_TEST_TEST,
-                                              _run_config);
+                    child_result = d_test_run_resolved(
+                                       child->D_KEYWORD_TEST_TEST,
+                                       _resolved);
                 }
                 break;
 
             case D_TEST_TYPE_TEST_BLOCK:
                 if (child->D_KEYWORD_TEST_BLOCK)
                 {
-                    child_result = d_test_block_run(child->D_KEYWORD_TEST_BLOCK, _run_config);
+                    child_result = d_test_block_run_resolved(child->D_KEYWORD_TEST_BLOCK, _resolved);
                 }
                 break;
 
@@ -715,6 +686,26 @@ d_test_block_run
                 }
                 break;
 
+            case D_TEST_TYPE_PROPERTY:
+                // the configured timeout bounds each case a worker checks
+                if ( (_resolved) &&
+                     (child->D_KEYWORD_TEST_PROPERTY) )
+                {
+                    child->D_KEYWORD_TEST_PROPERTY->timeout_ms =
+                        _resolved->timeout_ms;
+                }
+
+                child_result = d_test_property_run(
+                                   child->D_KEYWORD_TEST_PROPERTY);
+
+                // a falsified property reports what falsified it
+                if (!child_result)
+                {
+                    d_test_session_report_property(
+                        child->D_KEYWORD_TEST_PROPERTY);
+                }
+                break;
+
             default:
                 break;
         }
@@ -800,19 +791,17 @@ d_test_block_count_tests
     size_t              test_count;
     struct d_test_type* child;
 
-    if ( (!_block) ||
-         (!_block->children) )
+    if (!_block)
     {
         return 0;
     }
 
     test_count = 0;
-    count      = d_ptr_vector_size(_block->children);
+    count      = _block->children.count;
 
     for (i = 0; i < count; i++)
     {
-        child = (struct d_test_type*)d_ptr_vector_at(_block->children,
-                                                      (d_index)i);
+        child = d_test_children_at(&_block->children, i);
 
         if (child && child->type == D_TEST_TYPE_TEST)
         {
@@ -844,19 +833,17 @@ d_test_block_count_blocks
     size_t              block_count;
     struct d_test_type* child;
 
-    if ( (!_block) ||
-         (!_block->children) )
+    if (!_block)
     {
         return 0;
     }
 
     block_count = 0;
-    count       = d_ptr_vector_size(_block->children);
+    count       = _block->children.count;
 
     for (i = 0; i < count; i++)
     {
-        child = (struct d_test_type*)d_ptr_vector_at(_block->children,
-                                                      (d_index)i);
+        child = d_test_children_at(&_block->children, i);
 
         if (child && child->type == D_TEST_TYPE_TEST_BLOCK)
         {
@@ -1 +1,725 @@
-#include "..\..\inc\test\test_common.h"
\ No newline at end of file
+#include "..\..\inc\test\test_common.h"
+#include <string.h>
+
+
+/******************************************************************************
+ * CHILD STORAGE
+ *****************************************************************************/
+
+/*
+d_test_children_init
+  Initializes empty child storage, using only the inline buffer.
+
+Parameter(s):
+  _children: the storage to initialize
+Return:
+  none.
+*/
+void
+d_test_children_init
+(
+    struct d_test_children* _children
+)
+{
+    if (!_children)
+    {
+        return;
+    }
+
+    _children->count    = 0;
+    _children->capacity = 0;
+    _children->heap     = NULL;
+
+    return;
+}
+
+/*
+d_test_children_push
+  Appends a copy of a child.  The first D_TEST_CHILDREN_INLINE_CAPACITY
+children are stored inline; past that, all children move to a heap array
+that doubles as it fills.
+
+Parameter(s):
+  _children: the storage to append to
+  _child:    the child to copy in
+Return:
+  true if the child was stored, false if an argument was NULL or memory
+  allocation failed.
+*/
+bool
+d_test_children_push
+(
+    struct d_test_children*   _children,
+    const struct d_test_type* _child
+)
+{
+    size_t              capacity;
+    struct d_test_type* items;
+
+    if ( (!_children) || (!_child) )
+    {
+        return false;
+    }
+
+    if ( (!_children->heap) &&
+         (_children->count < D_TEST_CHILDREN_INLINE_CAPACITY) )
+    {
+        _children->inline_items[_children->count++] = *_child;
+
+        return true;
+    }
+
+    // spill, or grow the spilled array
+    if ( (!_children->heap) ||
+         (_children->count == _children->capacity) )
+    {
+        capacity = (_children->count) * 2;
+        items    = realloc(_children->heap,
+                           capacity * sizeof(struct d_test_type));
+
+        if (!items)
+        {
+            return false;
+        }
+
+        if (!_children->heap)
+        {
+            memcpy(items,
+                   _children->inline_items,
+                   _children->count * sizeof(struct d_test_type));
+        }
+
+        _children->heap     = items;
+        _children->capacity = capacity;
+    }
+
+    _children->heap[_children->count++] = *_child;
+
+    return true;
+}
+
+/*
+d_test_children_at
+  Gets the child at an index.
+
+Parameter(s):
+  _children: the storage to read
+  _index:    index of the child
+Return:
+  a pointer to the stored child, valid until the next push, or NULL if
+  _index is out of range.
+*/
+struct d_test_type*
+d_test_children_at
+(
+    const struct d_test_children* _children,
+    size_t                        _index
+)
+{
+    if ( (!_children) || (_index >= _children->count) )
+    {
+        return NULL;
+    }
+
+    return (_children->heap)
+        ? &_children->heap[_index]
+        : (struct d_test_type*)&_children->inline_items[_index];
+}
+
+/*
+d_test_children_clear
+  Removes all children and releases any spilled storage.  The children's
+elements are not freed.
+
+Parameter(s):
+  _children: the storage to clear
+Return:
+  none.
+*/
+void
+d_test_children_clear
+(
+    struct d_test_children* _children
+)
+{
+    if (!_children)
+    {
+        return;
+    }
+
+    free(_children->heap);
+    d_test_children_init(_children);
+
+    return;
+}
+
+
+/******************************************************************************
+ * NAME FILTER
+ *****************************************************************************/
+
+/*
+d_internal_test_filter_compile_segment
+  Compiles one path component of a pattern.
+
+Parameter(s):
+  _segment: the segment to fill in
+  _text:    start of the component text
+  _length:  length of the component text
+Return:
+  true if the segment was compiled, false if memory allocation failed.
+*/
+static bool
+d_internal_test_filter_compile_segment
+(
+    struct d_test_filter_segment* _segment,
+    const char*                   _text,
+    size_t                        _length
+)
+{
+    _segment->glob = malloc(_length + 1);
+
+    if (!_segment->glob)
+    {
+        return false;
+    }
+
+    memcpy(_segment->glob, _text, _length);
+    _segment->glob[_length] = '\0';
+
+    _segment->length        = _length;
+    _segment->prefix_length = strcspn(_segment->glob, "*?");
+    _segment->literal       = (_segment->prefix_length == _length);
+    _segment->any_depth     = (strcmp(_segment->glob,
+                                      D_TEST_FILTER_ANY_DEPTH) == 0);
+
+    return true;
+}
+
+/*
+d_internal_test_filter_free_pattern
+  Frees the segments owned by a compiled pattern.
+
+Parameter(s):
+  _pattern: the pattern to free
+Return:
+  none.
+*/
+static void
+d_internal_test_filter_free_pattern
+(
+    struct d_test_filter_pattern* _pattern
+)
+{
+    size_t i;
+
+    for (i = 0; i < _pattern->count; i++)
+    {
+        free(_pattern->segments[i].glob);
+    }
+
+    free(_pattern->segments);
+    _pattern->segments = NULL;
+    _pattern->count    = 0;
+
+    return;
+}
+
+/*
+d_internal_test_filter_compile_pattern
+  Splits one pattern on D_TEST_FILTER_PATH_SEPARATOR and compiles each
+component.
+
+Parameter(s):
+  _pattern: the pattern to fill in
+  _text:    start of the pattern text
+  _length:  length of the pattern text
+  _exclude: whether the pattern removes matches
+Return:
+  true if the pattern was compiled, false if memory allocation failed.
+*/
+static bool
+d_internal_test_filter_compile_pattern
+(
+    struct d_test_filter_pattern* _pattern,
+    const char*                   _text,
+    size_t                        _length,
+    bool                          _exclude
+)
+{
+    size_t      i;
+    size_t      count;
+    const char* start;
+    const char* end;
+    const char* sep;
+
+    count = 1;
+
+    for (i = 0; i < _length; i++)
+    {
+        if (_text[i] == D_TEST_FILTER_PATH_SEPARATOR)
+        {
+            count++;
+        }
+    }
+
+    _pattern->segments = calloc(count, sizeof(struct d_test_filter_segment));
+    _pattern->count    = 0;
+    _pattern->exclude  = _exclude;
+
+    if (!_pattern->segments)
+    {
+        return false;
+    }
+
+    start = _text;
+    end   = _text + _length;
+
+    while (_pattern->count < count)
+    {
+        sep = memchr(start, D_TEST_FILTER_PATH_SEPARATOR, (size_t)(end - start));
+
+        if (!sep)
+        {
+            sep = end;
+        }
+
+        if (!d_internal_test_filter_compile_segment(
+                 &_pattern->segments[_pattern->count],
+                 start,
+                 (size_t)(sep - start)))
+        {
+            d_internal_test_filter_free_pattern(_pattern);
+
+            return false;
+        }
+
+        _pattern->count++;
+        start = sep + 1;
+    }
+
+    return true;
+}
+
+/*
+d_internal_test_filter_glob
+  Matches a name against one compiled segment.  '*' matches any run of
+characters and '?' matches exactly one; the literal prefix is checked before
+the wildcard matcher runs.
+
+Parameter(s):
+  _segment: the compiled segment
+  _name:    the name to test
+Return:
+  true if _name matches the segment.
+*/
+static bool
+d_internal_test_filter_glob
+(
+    const struct d_test_filter_segment* _segment,
+    const char*                         _name
+)
+{
+    const char* glob;
+    const char* star_glob;
+    const char* star_name;
+
+    if (_segment->literal)
+    {
+        return (strcmp(_segment->glob, _name) == 0);
+    }
+
+    if (strncmp(_segment->glob, _name, _segment->prefix_length) != 0)
+    {
+        return false;
+    }
+
+    glob      = _segment->glob + _segment->prefix_length;
+    _name    += _segment->prefix_length;
+    star_glob = NULL;
+    star_name = NULL;
+
+    // iterative wildcard match; backtracks only to the most recent '*'
+    while (*_name)
+    {
+        if (*glob == '*')
+        {
+            star_glob = ++glob;
+            star_name = _name;
+        }
+        else if ( (*glob == '?') ||
+                  (*glob == *_name) )
+        {
+            glob++;
+            _name++;
+        }
+        else if (star_glob)
+        {
+            glob  = star_glob;
+            _name = ++star_name;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (*glob == '*')
+    {
+        glob++;
+    }
+
+    return (*glob == '\0');
+}
+
+/*
+d_internal_test_filter_match_pattern
+  Matches a path against a compiled pattern, starting at the given segment
+and path component.
+
+Parameter(s):
+  _pattern: the compiled pattern
+  _segment: index of the first segment to match
+  _path:    path components
+  _index:   index of the first path component to match
+  _depth:   number of path components
+Return:
+  FULL if the path (or one of its ancestors) matches the whole pattern,
+  PARTIAL if the path is a prefix of something that may match, NONE
+  otherwise.
+*/
+static enum DTestFilterMatch
+d_internal_test_filter_match_pattern
+(
+    const struct d_test_filter_pattern* _pattern,
+    size_t                              _segment,
+    const char* const*                  _path,
+    size_t                              _index,
+    size_t                              _depth
+)
+{
+    enum DTestFilterMatch result;
+    enum DTestFilterMatch deeper;
+
+    while (_segment < _pattern->count)
+    {
+        if (_pattern->segments[_segment].any_depth)
+        {
+            // try matching no components first, then one more
+            result = d_internal_test_filter_match_pattern(_pattern,
+                                                          _segment + 1,
+                                                          _path,
+                                                          _index,
+                                                          _depth);
+
+            if (result == D_TEST_FILTER_MATCH_FULL)
+            {
+                return result;
+            }
+
+            // path exhausted; "**" may still match descendants
+            if (_index == _depth)
+            {
+                return D_TEST_FILTER_MATCH_PARTIAL;
+            }
+
+            deeper = d_internal_test_filter_match_pattern(_pattern,
+                                                          _segment,
+                                                          _path,
+                                                          _index + 1,
+                                                          _depth);
+
+            return (deeper > result) ? deeper : result;
+        }
+
+        // path exhausted with pattern left; descendants may still match
+        if (_index == _depth)
+        {
+            return D_TEST_FILTER_MATCH_PARTIAL;
+        }
+
+        if ( (!_path[_index]) ||
+             (!d_internal_test_filter_glob(&_pattern->segments[_segment],
+                                           _path[_index])) )
+        {
+            return D_TEST_FILTER_MATCH_NONE;
+        }
+
+        _segment++;
+        _index++;
+    }
+
+    // pattern consumed; the path selects its whole subtree
+    return D_TEST_FILTER_MATCH_FULL;
+}
+
+/*
+d_test_filter_new
+  Compiles include and exclude pattern lists into a filter.  Each list holds
+patterns separated by D_TEST_FILTER_LIST_SEPARATOR; each pattern is a path of
+glob segments separated by D_TEST_FILTER_PATH_SEPARATOR.
+
+Parameter(s):
+  _include: include patterns, or NULL to select everything
+  _exclude: exclude patterns, or NULL
+Return:
+  the compiled filter, or NULL if memory allocation failed.
+*/
+struct d_test_filter*
+d_test_filter_new
+(
+    const char* _include,
+    const char* _exclude
+)
+{
+    struct d_test_filter* filter;
+
+    filter = calloc(1, sizeof(struct d_test_filter));
+
+    if (!filter)
+    {
+        return NULL;
+    }
+
+    if ( (!d_test_filter_add(filter, _include, false)) ||
+         (!d_test_filter_add(filter, _exclude, true)) )
+    {
+        d_test_filter_free(filter);
+
+        return NULL;
+    }
+
+    return filter;
+}
+
+/*
+d_test_filter_add
+  Compiles a list of patterns and adds them to a filter.  Empty patterns in
+the list are ignored.
+
+Parameter(s):
+  _filter:   the filter to extend
+  _patterns: patterns separated by D_TEST_FILTER_LIST_SEPARATOR; NULL adds
+             nothing
+  _exclude:  whether the patterns remove matches
+Return:
+  true on success, false if _filter is NULL or memory allocation failed.
+*/
+bool
+d_test_filter_add
+(
+    struct d_test_filter* _filter,
+    const char*           _patterns,
+    bool                  _exclude
+)
+{
+    size_t                        added;
+    const char*                   start;
+    const char*                   end;
+    struct d_test_filter_pattern* patterns;
+
+    if (!_filter)
+    {
+        return false;
+    }
+
+    if (!_patterns)
+    {
+        return true;
+    }
+
+    // count the patterns so the array grows once
+    added = 1;
+
+    for (start = _patterns; *start; start++)
+    {
+        if (*start == D_TEST_FILTER_LIST_SEPARATOR)
+        {
+            added++;
+        }
+    }
+
+    patterns = realloc(_filter->patterns,
+                       (_filter->count + added) *
+                       sizeof(struct d_test_filter_pattern));
+
+    if (!patterns)
+    {
+        return false;
+    }
+
+    _filter->patterns = patterns;
+    start             = _patterns;
+
+    for (;;)
+    {
+        end = strchr(start, D_TEST_FILTER_LIST_SEPARATOR);
+
+        if (!end)
+        {
+            end = start + strlen(start);
+        }
+
+        if (end > start)
+        {
+            if (!d_internal_test_filter_compile_pattern(
+                     &_filter->patterns[_filter->count],
+                     start,
+                     (size_t)(end - start),
+                     _exclude))
+            {
+                return false;
+            }
+
+            _filter->count++;
+
+            if (!_exclude)
+            {
+                _filter->include_count++;
+            }
+        }
+
+        if (*end == '\0')
+        {
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    return true;
+}
+
+/*
+d_test_filter_match
+  Matches a module/block/test path against a filter.  The path may stop at
+any level: a module-only path returns PARTIAL when some of its blocks or
+tests could be selected, so callers can skip whole subtrees that return NONE
+before building or evaluating them.
+
+Parameter(s):
+  _filter: the compiled filter; NULL selects everything
+  _path:   path components, outermost first
+  _depth:  number of path components
+Return:
+  FULL if the path is selected with its whole subtree, PARTIAL if only some
+  descendants may be selected, NONE if nothing under the path is selected.
+*/
+enum DTestFilterMatch
+d_test_filter_match
+(
+    const struct d_test_filter* _filter,
+    const char* const*          _path,
+    size_t                      _depth
+)
+{
+    size_t                i;
+    enum DTestFilterMatch best;
+    enum DTestFilterMatch current;
+
+    if (!_filter)
+    {
+        return D_TEST_FILTER_MATCH_FULL;
+    }
+
+    best = (_filter->include_count == 0) ? D_TEST_FILTER_MATCH_FULL
+                                         : D_TEST_FILTER_MATCH_NONE;
+
+    // strongest include match
+    for (i = 0;
+         (i < _filter->count) && (best != D_TEST_FILTER_MATCH_FULL);
+         i++)
+    {
+        if (_filter->patterns[i].exclude)
+        {
+            continue;
+        }
+
+        current = d_internal_test_filter_match_pattern(&_filter->patterns[i],
+                                                       0,
+                                                       _path,
+                                                       0,
+                                                       _depth);
+
+        if (current > best)
+        {
+            best = current;
+        }
+    }
+
+    if (best == D_TEST_FILTER_MATCH_NONE)
+    {
+        return best;
+    }
+
+    // an exclude only removes the subtree once it matches completely
+    for (i = 0; i < _filter->count; i++)
+    {
+        if ( (_filter->patterns[i].exclude) &&
+             (d_internal_test_filter_match_pattern(&_filter->patterns[i],
+                                                   0,
+                                                   _path,
+                                                   0,
+                                                   _depth) ==
+              D_TEST_FILTER_MATCH_FULL) )
+        {
+            return D_TEST_FILTER_MATCH_NONE;
+        }
+    }
+
+    return best;
+}
+
+/*
+d_test_filter_selects
+  Convenience check for a top-level (module) name.
+
+Parameter(s):
+  _filter: the compiled filter; NULL selects everything
+  _name:   the module name
+Return:
+  true if the module or any of its descendants may be selected.
+*/
+bool
+d_test_filter_selects
+(
+    const struct d_test_filter* _filter,
+    const char*                 _name
+)
+{
+    return (d_test_filter_match(_filter, &_name, 1) !=
+            D_TEST_FILTER_MATCH_NONE);
+}
+
+/*
+d_test_filter_free
+  Frees a filter created by d_test_filter_new.
+
+Parameter(s):
+  _filter: the filter to free; may be NULL
+Return:
+  none.
+*/
+void
+d_test_filter_free
+(
+    struct d_test_filter* _filter
+)
+{
+    size_t i;
+
+    if (!_filter)
+    {
+        return;
+    }
+
+    for (i = 0; i < _filter->count; i++)
+    {
+        d_internal_test_filter_free_pattern(&_filter->patterns[i]);
+    }
+
+    free(_filter->patterns);
+    free(_filter);
+
+    return;
+}
@@ -1,4 +1,5 @@
 #include "..\..\inc\test\test_cvar.h"
+#include <string.h>
 
 
 /******************************************************************************
@@ -17,6 +18,14 @@
 #define D_TEST_CONFIG_KEY_INVALID ((enum DTestConfigKey)UINT32_MAX)
 #endif
 
+// D_INTERNAL_TEST_CONFIG_PRESET_CAPACITY
+//   constant: number of distinct presets d_test_config_new_preset shares;
+// further presets are returned as private configs.
+#define D_INTERNAL_TEST_CONFIG_PRESET_CAPACITY 8
+
+// shared preset configs; each holds one reference for the process lifetime
+static struct d_test_config* g_test_config_presets[D_INTERNAL_TEST_CONFIG_PRESET_CAPACITY];
+
 
  /******************************************************************************
   * OVERRIDE ROW TYPE (PER-CONFIG STORAGE)
@@ -57,28 +66,13 @@ d_internal_test_registry_config_row_from_flag
     uint32_t _flag
 )
 {
-    struct d_test_registry_row* row;
-
     /*
       NOTE:
         DTestConfigKey and DTestMetadataFlag share the same numeric space
-        (both start at 0). Therefore, a simple \"find by flag\" is ambiguous.
-        We must search for a row that matches BOTH:
-          - the flag value, and
-          - the entry kind (IS_CONFIG).
+        (both start at 0), so the lookup must be restricted to IS_CONFIG rows.
+        The registry keeps a direct-index table per kind for this.
     */
-    row = NULL;
-
-    D_TEST_REGISTRY_FOREACH(row)
-    {
-        if ((row->flag == _flag) &&
-            ((row->command_flags & D_TEST_REGISTRY_FLAG_IS_CONFIG) != 0))
-        {
-            return row;
-        }
-    }
-
-    return NULL;
+    return d_test_registry_find_config(_flag);
 }
 
 /*
@@ -92,12 +86,12 @@ d_internal_test_config_has_override
     uint32_t                    _flag
 )
 {
-    if ( (!_config) || (!_config->settings) )
+    if ( (!_config) || (_flag >= D_TEST_CONFIG_KEY_COUNT) )
     {
         return false;
     }
 
-    return d_min_enum_map_contains(_config->settings, (int)_flag);
+    return ((_config->present & (1u << _flag)) != 0);
 }
 
 /*
@@ -111,32 +105,74 @@ d_internal_test_config_get_override_ptr
     uint32_t                    _flag
 )
 {
-    if ( (!_config) || (!_config->settings) )
+    if ( (!_config) || (_flag >= D_TEST_CONFIG_KEY_COUNT) )
     {
         return NULL;
     }
 
-    return d_min_enum_map_get(_config->settings, (int)_flag);
+    return _config->values[_flag];
 }
 
 /*
 d_internal_test_config_set_override
-  Sets an override value for the given flag.
+  Sets an override value for the given flag, first taking a private copy of
+the config if it is shared.
 */
 static bool
 d_internal_test_config_set_override
 (
-    struct d_test_config* _config,
-    uint32_t              _flag,
-    void*                 _value
+    struct d_test_config** _config,
+    uint32_t               _flag,
+    void*                  _value
 )
 {
-    if ( (!_config) || (!_config->settings) )
+    if ( (_flag >= D_TEST_CONFIG_KEY_COUNT) ||
+         (!d_test_config_unshare(_config)) )
     {
         return false;
     }
 
-    return d_min_enum_map_put(_config->settings, (int)_flag, _value);
+    (*_config)->values[_flag] = _value;
+    (*_config)->present      |= (1u << _flag);
+
+    return true;
+}
+
+/*
+d_internal_test_config_clone
+  Makes a private deep copy of a config with a reference count of one.
+*/
+static struct d_test_config*
+d_internal_test_config_clone
+(
+    const struct d_test_config* _other
+)
+{
+    struct d_test_config* copy;
+
+    copy = (struct d_test_config*)malloc(sizeof(*copy));
+
+    if (!copy)
+    {
+        return NULL;
+    }
+
+    // flags, config slots and stage hooks are plain data
+    memcpy(copy, _other, sizeof(*copy));
+    copy->ref_count = 1;
+
+    if (_other->settings)
+    {
+        copy->settings = d_min_enum_map_new_copy(_other->settings);
+
+        if (!copy->settings)
+        {
+            free(copy);
+            return NULL;
+        }
+    }
+
+    return copy;
 }
 
 static union d_test_value
@@ -200,6 +236,7 @@ struct d_test_config*
 
     d_internal_test_registry_init_once();
 
+    // slots, mask and hooks start zeroed; `settings` is allocated on demand
     config = (struct d_test_config*)calloc(1, sizeof(*config));
 
     if (!config)
@@ -207,86 +244,140 @@ struct d_test_config*
         return NULL;
     }
 
-    config->flags    = _flags;
-    config->settings = d_min_enum_map_new();
-
-    if (!config->settings)
-    {
-        free(config);
-        return NULL;
-    }
-
-    config->stage_hooks = NULL;
+    config->ref_count = 1;
+    config->flags     = _flags;
 
     return config;
 }
 
+/*
+d_test_config_new_preset
+  Returns a shared config holding only the preset's message flags.  Every
+caller asking for the same preset gets the same object with its reference
+count raised, so nodes that never override anything cost one pointer.
+Writing through d_test_config_set_* gives the writer a private copy.
+
+Parameter(s):
+  _preset: the preset flags (e.g. D_TEST_CONFIG_PRESET_NORMAL)
+Return:
+  a reference to the preset config, to be released with d_test_config_free,
+  or NULL if memory allocation failed.
+*/
 struct d_test_config*
     d_test_config_new_preset
     (
         uint32_t _preset
     )
 {
+    size_t i;
+
+    for (i = 0; i < D_INTERNAL_TEST_CONFIG_PRESET_CAPACITY; i++)
+    {
+        if (!g_test_config_presets[i])
+        {
+            g_test_config_presets[i] = d_test_config_new(_preset);
+
+            if (!g_test_config_presets[i])
+            {
+                return NULL;
+            }
+        }
+
+        if (g_test_config_presets[i]->flags == _preset)
+        {
+            g_test_config_presets[i]->ref_count++;
+
+            return g_test_config_presets[i];
+        }
+    }
+
+    // cache full: hand out a private config
     return d_test_config_new(_preset);
 }
 
+/*
+d_test_config_new_copy
+  Shares a config.  The copy is the same object with its reference count
+raised; it is duplicated only when one of the holders writes to it.
+
+Parameter(s):
+  _other: the config to share
+Return:
+  a reference to _other, to be released with d_test_config_free, or NULL if
+  _other is NULL.
+*/
 struct d_test_config*
     d_test_config_new_copy
     (
         const struct d_test_config* _other
     )
 {
-    struct d_test_config* copy;
+    struct d_test_config* shared;
 
     if (!_other)
     {
         return NULL;
     }
 
-    d_internal_test_registry_init_once();
+    // the reference count is the only field a shared config ever changes
+    shared = (struct d_test_config*)_other;
+    shared->ref_count++;
 
-    copy = (struct d_test_config*)calloc(1, sizeof(*copy));
+    return shared;
+}
 
-    if (!copy)
+/*
+d_test_config_unshare
+  Ensures the caller holds the only reference to a config before writing to
+it.  A shared config is deep-copied into `*_config` and the caller's
+reference to the original is released.
+
+Parameter(s):
+  _config: the caller's config pointer; may be replaced
+Return:
+  true if `*_config` may be written, false if it is NULL or memory
+  allocation failed (in which case `*_config` is unchanged).
+*/
+bool
+d_test_config_unshare
+(
+    struct d_test_config** _config
+)
+{
+    struct d_test_config* copy;
+
+    if ( (!_config) || (!*_config) )
     {
-        return NULL;
+        return false;
     }
 
-    copy->flags = _other->flags;
-
-    if (_other->settings)
+    if ((*_config)->ref_count <= 1)
     {
-        copy->settings = d_min_enum_map_new_copy(_other->settings);
-
-        if (!copy->settings)
-        {
-            free(copy);
-            return NULL;
-        }
+        return true;
     }
-    else
-    {
-        copy->settings = d_min_enum_map_new();
 
-        if (!copy->settings)
-        {
-            free(copy);
-            return NULL;
-        }
-    }
+    copy = d_internal_test_config_clone(*_config);
 
-    if (_other->stage_hooks)
-    {
-        copy->stage_hooks = d_min_enum_map_new_copy(_other->stage_hooks);
-    }
-    else
+    if (!copy)
     {
-        copy->stage_hooks = NULL;
+        return false;
     }
 
-    return copy;
+    (*_config)->ref_count--;
+    *_config = copy;
+
+    return true;
 }
 
+/*
+d_test_config_free
+  Releases one reference to a config, freeing it with the last one.
+
+Parameter(s):
+  _config: the config to release; may be NULL
+Return:
+  none.
+*/
 void
 d_test_config_free
 (
@@ -298,16 +389,17 @@ d_test_config_free
         return;
     }
 
-    if (_config->settings)
+    if (_config->ref_count > 1)
     {
-        d_min_enum_map_free(_config->settings);
-        _config->settings = NULL;
+        _config->ref_count--;
+
+        return;
     }
 
-    if (_config->stage_hooks)
+    if (_config->settings)
     {
-        d_min_enum_map_free(_config->stage_hooks);
-        _config->stage_hooks = NULL;
+        d_min_enum_map_free(_config->settings);
+        _config->settings = NULL;
     }
 
     free(_config);
@@ -491,14 +583,14 @@ d_test_config_get_ptr
 bool
 d_test_config_set_bool
 (
-    struct d_test_config* _config,
-    uint32_t              _key,
-    bool                  _value
+    struct d_test_config** _config,
+    uint32_t               _key,
+    bool                   _value
 )
 {
     const struct d_test_registry_row* schema_row;
 
-    if (!_config)
+    if ( (!_config) || (!*_config) )
     {
         return false;
     }
@@ -518,14 +610,14 @@ d_test_config_set_bool
 bool
 d_test_config_set_size_t
 (
-    struct d_test_config* _config,
-    uint32_t              _key,
-    size_t                _value
+    struct d_test_config** _config,
+    uint32_t               _key,
+    size_t                 _value
 )
 {
     const struct d_test_registry_row* schema_row;
 
-    if (!_config)
+    if ( (!_config) || (!*_config) )
     {
         return false;
     }
@@ -552,14 +644,14 @@ d_test_config_set_size_t
 bool
 d_test_config_set_int32
 (
-    struct d_test_config* _config,
-    uint32_t              _key,
-    int32_t               _value
+    struct d_test_config** _config,
+    uint32_t               _key,
+    int32_t                _value
 )
 {
     const struct d_test_registry_row* schema_row;
 
-    if (!_config)
+    if ( (!_config) || (!*_config) )
     {
         return false;
     }
@@ -579,14 +671,14 @@ d_test_config_set_int32
 bool
 d_test_config_set_uint32
 (
-    struct d_test_config* _config,
-    uint32_t              _key,
-    uint32_t              _value
+    struct d_test_config** _config,
+    uint32_t               _key,
+    uint32_t               _value
 )
 {
     const struct d_test_registry_row* schema_row;
 
-    if (!_config)
+    if ( (!_config) || (!*_config) )
     {
         return false;
     }
@@ -595,7 +687,12 @@ d_test_config_set_uint32
 
     if (_key == D_TEST_CONFIG_MESSAGE_FLAGS)
     {
-        _config->flags = _value;
+        if (!d_test_config_unshare(_config))
+        {
+            return false;
+        }
+
+        (*_config)->flags = _value;
         return true;
     }
 
@@ -619,14 +716,14 @@ d_test_config_set_uint32
 bool
 d_test_config_set_string
 (
-    struct d_test_config* _config,
-    uint32_t              _key,
-    const char*           _value
+    struct d_test_config** _config,
+    uint32_t               _key,
+    const char*            _value
 )
 {
     const struct d_test_registry_row* schema_row;
 
-    if (!_config)
+    if ( (!_config) || (!*_config) )
     {
         return false;
     }
@@ -646,14 +743,14 @@ d_test_config_set_string
 bool
 d_test_config_set_ptr
 (
-    struct d_test_config* _config,
-    uint32_t              _key,
-    void*                 _value
+    struct d_test_config** _config,
+    uint32_t               _key,
+    void*                  _value
 )
 {
     const struct d_test_registry_row* schema_row;
 
-    if (!_config)
+    if ( (!_config) || (!*_config) )
     {
         return false;
     }
@@ -671,6 +768,225 @@ d_test_config_set_ptr
 }
 
 
+/******************************************************************************
+ * REGISTRY-KEYED ENTRIES
+ *****************************************************************************/
+
+/*
+d_test_config_put
+  Stores a value under a registry row.  Config rows are written to their
+fixed slot (message flags to `flags`); metadata and any other keys go to the
+`settings` map, which is created on first use.  Used by the argument
+validators, which accept a mix of both kinds.
+
+Parameter(s):
+  _config: the caller's config pointer; replaced by a private copy if shared
+  _row:    the registry row naming the key
+  _value:  the pointer-sized value to store
+Return:
+  true if the value was stored, false if an argument was NULL or memory
+  allocation failed.
+*/
+bool
+d_test_config_put
+(
+    struct d_test_config**            _config,
+    const struct d_test_registry_row* _row,
+    void*                             _value
+)
+{
+    struct d_test_config* config;
+
+    if ( (!_row) ||
+         (!d_test_config_unshare(_config)) )
+    {
+        return false;
+    }
+
+    config = *_config;
+
+    if ( ((_row->command_flags & D_TEST_REGISTRY_FLAG_IS_CONFIG) != 0) &&
+         (_row->flag < D_TEST_CONFIG_KEY_COUNT) )
+    {
+        if (_row->flag == D_TEST_CONFIG_MESSAGE_FLAGS)
+        {
+            config->flags = (uint32_t)(uintptr_t)_value;
+
+            return true;
+        }
+
+        return d_internal_test_config_set_override(_config,
+                                                   _row->flag,
+                                                   _value);
+    }
+
+    if (!config->settings)
+    {
+        config->settings = d_min_enum_map_new();
+
+        if (!config->settings)
+        {
+            return false;
+        }
+    }
+
+    return d_min_enum_map_put(config->settings, (int)_row->flag, _value);
+}
+
+
+/******************************************************************************
+ * STAGE HOOKS
+ *****************************************************************************/
+
+/*
+d_test_config_set_stage_hook
+  Sets (or clears, with NULL) the hook for a lifecycle stage.
+
+Parameter(s):
+  _config: the caller's config pointer; replaced by a private copy if shared
+  _stage:  the lifecycle stage
+  _hook:   the hook, or NULL to clear it
+Return:
+  true if the hook was stored, false if _config is NULL or _stage is out of
+  range.
+*/
+bool
+d_test_config_set_stage_hook
+(
+    struct d_test_config** _config,
+    enum DTestStage        _stage,
+    fn_stage               _hook
+)
+{
+    if ( ((size_t)_stage >= D_TEST_STAGE_COUNT) ||
+         (!d_test_config_unshare(_config)) )
+    {
+        return false;
+    }
+
+    (*_config)->stage_hooks[_stage] = _hook;
+
+    return true;
+}
+
+/*
+d_test_config_get_stage_hook
+  Gets the hook for a lifecycle stage.
+
+Parameter(s):
+  _config: the config to read
+  _stage:  the lifecycle stage
+Return:
+  the hook, or NULL if none is set.
+*/
+fn_stage
+d_test_config_get_stage_hook
+(
+    const struct d_test_config* _config,
+    enum DTestStage             _stage
+)
+{
+    if ( (!_config) || ((size_t)_stage >= D_TEST_STAGE_COUNT) )
+    {
+        return NULL;
+    }
+
+    return _config->stage_hooks[_stage];
+}
+
+
+/******************************************************************************
+ * RESOLVED SNAPSHOTS
+ *****************************************************************************/
+
+/*
+d_test_config_resolve
+  Reads every per-node setting from a config (falling back to registry
+defaults) into a flat snapshot.  This is the only place a run pays for map
+and registry lookups; afterwards the snapshot is read field by field.
+
+Parameter(s):
+  _resolved: receives the snapshot
+  _config:   the config to read; NULL yields the registry defaults
+Return:
+  none.
+*/
+void
+d_test_config_resolve
+(
+    struct d_test_resolved_config* _resolved,
+    const struct d_test_config*    _config
+)
+{
+    if (!_resolved)
+    {
+        return;
+    }
+
+    d_internal_test_registry_init_once();
+
+    _resolved->source           = _config;
+    _resolved->timeout_ms       = d_test_config_get_size_t(_config,
+                                      D_TEST_CONFIG_TIMEOUT_MS);
+    _resolved->max_failures     = d_test_config_get_size_t(_config,
+                                      D_TEST_CONFIG_MAX_FAILURES);
+    _resolved->message_flags    = d_test_config_get_uint32(_config,
+                                      D_TEST_CONFIG_MESSAGE_FLAGS);
+    _resolved->priority         = d_test_config_get_int32(_config,
+                                      D_TEST_CONFIG_PRIORITY);
+    _resolved->indent_str       = d_test_config_get_string(_config,
+                                      D_TEST_CONFIG_INDENT_STR);
+    _resolved->indent_max_level = (uint16_t)d_test_config_get_size_t(_config,
+                                      D_TEST_CONFIG_INDENT_MAX_LEVEL);
+    _resolved->enabled          = d_test_config_get_bool(_config,
+                                      D_TEST_CONFIG_ENABLED);
+    _resolved->skip             = d_test_config_get_bool(_config,
+                                      D_TEST_CONFIG_SKIP);
+
+    return;
+}
+
+/*
+d_test_config_resolve_inherited
+  Chooses the snapshot a node runs with.  A parent snapshot takes precedence
+(run-time settings override a node's own config), and is shared by pointer
+rather than copied; otherwise the node's own config is resolved into
+`_storage`.
+
+Parameter(s):
+  _storage: snapshot storage owned by the caller, used only when the node's
+            own config is resolved
+  _parent:  the parent's snapshot, or NULL
+  _own:     the node's own config, or NULL
+Return:
+  the snapshot to use, or NULL if neither a parent snapshot nor an own
+  config exists.
+*/
+const struct d_test_resolved_config*
+d_test_config_resolve_inherited
+(
+    struct d_test_resolved_config*       _storage,
+    const struct d_test_resolved_config* _parent,
+    const struct d_test_config*          _own
+)
+{
+    if (_parent)
+    {
+        return _parent;
+    }
+
+    if ( (!_own) ||
+         (!_storage) )
+    {
+        return NULL;
+    }
+
+    d_test_config_resolve(_storage, _own);
+
+    return _storage;
+}
+
+
 /******************************************************************************
  * KEY LOOKUP
  *****************************************************************************/
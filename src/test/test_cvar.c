@@ -281,11 +281,72 @@ static struct d_registry g_test_registry =
 static union d_test_value g_test_registry_defaults[D_INTERNAL_TEST_REGISTRY_ROW_COUNT];
 static bool               g_test_registry_initialized = false;
 
+// D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY
+//   constant: number of flag values covered by the direct-index tables.
+// DTestConfigKey and DTestMetadataFlag are small dense enums; rows with a
+// larger flag fall back to a linear scan.
+#define D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY 64
+
+/*
+  Direct-index tables, built once at init: slot `flag` holds the row index
+  plus one (0 = no row).  Config and metadata flags share a numeric space, so
+  each kind has its own table; the "any" table keeps the first row for a flag
+  regardless of kind, matching the original table-order scan.
+*/
+static size_t g_test_registry_config_index[D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY];
+static size_t g_test_registry_metadata_index[D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY];
+static size_t g_test_registry_any_index[D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY];
+
 
 /******************************************************************************
  * INTERNAL HELPERS
  *****************************************************************************/
 
+/*
+d_internal_test_registry_index_row
+  Records a row in the direct-index tables for its flag, unless an earlier
+row of the same kind already claimed the slot.
+
+Parameter(s):
+  _index: index of the row in g_test_registry_rows
+Return:
+  none.
+*/
+static void
+d_internal_test_registry_index_row
+(
+    size_t _index
+)
+{
+    const struct d_test_registry_row* row;
+
+    row = &g_test_registry_rows[_index];
+
+    if (row->flag >= D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY)
+    {
+        return;
+    }
+
+    if (!g_test_registry_any_index[row->flag])
+    {
+        g_test_registry_any_index[row->flag] = _index + 1;
+    }
+
+    if ( ((row->command_flags & D_TEST_REGISTRY_FLAG_IS_CONFIG) != 0) &&
+         (!g_test_registry_config_index[row->flag]) )
+    {
+        g_test_registry_config_index[row->flag] = _index + 1;
+    }
+
+    if ( ((row->command_flags & D_TEST_REGISTRY_FLAG_IS_METADATA) != 0) &&
+         (!g_test_registry_metadata_index[row->flag]) )
+    {
+        g_test_registry_metadata_index[row->flag] = _index + 1;
+    }
+
+    return;
+}
+
 static void
 d_internal_test_registry_init_once
 (
@@ -305,6 +366,12 @@ d_internal_test_registry_init_once
         g_test_registry_defaults[i] = g_test_registry_rows[i].value;
     }
 
+    // build the flag -> row tables; the first row for a flag wins
+    for (i = 0; i < D_INTERNAL_TEST_REGISTRY_ROW_COUNT; i++)
+    {
+        d_internal_test_registry_index_row(i);
+    }
+
     // build the sorted lookup table from row keys
     d_registry_rebuild_lookup(&g_test_registry);
 
@@ -323,11 +390,26 @@ d_internal_test_registry_init_once
     return;
 }
 
+/*
+d_internal_test_registry_find_by_flag_ex
+  Finds the row for a flag through a direct-index table.
+
+Parameter(s):
+  _table:         direct-index table to consult
+  _required_kind: row flag the row must carry (0 = any kind); used only by
+                  the fallback scan for flags beyond the table
+  _flag:          DTestConfigKey or DTestMetadataFlag value
+  _out_index:     receives the row index (can be NULL)
+Return:
+  the row, or NULL if no row of the requested kind has this flag.
+*/
 static struct d_test_registry_row*
 d_internal_test_registry_find_by_flag_ex
 (
-    uint32_t _flag,
-    size_t*  _out_index
+    const size_t* _table,
+    uint16_t      _required_kind,
+    uint32_t      _flag,
+    size_t*       _out_index
 )
 {
     size_t i;
@@ -337,9 +419,29 @@ d_internal_test_registry_find_by_flag_ex
         *(_out_index) = 0;
     }
 
+    if (_flag < D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY)
+    {
+        i = _table[_flag];
+
+        if (!i)
+        {
+            return NULL;
+        }
+
+        if (_out_index)
+        {
+            *_out_index = i - 1;
+        }
+
+        return &g_test_registry_rows[i - 1];
+    }
+
+    // flags outside the tables are rare; scan in table order
     for (i = 0; i < D_INTERNAL_TEST_REGISTRY_ROW_COUNT; i++)
     {
-        if (g_test_registry_rows[i].flag == _flag)
+        if ( (g_test_registry_rows[i].flag == _flag) &&
+             ( (!_required_kind) ||
+               ((g_test_registry_rows[i].command_flags & _required_kind) != 0) ) )
         {
             if (_out_index)
             {
@@ -404,7 +506,40 @@ d_test_registry_find_by_flag
 {
     d_internal_test_registry_init_once();
 
-    return d_internal_test_registry_find_by_flag_ex(_flag, NULL);
+    return d_internal_test_registry_find_by_flag_ex(g_test_registry_any_index,
+                                                    0,
+                                                    _flag,
+                                                    NULL);
+}
+
+struct d_test_registry_row*
+d_test_registry_find_config
+(
+    uint32_t _flag
+)
+{
+    d_internal_test_registry_init_once();
+
+    return d_internal_test_registry_find_by_flag_ex(
+               g_test_registry_config_index,
+               D_TEST_REGISTRY_FLAG_IS_CONFIG,
+               _flag,
+               NULL);
+}
+
+struct d_test_registry_row*
+d_test_registry_find_metadata
+(
+    uint32_t _flag
+)
+{
+    d_internal_test_registry_init_once();
+
+    return d_internal_test_registry_find_by_flag_ex(
+               g_test_registry_metadata_index,
+               D_TEST_REGISTRY_FLAG_IS_METADATA,
+               _flag,
+               NULL);
 }
 
 bool
@@ -424,7 +559,10 @@ d_test_registry_set
         return false;
     }
 
-    row = d_internal_test_registry_find_by_flag_ex(_flag, NULL);
+    row = d_internal_test_registry_find_by_flag_ex(g_test_registry_any_index,
+                                                   0,
+                                                   _flag,
+                                                   NULL);
 
     if (!row)
     {
@@ -446,7 +584,10 @@ d_test_registry_get
 
     d_internal_test_registry_init_once();
 
-    row = d_internal_test_registry_find_by_flag_ex(_flag, NULL);
+    row = d_internal_test_registry_find_by_flag_ex(g_test_registry_any_index,
+                                                   0,
+                                                   _flag,
+                                                   NULL);
 
     if (!row)
     {
@@ -473,7 +614,10 @@ d_test_registry_reset
     }
 
     idx = 0;
-    row = d_internal_test_registry_find_by_flag_ex(_flag, &idx);
+    row = d_internal_test_registry_find_by_flag_ex(g_test_registry_any_index,
+                                                   0,
+                                                   _flag,
+                                                   &idx);
 
     if (!row)
     {
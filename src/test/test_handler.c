@@ -259,11 +259,12 @@ bool d_test_handler_run_block(struct d_test_handler* _handler, struct d_test_blo
     context.event_type = D_TEST_EVENT_SETUP;
     d_test_handler_emit_event(_handler, D_TEST_EVENT_SETUP, &context);
 
+    // the config cannot change between children; choose it once
+    struct d_test_config* config = _run_config ? _run_config :
+        (_block->override_block ? _block->block_settings : _handler->default_config);
+
     for (i = 0; i < _block->count; i++)
     {
-        struct d_test_config* config = _run_config ? _run_config :
-            (_block->override_block ? _block->block_settings : _handler->default_config);
-
         if (!d_test_handler_run_test_type(_handler, &_block->tests[i], config))
         {
             all_passed = false;
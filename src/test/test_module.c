@@ -77,8 +77,7 @@ d_internal_test_module_add_children
 {
     size_t i;
 
-    if ( (!_module)           ||
-         (!_module->children) ||
+    if ( (!_module) ||
          ( (!_children) && _child_count > 0) )
     {
         return false;
@@ -97,7 +96,8 @@ d_internal_test_module_add_children
             continue;
         }
 
-        if (!d_ptr_vector_push_back(_module->children, _children[i]))
+        // copied in; the caller keeps ownership of the wrapper
+        if (!d_test_children_push(&_module->children, _children[i]))
         {
             return false;
         }
@@ -127,25 +127,13 @@ d_test_module_validate_args
         return NULL;
     }
 
-    config = d_test_config_new(D_TEST_MODE_NORMAL);
+    config = d_test_config_new_preset(D_TEST_MODE_NORMAL);
 
     if (!config)
     {
         return NULL;
     }
 
-    if (!config->settings)
-    {
-        config->settings = d_min_enum_map_new();
-
-        if (!config->settings)
-        {
-            d_test_config_free(config);
-
-            return NULL;
-        }
-    }
-
     for (i = 0; i < _arg_count; i++)
     {
         if (!_args[i].key)
@@ -164,7 +152,7 @@ d_test_module_validate_args
         }
 
         // store with the registry flag as the key
-        d_min_enum_map_put(config->settings, (int)row->flag, (void*)_args[i].value);
+        d_test_config_put(&config, row, (void*)_args[i].value);
     }
 
     return config;
@@ -190,22 +178,14 @@ d_test_module_new
         return NULL;
     }
 
-    // create children vector
-    new_module->children = d_ptr_vector_new_default();
-
-    if (!new_module->children)
-    {
-        free(new_module);
-
-        return NULL;
-    }
+    // children are stored inline until they outgrow the small buffer
+    d_test_children_init(&new_module->children);
 
     // create config
-    new_module->config = d_test_config_new(D_TEST_DEFAULT_MODULE_FLAGS);
+    new_module->config = d_test_config_new_preset(D_TEST_DEFAULT_MODULE_FLAGS);
 
     if (!new_module->config)
     {
-        d_ptr_vector_free(new_module->children);
         free(new_module);
 
         return NULL;
@@ -217,7 +197,6 @@ d_test_module_new
     if (!new_module->result)
     {
         d_test_config_free(new_module->config);
-        d_ptr_vector_free(new_module->children);
         free(new_module);
 
         return NULL;
@@ -288,16 +267,17 @@ d_test_module_new_args
 bool
 d_test_module_add_child
 (
-    struct d_test_module*          _module,
-    const struct d_test_tree_node* _child
+    struct d_test_module*     _module,
+    const struct d_test_type* _child
 )
 {
-    if ( (!_module) || (!_module->children) || (!_child) )
+    if ( (!_module) || (!_child) )
     {
         return false;
     }
 
-    return d_ptr_vector_push_back(_module->children, (void*)_child);
+    // stored by value; the caller keeps ownership of `_child`
+    return d_test_children_push(&_module->children, _child);
 }
 
 
@@ -307,12 +287,12 @@ d_test_module_child_count
     const struct d_test_module* _module
 )
 {
-    if ( (!_module) || (!_module->children) )
+    if (!_module)
     {
         return 0;
     }
 
-    return d_ptr_vector_size(_module->children);
+    return _module->children.count;
 }
 
 
@@ -323,13 +303,12 @@ d_test_module_get_child_at
     size_t                      _index
 )
 {
-    if ( (!_module) || (!_module->children) )
+    if (!_module)
     {
         return NULL;
     }
 
-    return (struct d_test_type*)d_ptr_vector_at(_module->children, 
-                                                 (d_index)_index);
+    return d_test_children_at(&_module->children, _index);
 }
 
 
@@ -389,6 +368,55 @@ d_test_module_get_name
                                            D_TEST_METADATA_NAME);
 }
 
+/*
+d_test_module_get_dependencies
+  Gets the names of the modules this module depends on, from the
+  D_TEST_METADATA_DEPENDENCIES setting (a NULL-terminated array of names).
+*/
+const char* const*
+d_test_module_get_dependencies
+(
+    const struct d_test_module* _module
+)
+{
+    if ( (!_module)         || 
+         (!_module->config) || 
+         (!_module->config->settings) )
+    {
+        return NULL;
+    }
+
+    return (const char* const*)d_min_enum_map_get(_module->config->settings,
+                                                  D_TEST_METADATA_DEPENDENCIES);
+}
+
+/*
+d_test_module_dependency_count
+  Gets the number of names in the module's D_TEST_METADATA_DEPENDENCIES.
+*/
+size_t
+d_test_module_dependency_count
+(
+    const struct d_test_module* _module
+)
+{
+    const char* const* dependencies;
+    size_t             count;
+
+    dependencies = d_test_module_get_dependencies(_module);
+    count        = 0;
+
+    if (dependencies)
+    {
+        while (dependencies[count])
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
 
 /******************************************************************************
  * STAGE HOOK FUNCTIONS
@@ -402,13 +430,9 @@ d_test_module_set_stage_hook
     fn_stage              _hook
 )
 {
-    return ( (!_module)         ||
-             (!_module->config) ||
-             (!_module->config->stage_hooks) )
+    return (!_module)
         ? false
-        : d_min_enum_map_put(_module->config->stage_hooks, 
-                             _stage, 
-                             _hook);
+        : d_test_config_set_stage_hook(&_module->config, _stage, _hook);
 }
 
 fn_stage
@@ -418,12 +442,9 @@ d_test_module_get_stage_hook
     enum DTestStage             _stage
 )
 {
-    return ( (!_module)         ||
-             (!_module->config) ||
-             (!_module->config->stage_hooks) )
+    return (!_module)
         ? NULL
-        : d_min_enum_map_get(_module->config->stage_hooks, 
-                             _stage);
+        : d_test_config_get_stage_hook(_module->config, _stage);
 }
 
 
@@ -433,7 +454,8 @@ d_test_module_get_stage_hook
 
 /*
 d_test_module_run
-  Runs all children in the module.
+  Runs all children in the module.  Parent settings are resolved once into a
+  snapshot; see d_test_module_run_resolved.
 
 Parameter(s):
   _module:          the module to run.
@@ -448,24 +470,57 @@ d_test_module_run
     struct d_test_config* _parent_settings
 )
 {
-    size_t                i;
-    size_t                child_count;
-    struct d_test_type*   child;
-    struct d_test_config* effective;
-    fn_stage              setup_hook;
-    fn_stage              teardown_hook;
-    bool                  all_passed;
-    bool                  child_passed;
+    struct d_test_resolved_config resolved;
+
+    if (!_parent_settings)
+    {
+        return d_test_module_run_resolved(_module, NULL);
+    }
+
+    d_test_config_resolve(&resolved, _parent_settings);
+
+    return d_test_module_run_resolved(_module, &resolved);
+}
+
+/*
+d_test_module_run_resolved
+  Runs all children in the module with an already-resolved parent snapshot.
+  The module's effective snapshot is chosen once and passed to every block by
+  pointer.
+
+Parameter(s):
+  _module: the module to run.
+  _parent: parent snapshot (takes precedence), or NULL to resolve the
+           module's own config.
+Return:
+  true if all children passed.
+*/
+bool
+d_test_module_run_resolved
+(
+    struct d_test_module*                _module,
+    const struct d_test_resolved_config* _parent
+)
+{
+    size_t                               i;
+    size_t                               child_count;
+    struct d_test_type*                  child;
+    struct d_test_resolved_config        storage;
+    const struct d_test_resolved_config* effective;
+    fn_stage                             setup_hook;
+    fn_stage                             teardown_hook;
+    bool                                 all_passed;
+    bool                                 child_passed;
 
     if ( (!_module) || (!_module->result) )
     {
         return false;
     }
 
-    // get effective settings
-    effective = d_test_module_get_effective_settings(_module,
-                                                     _parent_settings,
-                                                     NULL);
+    // get effective settings, once for the whole module
+    effective = d_test_config_resolve_inherited(&storage,
+                                                _parent,
+                                                _module->config);
 
     // reset results
     d_test_module_reset_result(_module);
@@ -495,7 +550,8 @@ d_test_module_run
             continue;
         }
 
-        child_passed = d_test_block_run(child->D_KEYWORD_TEST_BLOCK, effective);
+        child_passed = d_test_block_run_resolved(child->D_KEYWORD_TEST_BLOCK,
+                                                 effective);
 
         if (child_passed)
         {
@@ -729,10 +785,7 @@ d_test_module_free
         return;
     }
 
-    if (_test_module->children)
-    {
-        d_ptr_vector_free(_test_module->children);
-    }
+    d_test_children_clear(&_test_module->children);
 
     if (_test_module->config)
     {
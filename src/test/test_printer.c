@@ -1,531 +1,618 @@
+// copy_file_range (used for prepend) is a GNU extension
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
 #include "..\..\inc\test\test_printer.h"
+#include "..\..\inc\dfile.h"
+#include <errno.h>
+#include <stdarg.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+    #include <windows.h>
+#else
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #if defined(__linux__)
+        #include <sys/sendfile.h>
+    #endif
+#endif
+
+
+// D_TEST_INTERNAL_THREAD_LOCAL
+//   macro: storage class for per-thread state (the stdout scratch buffer).
+#if defined(_MSC_VER)
+    #define D_TEST_INTERNAL_THREAD_LOCAL __declspec(thread)
+#elif ( defined(__STDC_VERSION__) &&  \
+        (__STDC_VERSION__ >= 201112L) )
+    #define D_TEST_INTERNAL_THREAD_LOCAL _Thread_local
+#else
+    #define D_TEST_INTERNAL_THREAD_LOCAL __thread
+#endif
+
+// d_test_internal_print_scratch
+//   variable: buffer the stdout printers render into on this thread.  It is
+// allocated on first use and keeps its capacity between calls, so printing
+// does not touch the heap once the largest layout has been rendered.
+static D_TEST_INTERNAL_THREAD_LOCAL struct d_test_string_buffer
+    d_test_internal_print_scratch = { NULL, 0, 0 };
+
+// D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY
+//   macro (internal): shared body of the stdout printers.  Renders into this
+// thread's scratch buffer through `render_call` (which refers to `buffer`)
+// and flushes it to stdout, so every layout is defined once, by its
+// *_to_buffer function.
+#define D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(render_call)                    \
+    struct d_test_string_buffer* buffer;                                     \
+                                                                             \
+    buffer = &d_test_internal_print_scratch;                                 \
+                                                                             \
+    if ( (!buffer->data) &&                                                  \
+         (!d_test_string_buffer_init(buffer, 0)) )                           \
+    {                                                                        \
+        return;                                                              \
+    }                                                                        \
+                                                                             \
+    if (render_call)                                                         \
+    {                                                                        \
+        d_test_string_buffer_flush(buffer, stdout);                          \
+    }                                                                        \
+                                                                             \
+    d_test_string_buffer_clear(buffer);
+
+// D_INTERNAL_TEST_PRINT_TO_STRING_BODY
+//   macro (internal): shared body of the *_to_string functions.  Renders into
+// a fresh buffer through `render_call` (which refers to `buffer`) and hands
+// the buffer's storage to the caller.
+#define D_INTERNAL_TEST_PRINT_TO_STRING_BODY(render_call)                    \
+    struct d_test_string_buffer* buffer;                                     \
+                                                                             \
+    buffer = d_test_string_buffer_new(D_TEST_PRINT_INITIAL_BUFFER_SIZE);     \
+                                                                             \
+    if (!buffer)                                                             \
+    {                                                                        \
+        return NULL;                                                         \
+    }                                                                        \
+                                                                             \
+    if (!(render_call))                                                      \
+    {                                                                        \
+        d_test_string_buffer_free(buffer);                                   \
+                                                                             \
+        return NULL;                                                         \
+    }                                                                        \
+                                                                             \
+    return d_test_string_buffer_finalize(buffer);
 
 
 //=============================================================================
-// FRAMEWORK HEADER FUNCTIONS
+// STRING BUFFER FUNCTIONS
 //=============================================================================
 
 /*
-d_test_print_framework_header
-  Prints standardized header for the test framework with version info,
-  platform details, and testing philosophy.
+d_test_string_buffer_new
+  Allocates a new heap-owned string buffer with the given initial capacity.
 
 Parameter(s):
-  _framework_name: name of the framework being tested
-  _framework_desc: description of the test suite (NULL uses default)
+  _initial_capacity: initial capacity in bytes (0 uses the default)
 Return:
-  none
+  Pointer to the new buffer, or NULL on allocation failure.
 */
-void
-d_test_print_framework_header
+struct d_test_string_buffer*
+d_test_string_buffer_new
 (
-    const char* _framework_name,
-    const char* _framework_desc
+    size_t _initial_capacity
 )
 {
-    const char* desc = (_framework_desc) ? _framework_desc :
-                                           D_TEST_PRINT_DEFAULT_FRAMEWORK_DESC;
+    struct d_test_string_buffer* buffer;
+
+    buffer = malloc(sizeof(struct d_test_string_buffer));
+
+    if (!buffer)
+    {
+        return NULL;
+    }
 
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("%s - %s\n", _framework_name, desc);
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("Framework Version: %s\n", D_TEST_PRINT_DEFAULT_VERSION);
-    printf("Test Framework:    Standalone Testing (test_standalone.h)\n");
-    printf("Target Platform:   Cross-Platform C99/C11\n");
-    printf("Test Philosophy:   \"dTest -- for those who DETEST testing\"\n\n");
-    
-    d_test_print_testing_approach();
+    if (!d_test_string_buffer_init(buffer, _initial_capacity))
+    {
+        free(buffer);
+
+        return NULL;
+    }
+
+    return buffer;
 }
 
 /*
-d_test_print_framework_header_custom
-  Prints customized framework header with user-specified version and details.
+d_test_string_buffer_init
+  Initializes a caller-owned string buffer (e.g. one on the stack).  The
+  buffer can then be rendered into repeatedly; clearing it keeps its storage
+  so repeated renders do not reallocate.
 
 Parameter(s):
-  _framework_name: name of the framework
-  _framework_desc: description of the test suite
-  _version: version string
-  _test_framework: name of testing framework being used
-  _platform: target platform description
+  _buffer:           buffer to initialize
+  _initial_capacity: initial capacity in bytes (0 uses the default)
 Return:
-  none
+  true if storage was allocated, false otherwise.
 */
-void
-d_test_print_framework_header_custom
+bool
+d_test_string_buffer_init
 (
-    const char* _framework_name,
-    const char* _framework_desc,
-    const char* _version,
-    const char* _test_framework,
-    const char* _platform
+    struct d_test_string_buffer* _buffer,
+    size_t                       _initial_capacity
 )
 {
-    const char* desc = (_framework_desc) ? _framework_desc :
-                                           D_TEST_PRINT_DEFAULT_FRAMEWORK_DESC;
-    const char* ver = (_version) ? _version : D_TEST_PRINT_DEFAULT_VERSION;
-    const char* test_fw = (_test_framework) ? _test_framework : 
-                                              "Standalone Testing (test_standalone.h)";
-    const char* plat = (_platform) ? _platform : "Cross-Platform C99/C11";
+    if (!_buffer)
+    {
+        return false;
+    }
+
+    if (_initial_capacity == 0)
+    {
+        _initial_capacity = D_TEST_PRINT_INITIAL_BUFFER_SIZE;
+    }
+
+    _buffer->data     = malloc(_initial_capacity);
+    _buffer->size     = 0;
+    _buffer->capacity = 0;
+
+    if (!_buffer->data)
+    {
+        return false;
+    }
 
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("%s - %s\n", _framework_name, desc);
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("Framework Version: %s\n", ver);
-    printf("Test Framework:    %s\n", test_fw);
-    printf("Target Platform:   %s\n", plat);
-    printf("Test Philosophy:   \"dTest -- for those who DETEST testing\"\n\n");
-    
-    d_test_print_testing_approach();
+    _buffer->data[0]  = '\0';
+    _buffer->capacity = _initial_capacity;
+
+    return true;
 }
 
 /*
-d_test_print_testing_approach
-  Prints the testing approach philosophy and methodology section.
+d_test_string_buffer_reserve
+  Ensures the buffer can hold `_additional` more characters plus the null
+  terminator, growing geometrically if it cannot.
 
 Parameter(s):
-  none
+  _buffer:     buffer to grow
+  _additional: number of characters about to be appended
 Return:
-  none
+  true if the buffer has enough room, false on allocation failure.
 */
-void
-d_test_print_testing_approach
+bool
+d_test_string_buffer_reserve
 (
-    void
+    struct d_test_string_buffer* _buffer,
+    size_t                       _additional
 )
 {
-    printf("TESTING APPROACH:\n");
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("%s Bootstrap Testing: Using standalone framework to test core modules\n", 
-           TEST_INFO_SYMBOL);
-    printf("%s Meta-Testing: Testing the testing framework itself (d_test)\n", 
-           TEST_INFO_SYMBOL);
-    printf("%s Foundation First: Core data structures before higher-level modules\n", 
-           TEST_INFO_SYMBOL);
-    printf("%s Comprehensive: Edge cases, memory management, and error conditions\n", 
-           TEST_INFO_SYMBOL);
-    printf("%s Production Ready: Tests designed for CI/CD integration\n", 
-           TEST_INFO_SYMBOL);
-    printf("\n");
-}
+    size_t required;
+    size_t new_capacity;
+    char*  new_data;
 
-//=============================================================================
-// MODULE HEADER FUNCTIONS
-//=============================================================================
+    if (!_buffer)
+    {
+        return false;
+    }
+
+    required = _buffer->size + _additional + 1;
+
+    if (required <= _buffer->capacity)
+    {
+        return true;
+    }
+
+    new_capacity = (_buffer->capacity > 0) ? _buffer->capacity
+                                           : D_TEST_PRINT_INITIAL_BUFFER_SIZE;
+
+    while (new_capacity < required)
+    {
+        new_capacity *= 2;
+    }
+
+    new_data = realloc(_buffer->data, new_capacity);
+
+    if (!new_data)
+    {
+        return false;
+    }
+
+    if (!_buffer->data)
+    {
+        new_data[0] = '\0';
+    }
+
+    _buffer->data     = new_data;
+    _buffer->capacity = new_capacity;
+
+    return true;
+}
 
 /*
-d_test_print_module_header
-  Prints standardized header for individual module test sections.
+d_test_string_buffer_append
+  Appends a null-terminated string to the buffer.
 
 Parameter(s):
-  _module_name: name of the module being tested
-  _description: brief description of the module's purpose
+  _buffer: buffer to append to
+  _str:    string to append
 Return:
-  none
+  true on success, false on invalid arguments or allocation failure.
 */
-void
-d_test_print_module_header
+bool
+d_test_string_buffer_append
 (
-    const char* _module_name,
-    const char* _description
+    struct d_test_string_buffer* _buffer,
+    const char*                  _str
 )
 {
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("TESTING MODULE: %s\n", _module_name);
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("Description: %s\n", _description);
-    printf("Starting module test suite...\n");
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
+    size_t length;
+
+    if ( (!_buffer) ||
+         (!_str) )
+    {
+        return false;
+    }
+
+    length = strlen(_str);
+
+    if (!d_test_string_buffer_reserve(_buffer, length))
+    {
+        return false;
+    }
+
+    d_memcpy(_buffer->data + _buffer->size, _str, length + 1);
+    _buffer->size += length;
+
+    return true;
 }
 
 /*
-d_test_print_module_header_detailed
-  Prints detailed module header with additional information.
+d_test_string_buffer_append_format
+  Appends printf-style formatted text to the buffer.  Formats directly into
+  the buffer's spare capacity and only grows (and re-formats) when the text
+  does not fit.
 
 Parameter(s):
-  _module_name: name of the module
-  _description: module description
-  _file_path: path to module source file
-  _test_count: number of unit tests to be run
+  _buffer: buffer to append to
+  _format: printf-style format string
+  ...:     format arguments
 Return:
-  none
+  true on success, false on invalid arguments, encoding or allocation failure.
 */
-void
-d_test_print_module_header_detailed
+bool
+d_test_string_buffer_append_format
 (
-    const char* _module_name,
-    const char* _description,
-    const char* _file_path,
-    size_t      _test_count
+    struct d_test_string_buffer* _buffer,
+    const char*                  _format,
+    ...
 )
 {
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("TESTING MODULE: %s\n", _module_name);
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("Description: %s\n", _description);
-    if (_file_path)
+    va_list args;
+    va_list args_copy;
+    int     needed;
+
+    if ( (!_buffer) ||
+         (!_format) ||
+         (!d_test_string_buffer_reserve(_buffer, 0)) )
     {
-        printf("Source File: %s\n", _file_path);
+        return false;
     }
-    printf("Test Count:  %zu unit tests\n", _test_count);
-    printf("Starting module test suite...\n");
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-}
 
-//=============================================================================
-// PROGRESS AND STATUS FUNCTIONS
-//=============================================================================
+    va_start(args, _format);
+    va_copy(args_copy, args);
+
+    needed = vsnprintf(_buffer->data + _buffer->size,
+                       _buffer->capacity - _buffer->size,
+                       _format,
+                       args);
+
+    va_end(args);
+
+    if (needed < 0)
+    {
+        va_end(args_copy);
+        _buffer->data[_buffer->size] = '\0';
+
+        return false;
+    }
+
+    // output was truncated; grow and format again
+    if ((size_t)needed >= _buffer->capacity - _buffer->size)
+    {
+        if (!d_test_string_buffer_reserve(_buffer, (size_t)needed))
+        {
+            va_end(args_copy);
+            _buffer->data[_buffer->size] = '\0';
+
+            return false;
+        }
+
+        vsnprintf(_buffer->data + _buffer->size,
+                  _buffer->capacity - _buffer->size,
+                  _format,
+                  args_copy);
+    }
+
+    va_end(args_copy);
+    _buffer->size += (size_t)needed;
+
+    return true;
+}
 
 /*
-d_test_print_test_start
-  Prints a message indicating a specific test is starting.
+d_test_string_buffer_finalize
+  Releases ownership of the buffer's string to the caller and frees the
+  buffer structure itself.
 
 Parameter(s):
-  _test_name: name of the test being started
+  _buffer: heap-owned buffer from d_test_string_buffer_new
 Return:
-  none
+  The buffer's string (caller must free), or NULL if `_buffer` is NULL.
 */
-void
-d_test_print_test_start
+char*
+d_test_string_buffer_finalize
 (
-    const char* _test_name
+    struct d_test_string_buffer* _buffer
 )
 {
-    printf("%sRunning: %s...\n", D_INDENT, _test_name);
+    char* result;
+
+    if (!_buffer)
+    {
+        return NULL;
+    }
+
+    result = _buffer->data;
+    free(_buffer);
+
+    return result;
 }
 
 /*
-d_test_print_test_result
-  Prints the result of a completed test.
+d_test_string_buffer_free
+  Frees a heap-owned buffer and its storage.
 
 Parameter(s):
-  _test_name: name of the completed test
-  _passed: whether the test passed
+  _buffer: heap-owned buffer from d_test_string_buffer_new (may be NULL)
 Return:
   none
 */
 void
-d_test_print_test_result
+d_test_string_buffer_free
 (
-    const char* _test_name,
-    bool        _passed
+    struct d_test_string_buffer* _buffer
 )
 {
-    if (_passed)
-    {
-        printf("%s%s %s: PASSED\n", D_INDENT, TEST_PASS_SYMBOL, _test_name);
-    }
-    else
+    if (!_buffer)
     {
-        printf("%s%s %s: FAILED\n", D_INDENT, TEST_FAIL_SYMBOL, _test_name);
+        return;
     }
+
+    free(_buffer->data);
+    free(_buffer);
 }
 
 /*
-d_test_print_progress
-  Prints progress indicator showing current position in test suite.
+d_test_string_buffer_clear
+  Empties the buffer while keeping its capacity for the next render.
 
 Parameter(s):
-  _current: current test number
-  _total:   total number of tests
+  _buffer: buffer to clear
 Return:
   none
 */
 void
-d_test_print_progress
+d_test_string_buffer_clear
 (
-    size_t _current,
-    size_t _total
+    struct d_test_string_buffer* _buffer
 )
 {
-    double percent = (_total > 0) ? ((double)_current / (double)_total * 100.0) : 0.0;
-    printf("%sProgress: [%zu/%zu] (%.1f%%)\n", D_INDENT, _current, _total, percent);
-}
+    if (!_buffer)
+    {
+        return;
+    }
 
-//=============================================================================
-// RESULT SUMMARY FUNCTIONS
-//=============================================================================
+    _buffer->size = 0;
+
+    if (_buffer->data)
+    {
+        _buffer->data[0] = '\0';
+    }
+}
 
 /*
-d_test_print_module_results
-  Prints standardized results summary for a completed module test suite.
+d_test_string_buffer_flush
+  Writes the buffer's contents to a stream and clears the buffer, keeping its
+  capacity.  Used to stream rendered output one section at a time.
 
 Parameter(s):
-  _module_name:    name of the tested module
-  _module_counter: test counter containing module-specific results
-  _module_result:  boolean indicating overall module test success
+  _buffer: buffer to flush
+  _file:   destination stream
 Return:
-  none
+  true if all bytes were written, false otherwise.
 */
-void
-d_test_print_module_results
+bool
+d_test_string_buffer_flush
 (
-    const char*                  _module_name,
-    const struct d_test_counter* _module_counter,
-    bool                         _module_result
+    struct d_test_string_buffer* _buffer,
+    FILE*                        _file
 )
 {
-    printf("\n");
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("MODULE RESULTS: %s\n", _module_name);
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    
-    // Assertion statistics
-    printf("Assertions: %zu/%zu passed (%.2f%%)\n",
-        _module_counter->assertions_passed, 
-        _module_counter->assertions_total,
-        _module_counter->assertions_total > 0 ? 
-            (double)_module_counter->assertions_passed / 
-            (double)_module_counter->assertions_total * 100.0 : 0.0);
-    
-    // Unit test statistics
-    printf("Unit Tests: %zu/%zu passed (%.2f%%)\n",
-        _module_counter->tests_passed,
-        _module_counter->tests_run,
-        _module_counter->tests_run > 0 ? 
-            (double)_module_counter->tests_passed / 
-            (double)_module_counter->tests_run * 100.0 : 0.0);
-
-    // Overall status
-    if (_module_result)
-    {
-        printf("Status: %s %s MODULE PASSED\n", TEST_SUCCESS_SYMBOL, _module_name);
+    if ( (!_buffer) ||
+         (!_file) )
+    {
+        return false;
     }
-    else
+
+    if ( (_buffer->size > 0) &&
+         (fwrite(_buffer->data, 1, _buffer->size, _file) != _buffer->size) )
     {
-        printf("Status: %s %s MODULE FAILED\n", TEST_FAIL_SYMBOL, _module_name);
+        return false;
     }
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("\n");
+
+    d_test_string_buffer_clear(_buffer);
+
+    return true;
 }
 
 /*
-d_test_print_comprehensive_results
-  Prints final comprehensive test results with detailed statistics.
+d_test_string_buffer_release
+  Frees the storage of a caller-owned buffer (see d_test_string_buffer_init)
+  without freeing the structure itself.
 
 Parameter(s):
-  _overall_counter: cumulative results from all modules
-  _overall_result:  whether all tests passed
-  _modules_tested:  number of modules included in test run
-  _modules_passed:  number of modules that passed all tests
+  _buffer: caller-owned buffer
 Return:
   none
 */
 void
-d_test_print_comprehensive_results
+d_test_string_buffer_release
 (
-    const struct d_test_counter* _overall_counter,
-    bool                         _overall_result,
-    size_t                       _modules_tested,
-    size_t                       _modules_passed
+    struct d_test_string_buffer* _buffer
 )
 {
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("COMPREHENSIVE TEST RESULTS\n");
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    
-    // Module-level results
-    printf("MODULE SUMMARY:\n");
-    printf("  Modules Tested: %zu\n", _modules_tested);
-    printf("  Modules Passed: %zu\n", _modules_passed);
-    printf("  Module Success Rate: %.2f%%\n",
-        _modules_tested > 0 ? 
-            (double)_modules_passed / (double)_modules_tested * 100.0 : 0.0);
-    printf("\n");
-    
-    // Assertion-level results
-    printf("ASSERTION SUMMARY:\n");
-    printf("  Total Assertions: %zu\n", _overall_counter->assertions_total);
-    printf("  Assertions Passed: %zu\n", _overall_counter->assertions_passed);
-    printf("  Assertions Failed: %zu\n", 
-        _overall_counter->assertions_total - _overall_counter->assertions_passed);
-    printf("  Assertion Success Rate: %.2f%%\n",
-        _overall_counter->assertions_total > 0 ? 
-            (double)_overall_counter->assertions_passed / 
-            (double)_overall_counter->assertions_total * 100.0 : 0.0);
-    printf("\n");
-    
-    // Unit test-level results
-    printf("UNIT TEST SUMMARY:\n");
-    printf("  Total Unit Tests: %zu\n", _overall_counter->tests_run);
-    printf("  Unit Tests Passed: %zu\n", _overall_counter->tests_passed);
-    printf("  Unit Tests Failed: %zu\n", 
-        _overall_counter->tests_run - _overall_counter->tests_passed);
-    printf("  Unit Test Success Rate: %.2f%%\n",
-        _overall_counter->tests_run > 0 ? 
-            (double)_overall_counter->tests_passed / 
-            (double)_overall_counter->tests_run * 100.0 : 0.0);
-    printf("\n");
-    
-    // Overall assessment
-    printf("OVERALL ASSESSMENT:\n");
-    if (_overall_result && 
-        _overall_counter->assertions_passed == _overall_counter->assertions_total)
-    {
-        printf("  %s ALL TESTS PASSED SUCCESSFULLY!\n", TEST_SUCCESS_SYMBOL);
-        printf("  %s djinterp core framework is ready for development\n", TEST_SUCCESS_SYMBOL);
-        printf("  %s All tested modules meet quality standards\n", TEST_SUCCESS_SYMBOL);
-        printf("  %s Memory management appears sound\n", TEST_SUCCESS_SYMBOL);
-        printf("  %s Error handling is robust\n", TEST_SUCCESS_SYMBOL);
-    }
-    else
+    if (!_buffer)
     {
-        printf("  %s SOME TESTS FAILED - ATTENTION REQUIRED\n", TEST_FAIL_SYMBOL);
-        printf("  %s Review failed tests before proceeding\n", TEST_FAIL_SYMBOL);
-        printf("  %s Check for memory leaks or logic errors\n", TEST_FAIL_SYMBOL);
-        printf("  %s Verify all edge cases are handled properly\n", TEST_FAIL_SYMBOL);
+        return;
     }
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-}
 
-//=============================================================================
-// STATISTICS AND ANALYSIS FUNCTIONS
-//=============================================================================
+    free(_buffer->data);
+
+    _buffer->data     = NULL;
+    _buffer->size     = 0;
+    _buffer->capacity = 0;
+}
 
 /*
-d_test_print_statistics_table
-  Prints detailed statistics in table format.
+d_test_print_scratch_release
+  Frees the scratch buffer the stdout printers of the calling thread render
+  into.  Printing again allocates a new one.
 
 Parameter(s):
-  _counter: test counter containing statistics
+  none
 Return:
   none
 */
 void
-d_test_print_statistics_table
+d_test_print_scratch_release
 (
-    const struct d_test_counter* _counter
+    void
 )
 {
-    printf("\n");
-    printf("STATISTICS TABLE:\n");
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("| %-30s | %10s | %10s | %10s |\n", 
-           "Category", "Total", "Passed", "Failed");
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("| %-30s | %10zu | %10zu | %10zu |\n",
-           "Assertions",
-           _counter->assertions_total,
-           _counter->assertions_passed,
-           _counter->assertions_total - _counter->assertions_passed);
-    printf("| %-30s | %10zu | %10zu | %10zu |\n",
-           "Unit Tests",
-           _counter->tests_run,
-           _counter->tests_passed,
-           _counter->tests_run - _counter->tests_passed);
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("\n");
+    d_test_string_buffer_release(&d_test_internal_print_scratch);
+
+    return;
 }
 
 /*
-d_test_print_success_rate
-  Prints success rate analysis with visual indicators.
+d_test_print_scratch_capacity
+  Returns the capacity of the calling thread's stdout scratch buffer, or 0
+  if it has not been allocated.
 
 Parameter(s):
-  _passed: number of items that passed
-  _total: total number of items
-  _item_name: name of items being measured (e.g., "Tests", "Assertions")
-Return:
   none
+Return:
+  The scratch buffer's capacity in bytes.
 */
-void
-d_test_print_success_rate
+size_t
+d_test_print_scratch_capacity
 (
-    size_t      _passed,
-    size_t      _total,
-    const char* _item_name
+    void
 )
 {
-    double rate = (_total > 0) ? ((double)_passed / (double)_total * 100.0) : 
-                                 0.0;
-
-    const char* symbol = (rate >= 100.0) ? TEST_SUCCESS_SYMBOL : 
-                         (rate >= 50.0)  ? TEST_INFO_SYMBOL : 
-                                           TEST_FAIL_SYMBOL;
-    
-    printf("%s %s Success Rate: %.2f%% (%zu/%zu)\n", symbol, 
-                                                     _item_name, 
-                                                     rate, 
-                                                     _passed, 
-                                                     _total);
+    return d_test_internal_print_scratch.capacity;
 }
 
-//=============================================================================
-// SEPARATOR AND FORMATTING FUNCTIONS
-//=============================================================================
-
 /*
-d_test_print_separator
-  Prints a horizontal separator line.
-
-Parameter(s):
-  _char: character to use for separator
-  _width: width of separator line (0 uses default)
-Return:
-  none
+d_internal_test_string_buffer_append_repeat
+  Appends `_count` copies of `_char` to the buffer.
 */
-void
-d_test_print_separator
+static bool
+d_internal_test_string_buffer_append_repeat
 (
-    char   _char,
-    size_t _width
+    struct d_test_string_buffer* _buffer,
+    char                         _char,
+    size_t                       _count
 )
 {
-    size_t width = (_width > 0) ? _width : D_TEST_PRINT_LINE_WIDTH;
-    
-    for (size_t i = 0; i < width; i++)
+    if (!d_test_string_buffer_reserve(_buffer, _count))
     {
-        putchar(_char);
+        return false;
     }
-    putchar('\n');
+
+    memset(_buffer->data + _buffer->size, _char, _count);
+    _buffer->size               += _count;
+    _buffer->data[_buffer->size] = '\0';
+
+    return true;
 }
 
+//=============================================================================
+// FRAMEWORK HEADER FUNCTIONS
+//=============================================================================
+
 /*
-d_test_print_section_header
-  Prints a formatted section header with title.
+d_test_print_framework_header
+  Prints standardized header for the test framework with version info,
+  platform details, and testing philosophy.
 
 Parameter(s):
-  _title: section title text
+  _framework_name: name of the framework being tested
+  _framework_desc: description of the test suite (NULL uses default)
 Return:
   none
 */
 void
-d_test_print_section_header
+d_test_print_framework_header
 (
-    const char* _title
+    const char* _framework_name,
+    const char* _framework_desc
 )
 {
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("%s\n", _title);
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_framework_header_to_buffer(buffer,
+                                                _framework_name,
+                                                _framework_desc)
+    )
 }
 
 /*
-d_test_print_subsection_header
-  Prints a formatted subsection header with title.
+d_test_print_framework_header_custom
+  Prints customized framework header with user-specified version and details.
 
 Parameter(s):
-  _title: subsection title text
+  _framework_name: name of the framework
+  _framework_desc: description of the test suite
+  _version: version string
+  _test_framework: name of testing framework being used
+  _platform: target platform description
 Return:
   none
 */
 void
-d_test_print_subsection_header
+d_test_print_framework_header_custom
 (
-    const char* _title
+    const char* _framework_name,
+    const char* _framework_desc,
+    const char* _version,
+    const char* _test_framework,
+    const char* _platform
 )
 {
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("%s\n", _title);
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_framework_header_custom_to_buffer(buffer,
+                                                       _framework_name,
+                                                       _framework_desc,
+                                                       _version,
+                                                       _test_framework,
+                                                       _platform)
+    )
 }
 
-//=============================================================================
-// INFORMATION AND NOTES FUNCTIONS
-//=============================================================================
-
 /*
-d_test_print_implementation_notes
-  Prints implementation notes, known issues, and developer guidelines.
+d_test_print_testing_approach
+  Prints the testing approach philosophy and methodology section.
 
 Parameter(s):
   none
@@ -533,220 +620,2692 @@ Return:
   none
 */
 void
-d_test_print_implementation_notes
+d_test_print_testing_approach
 (
     void
 )
 {
-    printf("\n");
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    printf("IMPLEMENTATION NOTES & RECOMMENDATIONS\n");
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    
-    printf("CURRENT STATUS:\n");
-    printf("  %s d_test framework core functionality tested\n", TEST_INFO_SYMBOL);
-    printf("  %s Core data structures verified\n", TEST_INFO_SYMBOL);
-    printf("  %s Memory management patterns established\n", TEST_INFO_SYMBOL);
-    printf("  %s Error handling conventions defined\n", TEST_INFO_SYMBOL);
-    printf("  %s Cross-platform compatibility addressed\n", TEST_INFO_SYMBOL);
-    printf("\n");
-    
-    printf("KNOWN ISSUES:\n");
-    printf("  %s Some advanced features have incomplete implementations\n", TEST_INFO_SYMBOL);
-    printf("  %s Complex configuration merging needs validation\n", TEST_INFO_SYMBOL);
-    printf("  %s Thread safety not yet tested (single-threaded design assumed)\n", 
-           TEST_INFO_SYMBOL);
-    printf("\n");
-    
-    printf("NEXT STEPS:\n");
-    printf("  %s Complete remaining module implementations\n", TEST_INFO_SYMBOL);
-    printf("  %s Add integration test scenarios\n", TEST_INFO_SYMBOL);
-    printf("  %s Create performance benchmarking\n", TEST_INFO_SYMBOL);
-    printf("  %s Expand test coverage to edge cases\n", TEST_INFO_SYMBOL);
-    printf("\n");
-    
-    printf("DEVELOPER GUIDELINES:\n");
-    printf("  %s Always run full test suite before commits\n", TEST_INFO_SYMBOL);
-    printf("  %s Add unit tests for any new functions\n", TEST_INFO_SYMBOL);
-    printf("  %s Test edge cases and error conditions thoroughly\n", TEST_INFO_SYMBOL);
-    printf("  %s Verify memory cleanup in all code paths\n", TEST_INFO_SYMBOL);
-    printf("  %s Maintain consistent coding standards\n", TEST_INFO_SYMBOL);
-    
-    d_test_print_separator(D_TEST_PRINT_HEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_testing_approach_to_buffer(buffer)
+    )
 }
 
 /*
-d_test_print_custom_notes
-  Prints custom notes section with provided content.
+d_test_print_framework_header_to_buffer
+  Renders the standard framework header (see d_test_print_framework_header)
+  into a caller-provided buffer.
 
 Parameter(s):
-  _title: title for notes section
-  _note_count: number of notes to print
-  _notes: array of note strings
+  _buffer:         buffer to append to
+  _framework_name: name of the framework being tested
+  _framework_desc: description of the test suite (NULL uses default)
 Return:
-  none
+  true on success, false on invalid buffer or allocation failure.
 */
-void
-d_test_print_custom_notes
+bool
+d_test_print_framework_header_to_buffer
 (
-    const char*  _title,
-    size_t       _note_count,
-    const char** _notes
+    struct d_test_string_buffer* _buffer,
+    const char*                  _framework_name,
+    const char*                  _framework_desc
 )
 {
-    if (!_title || !_notes || _note_count == 0)
-    {
-        return;
-    }
-    
-    printf("\n%s:\n", _title);
-    for (size_t i = 0; i < _note_count; i++)
-    {
-        if (_notes[i])
-        {
-            printf("  %s %s\n", TEST_INFO_SYMBOL, _notes[i]);
-        }
-    }
-    printf("\n");
+    return d_test_print_framework_header_custom_to_buffer(_buffer,
+                                                          _framework_name,
+                                                          _framework_desc,
+                                                          NULL,
+                                                          NULL,
+                                                          NULL);
 }
 
 /*
-d_test_print_info_line
-  Prints a single information line with icon.
+d_test_print_framework_header_custom_to_buffer
+  Renders a customized framework header into a caller-provided buffer.
 
 Parameter(s):
-  _message: information message to print
+  _buffer:         buffer to append to
+  _framework_name: name of the framework
+  _framework_desc: description of the test suite
+  _version:        version string
+  _test_framework: name of testing framework being used
+  _platform:       target platform description
 Return:
-  none
+  true on success, false on invalid buffer or allocation failure.
 */
-void
-d_test_print_info_line
+bool
+d_test_print_framework_header_custom_to_buffer
 (
-    const char* _message
+    struct d_test_string_buffer* _buffer,
+    const char*                  _framework_name,
+    const char*                  _framework_desc,
+    const char*                  _version,
+    const char*                  _test_framework,
+    const char*                  _platform
 )
 {
-    if (_message)
-    {
-        printf("%s %s\n", TEST_INFO_SYMBOL, _message);
-    }
+    const char* name = (_framework_name) ? _framework_name : "";
+    const char* desc = (_framework_desc) ? _framework_desc :
+                                           D_TEST_PRINT_DEFAULT_FRAMEWORK_DESC;
+    const char* ver = (_version) ? _version : D_TEST_PRINT_DEFAULT_VERSION;
+    const char* test_fw = (_test_framework) ? _test_framework : 
+                                              "Standalone Testing (test_standalone.h)";
+    const char* plat = (_platform) ? _platform : "Cross-Platform C99/C11";
+
+    return d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer, "%s - %s\n", name, desc) &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "Framework Version: %s\n",
+                                              ver)                             &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "Test Framework:    %s\n",
+                                              test_fw)                         &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "Target Platform:   %s\n",
+                                              plat)                            &&
+           d_test_string_buffer_append(_buffer,
+               "Test Philosophy:   \"dTest -- for those who DETEST testing\"\n\n") &&
+           d_test_print_testing_approach_to_buffer(_buffer);
 }
 
 /*
-d_test_print_warning_line
-  Prints a warning message line.
+d_test_print_testing_approach_to_buffer
+  Renders the testing approach section into a caller-provided buffer.
 
 Parameter(s):
-  _message: warning message to print
+  _buffer: buffer to append to
 Return:
-  none
+  true on success, false on invalid buffer or allocation failure.
 */
-void
-d_test_print_warning_line
+bool
+d_test_print_testing_approach_to_buffer
 (
-    const char* _message
+    struct d_test_string_buffer* _buffer
 )
 {
-    if (_message)
-    {
-        printf("%s WARNING: %s\n", TEST_INFO_SYMBOL, _message);
-    }
+    return d_test_string_buffer_append(_buffer, "TESTING APPROACH:\n")         &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+               "%s Bootstrap Testing: Using standalone framework to test core modules\n",
+               TEST_INFO_SYMBOL)                                               &&
+           d_test_string_buffer_append_format(_buffer,
+               "%s Meta-Testing: Testing the testing framework itself (d_test)\n",
+               TEST_INFO_SYMBOL)                                               &&
+           d_test_string_buffer_append_format(_buffer,
+               "%s Foundation First: Core data structures before higher-level modules\n",
+               TEST_INFO_SYMBOL)                                               &&
+           d_test_string_buffer_append_format(_buffer,
+               "%s Comprehensive: Edge cases, memory management, and error conditions\n",
+               TEST_INFO_SYMBOL)                                               &&
+           d_test_string_buffer_append_format(_buffer,
+               "%s Production Ready: Tests designed for CI/CD integration\n",
+               TEST_INFO_SYMBOL)                                               &&
+           d_test_string_buffer_append(_buffer, "\n");
 }
 
 /*
-d_test_print_error_line
-  Prints an error message line.
+d_test_print_framework_header_to_string
+  Returns the standard framework header as a newly allocated string.
 
 Parameter(s):
-  _message: error message to print
+  _framework_name: name of the framework being tested
+  _framework_desc: description of the test suite (NULL uses default)
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_framework_header_to_string
+(
+    const char* _framework_name,
+    const char* _framework_desc
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_framework_header_to_buffer(buffer,
+                                                _framework_name,
+                                                _framework_desc)
+    )
+}
+
+/*
+d_test_print_framework_header_custom_to_string
+  Returns a customized framework header as a newly allocated string.
+
+Parameter(s):
+  _framework_name: name of the framework
+  _framework_desc: description of the test suite
+  _version:        version string
+  _test_framework: name of testing framework being used
+  _platform:       target platform description
 Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_framework_header_custom_to_string
+(
+    const char* _framework_name,
+    const char* _framework_desc,
+    const char* _version,
+    const char* _test_framework,
+    const char* _platform
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_framework_header_custom_to_buffer(buffer,
+                                                       _framework_name,
+                                                       _framework_desc,
+                                                       _version,
+                                                       _test_framework,
+                                                       _platform)
+    )
+}
+
+/*
+d_test_print_testing_approach_to_string
+  Returns the testing approach section as a newly allocated string.
+
+Parameter(s):
   none
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
 */
-void
-d_test_print_error_line
+char*
+d_test_print_testing_approach_to_string
 (
-    const char* _message
+    void
 )
 {
-    if (_message)
-    {
-        printf("%s ERROR: %s\n", TEST_FAIL_SYMBOL, _message);
-    }
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_testing_approach_to_buffer(buffer)
+    )
 }
 
 //=============================================================================
-// SUMMARY AND FINAL MESSAGES
+// MODULE HEADER FUNCTIONS
 //=============================================================================
 
 /*
-d_test_print_final_summary
-  Prints final summary message with overall assessment.
+d_test_print_module_header
+  Prints standardized header for individual module test sections.
 
 Parameter(s):
-  _passed: whether all tests passed
-  _framework_name: name of framework being tested
+  _module_name: name of the module being tested
+  _description: brief description of the module's purpose
 Return:
   none
 */
 void
-d_test_print_final_summary
+d_test_print_module_header
 (
-    bool        _passed,
-    const char* _framework_name
+    const char* _module_name,
+    const char* _description
 )
 {
-    printf("\n");
-
-    if (_passed)
-    {
-        printf("%s%s %s Framework Test Suite COMPLETED SUCCESSFULLY\n", 
-            D_INDENT, TEST_SUCCESS_SYMBOL, _framework_name);
-        printf("%s Ready for development and integration\n", D_INDENT);
-    }
-    else
-    {
-        printf("%s%s %s Framework Test Suite COMPLETED WITH FAILURES\n", 
-            D_INDENT, TEST_FAIL_SYMBOL, _framework_name);
-        printf("%s Review failures before proceeding with development\n", D_INDENT);
-    }
-
-    printf("\n");
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_module_header_to_buffer(buffer,
+                                             _module_name,
+                                             _description)
+    )
 }
 
 /*
-d_test_print_recommendations
-  Prints next steps and recommendations based on test results.
+d_test_print_module_header_detailed
+  Prints detailed module header with additional information.
 
 Parameter(s):
-  _overall_result: whether all tests passed
+  _module_name: name of the module
+  _description: module description
+  _file_path: path to module source file
+  _test_count: number of unit tests to be run
 Return:
   none
 */
 void
-d_test_print_recommendations
+d_test_print_module_header_detailed
 (
-    bool _overall_result
+    const char* _module_name,
+    const char* _description,
+    const char* _file_path,
+    size_t      _test_count
 )
 {
-    printf("\nRECOMMENDATIONS:\n");
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
-    
-    if (_overall_result)
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_module_header_detailed_to_buffer(buffer,
+                                                      _module_name,
+                                                      _description,
+                                                      _file_path,
+                                                      _test_count)
+    )
+}
+
+/*
+d_test_print_module_header_to_buffer
+  Renders a module header into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:      buffer to append to
+  _module_name: name of the module being tested
+  _description: brief description of the module's purpose
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_module_header_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _module_name,
+    const char*                  _description
+)
+{
+    return d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "TESTING MODULE: %s\n",
+                                              _module_name ? _module_name : "") &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "Description: %s\n",
+                                              _description ? _description : "") &&
+           d_test_string_buffer_append(_buffer, "Starting module test suite...\n") &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH);
+}
+
+/*
+d_test_print_module_header_detailed_to_buffer
+  Renders a detailed module header into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:      buffer to append to
+  _module_name: name of the module
+  _description: module description
+  _file_path:   path to module source file (may be NULL)
+  _test_count:  number of unit tests to be run
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_module_header_detailed_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _module_name,
+    const char*                  _description,
+    const char*                  _file_path,
+    size_t                       _test_count
+)
+{
+    if ( (!d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH))          ||
+         (!d_test_string_buffer_append_format(_buffer,
+                                              "TESTING MODULE: %s\n",
+                                              _module_name ? _module_name : "")) ||
+         (!d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH))          ||
+         (!d_test_string_buffer_append_format(_buffer,
+                                              "Description: %s\n",
+                                              _description ? _description : "")) )
     {
-        printf("%s%s Proceed with next development phase\n",        D_INDENT, TEST_SUCCESS_SYMBOL);
-        printf("%s%s Consider expanding test coverage\n",           D_INDENT, TEST_INFO_SYMBOL);
-        printf("%s%s Review code for optimization opportunities\n", D_INDENT, TEST_INFO_SYMBOL);
-        printf("%s%s Document any new patterns or conventions\n",   D_INDENT, TEST_INFO_SYMBOL);
+        return false;
     }
-    else
+
+    if ( (_file_path) &&
+         (!d_test_string_buffer_append_format(_buffer,
+                                              "Source File: %s\n",
+                                              _file_path)) )
     {
-        printf("%s%s Fix all failing tests before proceeding\n",         D_INDENT, TEST_FAIL_SYMBOL);
-        printf("%s%s Review error messages for root causes\n",           D_INDENT, TEST_FAIL_SYMBOL);
-        printf("%s%s Check for memory leaks with valgrind/sanitizers\n", D_INDENT, TEST_INFO_SYMBOL);
-        printf("%s%s Verify assumptions about edge cases\n",             D_INDENT, TEST_INFO_SYMBOL);
-        printf("%s%s Consider refactoring problematic areas\n",          D_INDENT, TEST_INFO_SYMBOL);
+        return false;
     }
-    
-    d_test_print_separator(D_TEST_PRINT_SUBHEADER_CHAR, D_TEST_PRINT_LINE_WIDTH);
 
-    printf("\n");
-}
\ No newline at end of file
+    return d_test_string_buffer_append_format(_buffer,
+                                              "Test Count:  %zu unit tests\n",
+                                              _test_count)                     &&
+           d_test_string_buffer_append(_buffer, "Starting module test suite...\n") &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH);
+}
+
+/*
+d_test_print_module_header_to_string
+  Returns a module header as a newly allocated string.
+
+Parameter(s):
+  _module_name: name of the module being tested
+  _description: brief description of the module's purpose
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_module_header_to_string
+(
+    const char* _module_name,
+    const char* _description
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_module_header_to_buffer(buffer,
+                                             _module_name,
+                                             _description)
+    )
+}
+
+/*
+d_test_print_module_header_detailed_to_string
+  Returns a detailed module header as a newly allocated string.
+
+Parameter(s):
+  _module_name: name of the module
+  _description: module description
+  _file_path:   path to module source file (may be NULL)
+  _test_count:  number of unit tests to be run
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_module_header_detailed_to_string
+(
+    const char* _module_name,
+    const char* _description,
+    const char* _file_path,
+    size_t      _test_count
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_module_header_detailed_to_buffer(buffer,
+                                                      _module_name,
+                                                      _description,
+                                                      _file_path,
+                                                      _test_count)
+    )
+}
+
+//=============================================================================
+// PROGRESS AND STATUS FUNCTIONS
+//=============================================================================
+
+/*
+d_test_print_test_start
+  Prints a message indicating a specific test is starting.
+
+Parameter(s):
+  _test_name: name of the test being started
+Return:
+  none
+*/
+void
+d_test_print_test_start
+(
+    const char* _test_name
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_test_start_to_buffer(buffer,
+                                          _test_name)
+    )
+}
+
+/*
+d_test_print_test_result
+  Prints the result of a completed test.
+
+Parameter(s):
+  _test_name: name of the completed test
+  _passed: whether the test passed
+Return:
+  none
+*/
+void
+d_test_print_test_result
+(
+    const char* _test_name,
+    bool        _passed
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_test_result_to_buffer(buffer,
+                                           _test_name,
+                                           _passed)
+    )
+}
+
+/*
+d_test_print_progress
+  Prints progress indicator showing current position in test suite.
+
+Parameter(s):
+  _current: current test number
+  _total:   total number of tests
+Return:
+  none
+*/
+void
+d_test_print_progress
+(
+    size_t _current,
+    size_t _total
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_progress_to_buffer(buffer,
+                                        _current,
+                                        _total)
+    )
+}
+
+/*
+d_test_print_test_start_to_buffer
+  Renders a test-start line into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:    buffer to append to
+  _test_name: name of the test being started
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_test_start_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _test_name
+)
+{
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%sRunning: %s...\n",
+                                              D_INDENT,
+                                              _test_name ? _test_name : "");
+}
+
+/*
+d_test_print_test_result_to_buffer
+  Renders a test result line into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:    buffer to append to
+  _test_name: name of the completed test
+  _passed:    whether the test passed
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_test_result_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _test_name,
+    bool                         _passed
+)
+{
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%s%s %s: %s\n",
+                                              D_INDENT,
+                                              _passed ? TEST_PASS_SYMBOL
+                                                      : TEST_FAIL_SYMBOL,
+                                              _test_name ? _test_name : "",
+                                              _passed ? "PASSED" : "FAILED");
+}
+
+/*
+d_test_print_progress_to_buffer
+  Renders a progress indicator into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:  buffer to append to
+  _current: current test number
+  _total:   total number of tests
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_progress_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    size_t                       _current,
+    size_t                       _total
+)
+{
+    double percent = (_total > 0) ? ((double)_current / (double)_total * 100.0) : 0.0;
+
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%sProgress: [%zu/%zu] (%.1f%%)\n",
+                                              D_INDENT,
+                                              _current,
+                                              _total,
+                                              percent);
+}
+
+/*
+d_test_print_test_start_to_string
+  Returns a test-start line as a newly allocated string.
+
+Parameter(s):
+  _test_name: name of the test being started
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_test_start_to_string
+(
+    const char* _test_name
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_test_start_to_buffer(buffer, _test_name)
+    )
+}
+
+/*
+d_test_print_test_result_to_string
+  Returns a test result line as a newly allocated string.
+
+Parameter(s):
+  _test_name: name of the completed test
+  _passed:    whether the test passed
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_test_result_to_string
+(
+    const char* _test_name,
+    bool        _passed
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_test_result_to_buffer(buffer, _test_name, _passed)
+    )
+}
+
+/*
+d_test_print_progress_to_string
+  Returns a progress indicator as a newly allocated string.
+
+Parameter(s):
+  _current: current test number
+  _total:   total number of tests
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_progress_to_string
+(
+    size_t _current,
+    size_t _total
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_progress_to_buffer(buffer, _current, _total)
+    )
+}
+
+//=============================================================================
+// RESULT SUMMARY FUNCTIONS
+//=============================================================================
+
+/*
+d_test_print_module_results
+  Prints standardized results summary for a completed module test suite.
+
+Parameter(s):
+  _module_name:    name of the tested module
+  _module_counter: test counter containing module-specific results
+  _module_result:  boolean indicating overall module test success
+Return:
+  none
+*/
+void
+d_test_print_module_results
+(
+    const char*                  _module_name,
+    const struct d_test_counter* _module_counter,
+    bool                         _module_result
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_module_results_to_buffer(buffer,
+                                              _module_name,
+                                              _module_counter,
+                                              _module_result)
+    )
+}
+
+/*
+d_test_print_comprehensive_results
+  Prints final comprehensive test results with detailed statistics.
+
+Parameter(s):
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+Return:
+  none
+*/
+void
+d_test_print_comprehensive_results
+(
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_comprehensive_results_to_buffer(buffer,
+                                                     _overall_counter,
+                                                     _overall_result,
+                                                     _modules_tested,
+                                                     _modules_passed)
+    )
+}
+
+/*
+d_test_print_module_results_to_buffer
+  Renders a module results summary into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:         buffer to append to
+  _module_name:    name of the tested module
+  _module_counter: test counter containing module-specific results
+  _module_result:  boolean indicating overall module test success
+Return:
+  true on success, false on invalid arguments or allocation failure.
+*/
+bool
+d_test_print_module_results_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _module_name,
+    const struct d_test_counter* _module_counter,
+    bool                         _module_result
+)
+{
+    const char* name = (_module_name) ? _module_name : "";
+
+    if (!_module_counter)
+    {
+        return false;
+    }
+
+    return d_test_string_buffer_append(_buffer, "\n")                          &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "MODULE RESULTS: %s\n",
+                                              name)                            &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+               "Assertions: %zu/%zu passed (%.2f%%)\n",
+               _module_counter->assertions_passed,
+               _module_counter->assertions_total,
+               _module_counter->assertions_total > 0 ?
+                   (double)_module_counter->assertions_passed /
+                   (double)_module_counter->assertions_total * 100.0 : 0.0)    &&
+           d_test_string_buffer_append_format(_buffer,
+               "Unit Tests: %zu/%zu passed (%.2f%%)\n",
+               _module_counter->tests_passed,
+               _module_counter->tests_run,
+               _module_counter->tests_run > 0 ?
+                   (double)_module_counter->tests_passed /
+                   (double)_module_counter->tests_run * 100.0 : 0.0)           &&
+           d_test_string_buffer_append_format(_buffer,
+               "Status: %s %s MODULE %s\n",
+               _module_result ? TEST_SUCCESS_SYMBOL : TEST_FAIL_SYMBOL,
+               name,
+               _module_result ? "PASSED" : "FAILED")                           &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append(_buffer, "\n");
+}
+
+/*
+d_test_print_comprehensive_results_to_buffer
+  Renders the comprehensive results section into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:          buffer to append to
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+Return:
+  true on success, false on invalid arguments or allocation failure.
+*/
+bool
+d_test_print_comprehensive_results_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    bool ok;
+
+    if (!_overall_counter)
+    {
+        return false;
+    }
+
+    ok = d_test_print_section_header_to_buffer(_buffer,
+                                               "COMPREHENSIVE TEST RESULTS");
+
+    // module-level results
+    ok = ok &&
+         d_test_string_buffer_append(_buffer, "MODULE SUMMARY:\n")             &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Modules Tested: %zu\n", _modules_tested)                      &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Modules Passed: %zu\n", _modules_passed)                      &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Module Success Rate: %.2f%%\n\n",
+             _modules_tested > 0 ?
+                 (double)_modules_passed / (double)_modules_tested * 100.0 : 0.0);
+
+    // assertion-level results
+    ok = ok &&
+         d_test_string_buffer_append(_buffer, "ASSERTION SUMMARY:\n")          &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Total Assertions: %zu\n",
+             _overall_counter->assertions_total)                              &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Assertions Passed: %zu\n",
+             _overall_counter->assertions_passed)                             &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Assertions Failed: %zu\n",
+             _overall_counter->assertions_total -
+             _overall_counter->assertions_passed)                             &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Assertion Success Rate: %.2f%%\n\n",
+             _overall_counter->assertions_total > 0 ?
+                 (double)_overall_counter->assertions_passed /
+                 (double)_overall_counter->assertions_total * 100.0 : 0.0);
+
+    // unit test-level results
+    ok = ok &&
+         d_test_string_buffer_append(_buffer, "UNIT TEST SUMMARY:\n")          &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Total Unit Tests: %zu\n",
+             _overall_counter->tests_run)                                     &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Unit Tests Passed: %zu\n",
+             _overall_counter->tests_passed)                                  &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Unit Tests Failed: %zu\n",
+             _overall_counter->tests_run - _overall_counter->tests_passed)    &&
+         d_test_string_buffer_append_format(_buffer,
+             "  Unit Test Success Rate: %.2f%%\n\n",
+             _overall_counter->tests_run > 0 ?
+                 (double)_overall_counter->tests_passed /
+                 (double)_overall_counter->tests_run * 100.0 : 0.0);
+
+    // overall assessment
+    ok = ok && d_test_string_buffer_append(_buffer, "OVERALL ASSESSMENT:\n");
+
+    if (_overall_result && 
+        _overall_counter->assertions_passed == _overall_counter->assertions_total)
+    {
+        ok = ok &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s ALL TESTS PASSED SUCCESSFULLY!\n", TEST_SUCCESS_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s djinterp core framework is ready for development\n",
+                 TEST_SUCCESS_SYMBOL)                                         &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s All tested modules meet quality standards\n",
+                 TEST_SUCCESS_SYMBOL)                                         &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s Memory management appears sound\n", TEST_SUCCESS_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s Error handling is robust\n", TEST_SUCCESS_SYMBOL);
+    }
+    else
+    {
+        ok = ok &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s SOME TESTS FAILED - ATTENTION REQUIRED\n",
+                 TEST_FAIL_SYMBOL)                                            &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s Review failed tests before proceeding\n",
+                 TEST_FAIL_SYMBOL)                                            &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s Check for memory leaks or logic errors\n",
+                 TEST_FAIL_SYMBOL)                                            &&
+             d_test_string_buffer_append_format(_buffer,
+                 "  %s Verify all edge cases are handled properly\n",
+                 TEST_FAIL_SYMBOL);
+    }
+
+    return ok &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH);
+}
+
+/*
+d_test_print_module_results_to_string
+  Returns a module results summary as a newly allocated string.
+
+Parameter(s):
+  _module_name:    name of the tested module
+  _module_counter: test counter containing module-specific results
+  _module_result:  boolean indicating overall module test success
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_module_results_to_string
+(
+    const char*                  _module_name,
+    const struct d_test_counter* _module_counter,
+    bool                         _module_result
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_module_results_to_buffer(buffer,
+                                              _module_name,
+                                              _module_counter,
+                                              _module_result)
+    )
+}
+
+/*
+d_test_print_comprehensive_results_to_string
+  Returns the comprehensive results section as a newly allocated string.
+
+Parameter(s):
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_comprehensive_results_to_string
+(
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_comprehensive_results_to_buffer(buffer,
+                                                     _overall_counter,
+                                                     _overall_result,
+                                                     _modules_tested,
+                                                     _modules_passed)
+    )
+}
+
+//=============================================================================
+// STATISTICS AND ANALYSIS FUNCTIONS
+//=============================================================================
+
+/*
+d_test_print_statistics_table
+  Prints detailed statistics in table format.
+
+Parameter(s):
+  _counter: test counter containing statistics
+Return:
+  none
+*/
+void
+d_test_print_statistics_table
+(
+    const struct d_test_counter* _counter
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_statistics_table_to_buffer(buffer,
+                                                _counter)
+    )
+}
+
+/*
+d_test_print_success_rate
+  Prints success rate analysis with visual indicators.
+
+Parameter(s):
+  _passed: number of items that passed
+  _total: total number of items
+  _item_name: name of items being measured (e.g., "Tests", "Assertions")
+Return:
+  none
+*/
+void
+d_test_print_success_rate
+(
+    size_t      _passed,
+    size_t      _total,
+    const char* _item_name
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_success_rate_to_buffer(buffer,
+                                            _passed,
+                                            _total,
+                                            _item_name)
+    )
+}
+
+/*
+d_test_print_statistics_table_to_buffer
+  Renders the statistics table into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:  buffer to append to
+  _counter: test counter containing statistics
+Return:
+  true on success, false on invalid arguments or allocation failure.
+*/
+bool
+d_test_print_statistics_table_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const struct d_test_counter* _counter
+)
+{
+    if (!_counter)
+    {
+        return false;
+    }
+
+    return d_test_string_buffer_append(_buffer, "\nSTATISTICS TABLE:\n")       &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+               "| %-30s | %10s | %10s | %10s |\n",
+               "Category", "Total", "Passed", "Failed")                        &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+               "| %-30s | %10zu | %10zu | %10zu |\n",
+               "Assertions",
+               _counter->assertions_total,
+               _counter->assertions_passed,
+               _counter->assertions_total - _counter->assertions_passed)      &&
+           d_test_string_buffer_append_format(_buffer,
+               "| %-30s | %10zu | %10zu | %10zu |\n",
+               "Unit Tests",
+               _counter->tests_run,
+               _counter->tests_passed,
+               _counter->tests_run - _counter->tests_passed)                  &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append(_buffer, "\n");
+}
+
+/*
+d_test_print_success_rate_to_buffer
+  Renders a success rate line into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:    buffer to append to
+  _passed:    number of items that passed
+  _total:     total number of items
+  _item_name: name of items being measured (e.g., "Tests", "Assertions")
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_success_rate_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    size_t                       _passed,
+    size_t                       _total,
+    const char*                  _item_name
+)
+{
+    double rate = (_total > 0) ? ((double)_passed / (double)_total * 100.0) : 
+                                 0.0;
+
+    const char* symbol = (rate >= 100.0) ? TEST_SUCCESS_SYMBOL : 
+                         (rate >= 50.0)  ? TEST_INFO_SYMBOL : 
+                                           TEST_FAIL_SYMBOL;
+
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%s %s Success Rate: %.2f%% (%zu/%zu)\n",
+                                              symbol,
+                                              _item_name ? _item_name : "",
+                                              rate,
+                                              _passed,
+                                              _total);
+}
+
+/*
+d_test_print_statistics_table_to_string
+  Returns the statistics table as a newly allocated string.
+
+Parameter(s):
+  _counter: test counter containing statistics
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_statistics_table_to_string
+(
+    const struct d_test_counter* _counter
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_statistics_table_to_buffer(buffer, _counter)
+    )
+}
+
+/*
+d_test_print_success_rate_to_string
+  Returns a success rate line as a newly allocated string.
+
+Parameter(s):
+  _passed:    number of items that passed
+  _total:     total number of items
+  _item_name: name of items being measured
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_success_rate_to_string
+(
+    size_t      _passed,
+    size_t      _total,
+    const char* _item_name
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_success_rate_to_buffer(buffer, _passed, _total, _item_name)
+    )
+}
+
+//=============================================================================
+// SEPARATOR AND FORMATTING FUNCTIONS
+//=============================================================================
+
+/*
+d_test_print_separator
+  Prints a horizontal separator line.
+
+Parameter(s):
+  _char: character to use for separator
+  _width: width of separator line (0 uses default)
+Return:
+  none
+*/
+void
+d_test_print_separator
+(
+    char   _char,
+    size_t _width
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_separator_to_buffer(buffer,
+                                         _char,
+                                         _width)
+    )
+}
+
+/*
+d_test_print_section_header
+  Prints a formatted section header with title.
+
+Parameter(s):
+  _title: section title text
+Return:
+  none
+*/
+void
+d_test_print_section_header
+(
+    const char* _title
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_section_header_to_buffer(buffer,
+                                              _title)
+    )
+}
+
+/*
+d_test_print_subsection_header
+  Prints a formatted subsection header with title.
+
+Parameter(s):
+  _title: subsection title text
+Return:
+  none
+*/
+void
+d_test_print_subsection_header
+(
+    const char* _title
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_subsection_header_to_buffer(buffer,
+                                                 _title)
+    )
+}
+
+/*
+d_test_print_separator_to_buffer
+  Renders a horizontal separator line into a caller-provided buffer.
+
+Parameter(s):
+  _buffer: buffer to append to
+  _char:   character to use for separator
+  _width:  width of separator line (0 uses default)
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_separator_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    char                         _char,
+    size_t                       _width
+)
+{
+    size_t width = (_width > 0) ? _width : D_TEST_PRINT_LINE_WIDTH;
+
+    return d_internal_test_string_buffer_append_repeat(_buffer, _char, width) &&
+           d_internal_test_string_buffer_append_repeat(_buffer, '\n', 1);
+}
+
+/*
+d_test_print_section_header_to_buffer
+  Renders a section header into a caller-provided buffer.
+
+Parameter(s):
+  _buffer: buffer to append to
+  _title:  section title text
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_section_header_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _title
+)
+{
+    return d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "%s\n",
+                                              _title ? _title : "")            &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH);
+}
+
+/*
+d_test_print_subsection_header_to_buffer
+  Renders a subsection header into a caller-provided buffer.
+
+Parameter(s):
+  _buffer: buffer to append to
+  _title:  subsection title text
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_subsection_header_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _title
+)
+{
+    return d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append_format(_buffer,
+                                              "%s\n",
+                                              _title ? _title : "")            &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH);
+}
+
+/*
+d_test_print_separator_to_string
+  Returns a separator line as a newly allocated string.
+
+Parameter(s):
+  _char:  character to use for separator
+  _width: width of separator line (0 uses default)
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_separator_to_string
+(
+    char   _char,
+    size_t _width
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_separator_to_buffer(buffer, _char, _width)
+    )
+}
+
+/*
+d_test_print_section_header_to_string
+  Returns a section header as a newly allocated string.
+
+Parameter(s):
+  _title: section title text
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_section_header_to_string
+(
+    const char* _title
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_section_header_to_buffer(buffer, _title)
+    )
+}
+
+/*
+d_test_print_subsection_header_to_string
+  Returns a subsection header as a newly allocated string.
+
+Parameter(s):
+  _title: subsection title text
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_subsection_header_to_string
+(
+    const char* _title
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_subsection_header_to_buffer(buffer, _title)
+    )
+}
+
+//=============================================================================
+// INFORMATION AND NOTES FUNCTIONS
+//=============================================================================
+
+/*
+d_test_print_implementation_notes
+  Prints implementation notes, known issues, and developer guidelines.
+
+Parameter(s):
+  none
+Return:
+  none
+*/
+void
+d_test_print_implementation_notes
+(
+    void
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_implementation_notes_to_buffer(buffer)
+    )
+}
+
+/*
+d_test_print_custom_notes
+  Prints custom notes section with provided content.
+
+Parameter(s):
+  _title: title for notes section
+  _note_count: number of notes to print
+  _notes: array of note strings
+Return:
+  none
+*/
+void
+d_test_print_custom_notes
+(
+    const char*  _title,
+    size_t       _note_count,
+    const char** _notes
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_custom_notes_to_buffer(buffer,
+                                            _title,
+                                            _note_count,
+                                            _notes)
+    )
+}
+
+/*
+d_test_print_info_line
+  Prints a single information line with icon.
+
+Parameter(s):
+  _message: information message to print
+Return:
+  none
+*/
+void
+d_test_print_info_line
+(
+    const char* _message
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_info_line_to_buffer(buffer,
+                                         _message)
+    )
+}
+
+/*
+d_test_print_warning_line
+  Prints a warning message line.
+
+Parameter(s):
+  _message: warning message to print
+Return:
+  none
+*/
+void
+d_test_print_warning_line
+(
+    const char* _message
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_warning_line_to_buffer(buffer,
+                                            _message)
+    )
+}
+
+/*
+d_test_print_error_line
+  Prints an error message line.
+
+Parameter(s):
+  _message: error message to print
+Return:
+  none
+*/
+void
+d_test_print_error_line
+(
+    const char* _message
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_error_line_to_buffer(buffer,
+                                          _message)
+    )
+}
+
+/*
+d_test_print_implementation_notes_to_buffer
+  Renders the implementation notes section into a caller-provided buffer.
+
+Parameter(s):
+  _buffer: buffer to append to
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_implementation_notes_to_buffer
+(
+    struct d_test_string_buffer* _buffer
+)
+{
+    static const char* const current_status[] =
+    {
+        "d_test framework core functionality tested",
+        "Core data structures verified",
+        "Memory management patterns established",
+        "Error handling conventions defined",
+        "Cross-platform compatibility addressed"
+    };
+    static const char* const known_issues[] =
+    {
+        "Some advanced features have incomplete implementations",
+        "Complex configuration merging needs validation",
+        "Thread safety not yet tested (single-threaded design assumed)"
+    };
+    static const char* const next_steps[] =
+    {
+        "Complete remaining module implementations",
+        "Add integration test scenarios",
+        "Create performance benchmarking",
+        "Expand test coverage to edge cases"
+    };
+    static const char* const guidelines[] =
+    {
+        "Always run full test suite before commits",
+        "Add unit tests for any new functions",
+        "Test edge cases and error conditions thoroughly",
+        "Verify memory cleanup in all code paths",
+        "Maintain consistent coding standards"
+    };
+    bool   ok;
+    size_t i;
+
+    ok = d_test_string_buffer_append(_buffer, "\n") &&
+         d_test_print_section_header_to_buffer(_buffer,
+                                               "IMPLEMENTATION NOTES & RECOMMENDATIONS") &&
+         d_test_string_buffer_append(_buffer, "CURRENT STATUS:\n");
+
+    for (i = 0; ok && i < sizeof(current_status) / sizeof(current_status[0]); i++)
+    {
+        ok = d_test_string_buffer_append_format(_buffer, "  %s %s\n",
+                                                TEST_INFO_SYMBOL,
+                                                current_status[i]);
+    }
+
+    ok = ok && d_test_string_buffer_append(_buffer, "\nKNOWN ISSUES:\n");
+
+    for (i = 0; ok && i < sizeof(known_issues) / sizeof(known_issues[0]); i++)
+    {
+        ok = d_test_string_buffer_append_format(_buffer, "  %s %s\n",
+                                                TEST_INFO_SYMBOL,
+                                                known_issues[i]);
+    }
+
+    ok = ok && d_test_string_buffer_append(_buffer, "\nNEXT STEPS:\n");
+
+    for (i = 0; ok && i < sizeof(next_steps) / sizeof(next_steps[0]); i++)
+    {
+        ok = d_test_string_buffer_append_format(_buffer, "  %s %s\n",
+                                                TEST_INFO_SYMBOL,
+                                                next_steps[i]);
+    }
+
+    ok = ok && d_test_string_buffer_append(_buffer, "\nDEVELOPER GUIDELINES:\n");
+
+    for (i = 0; ok && i < sizeof(guidelines) / sizeof(guidelines[0]); i++)
+    {
+        ok = d_test_string_buffer_append_format(_buffer, "  %s %s\n",
+                                                TEST_INFO_SYMBOL,
+                                                guidelines[i]);
+    }
+
+    return ok &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_HEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH);
+}
+
+/*
+d_test_print_custom_notes_to_buffer
+  Renders a custom notes section into a caller-provided buffer.  Nothing is
+  rendered if the title or notes are missing.
+
+Parameter(s):
+  _buffer:     buffer to append to
+  _title:      title for notes section
+  _note_count: number of notes to render
+  _notes:      array of note strings
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_custom_notes_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _title,
+    size_t                       _note_count,
+    const char**                 _notes
+)
+{
+    size_t i;
+
+    if (!_buffer)
+    {
+        return false;
+    }
+
+    if (!_title || !_notes || _note_count == 0)
+    {
+        return true;
+    }
+
+    if (!d_test_string_buffer_append_format(_buffer, "\n%s:\n", _title))
+    {
+        return false;
+    }
+
+    for (i = 0; i < _note_count; i++)
+    {
+        if ( (_notes[i]) &&
+             (!d_test_string_buffer_append_format(_buffer,
+                                                  "  %s %s\n",
+                                                  TEST_INFO_SYMBOL,
+                                                  _notes[i])) )
+        {
+            return false;
+        }
+    }
+
+    return d_test_string_buffer_append(_buffer, "\n");
+}
+
+/*
+d_test_print_info_line_to_buffer
+  Renders an information line into a caller-provided buffer.  Nothing is
+  rendered for a NULL message.
+
+Parameter(s):
+  _buffer:  buffer to append to
+  _message: information message
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_info_line_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _message
+)
+{
+    if (!_message)
+    {
+        return (_buffer != NULL);
+    }
+
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%s %s\n",
+                                              TEST_INFO_SYMBOL,
+                                              _message);
+}
+
+/*
+d_test_print_warning_line_to_buffer
+  Renders a warning line into a caller-provided buffer.  Nothing is rendered
+  for a NULL message.
+
+Parameter(s):
+  _buffer:  buffer to append to
+  _message: warning message
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_warning_line_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _message
+)
+{
+    if (!_message)
+    {
+        return (_buffer != NULL);
+    }
+
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%s WARNING: %s\n",
+                                              TEST_INFO_SYMBOL,
+                                              _message);
+}
+
+/*
+d_test_print_error_line_to_buffer
+  Renders an error line into a caller-provided buffer.  Nothing is rendered
+  for a NULL message.
+
+Parameter(s):
+  _buffer:  buffer to append to
+  _message: error message
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_error_line_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _message
+)
+{
+    if (!_message)
+    {
+        return (_buffer != NULL);
+    }
+
+    return d_test_string_buffer_append_format(_buffer,
+                                              "%s ERROR: %s\n",
+                                              TEST_FAIL_SYMBOL,
+                                              _message);
+}
+
+/*
+d_test_print_implementation_notes_to_string
+  Returns the implementation notes section as a newly allocated string.
+
+Parameter(s):
+  none
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_implementation_notes_to_string
+(
+    void
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_implementation_notes_to_buffer(buffer)
+    )
+}
+
+/*
+d_test_print_custom_notes_to_string
+  Returns a custom notes section as a newly allocated string.
+
+Parameter(s):
+  _title:      title for notes section
+  _note_count: number of notes
+  _notes:      array of note strings
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_custom_notes_to_string
+(
+    const char*  _title,
+    size_t       _note_count,
+    const char** _notes
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_custom_notes_to_buffer(buffer, _title, _note_count, _notes)
+    )
+}
+
+/*
+d_test_print_info_line_to_string
+  Returns an information line as a newly allocated string.
+
+Parameter(s):
+  _message: information message
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_info_line_to_string
+(
+    const char* _message
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_info_line_to_buffer(buffer, _message)
+    )
+}
+
+/*
+d_test_print_warning_line_to_string
+  Returns a warning line as a newly allocated string.
+
+Parameter(s):
+  _message: warning message
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_warning_line_to_string
+(
+    const char* _message
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_warning_line_to_buffer(buffer, _message)
+    )
+}
+
+/*
+d_test_print_error_line_to_string
+  Returns an error line as a newly allocated string.
+
+Parameter(s):
+  _message: error message
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_error_line_to_string
+(
+    const char* _message
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_error_line_to_buffer(buffer, _message)
+    )
+}
+
+//=============================================================================
+// SUMMARY AND FINAL MESSAGES
+//=============================================================================
+
+/*
+d_test_print_final_summary
+  Prints final summary message with overall assessment.
+
+Parameter(s):
+  _passed: whether all tests passed
+  _framework_name: name of framework being tested
+Return:
+  none
+*/
+void
+d_test_print_final_summary
+(
+    bool        _passed,
+    const char* _framework_name
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_final_summary_to_buffer(buffer,
+                                             _passed,
+                                             _framework_name)
+    )
+}
+
+/*
+d_test_print_recommendations
+  Prints next steps and recommendations based on test results.
+
+Parameter(s):
+  _overall_result: whether all tests passed
+Return:
+  none
+*/
+void
+d_test_print_recommendations
+(
+    bool _overall_result
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STDOUT_BODY(
+        d_test_print_recommendations_to_buffer(buffer,
+                                               _overall_result)
+    )
+}
+
+/*
+d_test_print_final_summary_to_buffer
+  Renders the final summary message into a caller-provided buffer.
+
+Parameter(s):
+  _buffer:         buffer to append to
+  _passed:         whether all tests passed
+  _framework_name: name of framework being tested
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_final_summary_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    bool                         _passed,
+    const char*                  _framework_name
+)
+{
+    const char* name = (_framework_name) ? _framework_name : "";
+
+    if (_passed)
+    {
+        return d_test_string_buffer_append_format(_buffer,
+                   "\n%s%s %s Framework Test Suite COMPLETED SUCCESSFULLY\n",
+                   D_INDENT, TEST_SUCCESS_SYMBOL, name)                        &&
+               d_test_string_buffer_append_format(_buffer,
+                   "%s Ready for development and integration\n\n",
+                   D_INDENT);
+    }
+
+    return d_test_string_buffer_append_format(_buffer,
+               "\n%s%s %s Framework Test Suite COMPLETED WITH FAILURES\n",
+               D_INDENT, TEST_FAIL_SYMBOL, name)                               &&
+           d_test_string_buffer_append_format(_buffer,
+               "%s Review failures before proceeding with development\n\n",
+               D_INDENT);
+}
+
+/*
+d_test_print_recommendations_to_buffer
+  Renders recommendations based on test results into a caller-provided
+  buffer.
+
+Parameter(s):
+  _buffer:         buffer to append to
+  _overall_result: whether all tests passed
+Return:
+  true on success, false on invalid buffer or allocation failure.
+*/
+bool
+d_test_print_recommendations_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    bool                         _overall_result
+)
+{
+    bool ok;
+
+    ok = d_test_string_buffer_append(_buffer, "\nRECOMMENDATIONS:\n") &&
+         d_test_print_separator_to_buffer(_buffer,
+                                          D_TEST_PRINT_SUBHEADER_CHAR,
+                                          D_TEST_PRINT_LINE_WIDTH);
+
+    if (_overall_result)
+    {
+        ok = ok &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Proceed with next development phase\n",        D_INDENT, TEST_SUCCESS_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Consider expanding test coverage\n",           D_INDENT, TEST_INFO_SYMBOL)    &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Review code for optimization opportunities\n", D_INDENT, TEST_INFO_SYMBOL)    &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Document any new patterns or conventions\n",   D_INDENT, TEST_INFO_SYMBOL);
+    }
+    else
+    {
+        ok = ok &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Fix all failing tests before proceeding\n",         D_INDENT, TEST_FAIL_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Review error messages for root causes\n",           D_INDENT, TEST_FAIL_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Check for memory leaks with valgrind/sanitizers\n", D_INDENT, TEST_INFO_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Verify assumptions about edge cases\n",             D_INDENT, TEST_INFO_SYMBOL) &&
+             d_test_string_buffer_append_format(_buffer, "%s%s Consider refactoring problematic areas\n",          D_INDENT, TEST_INFO_SYMBOL);
+    }
+
+    return ok &&
+           d_test_print_separator_to_buffer(_buffer,
+                                            D_TEST_PRINT_SUBHEADER_CHAR,
+                                            D_TEST_PRINT_LINE_WIDTH)           &&
+           d_test_string_buffer_append(_buffer, "\n");
+}
+
+/*
+d_test_print_final_summary_to_string
+  Returns the final summary message as a newly allocated string.
+
+Parameter(s):
+  _passed:         whether all tests passed
+  _framework_name: name of framework being tested
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_final_summary_to_string
+(
+    bool        _passed,
+    const char* _framework_name
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_final_summary_to_buffer(buffer, _passed, _framework_name)
+    )
+}
+
+/*
+d_test_print_recommendations_to_string
+  Returns recommendations based on test results as a newly allocated string.
+
+Parameter(s):
+  _overall_result: whether all tests passed
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_print_recommendations_to_string
+(
+    bool _overall_result
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_print_recommendations_to_buffer(buffer, _overall_result)
+    )
+}
+
+//=============================================================================
+// FILE I/O FUNCTIONS
+//=============================================================================
+
+/*
+d_internal_test_write_with_mode
+  Opens `_filename` with the given fopen mode and writes `_content` to it.
+*/
+static bool
+d_internal_test_write_with_mode
+(
+    const char* _filename,
+    const char* _content,
+    const char* _fopen_mode
+)
+{
+    FILE*  file;
+    size_t length;
+    bool   ok;
+
+    if ( (!_filename) ||
+         (!_content) )
+    {
+        return false;
+    }
+
+    file = d_fopen(_filename, _fopen_mode);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    length = strlen(_content);
+    ok     = (fwrite(_content, 1, length, file) == length);
+
+    if (fclose(file) != 0)
+    {
+        ok = false;
+    }
+
+    return ok;
+}
+
+/*
+d_test_write_to_file
+  Writes a string to a file, overwriting any existing content.
+
+Parameter(s):
+  _filename: path of the destination file
+  _content:  string to write
+Return:
+  true on success, false otherwise.
+*/
+bool
+d_test_write_to_file
+(
+    const char* _filename,
+    const char* _content
+)
+{
+    return d_internal_test_write_with_mode(_filename, _content, "wb");
+}
+
+/*
+d_test_append_to_file
+  Appends a string to the end of a file, creating it if needed.
+
+Parameter(s):
+  _filename: path of the destination file
+  _content:  string to append
+Return:
+  true on success, false otherwise.
+*/
+bool
+d_test_append_to_file
+(
+    const char* _filename,
+    const char* _content
+)
+{
+    return d_internal_test_write_with_mode(_filename, _content, "ab");
+}
+
+/*
+d_internal_test_copy_stream
+  Copies the remainder of `_source` onto the end of `_dest`.  On Linux the
+  copy is done in the kernel with copy_file_range (falling back to sendfile),
+  so the data never passes through user memory; anything the kernel cannot
+  copy, and all other platforms, use a fixed-size buffered copy.
+*/
+static bool
+d_internal_test_copy_stream
+(
+    FILE* _source,
+    FILE* _dest
+)
+{
+    char   chunk[D_TEST_PRINT_COPY_CHUNK_SIZE];
+    size_t read_count;
+
+    if (fflush(_dest) != 0)
+    {
+        return false;
+    }
+
+#if defined(__linux__)
+    {
+        int     in_fd;
+        int     out_fd;
+        ssize_t copied;
+
+        in_fd  = fileno(_source);
+        out_fd = fileno(_dest);
+
+        // copy_file_range, then sendfile; both advance the file offsets, so
+        // each fallback resumes where the previous method stopped
+        do
+        {
+            copied = copy_file_range(in_fd, NULL, out_fd, NULL,
+                                     D_TEST_PRINT_KERNEL_COPY_SIZE, 0);
+        } while ( (copied > 0) ||
+                  ( (copied < 0) && (errno == EINTR) ) );
+
+        if (copied == 0)
+        {
+            return true;
+        }
+
+        do
+        {
+            copied = sendfile(out_fd, in_fd, NULL,
+                              D_TEST_PRINT_KERNEL_COPY_SIZE);
+        } while ( (copied > 0) ||
+                  ( (copied < 0) && (errno == EINTR) ) );
+
+        if (copied == 0)
+        {
+            return true;
+        }
+    }
+#endif
+
+    while ((read_count = fread(chunk, 1, sizeof(chunk), _source)) > 0)
+    {
+        if (fwrite(chunk, 1, read_count, _dest) != read_count)
+        {
+            return false;
+        }
+    }
+
+    return !ferror(_source);
+}
+
+/*
+d_internal_test_prepend_open
+  Opens the stream that new content for a prepend is written to.  If
+  `_filename` already exists this is a temporary file next to it and
+  `*_temp_path` is set; otherwise it is `_filename` itself and `*_temp_path`
+  is NULL.
+*/
+static FILE*
+d_internal_test_prepend_open
+(
+    const char* _filename,
+    char**      _temp_path
+)
+{
+    FILE*  existing;
+    FILE*  temp;
+    char*  temp_path;
+    size_t length;
+
+    *_temp_path = NULL;
+    existing    = d_fopen(_filename, "rb");
+
+    // nothing to prepend to; write the file directly
+    if (!existing)
+    {
+        return d_fopen(_filename, "wb");
+    }
+
+    fclose(existing);
+
+    length    = strlen(_filename);
+    temp_path = malloc(length + sizeof(D_TEST_PRINT_TEMP_SUFFIX));
+
+    if (!temp_path)
+    {
+        return NULL;
+    }
+
+    d_memcpy(temp_path, _filename, length);
+    d_memcpy(temp_path + length,
+             D_TEST_PRINT_TEMP_SUFFIX,
+             sizeof(D_TEST_PRINT_TEMP_SUFFIX));
+
+#if defined(_WIN32) || defined(_WIN64)
+    {
+        int    fd;
+        size_t attempt;
+
+        fd = -1;
+
+        // _mktemp_s only picks a name that is unused right now; creating it
+        // with _O_EXCL fails instead of truncating a file another writer (or
+        // an earlier crash) left there, in which case a fresh name is tried
+        for (attempt = 0;
+             (fd < 0) && (attempt < D_TEST_PRINT_TEMP_ATTEMPTS);
+             attempt++)
+        {
+            d_memcpy(temp_path + length,
+                     D_TEST_PRINT_TEMP_SUFFIX,
+                     sizeof(D_TEST_PRINT_TEMP_SUFFIX));
+
+            if (_mktemp_s(temp_path,
+                          length + sizeof(D_TEST_PRINT_TEMP_SUFFIX)) != 0)
+            {
+                break;
+            }
+
+            fd = _open(temp_path,
+                       _O_CREAT | _O_EXCL | _O_WRONLY | _O_BINARY,
+                       _S_IREAD | _S_IWRITE);
+        }
+
+        temp = (fd >= 0) ? _fdopen(fd, "wb") : NULL;
+
+        if ( (fd >= 0) &&
+             (!temp) )
+        {
+            _close(fd);
+            remove(temp_path);
+        }
+    }
+#else
+    {
+        int fd;
+
+        fd   = mkstemp(temp_path);
+        temp = (fd >= 0) ? fdopen(fd, "wb") : NULL;
+
+        if ( (fd >= 0) &&
+             (!temp) )
+        {
+            close(fd);
+            unlink(temp_path);
+        }
+    }
+#endif
+
+    if (!temp)
+    {
+        free(temp_path);
+
+        return NULL;
+    }
+
+    *_temp_path = temp_path;
+
+    return temp;
+}
+
+/*
+d_internal_test_prepend_commit
+  Finishes a prepend started with d_internal_test_prepend_open.  Splices the
+  original file's content after the new content and atomically renames the
+  temporary file over the original.  On failure (or if `_ok` is false) the
+  original file is left untouched and the temporary file is removed.
+*/
+static bool
+d_internal_test_prepend_commit
+(
+    const char* _filename,
+    char*       _temp_path,
+    FILE*       _stream,
+    bool        _ok
+)
+{
+    FILE* original;
+
+    if (!_temp_path)
+    {
+        return (fclose(_stream) == 0) && _ok;
+    }
+
+    original = (_ok) ? d_fopen(_filename, "rb") : NULL;
+    _ok      = (original != NULL) &&
+               d_internal_test_copy_stream(original, _stream);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    // keep the original file's permissions rather than mkstemp's 0600
+    if (_ok)
+    {
+        struct stat original_stat;
+
+        _ok = (fstat(fileno(original), &original_stat) == 0) &&
+              (fchmod(fileno(_stream), original_stat.st_mode & 07777) == 0);
+    }
+#endif
+
+    if (original)
+    {
+        fclose(original);
+    }
+
+    if (fclose(_stream) != 0)
+    {
+        _ok = false;
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    _ok = _ok &&
+          MoveFileExA(_temp_path, _filename, MOVEFILE_REPLACE_EXISTING);
+#else
+    _ok = _ok &&
+          (rename(_temp_path, _filename) == 0);
+#endif
+
+    if (!_ok)
+    {
+        remove(_temp_path);
+    }
+
+    free(_temp_path);
+
+    return _ok;
+}
+
+/*
+d_test_prepend_to_file
+  Prepends a string to the beginning of a file, creating it if needed.  The
+  new content is written to a temporary file beside the original, the
+  original content is spliced in after it (in the kernel where supported,
+  never loaded whole into memory), and the temporary file is then renamed
+  over the original, so readers never see a partially written file.
+
+Parameter(s):
+  _filename: path of the destination file
+  _content:  string to prepend
+Return:
+  true on success, false otherwise.  On failure the original file is left
+  unchanged.
+*/
+bool
+d_test_prepend_to_file
+(
+    const char* _filename,
+    const char* _content
+)
+{
+    FILE*  stream;
+    char*  temp_path;
+    size_t content_length;
+
+    if ( (!_filename) ||
+         (!_content) )
+    {
+        return false;
+    }
+
+    stream = d_internal_test_prepend_open(_filename, &temp_path);
+
+    if (!stream)
+    {
+        return false;
+    }
+
+    content_length = strlen(_content);
+
+    return d_internal_test_prepend_commit(
+               _filename,
+               temp_path,
+               stream,
+               (fwrite(_content, 1, content_length, stream) == content_length));
+}
+
+/*
+d_test_write_to_file_mode
+  Writes a string to a file using the specified mode.
+
+Parameter(s):
+  _filename: path of the destination file
+  _content:  string to write
+  _mode:     D_TEST_FILE_WRITE, D_TEST_FILE_APPEND or D_TEST_FILE_PREPEND
+Return:
+  true on success, false otherwise.
+*/
+bool
+d_test_write_to_file_mode
+(
+    const char*        _filename,
+    const char*        _content,
+    enum DTestFileMode _mode
+)
+{
+    switch (_mode)
+    {
+        case D_TEST_FILE_WRITE:
+            return d_test_write_to_file(_filename, _content);
+
+        case D_TEST_FILE_APPEND:
+            return d_test_append_to_file(_filename, _content);
+
+        case D_TEST_FILE_PREPEND:
+            return d_test_prepend_to_file(_filename, _content);
+
+        default:
+            return false;
+    }
+}
+
+//=============================================================================
+// COMPLETE REPORT GENERATION
+//=============================================================================
+
+// DTestReportSection
+//   enum (internal): sections of a full report, in output order.
+enum DTestReportSection
+{
+    D_INTERNAL_TEST_REPORT_HEADER = 0,
+    D_INTERNAL_TEST_REPORT_RESULTS,
+    D_INTERNAL_TEST_REPORT_STATISTICS,
+    D_INTERNAL_TEST_REPORT_RATES,
+    D_INTERNAL_TEST_REPORT_RECOMMENDATIONS,
+    D_INTERNAL_TEST_REPORT_SUMMARY,
+    D_INTERNAL_TEST_REPORT_SECTION_COUNT
+};
+
+/*
+d_internal_test_report_render_section
+  Appends a single report section to `_buffer`.  Sections are rendered one at
+  a time so file output never has to hold the whole report in memory.
+*/
+static bool
+d_internal_test_report_render_section
+(
+    struct d_test_string_buffer* _buffer,
+    enum DTestReportSection      _section,
+    const char*                  _framework_name,
+    const char*                  _framework_desc,
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    switch (_section)
+    {
+        case D_INTERNAL_TEST_REPORT_HEADER:
+            return d_test_print_framework_header_to_buffer(_buffer,
+                                                           _framework_name,
+                                                           _framework_desc);
+
+        case D_INTERNAL_TEST_REPORT_RESULTS:
+            return d_test_print_comprehensive_results_to_buffer(_buffer,
+                                                                _overall_counter,
+                                                                _overall_result,
+                                                                _modules_tested,
+                                                                _modules_passed);
+
+        case D_INTERNAL_TEST_REPORT_STATISTICS:
+            return d_test_print_statistics_table_to_buffer(_buffer,
+                                                           _overall_counter);
+
+        case D_INTERNAL_TEST_REPORT_RATES:
+            return d_test_print_success_rate_to_buffer(_buffer,
+                                                       _modules_passed,
+                                                       _modules_tested,
+                                                       "Module")                &&
+                   d_test_print_success_rate_to_buffer(_buffer,
+                                                       _overall_counter->assertions_passed,
+                                                       _overall_counter->assertions_total,
+                                                       "Assertion")             &&
+                   d_test_print_success_rate_to_buffer(_buffer,
+                                                       _overall_counter->tests_passed,
+                                                       _overall_counter->tests_run,
+                                                       "Unit Test");
+
+        case D_INTERNAL_TEST_REPORT_RECOMMENDATIONS:
+            return d_test_print_recommendations_to_buffer(_buffer,
+                                                          _overall_result);
+
+        case D_INTERNAL_TEST_REPORT_SUMMARY:
+            return d_test_print_final_summary_to_buffer(_buffer,
+                                                        _overall_result,
+                                                        _framework_name);
+
+        default:
+            return false;
+    }
+}
+
+/*
+d_test_generate_full_report_to_buffer
+  Appends a complete test report to a caller-provided buffer.
+
+Parameter(s):
+  _buffer:          buffer to append to
+  _framework_name:  name of the framework being tested
+  _framework_desc:  description of the test suite (NULL uses default)
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+Return:
+  true on success, false on invalid arguments or allocation failure.
+*/
+bool
+d_test_generate_full_report_to_buffer
+(
+    struct d_test_string_buffer* _buffer,
+    const char*                  _framework_name,
+    const char*                  _framework_desc,
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    size_t section;
+
+    if ( (!_buffer) ||
+         (!_overall_counter) )
+    {
+        return false;
+    }
+
+    for (section = 0; section < D_INTERNAL_TEST_REPORT_SECTION_COUNT; section++)
+    {
+        if (!d_internal_test_report_render_section(_buffer,
+                                                   (enum DTestReportSection)section,
+                                                   _framework_name,
+                                                   _framework_desc,
+                                                   _overall_counter,
+                                                   _overall_result,
+                                                   _modules_tested,
+                                                   _modules_passed))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+d_test_generate_full_report_to_stream
+  Writes a complete test report to an open stream.  Each section is rendered
+  into one reused scratch buffer and flushed before the next is rendered, so
+  memory use is bounded by the largest section rather than the whole report.
+
+Parameter(s):
+  _file:            destination stream
+  _framework_name:  name of the framework being tested
+  _framework_desc:  description of the test suite (NULL uses default)
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+Return:
+  true on success, false on invalid arguments, allocation or write failure.
+*/
+bool
+d_test_generate_full_report_to_stream
+(
+    FILE*                        _file,
+    const char*                  _framework_name,
+    const char*                  _framework_desc,
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    struct d_test_string_buffer scratch;
+    size_t                      section;
+    bool                        ok;
+
+    if ( (!_file) ||
+         (!_overall_counter) ||
+         (!d_test_string_buffer_init(&scratch, D_TEST_PRINT_INITIAL_BUFFER_SIZE)) )
+    {
+        return false;
+    }
+
+    ok = true;
+
+    for (section = 0;
+         ok && section < D_INTERNAL_TEST_REPORT_SECTION_COUNT;
+         section++)
+    {
+        ok = d_internal_test_report_render_section(&scratch,
+                                                   (enum DTestReportSection)section,
+                                                   _framework_name,
+                                                   _framework_desc,
+                                                   _overall_counter,
+                                                   _overall_result,
+                                                   _modules_tested,
+                                                   _modules_passed) &&
+             d_test_string_buffer_flush(&scratch, _file);
+    }
+
+    d_test_string_buffer_release(&scratch);
+
+    return ok;
+}
+
+/*
+d_test_generate_full_report_to_string
+  Generates a complete test report as a newly allocated string.
+
+Parameter(s):
+  _framework_name:  name of the framework being tested
+  _framework_desc:  description of the test suite (NULL uses default)
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+Return:
+  Newly allocated string (caller must free), or NULL on failure.
+*/
+char*
+d_test_generate_full_report_to_string
+(
+    const char*                  _framework_name,
+    const char*                  _framework_desc,
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed
+)
+{
+    D_INTERNAL_TEST_PRINT_TO_STRING_BODY(
+        d_test_generate_full_report_to_buffer(buffer,
+                                              _framework_name,
+                                              _framework_desc,
+                                              _overall_counter,
+                                              _overall_result,
+                                              _modules_tested,
+                                              _modules_passed)
+    )
+}
+
+/*
+d_test_generate_full_report_to_file
+  Generates a complete test report and writes it to a file.  The report is
+  streamed section by section straight into the file; in prepend mode it is
+  streamed into the temporary file used by d_test_prepend_to_file.
+
+Parameter(s):
+  _filename:        path of the destination file
+  _framework_name:  name of the framework being tested
+  _framework_desc:  description of the test suite (NULL uses default)
+  _overall_counter: cumulative results from all modules
+  _overall_result:  whether all tests passed
+  _modules_tested:  number of modules included in test run
+  _modules_passed:  number of modules that passed all tests
+  _mode:            file operation mode
+Return:
+  true on success, false otherwise.
+*/
+bool
+d_test_generate_full_report_to_file
+(
+    const char*                  _filename,
+    const char*                  _framework_name,
+    const char*                  _framework_desc,
+    const struct d_test_counter* _overall_counter,
+    bool                         _overall_result,
+    size_t                       _modules_tested,
+    size_t                       _modules_passed,
+    enum DTestFileMode           _mode
+)
+{
+    FILE* file;
+    bool  ok;
+
+    if ( (!_filename) ||
+         (!_overall_counter) )
+    {
+        return false;
+    }
+
+    if (_mode == D_TEST_FILE_PREPEND)
+    {
+        char* temp_path;
+
+        file = d_internal_test_prepend_open(_filename, &temp_path);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        ok = d_test_generate_full_report_to_stream(file,
+                                                   _framework_name,
+                                                   _framework_desc,
+                                                   _overall_counter,
+                                                   _overall_result,
+                                                   _modules_tested,
+                                                   _modules_passed);
+
+        return d_internal_test_prepend_commit(_filename, temp_path, file, ok);
+    }
+
+    file = d_fopen(_filename, (_mode == D_TEST_FILE_APPEND) ? "ab" : "wb");
+
+    if (!file)
+    {
+        return false;
+    }
+
+    ok = d_test_generate_full_report_to_stream(file,
+                                               _framework_name,
+                                               _framework_desc,
+                                               _overall_counter,
+                                               _overall_result,
+                                               _modules_tested,
+                                               _modules_passed);
+
+    if (fclose(file) != 0)
+    {
+        ok = false;
+    }
+
+    return ok;
+}
@@ -0,0 +1,2298 @@
+/******************************************************************************
+* djinterp [test]                                             test_property.c
+*
+*   Implementation of property-based test nodes: PRNG, generators, case
+* search and choice-sequence shrinking.
+*
+* path:      \src\test\test_property.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+// enable POSIX features for fork and waitpid
+#if ( !defined(_WIN32) && !defined(_WIN64) &&  \
+      !defined(_POSIX_C_SOURCE) )
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "..\..\inc\test\test_property.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if ( !defined(_WIN32) && !defined(_WIN64) )
+    #include <errno.h>
+    #include <limits.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <time.h>
+    #include <sys/socket.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+
+    // D_TEST_INTERNAL_PROPERTY_FORK
+    //   constant: defined where cases can be spread over worker processes.
+    #define D_TEST_INTERNAL_PROPERTY_FORK 1
+
+    // platforms without MSG_NOSIGNAL set SO_NOSIGPIPE on the socket instead
+    #if !defined(MSG_NOSIGNAL)
+        #define MSG_NOSIGNAL 0
+    #endif
+#endif
+
+
+// D_TEST_INTERNAL_PROPERTY_NONE
+//   constant: search result meaning no case or candidate failed.
+#define D_TEST_INTERNAL_PROPERTY_NONE SIZE_MAX
+
+// D_TEST_INTERNAL_PROPERTY_REDUCTIONS
+//   constant: shrink candidates tried per choice: zero, then value >> k and
+// its even-rounded form for k = 1..63.
+#define D_TEST_INTERNAL_PROPERTY_REDUCTIONS 127
+
+// D_TEST_INTERNAL_PROPERTY_MAX_WORKERS
+//   constant: upper bound on worker processes per search.
+#define D_TEST_INTERNAL_PROPERTY_MAX_WORKERS 64
+
+
+// DTestPropertySearch
+//   enum (internal): what the indices of a search refer to.
+enum DTestPropertySearch
+{
+    D_INTERNAL_PROPERTY_SEARCH_CASES  = 0,   // generated case i
+    D_INTERNAL_PROPERTY_SEARCH_SHRINK = 1    // shrink candidate i
+};
+
+// d_test_internal_property_source
+//   struct (internal): where generators take their choices from.  With a
+// PRNG the draws are recorded into `choices`; without one, `choices` is
+// replayed (values past `count` read as 0) and normalized in place.
+struct d_test_internal_property_source
+{
+    struct d_test_prng* prng;      // NULL while replaying
+    uint64_t*           choices;   // recorded or replayed choices
+    size_t              count;     // replayable choices
+    size_t              used;      // choices consumed so far
+    size_t              capacity;  // size of `choices`
+};
+
+// d_test_internal_property_scratch
+//   struct (internal): buffers for building and checking one input.
+struct d_test_internal_property_scratch
+{
+    uint64_t*      choices;        // choice sequence of the input
+    size_t         used;           // choices the input consumed
+    unsigned char* value;          // generated value
+    unsigned char* arena;          // storage for byte and string data
+    size_t         arena_used;     // arena bytes handed out
+};
+
+#if defined(D_TEST_INTERNAL_PROPERTY_FORK)
+// DTestPropertyMessage
+//   enum (internal): kinds of message exchanged with a worker.
+enum DTestPropertyMessage
+{
+    D_INTERNAL_PROPERTY_MESSAGE_SEARCH   = 0,  // to a worker: run a search
+    D_INTERNAL_PROPERTY_MESSAGE_BOUND    = 1,  // to a worker: lower the bound
+    D_INTERNAL_PROPERTY_MESSAGE_CHECKING = 2,  // from a worker: checking index
+    D_INTERNAL_PROPERTY_MESSAGE_FAILED   = 3,  // from a worker: index failed
+    D_INTERNAL_PROPERTY_MESSAGE_DONE     = 4   // from a worker: share done
+};
+
+// d_test_internal_property_message
+//   struct (internal): one message between the runner and a worker.  A
+// SEARCH message is followed by `count` choices.
+struct d_test_internal_property_message
+{
+    size_t type;    // DTestPropertyMessage
+    size_t search;  // DTestPropertySearch (SEARCH)
+    size_t index;   // bound to the worker, or index from it
+    size_t count;   // choices that follow (SEARCH)
+};
+
+// d_test_internal_property_worker
+//   struct (internal): a worker process and the runner's view of its scan.
+struct d_test_internal_property_worker
+{
+    pid_t    pid;       // -1 when not running
+    int      fd;        // runner's end of the worker's socket
+    bool     scanning;  // has not finished the current search
+    size_t   current;   // index being checked, or NONE before the first
+    uint64_t deadline;  // time it must report by (0 = no timeout)
+};
+#endif  // D_TEST_INTERNAL_PROPERTY_FORK
+
+// d_test_internal_property_pool
+//   struct (internal): workers kept for every search of one run, so shrink
+// rounds reuse them.  Worker w checks indices w, w + count, ... of a search.
+struct d_test_internal_property_pool
+{
+    size_t count;  // workers, and stride of every search
+#if defined(D_TEST_INTERNAL_PROPERTY_FORK)
+    struct d_test_internal_property_worker workers[D_TEST_INTERNAL_PROPERTY_MAX_WORKERS];
+#endif
+};
+
+
+/******************************************************************************
+ * PRNG
+ *****************************************************************************/
+
+/*
+d_internal_property_splitmix
+  Advances a splitmix64 state and returns its next output.
+*/
+static uint64_t
+d_internal_property_splitmix
+(
+    uint64_t* _state
+)
+{
+    uint64_t z;
+
+    *_state += 0x9E3779B97F4A7C15ULL;
+    z        = *_state;
+    z        = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z        = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+/*
+d_test_prng_seed
+  Seeds a PRNG.  The four state words are expanded from `_seed` with
+  splitmix64, which never yields the all-zero state.
+
+Parameter(s):
+  _prng: generator to seed
+  _seed: any 64-bit value
+Return:
+  None.
+*/
+void
+d_test_prng_seed
+(
+    struct d_test_prng* _prng,
+    uint64_t            _seed
+)
+{
+    size_t i;
+
+    if (!_prng)
+    {
+        return;
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+        _prng->state[i] = d_internal_property_splitmix(&_seed);
+    }
+
+    return;
+}
+
+/*
+d_test_prng_next
+  Returns the next 64-bit output of a xoshiro256** generator.
+
+Parameter(s):
+  _prng: seeded generator
+Return:
+  A uniformly distributed 64-bit value.
+*/
+uint64_t
+d_test_prng_next
+(
+    struct d_test_prng* _prng
+)
+{
+    uint64_t* s;
+    uint64_t  result;
+    uint64_t  t;
+
+    s      = _prng->state;
+    result = s[1] * 5;
+    result = ((result << 7) | (result >> 57)) * 9;
+    t      = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3]  = (s[3] << 45) | (s[3] >> 19);
+
+    return result;
+}
+
+/*
+d_test_prng_below
+  Returns an unbiased value in [0, _bound).  Outputs below 2^64 mod _bound
+  are rejected so every residue is equally likely.
+
+Parameter(s):
+  _prng:  seeded generator
+  _bound: exclusive upper bound; 0 means the full 64-bit range
+Return:
+  A uniformly distributed value in [0, _bound).
+*/
+uint64_t
+d_test_prng_below
+(
+    struct d_test_prng* _prng,
+    uint64_t            _bound
+)
+{
+    uint64_t threshold;
+    uint64_t value;
+
+    if (_bound == 0)
+    {
+        return d_test_prng_next(_prng);
+    }
+
+    threshold = (0 - _bound) % _bound;
+
+    do
+    {
+        value = d_test_prng_next(_prng);
+    } while (value < threshold);
+
+    return value % _bound;
+}
+
+
+/******************************************************************************
+ * GENERATORS
+ *****************************************************************************/
+
+/*
+d_internal_property_draw
+  Takes the next choice from a source, reduced to [0, _bound) (0 = full
+  range).  Both recording and replay store the reduced value, so the stored
+  sequence always rebuilds the same input.
+*/
+static uint64_t
+d_internal_property_draw
+(
+    struct d_test_internal_property_source* _source,
+    uint64_t                                _bound
+)
+{
+    uint64_t value;
+
+    if (_source->used >= _source->capacity)
+    {
+        return 0;
+    }
+
+    if (_source->prng)
+    {
+        value = d_test_prng_below(_source->prng, _bound);
+    }
+    else
+    {
+        value = (_source->used < _source->count)
+                    ? _source->choices[_source->used]
+                    : 0;
+
+        if (_bound != 0)
+        {
+            value %= _bound;
+        }
+    }
+
+    _source->choices[_source->used++] = value;
+
+    return value;
+}
+
+/*
+d_internal_property_store
+  Writes the low `_size` bytes of an integer value as the matching C type.
+  Signed and unsigned types of one width share the bit pattern, so only the
+  unsigned types are needed.
+*/
+static void
+d_internal_property_store
+(
+    void*    _destination,
+    size_t   _size,
+    uint64_t _value
+)
+{
+    uint8_t  u8;
+    uint16_t u16;
+    uint32_t u32;
+
+    switch (_size)
+    {
+        case 1:
+            u8 = (uint8_t)_value;
+            memcpy(_destination, &u8, sizeof(u8));
+            break;
+
+        case 2:
+            u16 = (uint16_t)_value;
+            memcpy(_destination, &u16, sizeof(u16));
+            break;
+
+        case 4:
+            u32 = (uint32_t)_value;
+            memcpy(_destination, &u32, sizeof(u32));
+            break;
+
+        default:
+            memcpy(_destination, &_value, sizeof(_value));
+            break;
+    }
+
+    return;
+}
+
+/*
+d_internal_property_load
+  Reads an integer of `_size` bytes written by d_internal_property_store,
+  sign-extending it when `_is_signed`.
+*/
+static uint64_t
+d_internal_property_load
+(
+    const void* _source,
+    size_t      _size,
+    bool        _is_signed
+)
+{
+    uint8_t  u8;
+    uint16_t u16;
+    uint32_t u32;
+    uint64_t value;
+
+    switch (_size)
+    {
+        case 1:
+            memcpy(&u8, _source, sizeof(u8));
+            value = u8;
+            break;
+
+        case 2:
+            memcpy(&u16, _source, sizeof(u16));
+            value = u16;
+            break;
+
+        case 4:
+            memcpy(&u32, _source, sizeof(u32));
+            value = u32;
+            break;
+
+        default:
+            memcpy(&value, _source, sizeof(value));
+
+            return value;
+    }
+
+    // propagate the sign bit of the stored width
+    if ( (_is_signed) && (value >> (_size * 8 - 1)) )
+    {
+        value |= ~(uint64_t)0 << (_size * 8);
+    }
+
+    return value;
+}
+
+/*
+d_internal_property_int_from_choice
+  Maps a choice in [0, span) onto [_min, _max] so that smaller choices give
+  values nearer the origin (the value in range closest to zero): 0 is the
+  origin, then +1, -1, +2, -2, ... until one side runs out, then the rest of
+  the longer side.  Works on the two's-complement bit patterns, so the full
+  int64 range is handled without overflow.
+*/
+static uint64_t
+d_internal_property_int_from_choice
+(
+    uint64_t _choice,
+    int64_t  _min,
+    int64_t  _max
+)
+{
+    int64_t  origin;
+    uint64_t up;
+    uint64_t down;
+    uint64_t shorter;
+
+    origin = (_min > 0) ? _min : ((_max < 0) ? _max : 0);
+    up     = (uint64_t)_max - (uint64_t)origin;
+    down   = (uint64_t)origin - (uint64_t)_min;
+
+    shorter = (up < down) ? up : down;
+
+    if ( (shorter < (UINT64_MAX / 2)) && (_choice > 2 * shorter) )
+    {
+        _choice -= 2 * shorter;
+
+        return (up > down) ? (uint64_t)origin + shorter + _choice
+                           : (uint64_t)origin - shorter - _choice;
+    }
+
+    if (_choice & 1)
+    {
+        return (uint64_t)origin + (_choice / 2) + 1;
+    }
+
+    return (uint64_t)origin - (_choice / 2);
+}
+
+/*
+d_internal_property_build
+  Builds one value of `_gen` at `_value`, drawing choices from `_source`.
+  Byte and string contents are placed in `_arena`.
+*/
+static void
+d_internal_property_build
+(
+    const struct d_test_gen*                _gen,
+    struct d_test_internal_property_source* _source,
+    unsigned char*                          _value,
+    unsigned char*                          _arena,
+    size_t*                                 _arena_used
+)
+{
+    struct d_test_bytes bytes;
+    unsigned char*      data;
+    const char*         alphabet;
+    size_t              alphabet_length;
+    size_t              length;
+    size_t              i;
+    uint64_t            choice;
+
+    switch (_gen->type)
+    {
+        case D_TEST_GEN_TYPE_INT:
+            choice = d_internal_property_draw(
+                         _source,
+                         (uint64_t)_gen->int_range.max -
+                             (uint64_t)_gen->int_range.min + 1);
+
+            d_internal_property_store(
+                _value,
+                _gen->size,
+                d_internal_property_int_from_choice(choice,
+                                                    _gen->int_range.min,
+                                                    _gen->int_range.max));
+            break;
+
+        case D_TEST_GEN_TYPE_UINT:
+            choice = d_internal_property_draw(
+                         _source,
+                         _gen->uint_range.max - _gen->uint_range.min + 1);
+
+            d_internal_property_store(_value,
+                                      _gen->size,
+                                      _gen->uint_range.min + choice);
+            break;
+
+        case D_TEST_GEN_TYPE_BYTES:
+        case D_TEST_GEN_TYPE_STRING:
+            length = _gen->sequence.min_length +
+                     (size_t)d_internal_property_draw(
+                         _source,
+                         (uint64_t)(_gen->sequence.max_length -
+                                    _gen->sequence.min_length) + 1);
+            data   = _arena + *_arena_used;
+
+            if (_gen->type == D_TEST_GEN_TYPE_BYTES)
+            {
+                for (i = 0; i < length; i++)
+                {
+                    data[i] = (unsigned char)d_internal_property_draw(_source,
+                                                                      256);
+                }
+
+                bytes.data   = data;
+                bytes.length = length;
+                memcpy(_value, &bytes, sizeof(bytes));
+                *_arena_used += _gen->sequence.max_length;
+            }
+            else
+            {
+                alphabet = ( (_gen->sequence.alphabet) &&
+                             (_gen->sequence.alphabet[0] != '\0') )
+                               ? _gen->sequence.alphabet
+                               : D_TEST_GEN_DEFAULT_ALPHABET;
+                alphabet_length = strlen(alphabet);
+
+                for (i = 0; i < length; i++)
+                {
+                    data[i] = (unsigned char)alphabet[
+                                  d_internal_property_draw(_source,
+                                                           alphabet_length)];
+                }
+
+                data[length] = '\0';
+                memcpy(_value, &data, sizeof(const char*));
+                *_arena_used += _gen->sequence.max_length + 1;
+            }
+            break;
+
+        case D_TEST_GEN_TYPE_STRUCT:
+            for (i = 0; i < _gen->composite.count; i++)
+            {
+                d_internal_property_build(_gen->composite.fields[i].gen,
+                                          _source,
+                                          _value + _gen->composite.fields[i].offset,
+                                          _arena,
+                                          _arena_used);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return;
+}
+
+/*
+d_test_gen_max_choices
+  Returns the most choices one value of a generator can consume, which sizes
+  choice sequences.
+
+Parameter(s):
+  _gen: generator
+Return:
+  The maximum number of choices, or 0 if `_gen` is NULL.
+*/
+size_t
+d_test_gen_max_choices
+(
+    const struct d_test_gen* _gen
+)
+{
+    size_t total;
+    size_t i;
+
+    if (!_gen)
+    {
+        return 0;
+    }
+
+    switch (_gen->type)
+    {
+        case D_TEST_GEN_TYPE_BYTES:
+        case D_TEST_GEN_TYPE_STRING:
+            return 1 + _gen->sequence.max_length;
+
+        case D_TEST_GEN_TYPE_STRUCT:
+            total = 0;
+
+            for (i = 0; i < _gen->composite.count; i++)
+            {
+                total += d_test_gen_max_choices(_gen->composite.fields[i].gen);
+            }
+
+            return total;
+
+        default:
+            return 1;
+    }
+}
+
+/*
+d_test_gen_arena_size
+  Returns the bytes of byte-buffer and string storage one value of a
+  generator can need.
+
+Parameter(s):
+  _gen: generator
+Return:
+  The arena size in bytes, or 0 if `_gen` is NULL.
+*/
+size_t
+d_test_gen_arena_size
+(
+    const struct d_test_gen* _gen
+)
+{
+    size_t total;
+    size_t i;
+
+    if (!_gen)
+    {
+        return 0;
+    }
+
+    switch (_gen->type)
+    {
+        case D_TEST_GEN_TYPE_BYTES:
+            return _gen->sequence.max_length;
+
+        case D_TEST_GEN_TYPE_STRING:
+            return _gen->sequence.max_length + 1;
+
+        case D_TEST_GEN_TYPE_STRUCT:
+            total = 0;
+
+            for (i = 0; i < _gen->composite.count; i++)
+            {
+                total += d_test_gen_arena_size(_gen->composite.fields[i].gen);
+            }
+
+            return total;
+
+        default:
+            return 0;
+    }
+}
+
+/*
+d_internal_property_append
+  snprintf-style append that tracks the would-be length past `_size`.
+*/
+static void
+d_internal_property_append
+(
+    char*       _buffer,
+    size_t      _size,
+    size_t*     _length,
+    const char* _format,
+    ...
+)
+{
+    va_list args;
+    int     written;
+
+    va_start(args, _format);
+    written = vsnprintf( (*_length < _size) ? _buffer + *_length : NULL,
+                         (*_length < _size) ? _size - *_length   : 0,
+                         _format,
+                         args);
+    va_end(args);
+
+    if (written > 0)
+    {
+        *_length += (size_t)written;
+    }
+
+    return;
+}
+
+/*
+d_internal_property_format
+  Appends a value of `_gen` to `_buffer` in C-like notation.
+*/
+static void
+d_internal_property_format
+(
+    const struct d_test_gen* _gen,
+    const unsigned char*     _value,
+    char*                    _buffer,
+    size_t                   _size,
+    size_t*                  _length
+)
+{
+    struct d_test_bytes bytes;
+    const char*         text;
+    size_t              i;
+
+    switch (_gen->type)
+    {
+        case D_TEST_GEN_TYPE_INT:
+            d_internal_property_append(
+                _buffer, _size, _length, "%lld",
+                (long long)(int64_t)d_internal_property_load(_value,
+                                                             _gen->size,
+                                                             true));
+            break;
+
+        case D_TEST_GEN_TYPE_UINT:
+            d_internal_property_append(
+                _buffer, _size, _length, "%llu",
+                (unsigned long long)d_internal_property_load(_value,
+                                                             _gen->size,
+                                                             false));
+            break;
+
+        case D_TEST_GEN_TYPE_BYTES:
+            memcpy(&bytes, _value, sizeof(bytes));
+            d_internal_property_append(_buffer, _size, _length, "[");
+
+            for (i = 0; i < bytes.length; i++)
+            {
+                d_internal_property_append(_buffer, _size, _length,
+                                           (i > 0) ? " %02x" : "%02x",
+                                           bytes.data[i]);
+            }
+
+            d_internal_property_append(_buffer, _size, _length, "]");
+            break;
+
+        case D_TEST_GEN_TYPE_STRING:
+            memcpy(&text, _value, sizeof(text));
+            d_internal_property_append(_buffer, _size, _length, "\"%s\"", text);
+            break;
+
+        case D_TEST_GEN_TYPE_STRUCT:
+            d_internal_property_append(_buffer, _size, _length, "{ ");
+
+            for (i = 0; i < _gen->composite.count; i++)
+            {
+                d_internal_property_append(_buffer, _size, _length,
+                                           (i > 0) ? ", .%s = " : ".%s = ",
+                                           _gen->composite.fields[i].name);
+                d_internal_property_format(_gen->composite.fields[i].gen,
+                                           _value + _gen->composite.fields[i].offset,
+                                           _buffer,
+                                           _size,
+                                           _length);
+            }
+
+            d_internal_property_append(_buffer, _size, _length, " }");
+            break;
+
+        default:
+            break;
+    }
+
+    return;
+}
+
+/*
+d_test_gen_format
+  Formats a generated value, e.g. `{ .id = -3, .name = "a0" }`.
+
+Parameter(s):
+  _gen:    generator that produced the value
+  _value:  value to format
+  _buffer: destination (may be NULL when _size is 0)
+  _size:   size of _buffer
+Return:
+  The length of the full text, excluding the terminator; the output was
+  truncated if this is >= _size.
+*/
+size_t
+d_test_gen_format
+(
+    const struct d_test_gen* _gen,
+    const void*              _value,
+    char*                    _buffer,
+    size_t                   _size
+)
+{
+    size_t length;
+
+    length = 0;
+
+    if ( (_buffer) && (_size > 0) )
+    {
+        _buffer[0] = '\0';
+    }
+
+    if ( (!_gen) || (!_value) )
+    {
+        return 0;
+    }
+
+    d_internal_property_format(_gen,
+                               (const unsigned char*)_value,
+                               _buffer,
+                               _size,
+                               &length);
+
+    return length;
+}
+
+
+/******************************************************************************
+ * SEARCH
+ *****************************************************************************/
+
+/*
+d_internal_property_shrink_candidate
+  Writes shrink candidate `_index` of `_current` into `_out`.  Candidates are
+  enumerated from most to least aggressive:
+    1. delete a run of 8, 4, 2 or 1 choices;
+    2. zero a run of 8, 4 or 2 choices;
+    3. lower one choice: to 0, then by value >> k for k = 1..63, each also
+       rounded to an even step (a binary search that keeps parity).
+  Every candidate is strictly smaller than `_current` in shortlex order, so
+  accepting failing candidates always terminates.
+
+Return:
+  0 if `_index` is past the last candidate, 1 if `_out` holds a candidate,
+  or -1 if the candidate would equal `_current` and should be skipped.
+*/
+static int
+d_internal_property_shrink_candidate
+(
+    const uint64_t* _current,
+    size_t          _count,
+    size_t          _index,
+    uint64_t*       _out,
+    size_t*         _out_count
+)
+{
+    static const size_t deletions[] = { 8, 4, 2, 1 };
+    static const size_t zeroings[]  = { 8, 4, 2 };
+    size_t              pass;
+    size_t              run;
+    size_t              positions;
+    size_t              slot;
+    size_t              i;
+    bool                changed;
+    uint64_t            value;
+    uint64_t            delta;
+
+    // 1. deletions
+    for (pass = 0; pass < (sizeof(deletions) / sizeof(deletions[0])); pass++)
+    {
+        run = deletions[pass];
+
+        if (run > _count)
+        {
+            continue;
+        }
+
+        positions = _count - run + 1;
+
+        if (_index < positions)
+        {
+            memcpy(_out, _current, _index * sizeof(uint64_t));
+            memcpy(_out + _index,
+                   _current + _index + run,
+                   (_count - _index - run) * sizeof(uint64_t));
+            *_out_count = _count - run;
+
+            return 1;
+        }
+
+        _index -= positions;
+    }
+
+    // 2. zeroed runs
+    for (pass = 0; pass < (sizeof(zeroings) / sizeof(zeroings[0])); pass++)
+    {
+        run = zeroings[pass];
+
+        if (run > _count)
+        {
+            continue;
+        }
+
+        positions = _count - run + 1;
+
+        if (_index < positions)
+        {
+            changed = false;
+
+            memcpy(_out, _current, _count * sizeof(uint64_t));
+
+            for (i = _index; i < _index + run; i++)
+            {
+                changed  = changed || (_out[i] != 0);
+                _out[i]  = 0;
+            }
+
+            *_out_count = _count;
+
+            return changed ? 1 : -1;
+        }
+
+        _index -= positions;
+    }
+
+    // 3. single-choice reductions
+    if (_index < D_TEST_INTERNAL_PROPERTY_REDUCTIONS * _count)
+    {
+        i     = _index / D_TEST_INTERNAL_PROPERTY_REDUCTIONS;
+        slot  = _index % D_TEST_INTERNAL_PROPERTY_REDUCTIONS;
+        value = _current[i];
+
+        if (slot == 0)
+        {
+            delta = value;
+        }
+        else
+        {
+            // odd slots subtract value >> k; even slots the same rounded down
+            // to an even step, which keeps the parity of the choice (and so
+            // the sign of a zig-zag mapped integer)
+            delta = value >> ((slot + 1) / 2);
+
+            if ((slot % 2) == 0)
+            {
+                if ((delta & 1) == 0)
+                {
+                    return -1;
+                }
+
+                delta &= ~(uint64_t)1;
+            }
+        }
+
+        // slot 0 already covers subtracting the whole value
+        if ( (delta == 0) || ( (slot != 0) && (delta == value) ) )
+        {
+            return -1;
+        }
+
+        memcpy(_out, _current, _count * sizeof(uint64_t));
+        _out[i]     = value - delta;
+        *_out_count = _count;
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+d_internal_property_simpler
+  Returns true if choice sequence `_a` is shorter than `_b`, or as long and
+  lexicographically smaller.
+*/
+static bool
+d_internal_property_simpler
+(
+    const uint64_t* _a,
+    size_t          _a_count,
+    const uint64_t* _b,
+    size_t          _b_count
+)
+{
+    size_t i;
+
+    if (_a_count != _b_count)
+    {
+        return _a_count < _b_count;
+    }
+
+    for (i = 0; i < _a_count; i++)
+    {
+        if (_a[i] != _b[i])
+        {
+            return _a[i] < _b[i];
+        }
+    }
+
+    return false;
+}
+
+/*
+d_internal_property_replay
+  Rebuilds the value of a choice sequence into `_scratch` without running
+  the property.  `_scratch->choices` holds the sequence on entry and its
+  normalized form on return.
+*/
+static void
+d_internal_property_replay
+(
+    const struct d_test_property*            _property,
+    size_t                                   _count,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    struct d_test_internal_property_source source;
+
+    source.prng     = NULL;
+    source.choices  = _scratch->choices;
+    source.count    = _count;
+    source.used     = 0;
+    source.capacity = d_test_gen_max_choices(_property->generator);
+
+    memset(_scratch->value, 0, _property->generator->size);
+    _scratch->arena_used = 0;
+
+    d_internal_property_build(_property->generator,
+                              &source,
+                              _scratch->value,
+                              _scratch->arena,
+                              &_scratch->arena_used);
+
+    _scratch->used = source.used;
+
+    return;
+}
+
+/*
+d_internal_property_input
+  Builds input `_index` of a search into `_scratch` without running the
+  property.
+
+Return:
+  1 if the input was built, 0 if the candidate was skipped, and -1 if
+  `_index` is past the end of the search.
+*/
+static int
+d_internal_property_input
+(
+    const struct d_test_property*            _property,
+    enum DTestPropertySearch                 _search,
+    const uint64_t*                          _current,
+    size_t                                   _current_count,
+    size_t                                   _index,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    struct d_test_internal_property_source source;
+    struct d_test_prng                     prng;
+    size_t                                 count;
+    int                                    candidate;
+
+    if (_search == D_INTERNAL_PROPERTY_SEARCH_CASES)
+    {
+        if (_index >= _property->case_count)
+        {
+            return -1;
+        }
+
+        // each case has its own stream so results do not depend on order
+        d_test_prng_seed(&prng,
+                         _property->seed ^
+                             ((uint64_t)(_index + 1) * 0xD1B54A32D192ED03ULL));
+
+        source.prng     = &prng;
+        source.choices  = _scratch->choices;
+        source.count    = 0;
+        source.used     = 0;
+        source.capacity = d_test_gen_max_choices(_property->generator);
+
+        memset(_scratch->value, 0, _property->generator->size);
+        _scratch->arena_used = 0;
+
+        d_internal_property_build(_property->generator,
+                                  &source,
+                                  _scratch->value,
+                                  _scratch->arena,
+                                  &_scratch->arena_used);
+
+        _scratch->used = source.used;
+
+        return 1;
+    }
+
+    candidate = d_internal_property_shrink_candidate(_current,
+                                                     _current_count,
+                                                     _index,
+                                                     _scratch->choices,
+                                                     &count);
+
+    if (candidate <= 0)
+    {
+        return candidate ? 0 : -1;
+    }
+
+    d_internal_property_replay(_property, count, _scratch);
+
+    // replay can lengthen a sequence (missing choices read as 0); only
+    // strictly simpler inputs count, which keeps shrinking finite
+    if (!d_internal_property_simpler(_scratch->choices,
+                                     _scratch->used,
+                                     _current,
+                                     _current_count))
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+d_internal_property_fails
+  Builds input `_index` of a search into `_scratch` and checks the property.
+
+Return:
+  1 if the property failed, 0 if it held or the candidate was skipped, and
+  -1 if `_index` is past the end of the search.
+*/
+static int
+d_internal_property_fails
+(
+    const struct d_test_property*            _property,
+    enum DTestPropertySearch                 _search,
+    const uint64_t*                          _current,
+    size_t                                   _current_count,
+    size_t                                   _index,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    int built;
+
+    built = d_internal_property_input(_property,
+                                      _search,
+                                      _current,
+                                      _current_count,
+                                      _index,
+                                      _scratch);
+
+    if (built <= 0)
+    {
+        return built;
+    }
+
+    return _property->property(_scratch->value, _property->context) ? 0 : 1;
+}
+
+
+/*
+d_internal_property_scan
+  Scans the indices _first, _first + _stride, ... in order and returns the
+  first whose input fails the property.
+*/
+static size_t
+d_internal_property_scan
+(
+    const struct d_test_property*            _property,
+    enum DTestPropertySearch                 _search,
+    const uint64_t*                          _current,
+    size_t                                   _current_count,
+    size_t                                   _first,
+    size_t                                   _stride,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    size_t index;
+    int    result;
+
+    for (index = _first; ; index += _stride)
+    {
+        result = d_internal_property_fails(_property,
+                                           _search,
+                                           _current,
+                                           _current_count,
+                                           index,
+                                           _scratch);
+
+        if (result < 0)
+        {
+            return D_TEST_INTERNAL_PROPERTY_NONE;
+        }
+
+        if (result > 0)
+        {
+            return index;
+        }
+    }
+}
+
+#if defined(D_TEST_INTERNAL_PROPERTY_FORK)
+/*
+d_internal_property_now_ms
+  Returns a monotonic time in milliseconds.
+*/
+static uint64_t
+d_internal_property_now_ms
+(
+    void
+)
+{
+    struct timespec now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+    {
+        return 0;
+    }
+
+    return ((uint64_t)now.tv_sec * 1000u) +
+           ((uint64_t)now.tv_nsec / 1000000u);
+}
+
+/*
+d_internal_property_send
+  Writes all of `_data` to a worker socket.  A peer that has exited fails
+  the write instead of raising SIGPIPE.
+*/
+static bool
+d_internal_property_send
+(
+    int         _fd,
+    const void* _data,
+    size_t      _size
+)
+{
+    const char* cursor;
+    ssize_t     sent;
+
+    cursor = (const char*)_data;
+
+    while (_size > 0)
+    {
+        sent = send(_fd, cursor, _size, MSG_NOSIGNAL);
+
+        if ( (sent < 0) &&
+             (errno == EINTR) )
+        {
+            continue;
+        }
+
+        if (sent <= 0)
+        {
+            return false;
+        }
+
+        cursor += sent;
+        _size  -= (size_t)sent;
+    }
+
+    return true;
+}
+
+/*
+d_internal_property_receive
+  Reads exactly `_size` bytes from a worker socket.
+
+Return:
+  true if all were read, false on end of stream or error.
+*/
+static bool
+d_internal_property_receive
+(
+    int    _fd,
+    void*  _data,
+    size_t _size
+)
+{
+    char*   cursor;
+    ssize_t received;
+
+    cursor = (char*)_data;
+
+    while (_size > 0)
+    {
+        received = read(_fd, cursor, _size);
+
+        if ( (received < 0) &&
+             (errno == EINTR) )
+        {
+            continue;
+        }
+
+        if (received <= 0)
+        {
+            return false;
+        }
+
+        cursor += received;
+        _size  -= (size_t)received;
+    }
+
+    return true;
+}
+
+/*
+d_internal_property_worker_main
+  Body of worker `_first` of a pool; never returns.  For each SEARCH it is
+  sent, it checks indices _first, _first + _stride, ... up to the search's
+  bound, announcing each index before checking it, then reports the index
+  that failed or that its share is done.  BOUND messages that arrive during
+  a scan lower the bound; indices past it cannot change the result.
+*/
+static void
+d_internal_property_worker_main
+(
+    const struct d_test_property*            _property,
+    size_t                                   _first,
+    size_t                                   _stride,
+    int                                      _fd,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    struct d_test_internal_property_message message;
+    struct pollfd                           poll_fd;
+    enum DTestPropertySearch                search;
+    uint64_t*                               current;
+    size_t                                  capacity;
+    size_t                                  count;
+    size_t                                  bound;
+    size_t                                  index;
+    int                                     result;
+    bool                                    failed;
+
+    capacity = d_test_gen_max_choices(_property->generator);
+    current  = (uint64_t*)malloc((capacity + 1) * sizeof(uint64_t));
+
+    if (!current)
+    {
+        _exit(1);
+    }
+
+    // the runner closing its end of the socket ends the worker
+    while (d_internal_property_receive(_fd, &message, sizeof(message)))
+    {
+        // a bound that arrives after a scan ended is stale
+        if (message.type != D_INTERNAL_PROPERTY_MESSAGE_SEARCH)
+        {
+            continue;
+        }
+
+        search = (enum DTestPropertySearch)message.search;
+        count  = message.count;
+        bound  = message.index;
+
+        if ( (count > capacity) ||
+             (!d_internal_property_receive(_fd,
+                                           current,
+                                           count * sizeof(uint64_t))) )
+        {
+            _exit(1);
+        }
+
+        failed = false;
+
+        for (index = _first; index <= bound; index += _stride)
+        {
+            poll_fd.fd      = _fd;
+            poll_fd.events  = POLLIN;
+            poll_fd.revents = 0;
+
+            while (poll(&poll_fd, 1, 0) > 0)
+            {
+                if (!d_internal_property_receive(_fd,
+                                                 &message,
+                                                 sizeof(message)))
+                {
+                    _exit(0);
+                }
+
+                if ( (message.type == D_INTERNAL_PROPERTY_MESSAGE_BOUND) &&
+                     (message.index < bound) )
+                {
+                    bound = message.index;
+                }
+            }
+
+            if (index > bound)
+            {
+                break;
+            }
+
+            message.type  = D_INTERNAL_PROPERTY_MESSAGE_CHECKING;
+            message.index = index;
+
+            if (!d_internal_property_send(_fd, &message, sizeof(message)))
+            {
+                _exit(1);
+            }
+
+            result = d_internal_property_fails(_property,
+                                               search,
+                                               current,
+                                               count,
+                                               index,
+                                               _scratch);
+
+            if (result != 0)
+            {
+                failed = (result > 0);
+
+                break;
+            }
+        }
+
+        message.type  = (failed) ? D_INTERNAL_PROPERTY_MESSAGE_FAILED
+                                 : D_INTERNAL_PROPERTY_MESSAGE_DONE;
+        message.index = index;
+
+        if (!d_internal_property_send(_fd, &message, sizeof(message)))
+        {
+            _exit(1);
+        }
+    }
+
+    _exit(0);
+}
+
+/*
+d_internal_property_pool_spawn
+  Starts worker `_index` of `_pool`.
+
+Return:
+  true if the worker is running, false if it could not be started.
+*/
+static bool
+d_internal_property_pool_spawn
+(
+    struct d_test_internal_property_pool*    _pool,
+    size_t                                   _index,
+    const struct d_test_property*            _property,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    struct d_test_internal_property_worker* worker;
+    pid_t                                   pid;
+    int                                     fds[2];
+    size_t                                  w;
+
+    worker = &_pool->workers[_index];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    {
+        return false;
+    }
+
+#if defined(SO_NOSIGPIPE)
+    {
+        int enabled;
+
+        enabled = 1;
+        setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+    }
+#endif
+
+    // anything still buffered would otherwise be printed by the child
+    fflush(stdout);
+
+    pid = fork();
+
+    if (pid == 0)
+    {
+        close(fds[0]);
+
+        // holding the other workers' sockets open would keep them alive
+        for (w = 0; w < _pool->count; w++)
+        {
+            if (_pool->workers[w].fd >= 0)
+            {
+                close(_pool->workers[w].fd);
+            }
+        }
+
+        d_internal_property_worker_main(_property,
+                                        _index,
+                                        _pool->count,
+                                        fds[1],
+                                        _scratch);
+    }
+
+    close(fds[1]);
+
+    if (pid < 0)
+    {
+        close(fds[0]);
+
+        return false;
+    }
+
+    worker->pid = pid;
+    worker->fd  = fds[0];
+
+    return true;
+}
+
+/*
+d_internal_property_pool_retire
+  Stops a worker, killing it first if `_kill` is set, and reaps it.  The
+  next search starts a fresh one in its place.
+*/
+static void
+d_internal_property_pool_retire
+(
+    struct d_test_internal_property_worker* _worker,
+    bool                                    _kill
+)
+{
+    int status;
+
+    if (_worker->pid < 0)
+    {
+        return;
+    }
+
+    if (_kill)
+    {
+        kill(_worker->pid, SIGKILL);
+    }
+
+    close(_worker->fd);
+
+    while ( (waitpid(_worker->pid, &status, 0) < 0) &&
+            (errno == EINTR) )
+    {
+    }
+
+    _worker->pid      = -1;
+    _worker->fd       = -1;
+    _worker->scanning = false;
+
+    return;
+}
+
+/*
+d_internal_property_pool_lower
+  Lowers `*_best` to `_found` and, if that changed it, sends the new bound
+  to every worker still scanning.
+*/
+static void
+d_internal_property_pool_lower
+(
+    struct d_test_internal_property_pool* _pool,
+    size_t*                               _best,
+    size_t                                _found
+)
+{
+    struct d_test_internal_property_message message;
+    size_t                                  w;
+
+    if (_found >= *_best)
+    {
+        return;
+    }
+
+    *_best = _found;
+
+    memset(&message, 0, sizeof(message));
+    message.type  = D_INTERNAL_PROPERTY_MESSAGE_BOUND;
+    message.index = _found;
+
+    // a worker that has died is noticed when its socket is polled
+    for (w = 0; w < _pool->count; w++)
+    {
+        if (_pool->workers[w].scanning)
+        {
+            d_internal_property_send(_pool->workers[w].fd,
+                                     &message,
+                                     sizeof(message));
+        }
+    }
+
+    return;
+}
+
+/*
+d_internal_property_pool_collect
+  Reads the messages worker `_index` has sent since it was last polled.  A
+  worker whose socket has closed died before finishing its share; the index
+  it was checking counts as failing.
+*/
+static void
+d_internal_property_pool_collect
+(
+    const struct d_test_property*         _property,
+    struct d_test_internal_property_pool* _pool,
+    size_t                                _index,
+    size_t*                               _best
+)
+{
+    struct d_test_internal_property_message messages[32];
+    struct d_test_internal_property_worker* worker;
+    ssize_t                                 received;
+    size_t                                  partial;
+    size_t                                  count;
+    size_t                                  found;
+    size_t                                  m;
+
+    worker = &_pool->workers[_index];
+
+    // one read takes every message already sent; announcements are frequent
+    do
+    {
+        received = read(worker->fd, messages, sizeof(messages));
+    } while ( (received < 0) &&
+              (errno == EINTR) );
+
+    partial = (received > 0)
+                  ? (size_t)received % sizeof(messages[0])
+                  : 0;
+
+    if ( (received <= 0) ||
+         ( (partial) &&
+           (!d_internal_property_receive(worker->fd,
+                                         (char*)messages + received,
+                                         sizeof(messages[0]) - partial)) ) )
+    {
+        found = (worker->current != D_TEST_INTERNAL_PROPERTY_NONE)
+                    ? worker->current
+                    : _index;
+
+        d_internal_property_pool_retire(worker, false);
+        d_internal_property_pool_lower(_pool, _best, found);
+
+        return;
+    }
+
+    count = ((size_t)received + sizeof(messages[0]) - 1) / sizeof(messages[0]);
+
+    for (m = 0; m < count; m++)
+    {
+        switch (messages[m].type)
+        {
+            case D_INTERNAL_PROPERTY_MESSAGE_CHECKING:
+                worker->current  = messages[m].index;
+                worker->deadline = (_property->timeout_ms)
+                                       ? d_internal_property_now_ms() +
+                                             _property->timeout_ms
+                                       : 0;
+                break;
+
+            case D_INTERNAL_PROPERTY_MESSAGE_FAILED:
+                worker->scanning = false;
+                d_internal_property_pool_lower(_pool,
+                                               _best,
+                                               messages[m].index);
+                break;
+
+            default:
+                worker->scanning = false;
+                break;
+        }
+    }
+
+    return;
+}
+
+/*
+d_internal_property_pool_search
+  Runs one search on the pool's workers and returns its lowest failing
+  index.  Workers that cannot be started have their share scanned
+  in-process.  A worker that dies, or that reports nothing for the
+  property's `timeout_ms` (and is then killed), counts as failing at the
+  index it last announced.
+*/
+static size_t
+d_internal_property_pool_search
+(
+    const struct d_test_property*            _property,
+    struct d_test_internal_property_pool*    _pool,
+    enum DTestPropertySearch                 _search,
+    const uint64_t*                          _current,
+    size_t                                   _current_count,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    struct d_test_internal_property_message message;
+    struct d_test_internal_property_worker* worker;
+    struct pollfd                           polls[D_TEST_INTERNAL_PROPERTY_MAX_WORKERS];
+    size_t                                  owners[D_TEST_INTERNAL_PROPERTY_MAX_WORKERS];
+    size_t                                  best;
+    size_t                                  found;
+    size_t                                  polled;
+    size_t                                  w;
+    size_t                                  i;
+    uint64_t                                now;
+    uint64_t                                remaining;
+    int                                     wait_ms;
+
+    best = D_TEST_INTERNAL_PROPERTY_NONE;
+    now  = d_internal_property_now_ms();
+
+    memset(&message, 0, sizeof(message));
+    message.type   = D_INTERNAL_PROPERTY_MESSAGE_SEARCH;
+    message.search = (size_t)_search;
+    message.index  = D_TEST_INTERNAL_PROPERTY_NONE;
+    message.count  = _current_count;
+
+    // hand the search to every worker, starting those not yet running
+    for (w = 0; w < _pool->count; w++)
+    {
+        worker = &_pool->workers[w];
+
+        if ( (worker->pid < 0) &&
+             (!d_internal_property_pool_spawn(_pool, w, _property, _scratch)) )
+        {
+            continue;
+        }
+
+        if ( (!d_internal_property_send(worker->fd,
+                                        &message,
+                                        sizeof(message))) ||
+             (!d_internal_property_send(worker->fd,
+                                        _current,
+                                        _current_count * sizeof(uint64_t))) )
+        {
+            d_internal_property_pool_retire(worker, true);
+
+            continue;
+        }
+
+        worker->scanning = true;
+        worker->current  = D_TEST_INTERNAL_PROPERTY_NONE;
+        worker->deadline = (_property->timeout_ms)
+                               ? now + _property->timeout_ms
+                               : 0;
+    }
+
+    // shares without a worker are scanned here while the workers run
+    for (w = 0; w < _pool->count; w++)
+    {
+        if (!_pool->workers[w].scanning)
+        {
+            found = d_internal_property_scan(_property,
+                                             _search,
+                                             _current,
+                                             _current_count,
+                                             w,
+                                             _pool->count,
+                                             _scratch);
+
+            d_internal_property_pool_lower(_pool, &best, found);
+        }
+    }
+
+    for (;;)
+    {
+        polled  = 0;
+        wait_ms = -1;
+        now     = d_internal_property_now_ms();
+
+        for (w = 0; w < _pool->count; w++)
+        {
+            worker = &_pool->workers[w];
+
+            if (!worker->scanning)
+            {
+                continue;
+            }
+
+            // wait no longer than the nearest deadline
+            if (worker->deadline)
+            {
+                remaining = (worker->deadline > now)
+                                ? worker->deadline - now
+                                : 0;
+
+                if ( (wait_ms < 0) ||
+                     (remaining < (uint64_t)wait_ms) )
+                {
+                    wait_ms = (remaining > INT_MAX) ? INT_MAX
+                                                    : (int)remaining;
+                }
+            }
+
+            polls[polled].fd      = worker->fd;
+            polls[polled].events  = POLLIN;
+            polls[polled].revents = 0;
+            owners[polled]        = w;
+            polled++;
+        }
+
+        if (polled == 0)
+        {
+            break;
+        }
+
+        if (poll(polls, (nfds_t)polled, wait_ms) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // poll itself failed: wait on every worker with blocking reads
+            for (i = 0; i < polled; i++)
+            {
+                polls[i].revents = POLLIN;
+            }
+        }
+
+        now = d_internal_property_now_ms();
+
+        for (i = 0; i < polled; i++)
+        {
+            worker = &_pool->workers[owners[i]];
+
+            if (polls[i].revents != 0)
+            {
+                d_internal_property_pool_collect(_property,
+                                                 _pool,
+                                                 owners[i],
+                                                 &best);
+            }
+            // silent past its deadline: the index it is stuck on fails
+            else if ( (worker->deadline) &&
+                      (now >= worker->deadline) )
+            {
+                found = (worker->current != D_TEST_INTERNAL_PROPERTY_NONE)
+                            ? worker->current
+                            : owners[i];
+
+                d_internal_property_pool_retire(worker, true);
+                d_internal_property_pool_lower(_pool, &best, found);
+            }
+        }
+    }
+
+    return best;
+}
+#endif  // D_TEST_INTERNAL_PROPERTY_FORK
+
+/*
+d_internal_property_pool_init
+  Prepares a pool of `_workers` workers (clamped to
+  D_TEST_INTERNAL_PROPERTY_MAX_WORKERS).  Workers are started by the first
+  search that needs them.
+*/
+static void
+d_internal_property_pool_init
+(
+    struct d_test_internal_property_pool* _pool,
+    size_t                                _workers
+)
+{
+    _pool->count = (_workers > D_TEST_INTERNAL_PROPERTY_MAX_WORKERS)
+                       ? D_TEST_INTERNAL_PROPERTY_MAX_WORKERS
+                       : _workers;
+
+#if defined(D_TEST_INTERNAL_PROPERTY_FORK)
+    {
+        size_t w;
+
+        for (w = 0; w < D_TEST_INTERNAL_PROPERTY_MAX_WORKERS; w++)
+        {
+            _pool->workers[w].pid      = -1;
+            _pool->workers[w].fd       = -1;
+            _pool->workers[w].scanning = false;
+            _pool->workers[w].current  = D_TEST_INTERNAL_PROPERTY_NONE;
+            _pool->workers[w].deadline = 0;
+        }
+    }
+#endif
+
+    return;
+}
+
+/*
+d_internal_property_pool_close
+  Stops and reaps every worker of a pool.
+*/
+static void
+d_internal_property_pool_close
+(
+    struct d_test_internal_property_pool* _pool
+)
+{
+#if defined(D_TEST_INTERNAL_PROPERTY_FORK)
+    size_t w;
+
+    // idle workers exit once their socket is closed
+    for (w = 0; w < _pool->count; w++)
+    {
+        d_internal_property_pool_retire(&_pool->workers[w], false);
+    }
+#else
+    (void)_pool;
+#endif
+
+    return;
+}
+
+/*
+d_internal_property_search
+  Returns the lowest index of a search whose input fails the property.  With
+  more than one worker, worker w of `_pool` checks indices w, w + W, ...
+  and the minimum over workers equals what a single in-process scan would
+  return: a worker only skips indices above a failure already found.
+*/
+static size_t
+d_internal_property_search
+(
+    const struct d_test_property*            _property,
+    struct d_test_internal_property_pool*    _pool,
+    enum DTestPropertySearch                 _search,
+    const uint64_t*                          _current,
+    size_t                                   _current_count,
+    struct d_test_internal_property_scratch* _scratch
+)
+{
+    if (_pool->count <= 1)
+    {
+        return d_internal_property_scan(_property,
+                                        _search,
+                                        _current,
+                                        _current_count,
+                                        0,
+                                        1,
+                                        _scratch);
+    }
+
+#if defined(D_TEST_INTERNAL_PROPERTY_FORK)
+    return d_internal_property_pool_search(_property,
+                                           _pool,
+                                           _search,
+                                           _current,
+                                           _current_count,
+                                           _scratch);
+#else
+    {
+        size_t best;
+        size_t found;
+        size_t w;
+
+        best = D_TEST_INTERNAL_PROPERTY_NONE;
+
+        for (w = 0; w < _pool->count; w++)
+        {
+            found = d_internal_property_scan(_property,
+                                             _search,
+                                             _current,
+                                             _current_count,
+                                             w,
+                                             _pool->count,
+                                             _scratch);
+
+            if (found < best)
+            {
+                best = found;
+            }
+        }
+
+        return best;
+    }
+#endif  // D_TEST_INTERNAL_PROPERTY_FORK
+}
+
+
+/******************************************************************************
+ * PROPERTY NODE
+ *****************************************************************************/
+
+/*
+d_internal_property_clear_result
+  Releases the result of the previous run.
+*/
+static void
+d_internal_property_clear_result
+(
+    struct d_test_property* _property
+)
+{
+    free(_property->choices);
+    free(_property->counterexample);
+    free(_property->arena);
+
+    _property->falsified      = false;
+    _property->failing_case   = 0;
+    _property->shrink_steps   = 0;
+    _property->choice_count   = 0;
+    _property->choices        = NULL;
+    _property->counterexample = NULL;
+    _property->arena          = NULL;
+
+    return;
+}
+
+/*
+d_test_property_new
+  Creates a property node with the default case count, seed, worker count,
+  shrink limit and worker timeout.
+
+Parameter(s):
+  _property:  predicate under test
+  _generator: generator for its input
+  _context:   passed through to every call of _property
+Return:
+  A new d_test_property, or NULL if an argument is NULL or allocation
+  failed.
+*/
+struct d_test_property*
+d_test_property_new
+(
+    fn_test_property         _property,
+    const struct d_test_gen* _generator,
+    void*                    _context
+)
+{
+    struct d_test_property* result;
+
+    if ( (!_property) || (!_generator) )
+    {
+        return NULL;
+    }
+
+    result = (struct d_test_property*)calloc(1, sizeof(struct d_test_property));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    result->property    = _property;
+    result->context     = _context;
+    result->generator   = _generator;
+    result->case_count  = D_TEST_PROPERTY_DEFAULT_CASES;
+    result->seed        = D_TEST_PROPERTY_DEFAULT_SEED;
+    result->workers     = D_TEST_PROPERTY_DEFAULT_WORKERS;
+    result->max_shrinks = D_TEST_PROPERTY_DEFAULT_MAX_SHRINKS;
+    result->timeout_ms  = D_TEST_PROPERTY_DEFAULT_TIMEOUT_MS;
+
+    return result;
+}
+
+/*
+d_test_property_run
+  Checks the property against `case_count` generated inputs.  If one fails,
+  its choice sequence is shrunk: each round searches the candidates of the
+  current sequence and keeps the first that still fails, until none does or
+  `max_shrinks` steps were taken.  The shrunk input is rebuilt into
+  `counterexample`.
+  With more than one worker, the same worker processes serve every search
+  of the run.  An input that crashes a worker, or that a worker spends more
+  than `timeout_ms` on, counts as failing.
+
+Parameter(s):
+  _property: property to run
+Return:
+  true if every case passed, false if the property was falsified or the run
+  could not be set up.
+*/
+bool
+d_test_property_run
+(
+    struct d_test_property* _property
+)
+{
+    struct d_test_internal_property_scratch scratch;
+    struct d_test_internal_property_pool    pool;
+    uint64_t*                               current;
+    size_t                                  current_count;
+    size_t                                  capacity;
+    size_t                                  arena_size;
+    size_t                                  found;
+    bool                                    ok;
+
+    if ( (!_property)            ||
+         (!_property->property)  ||
+         (!_property->generator) )
+    {
+        return false;
+    }
+
+    d_internal_property_clear_result(_property);
+
+    capacity   = d_test_gen_max_choices(_property->generator);
+    arena_size = d_test_gen_arena_size(_property->generator);
+
+    scratch.choices = (uint64_t*)malloc((capacity + 1) * sizeof(uint64_t));
+    scratch.value   = (unsigned char*)malloc(_property->generator->size + 1);
+    scratch.arena   = (unsigned char*)malloc(arena_size + 1);
+    current         = (uint64_t*)malloc((capacity + 1) * sizeof(uint64_t));
+    ok              = (scratch.choices) && (scratch.value) &&
+                      (scratch.arena)   && (current);
+
+    d_internal_property_pool_init(&pool, _property->workers);
+
+    if (ok)
+    {
+        found = d_internal_property_search(_property,
+                                           &pool,
+                                           D_INTERNAL_PROPERTY_SEARCH_CASES,
+                                           NULL,
+                                           0,
+                                           &scratch);
+
+        if (found != D_TEST_INTERNAL_PROPERTY_NONE)
+        {
+            _property->falsified    = true;
+            _property->failing_case = found;
+
+            // rebuild the failing case without rerunning the property; it
+            // may be the case that crashed a worker
+            d_internal_property_input(_property,
+                                      D_INTERNAL_PROPERTY_SEARCH_CASES,
+                                      NULL,
+                                      0,
+                                      found,
+                                      &scratch);
+
+            current_count = scratch.used;
+            memcpy(current, scratch.choices, current_count * sizeof(uint64_t));
+
+            while (_property->shrink_steps < _property->max_shrinks)
+            {
+                found = d_internal_property_search(
+                            _property,
+                            &pool,
+                            D_INTERNAL_PROPERTY_SEARCH_SHRINK,
+                            current,
+                            current_count,
+                            &scratch);
+
+                if (found == D_TEST_INTERNAL_PROPERTY_NONE)
+                {
+                    break;
+                }
+
+                d_internal_property_input(_property,
+                                          D_INTERNAL_PROPERTY_SEARCH_SHRINK,
+                                          current,
+                                          current_count,
+                                          found,
+                                          &scratch);
+
+                current_count = scratch.used;
+                memcpy(current,
+                       scratch.choices,
+                       current_count * sizeof(uint64_t));
+
+                _property->shrink_steps++;
+            }
+
+            // rebuild the shrunk input; the last search reused the scratch
+            memcpy(scratch.choices, current, current_count * sizeof(uint64_t));
+            d_internal_property_replay(_property, current_count, &scratch);
+
+            // the result keeps the value together with the storage it uses
+            _property->choices        = current;
+            _property->choice_count   = current_count;
+            _property->counterexample = scratch.value;
+            _property->arena          = scratch.arena;
+            current                   = NULL;
+            scratch.value             = NULL;
+            scratch.arena             = NULL;
+        }
+    }
+
+    d_internal_property_pool_close(&pool);
+
+    free(scratch.choices);
+    free(scratch.value);
+    free(scratch.arena);
+    free(current);
+
+    return (ok) && (!_property->falsified);
+}
+
+/*
+d_test_property_counterexample
+  Returns the shrunk counterexample of the last run, laid out as the
+  generator's value type.
+
+Parameter(s):
+  _property: property that was run
+Return:
+  The counterexample, or NULL if the last run passed.
+*/
+const void*
+d_test_property_counterexample
+(
+    const struct d_test_property* _property
+)
+{
+    if (!_property)
+    {
+        return NULL;
+    }
+
+    return _property->counterexample;
+}
+
+/*
+d_test_property_format
+  Formats the counterexample of the last run with d_test_gen_format.
+
+Parameter(s):
+  _property: property that was run
+  _buffer:   destination (may be NULL when _size is 0)
+  _size:     size of _buffer
+Return:
+  The length of the full text, or 0 if there is no counterexample.
+*/
+size_t
+d_test_property_format
+(
+    const struct d_test_property* _property,
+    char*                         _buffer,
+    size_t                        _size
+)
+{
+    if (!_property)
+    {
+        if ( (_buffer) && (_size > 0) )
+        {
+            _buffer[0] = '\0';
+        }
+
+        return 0;
+    }
+
+    return d_test_gen_format(_property->generator,
+                             _property->counterexample,
+                             _buffer,
+                             _size);
+}
+
+/*
+d_test_property_describe
+  Describes a falsified run for failure output: the case that failed, the
+  seed that generated it and the shrunk counterexample, e.g.
+  `case 12 of seed 0x9e3779b97f4a7c15 failed; shrunk in 4 steps to 100`.
+
+Parameter(s):
+  _property: property that was run
+  _buffer:   destination (may be NULL when _size is 0)
+  _size:     size of _buffer
+Return:
+  The length of the full text, excluding the terminator, or 0 if the last
+  run was not falsified.  The output was truncated if this is >= _size.
+*/
+size_t
+d_test_property_describe
+(
+    const struct d_test_property* _property,
+    char*                         _buffer,
+    size_t                        _size
+)
+{
+    size_t length;
+
+    length = 0;
+
+    if ( (_buffer) && (_size > 0) )
+    {
+        _buffer[0] = '\0';
+    }
+
+    if ( (!_property) || (!_property->falsified) )
+    {
+        return 0;
+    }
+
+    d_internal_property_append(_buffer,
+                               _size,
+                               &length,
+                               "case %zu of seed 0x%016llx failed; "
+                               "shrunk in %zu steps to ",
+                               _property->failing_case,
+                               (unsigned long long)_property->seed,
+                               _property->shrink_steps);
+
+    if (_property->counterexample)
+    {
+        d_internal_property_format(_property->generator,
+                                   (const unsigned char*)
+                                       _property->counterexample,
+                                   _buffer,
+                                   _size,
+                                   &length);
+    }
+
+    return length;
+}
+
+/*
+d_test_property_free
+  Frees a property node and the result of its last run.  The generator and
+  context are not owned and are left alone.
+
+Parameter(s):
+  _property: property to free (may be NULL)
+Return:
+  None.
+*/
+void
+d_test_property_free
+(
+    struct d_test_property* _property
+)
+{
+    if (!_property)
+    {
+        return;
+    }
+
+    d_internal_property_clear_result(_property);
+    free(_property);
+
+    return;
+}
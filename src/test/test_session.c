@@ -14,6 +14,24 @@
 #include <stdarg.h>
 
 
+// D_TEST_INTERNAL_THREAD_LOCAL
+//   macro: storage class for per-thread state (the active session).
+#if defined(_MSC_VER)
+    #define D_TEST_INTERNAL_THREAD_LOCAL __declspec(thread)
+#elif ( defined(__STDC_VERSION__) &&  \
+        (__STDC_VERSION__ >= 201112L) )
+    #define D_TEST_INTERNAL_THREAD_LOCAL _Thread_local
+#else
+    #define D_TEST_INTERNAL_THREAD_LOCAL __thread
+#endif
+
+// d_internal_session_active
+//   variable: session being run on this thread, or NULL outside of
+// d_test_session_run.  D_TEST_SESSION_CHECK records into it.
+static D_TEST_INTERNAL_THREAD_LOCAL struct d_test_session*
+    d_internal_session_active = NULL;
+
+
 /******************************************************************************
  * INTERNAL HELPERS - TIMING
  *****************************************************************************/
@@ -280,6 +298,39 @@ d_internal_session_color_bold
 }
 
 
+/******************************************************************************
+ * INTERNAL HELPERS - ASSERTIONS
+ *****************************************************************************/
+
+/*
+d_internal_session_clear_failures
+  Frees every failed assertion recorded by the session.
+*/
+static void
+d_internal_session_clear_failures
+(
+    struct d_test_session* _session
+)
+{
+    size_t i;
+
+    if ( (!_session) || (!_session->failures) )
+    {
+        return;
+    }
+
+    for (i = 0; i < d_ptr_vector_size(_session->failures); i++)
+    {
+        d_assert_free((struct d_assert*)d_ptr_vector_at(_session->failures,
+                                                        (d_index)i));
+    }
+
+    d_ptr_vector_clear(_session->failures);
+
+    return;
+}
+
+
 /******************************************************************************
  * INTERNAL HELPERS - CHILDREN
  *****************************************************************************/
@@ -351,10 +402,21 @@ d_test_session_new
         return NULL;
     }
 
+    session->failures = d_ptr_vector_new_default();
+
+    if (!session->failures)
+    {
+        d_ptr_vector_free(session->children);
+        free(session);
+
+        return NULL;
+    }
+
     session->config = d_test_config_new(D_TEST_MODE_NORMAL);
 
     if (!session->config)
     {
+        d_ptr_vector_free(session->failures);
         d_ptr_vector_free(session->children);
         free(session);
 
@@ -368,6 +430,8 @@ d_test_session_new
     session->current_index  = 0;
     session->failure_count  = 0;
     session->repeat_current = 0;
+    session->message_flags  = D_TEST_MODE_NORMAL;
+    session->count_only     = false;
     session->start_time_ms  = 0.0;
     session->end_time_ms    = 0.0;
 
@@ -559,18 +623,6 @@ d_test_session_validate_args
         return NULL;
     }
 
-    if (!config->settings)
-    {
-        config->settings = d_min_enum_map_new();
-
-        if (!config->settings)
-        {
-            d_test_config_free(config);
-
-            return NULL;
-        }
-    }
-
     for (i = 0; i < _arg_count; i++)
     {
         if (!_args[i].key)
@@ -589,9 +641,7 @@ d_test_session_validate_args
         }
 
         // store with the registry flag as the key
-        d_min_enum_map_put(config->settings, 
-                           (int)row->flag, 
-                           (void*)_args[i].value);
+        d_test_config_put(&config, row, (void*)_args[i].value);
     }
 
     return config;
@@ -616,6 +666,12 @@ d_test_session_free
         d_ptr_vector_free(_session->children);
     }
 
+    if (_session->failures)
+    {
+        d_internal_session_clear_failures(_session);
+        d_ptr_vector_free(_session->failures);
+    }
+
     if (_session->config)
     {
         d_test_config_free(_session->config);
@@ -640,12 +696,28 @@ d_test_session_set_option
 )
 {
     if ( (!_session) || 
-         (!_session->config) || 
-         (!_session->config->settings) )
+         (!_session->config) )
     {
         return false;
     }
 
+    // the session may share its config; write to a private copy
+    if (!d_test_config_unshare(&_session->config))
+    {
+        return false;
+    }
+
+    // the settings map is created with the first non-config entry
+    if (!_session->config->settings)
+    {
+        _session->config->settings = d_min_enum_map_new();
+
+        if (!_session->config->settings)
+        {
+            return false;
+        }
+    }
+
     return d_min_enum_map_put(_session->config->settings, 
                               (int)_option, 
                               (void*)_value);
@@ -874,15 +946,20 @@ d_test_session_run
     struct d_test_session* _session
 )
 {
-    size_t              i;
-    size_t              child_count;
-    size_t              repeat_count;
-    size_t              fail_fast;
-    struct d_test_type* child;
-    bool                child_passed;
-    bool                all_passed;
-    bool                abort_on_failure;
-    void*               opt_value;
+    size_t                        i;
+    size_t                        child_count;
+    size_t                        repeat_count;
+    size_t                        fail_fast;
+    struct d_test_type*           child;
+    struct d_test_filter*         filter;
+    struct d_test_resolved_config resolved;
+    struct d_test_session*        previous;
+    const char*                   include;
+    const char*                   exclude;
+    bool                          child_passed;
+    bool                          all_passed;
+    bool                          abort_on_failure;
+    void*                         opt_value;
 
     if (!_session)
     {
@@ -894,6 +971,23 @@ d_test_session_run
         return false;
     }
 
+    // compile name filters once for the whole run
+    include = d_test_session_get_option(_session,
+                                        D_TEST_SESSION_OPT_FILTER_INCLUDE);
+    exclude = d_test_session_get_option(_session,
+                                        D_TEST_SESSION_OPT_FILTER_EXCLUDE);
+    filter  = NULL;
+
+    if ( (include) || (exclude) )
+    {
+        filter = d_test_filter_new(include, exclude);
+
+        if (!filter)
+        {
+            return false;
+        }
+    }
+
     opt_value = d_test_session_get_option(_session, 
                                           D_TEST_SESSION_OPT_ABORT_ON_FAILURE);
     abort_on_failure = opt_value ? (bool)(uintptr_t)opt_value : false;
@@ -907,6 +1001,22 @@ d_test_session_run
                                           D_TEST_SESSION_OPT_FAIL_FAST);
     fail_fast = opt_value ? (size_t)(uintptr_t)opt_value : 0;
 
+    // resolve the session config once; every module shares the snapshot
+    if (_session->config)
+    {
+        d_test_config_resolve(&resolved, _session->config);
+
+        _session->message_flags = resolved.message_flags;
+    }
+
+    // counters without printing: passing checks never build a d_assert
+    _session->count_only = D_TEST_MSG_IS_COUNT_ONLY(_session->message_flags);
+
+    d_internal_session_clear_failures(_session);
+
+    previous                  = d_internal_session_active;
+    d_internal_session_active = _session;
+
     _session->status         = D_TEST_SESSION_STATUS_RUNNING;
     _session->current_index  = 0;
     _session->failure_count  = 0;
@@ -953,10 +1063,21 @@ d_test_session_run
                 continue;
             }
 
+            // modules outside the filter are skipped without being run
+            if (!d_test_filter_selects(
+                     filter,
+                     d_test_module_get_name(child->D_KEYWORD_TEST_MODULE)))
+            {
+                D_COUNTER_INC_MODULE_SKIP(&_session->stats);
+
+                continue;
+            }
+
             d_test_session_write_module_start(_session, child);
 
-            child_passed = d_test_module_run(child->D_KEYWORD_TEST_MODULE, 
-                                             _session->config);
+            child_passed = d_test_module_run_resolved(
+                               child->D_KEYWORD_TEST_MODULE,
+                               (_session->config) ? &resolved : NULL);
 
             if (child_passed)
             {
@@ -990,6 +1111,10 @@ d_test_session_run
         }
     }
 
+    d_test_filter_free(filter);
+
+    d_internal_session_active = previous;
+
     _session->end_time_ms = d_internal_session_get_time_ms();
     d_test_statistics_stop_timer(&_session->stats);
 
@@ -1038,18 +1163,32 @@ d_test_session_run_by_name
     const char*            _name
 )
 {
-    size_t              i;
-    size_t              count;
-    struct d_test_type* child;
-    const char*         child_name;
-    bool                all_passed;
-    bool                found;
+    size_t                        i;
+    size_t                        count;
+    struct d_test_type*           child;
+    struct d_test_filter*         filter;
+    struct d_test_resolved_config resolved;
+    bool                          all_passed;
+    bool                          found;
 
     if ( (!_session) || (!_name) )
     {
         return false;
     }
 
+    // _name is a filter pattern list; plain names match exactly
+    filter = d_test_filter_new(_name, NULL);
+
+    if (!filter)
+    {
+        return false;
+    }
+
+    if (_session->config)
+    {
+        d_test_config_resolve(&resolved, _session->config);
+    }
+
     all_passed = true;
     found      = false;
     count      = d_test_session_child_count(_session);
@@ -1063,20 +1202,23 @@ d_test_session_run_by_name
             continue;
         }
 
-        child_name = d_test_module_get_name(child->D_KEYWORD_TEST_MODULE);
-
-        if ( (child_name) && (strcmp(child_name, _name) == 0) )
+        if (d_test_filter_selects(
+                filter,
+                d_test_module_get_name(child->D_KEYWORD_TEST_MODULE)))
         {
             found = true;
 
-            if (!d_test_module_run(child->D_KEYWORD_TEST_MODULE, 
-                                   _session->config))
+            if (!d_test_module_run_resolved(
+                     child->D_KEYWORD_TEST_MODULE,
+                     (_session->config) ? &resolved : NULL))
             {
                 all_passed = false;
             }
         }
     }
 
+    d_test_filter_free(filter);
+
     return found && all_passed;
 }
 
@@ -1160,12 +1302,243 @@ d_test_session_reset
     _session->start_time_ms  = 0.0;
     _session->end_time_ms    = 0.0;
 
+    d_internal_session_clear_failures(_session);
     D_STATISTICS_RESET(&_session->stats);
 
     return true;
 }
 
 
+/******************************************************************************
+ * ASSERTION RECORDING FUNCTIONS
+ *****************************************************************************/
+
+struct d_test_session*
+d_test_session_active
+(
+    void
+)
+{
+    return d_internal_session_active;
+}
+
+
+bool
+d_test_session_is_count_only
+(
+    const struct d_test_session* _session
+)
+{
+    if (!_session)
+    {
+        return false;
+    }
+
+    return _session->count_only;
+}
+
+
+bool
+d_test_session_check_pass
+(
+    const char* _file,
+    int         _line,
+    const char* _expression
+)
+{
+    struct d_test_session* session;
+
+    // a pass is printed by its expression alone; only failures report where
+    (void)_file;
+    (void)_line;
+
+    session = d_internal_session_active;
+
+    if (!session)
+    {
+        return true;
+    }
+
+    if (session->message_flags & D_TEST_MSG_FLAG_COUNT_ASSERTS_PASS)
+    {
+        D_COUNTER_INC_ASSERT_PASS(&session->stats);
+    }
+
+    // count-only sessions stop here; nothing is allocated or formatted
+    if (D_ASSERT_LIKELY(session->count_only))
+    {
+        return true;
+    }
+
+    // passes are never materialized as a d_assert
+    if (session->message_flags & D_TEST_MSG_FLAG_PRINT_ASSERTS_PASS)
+    {
+        d_test_session_write_test_result(session,
+                                         _expression,
+                                         true,
+                                         NULL,
+                                         0.0);
+    }
+
+    return true;
+}
+
+
+D_ASSERT_COLD bool
+d_test_session_check_fail
+(
+    const char* _file,
+    int         _line,
+    const char* _expression
+)
+{
+    if (!d_internal_session_active)
+    {
+        return false;
+    }
+
+    return d_test_session_record_fail(
+               d_assert_at(d_assert_new(false, NULL, NULL),
+                           _file,
+                           _line,
+                           _expression));
+}
+
+
+D_ASSERT_COLD bool
+d_test_session_record_fail
+(
+    struct d_assert* _assertion
+)
+{
+    struct d_test_session* session;
+
+    session = d_internal_session_active;
+
+    if (!session)
+    {
+        d_assert_free(_assertion);
+
+        return false;
+    }
+
+    if (session->message_flags & D_TEST_MSG_FLAG_COUNT_ASSERTS_FAIL)
+    {
+        D_COUNTER_INC_ASSERT_FAIL(&session->stats);
+    }
+
+    if (!_assertion)
+    {
+        return false;
+    }
+
+    if (session->message_flags & D_TEST_MSG_FLAG_PRINT_ASSERTS_FAIL)
+    {
+        d_test_session_write_test_result(session,
+                                         _assertion->expression,
+                                         false,
+                                         d_assert_describe(_assertion),
+                                         0.0);
+    }
+
+    if ( (!session->failures) ||
+         (!d_ptr_vector_push_back(session->failures, _assertion)) )
+    {
+        d_assert_free(_assertion);
+    }
+
+    return false;
+}
+
+
+D_ASSERT_COLD void
+d_test_session_report_property
+(
+    const struct d_test_property* _property
+)
+{
+    struct d_test_session* session;
+    char*                  description;
+    size_t                 length;
+
+    if ( (!_property) || (!_property->falsified) )
+    {
+        return;
+    }
+
+    session = d_internal_session_active;
+
+    if ( (session) &&
+         ( (session->count_only) ||
+           (!(session->message_flags & D_TEST_MSG_FLAG_PRINT_TESTS_FAIL)) ) )
+    {
+        return;
+    }
+
+    length      = d_test_property_describe(_property, NULL, 0);
+    description = (char*)malloc(length + 1);
+
+    if (!description)
+    {
+        return;
+    }
+
+    d_test_property_describe(_property, description, length + 1);
+
+    // outside a session the counterexample still reaches the console
+    if (session)
+    {
+        d_test_session_write_test_result(session,
+                                         "property",
+                                         false,
+                                         description,
+                                         0.0);
+    }
+    else
+    {
+        printf("    %s property\n      %s\n", D_TEST_SYMBOL_FAIL, description);
+    }
+
+    free(description);
+
+    return;
+}
+
+
+size_t
+d_test_session_failure_record_count
+(
+    const struct d_test_session* _session
+)
+{
+    if ( (!_session) || (!_session->failures) )
+    {
+        return 0;
+    }
+
+    return d_ptr_vector_size(_session->failures);
+}
+
+
+const struct d_assert*
+d_test_session_get_failure_at
+(
+    const struct d_test_session* _session,
+    size_t                       _index
+)
+{
+    if ( (!_session)           ||
+         (!_session->failures) ||
+         (_index >= d_ptr_vector_size(_session->failures)) )
+    {
+        return NULL;
+    }
+
+    return (const struct d_assert*)d_ptr_vector_at(_session->failures,
+                                                   (d_index)_index);
+}
+
+
 /******************************************************************************
  * OUTPUT FUNCTIONS
  *****************************************************************************/
@@ -1,52 +1,439 @@
+// enable POSIX features for clock_gettime and localtime_r
+#if ( !defined(_WIN32) && !defined(_WIN64) &&  \
+      !defined(_POSIX_C_SOURCE) )
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "..\..\inc\test\test_standalone.h"
 
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <errno.h>
+    #include <poll.h>
+    #include <time.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+
+// D_TEST_INTERNAL_THREAD_LOCAL
+//   macro: storage class for per-thread state (the active object pool).
+#if defined(_MSC_VER)
+    #define D_TEST_INTERNAL_THREAD_LOCAL __declspec(thread)
+#elif ( defined(__STDC_VERSION__) &&  \
+        (__STDC_VERSION__ >= 201112L) )
+    #define D_TEST_INTERNAL_THREAD_LOCAL _Thread_local
+#else
+    #define D_TEST_INTERNAL_THREAD_LOCAL __thread
+#endif
+
+// D_TEST_INTERNAL_POOL_ALIGN
+//   constant: alignment of every allocation handed out by a pool.
+#define D_TEST_INTERNAL_POOL_ALIGN 16
+
+// d_test_internal_active_pool
+//   variable: pool the object constructors allocate from on this thread, or
+// NULL to use the heap.
+static D_TEST_INTERNAL_THREAD_LOCAL struct d_test_object_pool*
+    d_test_internal_active_pool = NULL;
+
 
 /******************************************************************************
  * INTERNAL HELPER FUNCTIONS
  *****************************************************************************/
 
 /*
-d_test_internal_strcat_safe
-  Internal helper to safely concatenate strings with capacity tracking.
+d_test_internal_template_find_key
+  Internal helper to resolve a placeholder key to its index in a key table.
+  The table is read with a stride so that both plain key arrays and the
+  key/value pair rows of d_test_substitute_template can be searched in place.
 
 Parameter(s):
-  _dest:          destination buffer
-  _dest_capacity: total capacity of destination buffer
-  _dest_len:      current length of string in destination (updated on success)
-  _src:           source string to append
-  _src_len:       length of source string to append
+  _key:       placeholder key (not null-terminated)
+  _key_len:   length of the placeholder key
+  _key_count: number of entries in the key table
+  _keys:      first key in the table
+  _stride:    distance, in pointers, between consecutive keys
 Return:
-  0 on success, non-zero on failure (buffer too small).
+  The key's index, or _key_count if it is not in the table.
 */
-static int
-d_test_internal_strcat_safe
+static size_t
+d_test_internal_template_find_key
 (
-    char*       _dest,
-    size_t      _dest_capacity,
-    size_t*     _dest_len,
-    const char* _src,
-    size_t      _src_len
+    const char*        _key,
+    size_t             _key_len,
+    size_t             _key_count,
+    const char* const* _keys,
+    size_t             _stride
 )
 {
-    if ( (!_dest)     ||
-         (!_dest_len) ||
-         (!_src) )
+    size_t      i;
+    const char* candidate;
+
+    for (i = 0; i < _key_count; i++)
+    {
+        candidate = _keys[i * _stride];
+
+        if ( (candidate)                           &&
+             (strncmp(candidate, _key, _key_len) == 0) &&
+             (candidate[_key_len] == '\0') )
+        {
+            return i;
+        }
+    }
+
+    return _key_count;
+}
+
+/*
+d_test_internal_template_parse
+  Internal helper that splits a template into literal and slot segments.
+  Placeholders whose key is not in the key table, and a trailing opening
+  delimiter with no closing delimiter, are kept as literal text.  Called once
+  with `_segments` NULL to count segments, then again to fill them.
+
+Parameter(s):
+  _template:  template text
+  _open:      opening delimiter (non-empty)
+  _close:     closing delimiter (non-empty)
+  _key_count: number of entries in the key table
+  _keys:      first key in the table
+  _stride:    distance, in pointers, between consecutive keys
+  _segments:  output array, or NULL to only count
+Return:
+  The number of segments.
+*/
+static size_t
+d_test_internal_template_parse
+(
+    const char*                     _template,
+    const char*                     _open,
+    const char*                     _close,
+    size_t                          _key_count,
+    const char* const*              _keys,
+    size_t                          _stride,
+    struct d_test_template_segment* _segments
+)
+{
+    size_t      count;
+    size_t      open_len;
+    size_t      close_len;
+    size_t      key_index;
+    const char* current;
+    const char* literal_start;
+    const char* next_open;
+    const char* close_pos;
+
+    count         = 0;
+    open_len      = strlen(_open);
+    close_len     = strlen(_close);
+    current       = _template;
+    literal_start = _template;
+
+    while ( (next_open = strstr(current, _open)) != NULL )
+    {
+        close_pos = strstr(next_open + open_len, _close);
+
+        if (!close_pos)
+        {
+            break;
+        }
+
+        key_index = d_test_internal_template_find_key(next_open + open_len,
+                                                      (size_t)(close_pos -
+                                                          (next_open + open_len)),
+                                                      _key_count,
+                                                      _keys,
+                                                      _stride);
+        current   = close_pos + close_len;
+
+        // unknown key: the placeholder stays part of the literal run
+        if (key_index == _key_count)
+        {
+            continue;
+        }
+
+        if (next_open > literal_start)
+        {
+            if (_segments)
+            {
+                _segments[count].is_slot   = false;
+                _segments[count].key_index = 0;
+                _segments[count].text      = literal_start;
+                _segments[count].length    = (size_t)(next_open - literal_start);
+            }
+
+            count++;
+        }
+
+        if (_segments)
+        {
+            _segments[count].is_slot   = true;
+            _segments[count].key_index = key_index;
+            _segments[count].text      = NULL;
+            _segments[count].length    = 0;
+        }
+
+        count++;
+        literal_start = current;
+    }
+
+    if (*literal_start)
+    {
+        if (_segments)
+        {
+            _segments[count].is_slot   = false;
+            _segments[count].key_index = 0;
+            _segments[count].text      = literal_start;
+            _segments[count].length    = strlen(literal_start);
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+/*
+d_test_internal_template_compile
+  Internal helper that compiles a template against a (possibly strided) key
+  table.  The template object, its segment array and its copy of the template
+  text share a single allocation.
+
+Parameter(s):
+  _template:   template text
+  _delimiters: opening and closing delimiters
+  _key_count:  number of entries in the key table
+  _keys:       first key in the table (may be NULL if _key_count is 0)
+  _stride:     distance, in pointers, between consecutive keys
+Return:
+  The compiled template, or NULL on invalid arguments or allocation failure.
+*/
+static struct d_test_template*
+d_test_internal_template_compile
+(
+    const char*        _template,
+    const char*        _delimiters[2],
+    size_t             _key_count,
+    const char* const* _keys,
+    size_t             _stride
+)
+{
+    struct d_test_template* compiled;
+    char*                   text;
+    size_t                  text_len;
+    size_t                  segment_count;
+    size_t                  i;
+
+    if ( (!_template)       ||
+         (!_delimiters)     ||
+         (!_delimiters[0])  ||
+         (!_delimiters[1])  ||
+         (!_delimiters[0][0]) ||
+         (!_delimiters[1][0]) ||
+         ( (_key_count > 0) && (!_keys) ) )
+    {
+        return NULL;
+    }
+
+    text_len      = strlen(_template);
+    segment_count = d_test_internal_template_parse(_template,
+                                                   _delimiters[0],
+                                                   _delimiters[1],
+                                                   _key_count,
+                                                   _keys,
+                                                   _stride,
+                                                   NULL);
+
+    compiled = malloc(sizeof(struct d_test_template) +
+                      (segment_count * sizeof(struct d_test_template_segment)) +
+                      text_len + 1);
+
+    if (!compiled)
+    {
+        return NULL;
+    }
+
+    compiled->segments = (struct d_test_template_segment*)(compiled + 1);
+    text               = (char*)(compiled->segments + segment_count);
+    d_memcpy(text, _template, text_len + 1);
+
+    // parse the owned copy so literal segments point into it
+    compiled->key_count      = _key_count;
+    compiled->segment_count  = d_test_internal_template_parse(text,
+                                                              _delimiters[0],
+                                                              _delimiters[1],
+                                                              _key_count,
+                                                              _keys,
+                                                              _stride,
+                                                              compiled->segments);
+    compiled->literal_length = 0;
+
+    for (i = 0; i < compiled->segment_count; i++)
+    {
+        compiled->literal_length += compiled->segments[i].length;
+    }
+
+    return compiled;
+}
+
+/*
+d_test_internal_template_render
+  Internal helper that renders a compiled template with a (possibly strided)
+  value table.  Follows snprintf semantics: writes at most `_buffer_size`
+  bytes including the null terminator and returns the full length.
+
+Parameter(s):
+  _template:    compiled template
+  _values:      first value in the table; NULL values render as empty
+  _stride:      distance, in pointers, between consecutive values
+  _buffer:      destination buffer, or NULL to only measure
+  _buffer_size: capacity of `_buffer` in bytes
+Return:
+  Length of the fully rendered output, excluding the null terminator.
+*/
+static size_t
+d_test_internal_template_render
+(
+    const struct d_test_template* _template,
+    const char* const*            _values,
+    size_t                        _stride,
+    char*                         _buffer,
+    size_t                        _buffer_size
+)
+{
+    const struct d_test_template_segment* segment;
+    const char*                           src;
+    size_t                                src_len;
+    size_t                                total;
+    size_t                                copy_len;
+    size_t                                i;
+
+    total = 0;
+
+    for (i = 0; i < _template->segment_count; i++)
+    {
+        segment = &_template->segments[i];
+
+        if (segment->is_slot)
+        {
+            src     = (_values) ? _values[segment->key_index * _stride] : NULL;
+            src     = (src) ? src : "";
+            src_len = strlen(src);
+        }
+        else
+        {
+            src     = segment->text;
+            src_len = segment->length;
+        }
+
+        if ( (_buffer) &&
+             (total + 1 < _buffer_size) )
+        {
+            copy_len = _buffer_size - 1 - total;
+            copy_len = (src_len < copy_len) ? src_len : copy_len;
+            d_memcpy(_buffer + total, src, copy_len);
+        }
+
+        total += src_len;
+    }
+
+    if ( (_buffer) &&
+         (_buffer_size > 0) )
     {
-        return EINVAL;
+        _buffer[(total < _buffer_size) ? total : (_buffer_size - 1)] = '\0';
     }
 
-    // check if there's room (need space for src + null terminator)
-    if (*_dest_len + _src_len >= _dest_capacity)
+    return total;
+}
+
+
+/*
+d_test_internal_pool_round
+  Rounds `_size` up to the pool alignment.
+*/
+static size_t
+d_test_internal_pool_round
+(
+    size_t _size
+)
+{
+    return (_size + (D_TEST_INTERNAL_POOL_ALIGN - 1)) &
+           ~(size_t)(D_TEST_INTERNAL_POOL_ALIGN - 1);
+}
+
+/*
+d_test_internal_pool_alloc
+  Allocates `_size` bytes from `_pool`, starting a new chunk when the current
+one is full.  Requests larger than D_TEST_OBJECT_POOL_CHUNK_SIZE get a chunk
+sized to fit them exactly.
+
+Parameter(s):
+  _pool: the pool to allocate from
+  _size: number of bytes required
+  _zero: true to zero the returned memory
+Return:
+  Pointer to the memory, or NULL on allocation failure.
+*/
+static void*
+d_test_internal_pool_alloc
+(
+    struct d_test_object_pool* _pool,
+    size_t                     _size,
+    bool                       _zero
+)
+{
+    struct d_test_object_pool_chunk* chunk;
+    size_t                           header;
+    size_t                           capacity;
+    void*                            memory;
+
+    header = d_test_internal_pool_round(sizeof(struct d_test_object_pool_chunk));
+    _size  = d_test_internal_pool_round(_size);
+    chunk  = _pool->chunks;
+
+    if ( (!chunk) ||
+         (chunk->capacity - chunk->used < _size) )
     {
-        return ERANGE;
+        capacity = (_size > D_TEST_OBJECT_POOL_CHUNK_SIZE)
+                       ? _size
+                       : D_TEST_OBJECT_POOL_CHUNK_SIZE;
+
+        chunk = malloc(header + capacity);
+
+        if (!chunk)
+        {
+            return NULL;
+        }
+
+        chunk->used     = 0;
+        chunk->capacity = capacity;
+
+        // an oversized request leaves the partially used chunk current
+        if ( (_pool->chunks) &&
+             (capacity > D_TEST_OBJECT_POOL_CHUNK_SIZE) )
+        {
+            chunk->next         = _pool->chunks->next;
+            _pool->chunks->next = chunk;
+        }
+        else
+        {
+            chunk->next   = _pool->chunks;
+            _pool->chunks = chunk;
+        }
     }
 
-    // copy source to end of destination
-    d_memcpy(_dest + *_dest_len, _src, _src_len);
-    *_dest_len        += _src_len;
-    _dest[*_dest_len]  = '\0';
+    memory       = (char*)chunk + header + chunk->used;
+    chunk->used += _size;
 
-    return 0;
+    if (_zero)
+    {
+        memset(memory, 0, _size);
+    }
+
+    return memory;
 }
 
 
@@ -125,17 +512,27 @@ d_test_object_new_leaf
 {
     struct d_test_object* obj;
 
-    obj = malloc(sizeof(struct d_test_object));
+    obj = (d_test_internal_active_pool)
+              ? d_test_internal_pool_alloc(d_test_internal_active_pool,
+                                           sizeof(struct d_test_object),
+                                           false)
+              : malloc(sizeof(struct d_test_object));
 
     if (!obj)
     {
         return NULL;
     }
 
+    if (d_test_internal_active_pool)
+    {
+        d_test_internal_active_pool->object_count++;
+    }
+
     obj->is_leaf  = true;
     obj->name     = _name;
     obj->message  = _message;
     obj->result   = _result;
+    obj->pooled   = (d_test_internal_active_pool != NULL);
     obj->args     = NULL;
     obj->count    = 0;
     obj->elements = NULL;
@@ -163,6 +560,51 @@ d_test_object_new_interior
 {
     struct d_test_object* obj;
 
+    // pooled interior nodes take the node and element array in one request
+    if (d_test_internal_active_pool)
+    {
+        if (_child_count > (SIZE_MAX - sizeof(struct d_test_object)) /
+                           sizeof(struct d_test_object*))
+        {
+            return NULL;
+        }
+
+        obj = d_test_internal_pool_alloc(
+                  d_test_internal_active_pool,
+                  d_test_internal_pool_round(sizeof(struct d_test_object)) +
+                      (_child_count * sizeof(struct d_test_object*)),
+                  false);
+
+        if (!obj)
+        {
+            return NULL;
+        }
+
+        d_test_internal_active_pool->object_count++;
+
+        obj->is_leaf  = false;
+        obj->name     = _name;
+        obj->message  = NULL;
+        obj->result   = false;
+        obj->pooled   = true;
+        obj->args     = NULL;
+        obj->count    = _child_count;
+        obj->elements = NULL;
+
+        if (_child_count > 0)
+        {
+            obj->elements = (struct d_test_object**)
+                ( (char*)obj +
+                  d_test_internal_pool_round(sizeof(struct d_test_object)) );
+
+            memset(obj->elements,
+                   0,
+                   _child_count * sizeof(struct d_test_object*));
+        }
+
+        return obj;
+    }
+
     obj = malloc(sizeof(struct d_test_object));
 
     if (!obj)
@@ -174,6 +616,7 @@ d_test_object_new_interior
     obj->name    = _name;
     obj->message = NULL;
     obj->result  = false;
+    obj->pooled  = false;
     obj->args    = NULL;
     obj->count   = _child_count;
 
@@ -199,7 +642,8 @@ d_test_object_new_interior
 
 /*
 d_test_object_free
-  Recursively frees a test object and all its children.
+  Recursively frees a test object and all its children.  Nodes allocated
+  from a d_test_object_pool are left for d_test_object_pool_release.
 
 Parameter(s):
   _obj: test object to free
@@ -227,7 +671,16 @@ d_test_object_free
             d_test_object_free(_obj->elements[i]);
         }
 
-        free(_obj->elements);
+        if (!_obj->pooled)
+        {
+            free(_obj->elements);
+        }
+    }
+
+    // pooled nodes are reclaimed by d_test_object_pool_release
+    if (_obj->pooled)
+    {
+        return;
     }
 
     // free args if present
@@ -287,6 +740,116 @@ d_test_object_add_child
 }
 
 
+/*
+d_test_object_pool_init
+  Initializes an empty object pool.
+
+Parameter(s):
+  _pool: the pool to initialize
+Return:
+  none.
+*/
+void
+d_test_object_pool_init
+(
+    struct d_test_object_pool* _pool
+)
+{
+    if (!_pool)
+    {
+        return;
+    }
+
+    _pool->chunks       = NULL;
+    _pool->object_count = 0;
+
+    return;
+}
+
+/*
+d_test_object_pool_begin
+  Makes `_pool` the allocation target for d_test_object_new_leaf and
+  d_test_object_new_interior on the calling thread.  Pools nest: pass the
+  returned value to d_test_object_pool_end to restore the previous target.
+
+Parameter(s):
+  _pool: the pool to allocate from, or NULL to allocate from the heap
+Return:
+  The previously active pool (NULL if the heap was in use).
+*/
+struct d_test_object_pool*
+d_test_object_pool_begin
+(
+    struct d_test_object_pool* _pool
+)
+{
+    struct d_test_object_pool* previous;
+
+    previous                    = d_test_internal_active_pool;
+    d_test_internal_active_pool = _pool;
+
+    return previous;
+}
+
+/*
+d_test_object_pool_end
+  Restores the allocation target that was active before the matching
+  d_test_object_pool_begin.
+
+Parameter(s):
+  _previous: value returned by d_test_object_pool_begin
+Return:
+  none.
+*/
+void
+d_test_object_pool_end
+(
+    struct d_test_object_pool* _previous
+)
+{
+    d_test_internal_active_pool = _previous;
+
+    return;
+}
+
+/*
+d_test_object_pool_release
+  Frees every object allocated from `_pool` in one pass over its chunks,
+  without walking the trees.  All pointers into the pool become invalid; the
+  pool is left empty and may be reused.
+
+Parameter(s):
+  _pool: the pool to release
+Return:
+  none.
+*/
+void
+d_test_object_pool_release
+(
+    struct d_test_object_pool* _pool
+)
+{
+    struct d_test_object_pool_chunk* chunk;
+    struct d_test_object_pool_chunk* next;
+
+    if (!_pool)
+    {
+        return;
+    }
+
+    for (chunk = _pool->chunks; chunk; chunk = next)
+    {
+        next = chunk->next;
+        free(chunk);
+    }
+
+    _pool->chunks       = NULL;
+    _pool->object_count = 0;
+
+    return;
+}
+
+
 /******************************************************************************
  * TEST COUNTER FUNCTIONS
  *****************************************************************************/
@@ -358,6 +921,9 @@ d_test_counter_add
 /*
 d_test_substitute_template
   Substitutes key-value pairs into a template string using delimiters.
+  Placeholders whose key is not among the pairs are kept unchanged.  For
+  templates that are rendered repeatedly, compile them once with
+  d_test_template_compile instead.
 
 Parameter(s):
   _template:   template string with delimited placeholders
@@ -377,368 +943,741 @@ d_test_substitute_template
     const char* _key_values[][2]
 )
 {
-    char*       result;
-    size_t      result_capacity;
-    size_t      result_length;
-    const char* current;
-    const char* next_open;
-    char*       placeholder;
-    size_t      placeholder_len;
-    size_t      i;
-    size_t      open_len;
-    size_t      close_len;
-    const char* close_pos;
-    bool        found;
-    char*       new_result;
+    struct d_test_template* compiled;
+    char*                   result;
+    size_t                  length;
+
+    // keys and values are read in place from the pair rows (stride 2)
+    compiled = d_test_internal_template_compile(_template,
+                                                _delimiters,
+                                                (_key_values) ? _kv_count : 0,
+                                                (_key_values) ? &_key_values[0][0]
+                                                              : NULL,
+                                                2);
 
-    if ( (!_template)      ||
-         (!_delimiters)    ||
-         (!_delimiters[0]) ||
-         (!_delimiters[1]) )
+    if (!compiled)
     {
         return NULL;
     }
 
-    result_capacity = strlen(_template) * 2;
-    result          = malloc(result_capacity);
+    length = d_test_internal_template_render(compiled,
+                                             (_key_values) ? &_key_values[0][1]
+                                                           : NULL,
+                                             2,
+                                             NULL,
+                                             0);
+    result = malloc(length + 1);
 
-    if (!result)
+    if (result)
     {
-        return NULL;
+        d_test_internal_template_render(compiled,
+                                        (_key_values) ? &_key_values[0][1]
+                                                      : NULL,
+                                        2,
+                                        result,
+                                        length + 1);
     }
 
-    result[0]     = '\0';
-    result_length = 0;
-    current       = _template;
-    open_len      = strlen(_delimiters[0]);
-    close_len     = strlen(_delimiters[1]);
+    d_test_template_free(compiled);
 
-    while (*current)
-    {
-        next_open = strstr(current, _delimiters[0]);
+    return result;
+}
 
-        if (!next_open)
-        {
-            // no more placeholders, copy rest of string
-            size_t remaining = strlen(current);
+/*
+d_test_template_compile
+  Parses a template once into literal and slot segments, resolving each
+  placeholder key to its index in `_keys`.  Placeholders with unknown keys
+  are kept as literal text.  The result can be rendered any number of times
+  with d_test_template_render without re-parsing or allocating.
 
-            while (result_length + remaining >= result_capacity)
-            {
-                result_capacity *= 2;
-                new_result       = (char*)realloc(result, result_capacity);
+Parameter(s):
+  _template:   template string with delimited placeholders
+  _delimiters: array of 2 non-empty strings - opening and closing delimiters
+  _key_count:  number of keys
+  _keys:       array of key names; slot `i` is filled from value `i`
+Return:
+  Newly allocated compiled template, or NULL on failure.  Caller must free
+  it with d_test_template_free.
+*/
+struct d_test_template*
+d_test_template_compile
+(
+    const char*        _template,
+    const char*        _delimiters[2],
+    size_t             _key_count,
+    const char* const* _keys
+)
+{
+    return d_test_internal_template_compile(_template,
+                                            _delimiters,
+                                            _key_count,
+                                            _keys,
+                                            1);
+}
 
-                if (!new_result)
-                {
-                    free(result);
+/*
+d_test_template_render_length
+  Computes the exact length of a compiled template rendered with `_values`.
 
-                    return NULL;
-                }
+Parameter(s):
+  _template: compiled template
+  _values:   array of `key_count` values (NULL entries render as empty)
+Return:
+  Rendered length in bytes, excluding the null terminator; 0 if `_template`
+  is NULL.
+*/
+size_t
+d_test_template_render_length
+(
+    const struct d_test_template* _template,
+    const char* const*            _values
+)
+{
+    if (!_template)
+    {
+        return 0;
+    }
 
-                result = new_result;
-            }
+    return d_test_internal_template_render(_template, _values, 1, NULL, 0);
+}
 
-            d_test_internal_strcat_safe(result,
-                                        result_capacity,
-                                        &result_length,
-                                        current,
-                                        remaining);
-            break;
-        }
+/*
+d_test_template_render
+  Renders a compiled template into a caller-provided buffer in a single pass,
+  without allocating.  Output is truncated (and always null-terminated) if
+  the buffer is too small, as with snprintf.
 
-        // copy text before placeholder
-        if (next_open > current)
+Parameter(s):
+  _template:    compiled template
+  _values:      array of `key_count` values (NULL entries render as empty)
+  _buffer:      destination buffer (may be NULL to only measure)
+  _buffer_size: capacity of `_buffer` in bytes
+Return:
+  Length of the full rendered output, excluding the null terminator.  The
+  output was truncated if this is >= `_buffer_size`.
+*/
+size_t
+d_test_template_render
+(
+    const struct d_test_template* _template,
+    const char* const*            _values,
+    char*                         _buffer,
+    size_t                        _buffer_size
+)
+{
+    if (!_template)
+    {
+        if ( (_buffer) &&
+             (_buffer_size > 0) )
         {
-            size_t prefix_len = (size_t)(next_open - current);
-
-            while (result_length + prefix_len >= result_capacity)
-            {
-                result_capacity *= 2;
-                new_result       = (char*)realloc(result, result_capacity);
-
-                if (!new_result)
-                {
-                    free(result);
-
-                    return NULL;
-                }
-
-                result = new_result;
-            }
-
-            d_test_internal_strcat_safe(result,
-                                        result_capacity,
-                                        &result_length,
-                                        current,
-                                        prefix_len);
+            _buffer[0] = '\0';
         }
 
-        // find closing delimiter
-        close_pos = strstr(next_open + open_len, _delimiters[1]);
-
-        if (!close_pos)
-        {
-            // no closing delimiter, copy rest as-is
-            size_t remaining = strlen(next_open);
+        return 0;
+    }
 
-            while (result_length + remaining >= result_capacity)
-            {
-                result_capacity *= 2;
-                new_result       = (char*)realloc(result, result_capacity);
+    return d_test_internal_template_render(_template,
+                                           _values,
+                                           1,
+                                           _buffer,
+                                           _buffer_size);
+}
 
-                if (!new_result)
-                {
-                    free(result);
+/*
+d_test_template_render_to_string
+  Renders a compiled template into a newly allocated string of exactly the
+  required size.
 
-                    return NULL;
-                }
+Parameter(s):
+  _template: compiled template
+  _values:   array of `key_count` values (NULL entries render as empty)
+Return:
+  Newly allocated string, or NULL on failure.  Caller must free it.
+*/
+char*
+d_test_template_render_to_string
+(
+    const struct d_test_template* _template,
+    const char* const*            _values
+)
+{
+    char*  result;
+    size_t length;
 
-                result = new_result;
-            }
+    if (!_template)
+    {
+        return NULL;
+    }
 
-            d_test_internal_strcat_safe(result,
-                                        result_capacity,
-                                        &result_length,
-                                        next_open,
-                                        remaining);
-            current = next_open + open_len;
-            continue;
-        }
+    length = d_test_internal_template_render(_template, _values, 1, NULL, 0);
+    result = malloc(length + 1);
 
-        // extract placeholder key
-        placeholder_len = (size_t)(close_pos - (next_open + open_len));
-        placeholder     = malloc(placeholder_len + 1);
+    if (result)
+    {
+        d_test_internal_template_render(_template,
+                                        _values,
+                                        1,
+                                        result,
+                                        length + 1);
+    }
 
-        if (!placeholder)
-        {
-            free(result);
+    return result;
+}
 
-            return NULL;
-        }
+/*
+d_test_template_free
+  Frees a compiled template.
 
-        // safe copy of placeholder key
-        d_strncpy_s(placeholder,
-                    placeholder_len + 1,
-                    next_open + open_len,
-                    placeholder_len);
+Parameter(s):
+  _template: compiled template to free (may be NULL)
+Return:
+  none.
+*/
+void
+d_test_template_free
+(
+    struct d_test_template* _template
+)
+{
+    // segments and template text share the template's allocation
+    free(_template);
 
-        // find matching key-value pair
-        found = false;
+    return;
+}
 
-        for (i = 0; i < _kv_count; i++)
-        {
-            if (strcmp(placeholder, _key_values[i][0]) == 0)
-            {
-                size_t value_len = strlen(_key_values[i][1]);
 
-                while (result_length + value_len >= result_capacity)
-                {
-                    result_capacity *= 2;
-                    new_result       = (char*)realloc(result, result_capacity);
+/******************************************************************************
+ * STREAMING FUNCTIONS
+ *****************************************************************************/
 
-                    if (!new_result)
-                    {
-                        free(placeholder);
-                        free(result);
+/*
+d_test_internal_stream_print_open
+  Default open handler; prints a group header the same way
+d_test_default_print_object prints an interior node.
+*/
+static void
+d_test_internal_stream_print_open
+(
+    void*       _context,
+    const char* _name,
+    size_t      _depth
+)
+{
+    size_t i;
 
-                        return NULL;
-                    }
+    (void)_context;
 
-                    result = new_result;
-                }
+    for (i = 0; i < _depth; i++)
+    {
+        printf("  ");
+    }
 
-                d_test_internal_strcat_safe(result,
-                                            result_capacity,
-                                            &result_length,
-                                            _key_values[i][1],
-                                            value_len);
-                found = true;
-                break;
-            }
-        }
+    printf("--- Testing %s ---\n", _name ? _name : "(unnamed)");
 
-        if (!found)
-        {
-            // key not found, keep placeholder as-is
-            size_t full_placeholder_len = (size_t)(close_pos + close_len - next_open);
+    return;
+}
 
-            while (result_length + full_placeholder_len >= result_capacity)
-            {
-                result_capacity *= 2;
-                new_result       = (char*)realloc(result, result_capacity);
+/*
+d_test_internal_stream_print_leaf
+  Default leaf handler; prints an assertion result the same way
+d_test_default_print_object prints a leaf.
+*/
+static void
+d_test_internal_stream_print_leaf
+(
+    void*       _context,
+    const char* _name,
+    const char* _message,
+    bool        _result,
+    size_t      _depth
+)
+{
+    size_t i;
 
-                if (!new_result)
-                {
-                    free(placeholder);
-                    free(result);
+    (void)_context;
+    (void)_name;
 
-                    return NULL;
-                }
+    for (i = 0; i < _depth; i++)
+    {
+        printf("  ");
+    }
 
-                result = new_result;
-            }
+    printf("%s %s\n",
+           _result ? D_TEST_SYMBOL_PASS : D_TEST_SYMBOL_FAIL,
+           _message ? _message : "");
 
-            d_test_internal_strcat_safe(result,
-                                        result_capacity,
-                                        &result_length,
-                                        next_open,
-                                        full_placeholder_len);
-        }
+    return;
+}
 
-        free(placeholder);
-        current = close_pos + close_len;
+/*
+d_test_internal_stream_group
+  Returns the bookkeeping slot for the innermost open group, or NULL if no
+group is open or it is nested deeper than D_TEST_STREAM_MAX_DEPTH.
+*/
+static struct d_test_stream_group*
+d_test_internal_stream_group
+(
+    struct d_test_stream* _stream
+)
+{
+    if ( (_stream->depth == 0) ||
+         (_stream->depth > D_TEST_STREAM_MAX_DEPTH) )
+    {
+        return NULL;
     }
 
-    return result;
+    return &_stream->groups[_stream->depth - 1];
 }
 
-
-/******************************************************************************
- * DEFAULT PRINT FUNCTIONS
- *****************************************************************************/
-
 /*
-d_test_default_print_object
-  Default recursive print function for test objects.
-  Prints leaves as assertions with pass/fail symbols, interior nodes as
-  groups with nested indentation.
+d_test_stream_init
+  Initializes a test stream.  Events update `_counter` with the same rules
+d_test_default_print_object applies to a tree: each group counts as a test,
+which passes if every assertion directly inside it passed.
 
 Parameter(s):
-  _obj:          test object to print
-  _indent_level: current indentation level
-  _counter:      optional counter to update (can be NULL)
+  _stream:  the stream to initialize
+  _counter: counter to update (can be NULL)
+  _sink:    event receivers, copied into the stream; NULL prints events to
+            stdout in the d_test_default_print_object format
 Return:
   none.
 */
 void
-d_test_default_print_object
+d_test_stream_init
 (
-    const struct d_test_object* _obj,
-    size_t                      _indent_level,
-    struct d_test_counter*      _counter
+    struct d_test_stream*            _stream,
+    struct d_test_counter*           _counter,
+    const struct d_test_stream_sink* _sink
 )
 {
-    size_t i;
-    size_t j;
-
-    if (!_obj)
+    if (!_stream)
     {
         return;
     }
 
-    // print indentation
-    for (i = 0; i < _indent_level; i++)
-    {
-        printf("  ");
-    }
+    _stream->counter         = _counter;
+    _stream->depth           = 0;
+    _stream->overflow_passed = true;
+    _stream->filter          = NULL;
+    _stream->root            = NULL;
 
-    if (_obj->is_leaf)
+    if (_sink)
     {
-        // leaf node - print assertion result
-        const char* symbol = _obj->result ? D_TEST_SYMBOL_PASS : D_TEST_SYMBOL_FAIL;
-
-        printf("%s %s\n", symbol, _obj->message ? _obj->message : "");
-
-        // update counter if provided
-        if (_counter)
-        {
-            _counter->assertions_total++;
-
-            if (_obj->result)
-            {
-                _counter->assertions_passed++;
-            }
-        }
+        _stream->sink = *_sink;
     }
     else
     {
-        // interior node - print group header and recurse
-        printf("--- Testing %s ---\n", _obj->name ? _obj->name : "(unnamed)");
-
-        // update test counter for interior nodes
-        if (_counter)
-        {
-            _counter->tests_total++;
-        }
-
-        // track if all children passed
-        bool all_passed = true;
+        _stream->sink.on_open  = d_test_internal_stream_print_open;
+        _stream->sink.on_leaf  = d_test_internal_stream_print_leaf;
+        _stream->sink.on_close = NULL;
+        _stream->sink.context  = NULL;
+    }
 
-        for (j = 0; j < _obj->count; j++)
-        {
-            if (_obj->elements[j])
-            {
-                d_test_default_print_object(_obj->elements[j],
-                                            _indent_level + 1,
-                                            _counter);
+    return;
+}
 
-                // check if this child (if leaf) failed
-                if ( _obj->elements[j]->is_leaf &&
-                    !_obj->elements[j]->result )
-                {
-                    all_passed = false;
-                }
-            }
-        }
+/*
+d_test_stream_set_filter
+  Attaches a name filter to a stream so the module can skip unselected
+groups before evaluating them (see d_test_stream_selects).
 
-        // update test pass counter
-        if (_counter && all_passed)
-        {
-            _counter->tests_passed++;
-        }
+Parameter(s):
+  _stream: the stream
+  _filter: the compiled filter; NULL selects everything
+  _root:   name prefixed to every group path, normally the module name; NULL
+           matches paths from the first group
+Return:
+  none.
+*/
+void
+d_test_stream_set_filter
+(
+    struct d_test_stream*       _stream,
+    const struct d_test_filter* _filter,
+    const char*                 _root
+)
+{
+    if (!_stream)
+    {
+        return;
     }
 
+    _stream->filter = _filter;
+    _stream->root   = _root;
+
     return;
 }
 
 /*
-d_test_default_print_object_to_file
-  Default recursive print function for test objects to a FILE* stream.
-  Prints leaves as assertions with pass/fail symbols, interior nodes as
-  groups with nested indentation.
+d_test_stream_selects
+  Checks whether a group or assertion named `_name` under the currently open
+groups is selected by the stream's filter.  Modules call this before opening
+a group so unselected subtrees are never evaluated.
 
 Parameter(s):
-  _file:         file stream to print to
-  _obj:          test object to print
-  _indent_level: current indentation level
-  _counter:      optional counter to update (can be NULL)
+  _stream: the stream
+  _name:   name of the group or assertion about to be produced
 Return:
-  none.
+  true if the item or any of its descendants may be selected.
 */
-void
-d_test_default_print_object_to_file
+bool
+d_test_stream_selects
 (
-    FILE*                       _file,
-    const struct d_test_object* _obj,
-    size_t                      _indent_level,
-    struct d_test_counter*      _counter
+    const struct d_test_stream* _stream,
+    const char*                 _name
 )
 {
-    size_t i;
-    size_t j;
+    const char* path[D_TEST_STREAM_MAX_DEPTH + 2];
+    size_t      depth;
+    size_t      i;
 
-    if ( (!_file) ||
-         (!_obj) )
+    if ( (!_stream) ||
+         (!_stream->filter) )
     {
-        return;
+        return true;
     }
 
-    // print indentation
-    for (i = 0; i < _indent_level; i++)
+    // groups past the maximum depth have no recorded names
+    if (_stream->depth > D_TEST_STREAM_MAX_DEPTH)
     {
-        fprintf(_file, "  ");
+        return true;
     }
 
-    if (_obj->is_leaf)
+    depth = 0;
+
+    if (_stream->root)
     {
-        // leaf node - print assertion result
-        const char* symbol = _obj->result ? D_TEST_SYMBOL_PASS : D_TEST_SYMBOL_FAIL;
+        path[depth++] = _stream->root;
+    }
 
-        fprintf(_file, "%s %s\n", symbol, _obj->message ? _obj->message : "");
+    for (i = 0; i < _stream->depth; i++)
+    {
+        path[depth++] = _stream->groups[i].name;
+    }
 
-        // update counter if provided
-        if (_counter)
-        {
-            _counter->assertions_total++;
+    path[depth++] = _name;
+
+    return (d_test_filter_match(_stream->filter, path, depth) !=
+            D_TEST_FILTER_MATCH_NONE);
+}
+
+/*
+d_test_stream_open
+  Opens a group (the streaming equivalent of an interior node).  Every open
+must be matched by a d_test_stream_close.
+
+Parameter(s):
+  _stream: the stream
+  _name:   group name; must remain valid until the group is closed
+Return:
+  none.
+*/
+void
+d_test_stream_open
+(
+    struct d_test_stream* _stream,
+    const char*           _name
+)
+{
+    struct d_test_stream_group* group;
+
+    if (!_stream)
+    {
+        return;
+    }
+
+    if (_stream->sink.on_open)
+    {
+        _stream->sink.on_open(_stream->sink.context, _name, _stream->depth);
+    }
+
+    if (_stream->counter)
+    {
+        _stream->counter->tests_total++;
+    }
+
+    _stream->depth++;
+
+    // groups past the maximum depth are counted but have no slot; they
+    // share one status, reset when the first of them opens
+    if (_stream->depth <= D_TEST_STREAM_MAX_DEPTH)
+    {
+        group         = &_stream->groups[_stream->depth - 1];
+        group->name   = _name;
+        group->passed = true;
+    }
+    else if (_stream->depth == D_TEST_STREAM_MAX_DEPTH + 1)
+    {
+        _stream->overflow_passed = true;
+    }
+
+    return;
+}
+
+/*
+d_test_stream_leaf
+  Records a single assertion (the streaming equivalent of a leaf node).
+
+Parameter(s):
+  _stream:  the stream
+  _name:    assertion name
+  _message: result message
+  _result:  pass/fail
+Return:
+  The value of `_result`.
+*/
+bool
+d_test_stream_leaf
+(
+    struct d_test_stream* _stream,
+    const char*           _name,
+    const char*           _message,
+    bool                  _result
+)
+{
+    struct d_test_stream_group* group;
+
+    if (!_stream)
+    {
+        return _result;
+    }
+
+    if (_stream->sink.on_leaf)
+    {
+        _stream->sink.on_leaf(_stream->sink.context,
+                              _name,
+                              _message,
+                              _result,
+                              _stream->depth);
+    }
+
+    if (_stream->counter)
+    {
+        _stream->counter->assertions_total++;
+
+        if (_result)
+        {
+            _stream->counter->assertions_passed++;
+        }
+    }
+
+    if (!_result)
+    {
+        group = d_test_internal_stream_group(_stream);
+
+        if (group)
+        {
+            group->passed = false;
+        }
+        else if (_stream->depth > D_TEST_STREAM_MAX_DEPTH)
+        {
+            _stream->overflow_passed = false;
+        }
+    }
+
+    return _result;
+}
+
+/*
+d_test_stream_close
+  Closes the innermost open group.  A group nested deeper than
+D_TEST_STREAM_MAX_DEPTH is reported without a name, and passes only if no
+assertion failed since the stream went past the maximum depth.
+
+Parameter(s):
+  _stream: the stream
+Return:
+  true if every assertion directly inside the group passed, false if any
+  failed or no group was open.
+*/
+bool
+d_test_stream_close
+(
+    struct d_test_stream* _stream
+)
+{
+    struct d_test_stream_group* group;
+    const char*                 name;
+    bool                        passed;
+
+    if ( (!_stream) ||
+         (_stream->depth == 0) )
+    {
+        return false;
+    }
+
+    group  = d_test_internal_stream_group(_stream);
+    name   = (group) ? group->name : NULL;
+    passed = (group) ? group->passed : _stream->overflow_passed;
+
+    _stream->depth--;
+
+    if ( (_stream->counter) &&
+         (passed) )
+    {
+        _stream->counter->tests_passed++;
+    }
+
+    if (_stream->sink.on_close)
+    {
+        _stream->sink.on_close(_stream->sink.context,
+                               name,
+                               passed,
+                               _stream->depth);
+    }
+
+    return passed;
+}
+
+
+/******************************************************************************
+ * DEFAULT PRINT FUNCTIONS
+ *****************************************************************************/
+
+/*
+d_test_default_print_object
+  Default recursive print function for test objects.
+  Prints leaves as assertions with pass/fail symbols, interior nodes as
+  groups with nested indentation.
+
+Parameter(s):
+  _obj:          test object to print
+  _indent_level: current indentation level
+  _counter:      optional counter to update (can be NULL)
+Return:
+  none.
+*/
+void
+d_test_default_print_object
+(
+    const struct d_test_object* _obj,
+    size_t                      _indent_level,
+    struct d_test_counter*      _counter
+)
+{
+    size_t i;
+    size_t j;
+
+    if (!_obj)
+    {
+        return;
+    }
+
+    // print indentation
+    for (i = 0; i < _indent_level; i++)
+    {
+        printf("  ");
+    }
+
+    if (_obj->is_leaf)
+    {
+        // leaf node - print assertion result
+        const char* symbol = _obj->result ? D_TEST_SYMBOL_PASS : D_TEST_SYMBOL_FAIL;
+
+        printf("%s %s\n", symbol, _obj->message ? _obj->message : "");
+
+        // update counter if provided
+        if (_counter)
+        {
+            _counter->assertions_total++;
+
+            if (_obj->result)
+            {
+                _counter->assertions_passed++;
+            }
+        }
+    }
+    else
+    {
+        // interior node - print group header and recurse
+        printf("--- Testing %s ---\n", _obj->name ? _obj->name : "(unnamed)");
+
+        // update test counter for interior nodes
+        if (_counter)
+        {
+            _counter->tests_total++;
+        }
+
+        // track if all children passed
+        bool all_passed = true;
+
+        for (j = 0; j < _obj->count; j++)
+        {
+            if (_obj->elements[j])
+            {
+                d_test_default_print_object(_obj->elements[j],
+                                            _indent_level + 1,
+                                            _counter);
+
+                // check if this child (if leaf) failed
+                if ( _obj->elements[j]->is_leaf &&
+                    !_obj->elements[j]->result )
+                {
+                    all_passed = false;
+                }
+            }
+        }
+
+        // update test pass counter
+        if (_counter && all_passed)
+        {
+            _counter->tests_passed++;
+        }
+    }
+
+    return;
+}
+
+/*
+d_test_default_print_object_to_file
+  Default recursive print function for test objects to a FILE* stream.
+  Prints leaves as assertions with pass/fail symbols, interior nodes as
+  groups with nested indentation.
+
+Parameter(s):
+  _file:         file stream to print to
+  _obj:          test object to print
+  _indent_level: current indentation level
+  _counter:      optional counter to update (can be NULL)
+Return:
+  none.
+*/
+void
+d_test_default_print_object_to_file
+(
+    FILE*                       _file,
+    const struct d_test_object* _obj,
+    size_t                      _indent_level,
+    struct d_test_counter*      _counter
+)
+{
+    size_t i;
+    size_t j;
+
+    if ( (!_file) ||
+         (!_obj) )
+    {
+        return;
+    }
+
+    // print indentation
+    for (i = 0; i < _indent_level; i++)
+    {
+        fprintf(_file, "  ");
+    }
+
+    if (_obj->is_leaf)
+    {
+        // leaf node - print assertion result
+        const char* symbol = _obj->result ? D_TEST_SYMBOL_PASS : D_TEST_SYMBOL_FAIL;
+
+        fprintf(_file, "%s %s\n", symbol, _obj->message ? _obj->message : "");
+
+        // update counter if provided
+        if (_counter)
+        {
+            _counter->assertions_total++;
 
             if (_obj->result)
             {
@@ -1001,33 +1940,119 @@ d_test_sa_get_elapsed_time
     return (double)(_end - _start) / CLOCKS_PER_SEC;
 }
 
-
-/******************************************************************************
- * STANDALONE TEST OUTPUT FORMATTING FUNCTIONS
- *****************************************************************************/
-
 /*
-d_test_sa_create_framework_header
-  Prints the framework header banner for a test suite.
-  Creates the top-level banner with suite name, description, and timestamp.
+d_test_sa_get_wall_time
+  Reads a monotonic, high-resolution wall clock.  Only differences between
+  two readings are meaningful.
 
 Parameter(s):
-  _suite_name:  name of the test suite
-  _description: brief description of the test suite
-Return:
   none.
+Return:
+  Current monotonic time in seconds.
 */
-void
-d_test_sa_create_framework_header
+double
+d_test_sa_get_wall_time
 (
-    const char* _suite_name,
-    const char* _description
+    void
 )
 {
-    if (!_suite_name)
-    {
-        _suite_name = "(unknown suite)";
-    }
+#if defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+    {
+        return (double)clock() / CLOCKS_PER_SEC;
+    }
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+#endif
+}
+
+/*
+d_test_sa_get_thread_cpu_time
+  Reads the CPU time consumed by the calling thread (user and kernel).  Falls
+  back to process CPU time where per-thread time is unavailable.
+
+Parameter(s):
+  none.
+Return:
+  CPU time in seconds.
+*/
+double
+d_test_sa_get_thread_cpu_time
+(
+    void
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    FILETIME creation_time;
+    FILETIME exit_time;
+    FILETIME kernel_time;
+    FILETIME user_time;
+
+    if (!GetThreadTimes(GetCurrentThread(),
+                        &creation_time,
+                        &exit_time,
+                        &kernel_time,
+                        &user_time))
+    {
+        return (double)clock() / CLOCKS_PER_SEC;
+    }
+
+    // FILETIME counts 100-nanosecond intervals
+    return ( ( ((double)kernel_time.dwHighDateTime * 4294967296.0) +
+               (double)kernel_time.dwLowDateTime ) +
+             ( ((double)user_time.dwHighDateTime * 4294967296.0) +
+               (double)user_time.dwLowDateTime ) ) / 10000000.0;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+    {
+        return (double)clock() / CLOCKS_PER_SEC;
+    }
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+/******************************************************************************
+ * STANDALONE TEST OUTPUT FORMATTING FUNCTIONS
+ *****************************************************************************/
+
+/*
+d_test_sa_create_framework_header
+  Prints the framework header banner for a test suite.
+  Creates the top-level banner with suite name, description, and timestamp.
+
+Parameter(s):
+  _suite_name:  name of the test suite
+  _description: brief description of the test suite
+Return:
+  none.
+*/
+void
+d_test_sa_create_framework_header
+(
+    const char* _suite_name,
+    const char* _description
+)
+{
+    if (!_suite_name)
+    {
+        _suite_name = "(unknown suite)";
+    }
 
     if (!_description)
     {
@@ -1106,9 +2131,36 @@ d_test_sa_create_module_test_results
     const char*                  _module_name,
     const struct d_test_counter* _counter
 )
+{
+    d_test_sa_create_module_test_results_timed(_module_name, _counter, NULL);
+
+    return;
+}
+
+/*
+d_test_sa_create_module_test_results_timed
+  Prints the results summary for a single test module, with its timing.
+  Wall-clock and CPU time are both shown along with their difference, so
+  modules that spend their time blocked or sleeping stand out.
+
+Parameter(s):
+  _module_name: name of the module
+  _counter:     test counter with assertion/test results
+  _timing:      module timing (can be NULL, which prints no times)
+Return:
+  none.
+*/
+void
+d_test_sa_create_module_test_results_timed
+(
+    const char*                    _module_name,
+    const struct d_test_counter*   _counter,
+    const struct d_test_sa_timing* _timing
+)
 {
     double assertion_rate;
     double test_rate;
+    double off_cpu;
     bool   passed;
 
     if (!_module_name)
@@ -1155,6 +2207,24 @@ d_test_sa_create_module_test_results
            _counter->tests_total,
            test_rate);
 
+    if (_timing)
+    {
+        off_cpu = _timing->wall_time - _timing->cpu_time;
+
+        if (off_cpu < 0.0)
+        {
+            off_cpu = 0.0;
+        }
+
+        printf("  Wall Time:  %.3f ms\n", _timing->wall_time * 1000.0);
+        printf("  CPU Time:   %.3f ms\n", _timing->cpu_time * 1000.0);
+        printf("  Off-CPU:    %.3f ms (%.2f%% of wall time)\n",
+               off_cpu * 1000.0,
+               (_timing->wall_time > 0.0)
+                   ? (100.0 * off_cpu / _timing->wall_time)
+                   : 0.0);
+    }
+
     if (passed)
     {
         printf("  Status:     %s %s MODULE PASSED\n",
@@ -1263,6 +2333,7 @@ d_test_sa_create_comprehensive_results
         printf("\n");
         printf("  EXECUTION TIME:\n");
         printf("    Total Time:           %.3f seconds\n", _suite->total_time);
+        printf("    Total CPU Time:       %.3f seconds\n", _suite->cpu_time);
     }
 
     // overall assessment
@@ -1443,192 +2514,916 @@ d_test_sa_runner_init
 {
     if (!_runner)
     {
-        return;
+        return;
+    }
+
+    _runner->suite_name        = _suite_name;
+    _runner->suite_description = _suite_description;
+    _runner->module_count      = 0;
+    _runner->wait_for_input    = true;
+    _runner->show_notes        = true;
+    _runner->parallel_jobs     = 1;
+    _runner->filter            = NULL;
+
+    // initialize results
+    _runner->results.modules_total  = 0;
+    _runner->results.modules_passed = 0;
+    _runner->results.total_time     = 0.0;
+    _runner->results.cpu_time       = 0.0;
+    _runner->results.modules        = NULL;
+    d_test_counter_reset(&_runner->results.totals);
+
+    return;
+}
+
+/*
+d_test_sa_runner_add_module
+  Registers a test module with the runner (tree-based test function).
+
+Parameter(s):
+  _runner:      the runner to add the module to
+  _name:        module name
+  _description: module description
+  _run_fn:      function that runs tests and returns a d_test_object tree
+  _note_count:  number of implementation note sections
+  _notes:       array of note sections
+Return:
+  none.
+*/
+void
+d_test_sa_runner_add_module
+(
+    struct d_test_sa_runner*             _runner,
+    const char*                          _name,
+    const char*                          _description,
+    fn_test_module                       _run_fn,
+    size_t                               _note_count,
+    const struct d_test_sa_note_section* _notes
+)
+{
+    size_t idx;
+
+    if ( (!_runner) ||
+         (!_run_fn) )
+    {
+        return;
+    }
+
+    // modules outside the filter are never registered, so never run
+    if (!d_test_filter_selects(_runner->filter, _name))
+    {
+        return;
+    }
+
+    if (_runner->module_count >= D_TEST_SA_MAX_MODULES)
+    {
+        printf("ERROR: Maximum module count (%d) exceeded\n",
+               D_TEST_SA_MAX_MODULES);
+
+        return;
+    }
+
+    idx = _runner->module_count;
+
+    _runner->modules[idx].name        = _name;
+    _runner->modules[idx].description = _description;
+    _runner->modules[idx].run_fn      = _run_fn;
+    _runner->modules[idx].run_counter = NULL;
+    _runner->modules[idx].run_stream  = NULL;
+    _runner->modules[idx].note_count  = _note_count;
+    _runner->modules[idx].notes       = _notes;
+
+    _runner->module_count++;
+
+    return;
+}
+
+/*
+d_test_sa_runner_add_module_counter
+  Registers a test module with the runner (counter-based test function).
+
+Parameter(s):
+  _runner:      the runner to add the module to
+  _name:        module name
+  _description: module description
+  _run_fn:      function that runs tests and updates a counter directly
+  _note_count:  number of implementation note sections
+  _notes:       array of note sections
+Return:
+  none.
+*/
+void
+d_test_sa_runner_add_module_counter
+(
+    struct d_test_sa_runner*             _runner,
+    const char*                          _name,
+    const char*                          _description,
+    fn_test_module_counter               _run_fn,
+    size_t                               _note_count,
+    const struct d_test_sa_note_section* _notes
+)
+{
+    size_t idx;
+
+    if ( (!_runner) ||
+         (!_run_fn) )
+    {
+        return;
+    }
+
+    // modules outside the filter are never registered, so never run
+    if (!d_test_filter_selects(_runner->filter, _name))
+    {
+        return;
+    }
+
+    if (_runner->module_count >= D_TEST_SA_MAX_MODULES)
+    {
+        printf("ERROR: Maximum module count (%d) exceeded\n",
+               D_TEST_SA_MAX_MODULES);
+
+        return;
+    }
+
+    idx = _runner->module_count;
+
+    _runner->modules[idx].name        = _name;
+    _runner->modules[idx].description = _description;
+    _runner->modules[idx].run_fn      = NULL;
+    _runner->modules[idx].run_counter = _run_fn;
+    _runner->modules[idx].run_stream  = NULL;
+    _runner->modules[idx].note_count  = _note_count;
+    _runner->modules[idx].notes       = _notes;
+
+    _runner->module_count++;
+
+    return;
+}
+
+/*
+d_test_sa_runner_add_module_stream
+  Registers a test module with the runner (stream-based test function).
+  The module's results are printed and counted as they are produced, so no
+  test tree is built.
+
+Parameter(s):
+  _runner:      the runner to add the module to
+  _name:        module name
+  _description: module description
+  _run_fn:      function that runs tests by emitting events to a stream
+  _note_count:  number of implementation note sections
+  _notes:       array of note sections
+Return:
+  none.
+*/
+void
+d_test_sa_runner_add_module_stream
+(
+    struct d_test_sa_runner*             _runner,
+    const char*                          _name,
+    const char*                          _description,
+    fn_test_module_stream                _run_fn,
+    size_t                               _note_count,
+    const struct d_test_sa_note_section* _notes
+)
+{
+    size_t idx;
+
+    if ( (!_runner) ||
+         (!_run_fn) )
+    {
+        return;
+    }
+
+    // modules outside the filter are never registered, so never run
+    if (!d_test_filter_selects(_runner->filter, _name))
+    {
+        return;
+    }
+
+    if (_runner->module_count >= D_TEST_SA_MAX_MODULES)
+    {
+        printf("ERROR: Maximum module count (%d) exceeded\n",
+               D_TEST_SA_MAX_MODULES);
+
+        return;
+    }
+
+    idx = _runner->module_count;
+
+    _runner->modules[idx].name        = _name;
+    _runner->modules[idx].description = _description;
+    _runner->modules[idx].run_fn      = NULL;
+    _runner->modules[idx].run_counter = NULL;
+    _runner->modules[idx].run_stream  = _run_fn;
+    _runner->modules[idx].note_count  = _note_count;
+    _runner->modules[idx].notes       = _notes;
+
+    _runner->module_count++;
+
+    return;
+}
+
+/*
+d_test_sa_runner_set_wait_for_input
+  Sets whether the runner should wait for user input before exiting.
+
+Parameter(s):
+  _runner: the runner to configure
+  _wait:   true to wait for input, false to exit immediately
+Return:
+  none.
+*/
+void
+d_test_sa_runner_set_wait_for_input
+(
+    struct d_test_sa_runner* _runner,
+    bool                     _wait
+)
+{
+    if (!_runner)
+    {
+        return;
+    }
+
+    _runner->wait_for_input = _wait;
+
+    return;
+}
+
+/*
+d_test_sa_runner_set_show_notes
+  Sets whether the runner should display implementation notes.
+
+Parameter(s):
+  _runner: the runner to configure
+  _show:   true to show notes, false to hide them
+Return:
+  none.
+*/
+void
+d_test_sa_runner_set_show_notes
+(
+    struct d_test_sa_runner* _runner,
+    bool                     _show
+)
+{
+    if (!_runner)
+    {
+        return;
+    }
+
+    _runner->show_notes = _show;
+
+    return;
+}
+
+/*
+d_test_sa_runner_set_parallel
+  Sets how many modules the runner may execute at once.  Parallel modules
+  run in separate processes, so they need not be thread-safe; each module's
+  output is buffered and printed in registration order, and totals are
+  merged as if the modules had run serially.  Parallel execution is only
+  available on POSIX systems; elsewhere modules always run serially.
+
+Parameter(s):
+  _runner: the runner to configure
+  _jobs:   maximum concurrent modules; 1 runs serially (the default), 0 uses
+           one job per online processor
+Return:
+  none.
+*/
+void
+d_test_sa_runner_set_parallel
+(
+    struct d_test_sa_runner* _runner,
+    size_t                   _jobs
+)
+{
+    if (!_runner)
+    {
+        return;
+    }
+
+    _runner->parallel_jobs = _jobs;
+
+    return;
+}
+
+/*
+d_test_sa_runner_set_filter
+  Restricts the runner to modules whose names match a filter.  The patterns
+  are compiled once here; modules already registered that cannot match are
+  dropped, and later registrations that cannot match are ignored, so their
+  test functions are never called.  Stream-based modules also receive the
+  filter and can skip unselected groups with d_test_stream_selects.
+
+Parameter(s):
+  _runner:  the runner to configure
+  _include: comma-separated glob patterns to run, e.g. "alloc/vector/resize*";
+            NULL runs every module
+  _exclude: comma-separated glob patterns to skip; NULL skips none
+Return:
+  true on success, false if _runner is NULL or the filter could not be
+  allocated.
+*/
+bool
+d_test_sa_runner_set_filter
+(
+    struct d_test_sa_runner* _runner,
+    const char*              _include,
+    const char*              _exclude
+)
+{
+    size_t                i;
+    size_t                kept;
+    struct d_test_filter* filter;
+
+    if (!_runner)
+    {
+        return false;
+    }
+
+    filter = NULL;
+
+    if ( (_include) ||
+         (_exclude) )
+    {
+        filter = d_test_filter_new(_include, _exclude);
+
+        if (!filter)
+        {
+            return false;
+        }
+    }
+
+    d_test_filter_free(_runner->filter);
+    _runner->filter = filter;
+
+    // drop registered modules the filter excludes, preserving order
+    kept = 0;
+
+    for (i = 0; i < _runner->module_count; i++)
+    {
+        if (d_test_filter_selects(filter, _runner->modules[i].name))
+        {
+            _runner->modules[kept++] = _runner->modules[i];
+        }
+    }
+
+    _runner->module_count = kept;
+
+    return true;
+}
+
+/*
+d_test_internal_runner_run_module
+  Runs one registered module: prints its header, executes it, and prints its
+results and notes.  Output goes to stdout, which parallel execution redirects
+per module.
+
+Parameter(s):
+  _runner:  the runner
+  _index:   index of the module to run
+  _entry:   receives the module's counters, status and timing
+Return:
+  none.
+*/
+static void
+d_test_internal_runner_run_module
+(
+    const struct d_test_sa_runner*   _runner,
+    size_t                           _index,
+    struct d_test_sa_module_results* _entry
+)
+{
+    const struct d_test_sa_module_entry* module;
+    struct d_test_counter                module_counter;
+    struct d_test_sa_timing              module_timing;
+    double                               module_wall_start;
+    double                               module_cpu_start;
+    bool                                 module_result;
+
+    module = &_runner->modules[_index];
+
+    d_test_counter_reset(&module_counter);
+    module_result = false;
+
+    // print module header
+    d_test_sa_create_module_test_header(module->name, module->description);
+
+    // record module start times
+    module_wall_start = d_test_sa_get_wall_time();
+    module_cpu_start  = d_test_sa_get_thread_cpu_time();
+
+    // execute module tests
+    if (module->run_fn)
+    {
+        // tree-based test function; the tree is built in a pool so it can
+        // be released in one operation
+        struct d_test_object*      test_results;
+        struct d_test_object_pool  pool;
+        struct d_test_object_pool* previous_pool;
+
+        d_test_object_pool_init(&pool);
+        previous_pool = d_test_object_pool_begin(&pool);
+
+        test_results = module->run_fn();
+
+        d_test_object_pool_end(previous_pool);
+
+        if (test_results)
+        {
+            d_test_default_print_object(test_results, 0, &module_counter);
+
+            module_result =
+                (module_counter.assertions_passed ==
+                 module_counter.assertions_total) &&
+                (module_counter.tests_passed ==
+                 module_counter.tests_total);
+
+            // frees any heap nodes the module attached to the tree
+            d_test_object_free(test_results);
+        }
+
+        d_test_object_pool_release(&pool);
+    }
+    else if (module->run_counter)
+    {
+        // counter-based test function
+        module_result = module->run_counter(&module_counter);
+    }
+    else if (module->run_stream)
+    {
+        // stream-based test function
+        struct d_test_stream stream;
+
+        d_test_stream_init(&stream, &module_counter, NULL);
+        d_test_stream_set_filter(&stream, _runner->filter, module->name);
+
+        module_result = module->run_stream(&stream);
+
+        // close any groups the module left open
+        while (stream.depth > 0)
+        {
+            d_test_stream_close(&stream);
+        }
+
+        module_result = module_result &&
+                        (module_counter.assertions_passed ==
+                         module_counter.assertions_total) &&
+                        (module_counter.tests_passed ==
+                         module_counter.tests_total);
+    }
+
+    // record module times
+    module_timing.wall_time = d_test_sa_get_wall_time() - module_wall_start;
+    module_timing.cpu_time  = d_test_sa_get_thread_cpu_time() -
+                              module_cpu_start;
+
+    // print module results
+    d_test_sa_create_module_test_results_timed(module->name,
+                                               &module_counter,
+                                               &module_timing);
+
+    // print module notes if enabled
+    if ( _runner->show_notes &&
+         module->notes       &&
+         module->note_count > 0 )
+    {
+        d_test_sa_create_implementation_notes(module->note_count,
+                                              module->notes);
     }
 
-    _runner->suite_name        = _suite_name;
-    _runner->suite_description = _suite_description;
-    _runner->module_count      = 0;
-    _runner->wait_for_input    = true;
-    _runner->show_notes        = true;
-
-    // initialize results
-    _runner->results.modules_total  = 0;
-    _runner->results.modules_passed = 0;
-    _runner->results.total_time     = 0.0;
-    _runner->results.modules        = NULL;
-    d_test_counter_reset(&_runner->results.totals);
+    _entry->name         = module->name;
+    _entry->description  = module->description;
+    _entry->counter      = module_counter;
+    _entry->passed       = module_result;
+    _entry->elapsed_time = module_timing.wall_time;
+    _entry->cpu_time     = module_timing.cpu_time;
 
     return;
 }
 
+#if !defined(_WIN32) && !defined(_WIN64)
+
+// DTestParallelState
+//   enum (internal): progress of a module during parallel execution.
+enum DTestParallelState
+{
+    D_INTERNAL_TEST_PARALLEL_PENDING = 0,
+    D_INTERNAL_TEST_PARALLEL_RUNNING,
+    D_INTERNAL_TEST_PARALLEL_DONE,
+    D_INTERNAL_TEST_PARALLEL_INLINE
+};
+
+// d_test_internal_parallel_slot
+//   struct (internal): bookkeeping for one module run in a child process.
+struct d_test_internal_parallel_slot
+{
+    enum DTestParallelState state;
+    pid_t                   pid;
+    FILE*                   output;       // child's captured stdout
+    int                     result_fd;    // read end of the result pipe
+    bool                    completed;    // child reported its results
+};
+
 /*
-d_test_sa_runner_add_module
-  Registers a test module with the runner (tree-based test function).
+d_test_internal_parallel_start
+  Forks a child process that runs module `_index` with stdout redirected to a
+temporary file, and reports its d_test_sa_module_results through a pipe.
 
-Parameter(s):
-  _runner:      the runner to add the module to
-  _name:        module name
-  _description: module description
-  _run_fn:      function that runs tests and returns a d_test_object tree
-  _note_count:  number of implementation note sections
-  _notes:       array of note sections
 Return:
-  none.
+  true if the child was started, false if the module must run in-process.
 */
-void
-d_test_sa_runner_add_module
+static bool
+d_test_internal_parallel_start
 (
-    struct d_test_sa_runner*             _runner,
-    const char*                          _name,
-    const char*                          _description,
-    fn_test_module                       _run_fn,
-    size_t                               _note_count,
-    const struct d_test_sa_note_section* _notes
+    const struct d_test_sa_runner*        _runner,
+    size_t                                _index,
+    struct d_test_internal_parallel_slot* _slot
 )
 {
-    size_t idx;
+    int   fds[2];
+    FILE* output;
+    pid_t pid;
 
-    if ( (!_runner) ||
-         (!_run_fn) )
+    output = tmpfile();
+
+    if (!output)
     {
-        return;
+        return false;
     }
 
-    if (_runner->module_count >= D_TEST_SA_MAX_MODULES)
+    if (pipe(fds) != 0)
     {
-        printf("ERROR: Maximum module count (%d) exceeded\n",
-               D_TEST_SA_MAX_MODULES);
+        fclose(output);
 
-        return;
+        return false;
     }
 
-    idx = _runner->module_count;
+    // anything still buffered would otherwise be printed by the child too
+    fflush(stdout);
 
-    _runner->modules[idx].name        = _name;
-    _runner->modules[idx].description = _description;
-    _runner->modules[idx].run_fn      = _run_fn;
-    _runner->modules[idx].run_counter = NULL;
-    _runner->modules[idx].note_count  = _note_count;
-    _runner->modules[idx].notes       = _notes;
+    pid = fork();
 
-    _runner->module_count++;
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        fclose(output);
 
-    return;
+        return false;
+    }
+
+    if (pid == 0)
+    {
+        struct d_test_sa_module_results entry;
+        const char*                     cursor;
+        size_t                          remaining;
+        ssize_t                         written;
+
+        close(fds[0]);
+
+        if (dup2(fileno(output), STDOUT_FILENO) < 0)
+        {
+            _exit(1);
+        }
+
+        memset(&entry, 0, sizeof(entry));
+        d_test_internal_runner_run_module(_runner, _index, &entry);
+        fflush(stdout);
+
+        cursor    = (const char*)&entry;
+        remaining = sizeof(entry);
+
+        while (remaining > 0)
+        {
+            written = write(fds[1], cursor, remaining);
+
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                _exit(1);
+            }
+
+            cursor    += written;
+            remaining -= (size_t)written;
+        }
+
+        _exit(0);
+    }
+
+    close(fds[1]);
+
+    _slot->state     = D_INTERNAL_TEST_PARALLEL_RUNNING;
+    _slot->pid       = pid;
+    _slot->output    = output;
+    _slot->result_fd = fds[0];
+    _slot->completed = false;
+
+    return true;
 }
 
 /*
-d_test_sa_runner_add_module_counter
-  Registers a test module with the runner (counter-based test function).
-
-Parameter(s):
-  _runner:      the runner to add the module to
-  _name:        module name
-  _description: module description
-  _run_fn:      function that runs tests and updates a counter directly
-  _note_count:  number of implementation note sections
-  _notes:       array of note sections
-Return:
-  none.
+d_test_internal_parallel_collect
+  Reads the results of a child whose result pipe is ready, then reaps that
+child by its pid.  A child that died before reporting, or exited abnormally,
+is recorded as a failed module with no counted tests.
 */
-void
-d_test_sa_runner_add_module_counter
+static void
+d_test_internal_parallel_collect
 (
-    struct d_test_sa_runner*             _runner,
-    const char*                          _name,
-    const char*                          _description,
-    fn_test_module_counter               _run_fn,
-    size_t                               _note_count,
-    const struct d_test_sa_note_section* _notes
+    const struct d_test_sa_runner*        _runner,
+    size_t                                _index,
+    struct d_test_internal_parallel_slot* _slot,
+    struct d_test_sa_module_results*      _entry
 )
 {
-    size_t idx;
+    char*   cursor;
+    size_t  remaining;
+    ssize_t received;
+    pid_t   reaped;
+    int     status;
 
-    if ( (!_runner) ||
-         (!_run_fn) )
+    cursor    = (char*)_entry;
+    remaining = sizeof(*_entry);
+
+    while (remaining > 0)
     {
-        return;
+        received = read(_slot->result_fd, cursor, remaining);
+
+        if ( (received < 0) &&
+             (errno == EINTR) )
+        {
+            continue;
+        }
+
+        if (received <= 0)
+        {
+            break;
+        }
+
+        cursor    += received;
+        remaining -= (size_t)received;
     }
 
-    if (_runner->module_count >= D_TEST_SA_MAX_MODULES)
+    close(_slot->result_fd);
+
+    // reap exactly this child; never another process's
+    do
     {
-        printf("ERROR: Maximum module count (%d) exceeded\n",
-               D_TEST_SA_MAX_MODULES);
+        reaped = waitpid(_slot->pid, &status, 0);
+    } while ( (reaped < 0) &&
+              (errno == EINTR) );
 
-        return;
+    _slot->state     = D_INTERNAL_TEST_PARALLEL_DONE;
+    _slot->completed = (remaining == 0);
+
+    // ECHILD means the host ignores SIGCHLD; the pipe alone decides then
+    if ( (reaped == _slot->pid) &&
+         ( (!WIFEXITED(status)) ||
+           (WEXITSTATUS(status) != 0) ) )
+    {
+        _slot->completed = false;
     }
 
-    idx = _runner->module_count;
+    // a child that died early reported nothing (or part of its results)
+    if (!_slot->completed)
+    {
+        memset(_entry, 0, sizeof(*_entry));
+    }
 
-    _runner->modules[idx].name        = _name;
-    _runner->modules[idx].description = _description;
-    _runner->modules[idx].run_fn      = NULL;
-    _runner->modules[idx].run_counter = _run_fn;
-    _runner->modules[idx].note_count  = _note_count;
-    _runner->modules[idx].notes       = _notes;
+    _entry->name        = _runner->modules[_index].name;
+    _entry->description = _runner->modules[_index].description;
 
-    _runner->module_count++;
+    if (!_slot->completed)
+    {
+        _entry->passed = false;
+    }
 
     return;
 }
 
 /*
-d_test_sa_runner_set_wait_for_input
-  Sets whether the runner should wait for user input before exiting.
+d_test_internal_parallel_wait
+  Blocks until at least one running child's result pipe is readable or
+closed, then collects each such child.  Children are found through their own
+pipes and pids rather than waitpid(-1), so exit statuses of processes the
+host program or a module started are left alone.
 
-Parameter(s):
-  _runner: the runner to configure
-  _wait:   true to wait for input, false to exit immediately
 Return:
-  none.
+  the number of children collected (0 if the wait was interrupted).
 */
-void
-d_test_sa_runner_set_wait_for_input
+static size_t
+d_test_internal_parallel_wait
 (
-    struct d_test_sa_runner* _runner,
-    bool                     _wait
+    const struct d_test_sa_runner*        _runner,
+    struct d_test_internal_parallel_slot* _slots,
+    struct d_test_sa_module_results*      _entries,
+    struct pollfd*                        _polls,
+    size_t                                _count
 )
 {
-    if (!_runner)
+    size_t i;
+    size_t polled;
+    size_t collected;
+    bool   failed;
+
+    polled = 0;
+
+    for (i = 0; i < _count; i++)
     {
-        return;
+        if (_slots[i].state == D_INTERNAL_TEST_PARALLEL_RUNNING)
+        {
+            _polls[polled].fd      = _slots[i].result_fd;
+            _polls[polled].events  = POLLIN;
+            _polls[polled].revents = 0;
+            polled++;
+        }
     }
 
-    _runner->wait_for_input = _wait;
+    if (polled == 0)
+    {
+        return 0;
+    }
 
-    return;
+    failed = (poll(_polls, (nfds_t)polled, -1) < 0);
+
+    if ( (failed) &&
+         (errno == EINTR) )
+    {
+        return 0;
+    }
+
+    // `_polls` follows the running slots in order; if poll itself failed,
+    // collect every child with blocking reads instead
+    collected = 0;
+    polled    = 0;
+
+    for (i = 0; i < _count; i++)
+    {
+        if (_slots[i].state != D_INTERNAL_TEST_PARALLEL_RUNNING)
+        {
+            continue;
+        }
+
+        if ( (failed) ||
+             (_polls[polled].revents != 0) )
+        {
+            d_test_internal_parallel_collect(_runner,
+                                             i,
+                                             &_slots[i],
+                                             &_entries[i]);
+            collected++;
+        }
+
+        polled++;
+    }
+
+    return collected;
 }
 
 /*
-d_test_sa_runner_set_show_notes
-  Sets whether the runner should display implementation notes.
+d_test_internal_runner_execute_parallel
+  Runs the registered modules in up to `_jobs` child processes at a time.
+Each module's output is captured and printed in registration order once it
+and every earlier module have finished.  Modules that cannot be forked run
+in-process when their turn to print comes.
 
-Parameter(s):
-  _runner: the runner to configure
-  _show:   true to show notes, false to hide them
 Return:
-  none.
+  true if execution completed, false if it could not begin (the caller then
+  runs the modules serially).
 */
-void
-d_test_sa_runner_set_show_notes
+static bool
+d_test_internal_runner_execute_parallel
 (
     struct d_test_sa_runner* _runner,
-    bool                     _show
+    size_t                   _jobs
 )
 {
-    if (!_runner)
+    struct d_test_internal_parallel_slot* slots;
+    struct d_test_sa_module_results*      entries;
+    struct pollfd*                        polls;
+    size_t                                count;
+    size_t                                next_start;
+    size_t                                next_print;
+    size_t                                running;
+
+    count   = _runner->module_count;
+    entries = _runner->results.modules;
+    slots   = calloc(count, sizeof(struct d_test_internal_parallel_slot));
+    polls   = calloc(count, sizeof(struct pollfd));
+
+    if ( (!slots) ||
+         (!polls) )
     {
-        return;
+        free(slots);
+        free(polls);
+
+        return false;
     }
 
-    _runner->show_notes = _show;
+    next_start = 0;
+    next_print = 0;
+    running    = 0;
 
-    return;
+    while (next_print < count)
+    {
+        // keep up to `_jobs` children running
+        while ( (running < _jobs) &&
+                (next_start < count) )
+        {
+            if (d_test_internal_parallel_start(_runner,
+                                               next_start,
+                                               &slots[next_start]))
+            {
+                running++;
+            }
+            else
+            {
+                slots[next_start].state = D_INTERNAL_TEST_PARALLEL_INLINE;
+            }
+
+            next_start++;
+        }
+
+        // print every finished module whose predecessors have printed
+        while ( (next_print < next_start) &&
+                (slots[next_print].state != D_INTERNAL_TEST_PARALLEL_RUNNING) )
+        {
+            struct d_test_internal_parallel_slot* slot;
+
+            slot = &slots[next_print];
+
+            if (slot->state == D_INTERNAL_TEST_PARALLEL_INLINE)
+            {
+                d_test_internal_runner_run_module(_runner,
+                                                  next_print,
+                                                  &entries[next_print]);
+            }
+            else
+            {
+                char   chunk[4096];
+                size_t read_count;
+
+                rewind(slot->output);
+
+                while ((read_count = fread(chunk, 1, sizeof(chunk),
+                                           slot->output)) > 0)
+                {
+                    fwrite(chunk, 1, read_count, stdout);
+                }
+
+                fclose(slot->output);
+
+                if (!slot->completed)
+                {
+                    printf("\n  %s %s: module process terminated before "
+                           "reporting results\n",
+                           D_TEST_SYMBOL_FAIL,
+                           _runner->modules[next_print].name
+                               ? _runner->modules[next_print].name
+                               : "(unknown)");
+                }
+            }
+
+            next_print++;
+        }
+
+        if ( (next_print >= count) ||
+             (running == 0) )
+        {
+            continue;
+        }
+
+        // wait for a child to report, then collect (and reap) it
+        running -= d_test_internal_parallel_wait(_runner,
+                                                 slots,
+                                                 entries,
+                                                 polls,
+                                                 count);
+    }
+
+    fflush(stdout);
+    free(polls);
+    free(slots);
+
+    return true;
 }
 
+#endif  // !_WIN32 && !_WIN64
+
 /*
 d_test_sa_runner_execute
   Executes all registered test modules and generates comprehensive output.
+  With parallel jobs configured (see d_test_sa_runner_set_parallel), modules
+  run concurrently in child processes and their output is printed in
+  registration order.
 
 Parameter(s):
   _runner: the runner to execute
@@ -1641,112 +3436,109 @@ d_test_sa_runner_execute
     struct d_test_sa_runner* _runner
 )
 {
-    size_t                 i;
-    clock_t                suite_start;
-    clock_t                suite_end;
-    clock_t                module_start;
-    clock_t                module_end;
-    bool                   overall_result;
-    struct d_test_counter  overall_counter;
-    size_t                 modules_passed;
+    size_t                           i;
+    double                           suite_start;
+    bool                             overall_result;
+    bool                             executed;
+    struct d_test_counter            overall_counter;
+    size_t                           modules_passed;
+    struct d_test_sa_module_results* entries;
 
     if (!_runner)
     {
         return 1;
     }
 
-    // initialize tracking
-    overall_result = true;
-    modules_passed = 0;
-    d_test_counter_reset(&overall_counter);
+    // per-module results; replaced on each execution
+    free(_runner->results.modules);
+    _runner->results.modules = NULL;
+
+    if (_runner->module_count > 0)
+    {
+        entries = calloc(_runner->module_count,
+                         sizeof(struct d_test_sa_module_results));
+
+        if (!entries)
+        {
+            printf("ERROR: Unable to allocate module results\n");
+
+            return 1;
+        }
+
+        _runner->results.modules = entries;
+    }
+    else
+    {
+        entries = NULL;
+    }
 
     // record suite start time
-    suite_start = clock();
+    suite_start = d_test_sa_get_wall_time();
 
     // print framework header
     d_test_sa_create_framework_header(_runner->suite_name,
                                       _runner->suite_description);
 
-    // execute each registered module
-    for (i = 0; i < _runner->module_count; i++)
-    {
-        struct d_test_counter  module_counter;
-        bool                   module_result;
+    executed = false;
 
-        d_test_counter_reset(&module_counter);
-        module_result = false;
-
-        // print module header
-        d_test_sa_create_module_test_header(_runner->modules[i].name,
-                                            _runner->modules[i].description);
+#if !defined(_WIN32) && !defined(_WIN64)
+    {
+        size_t jobs;
 
-        // record module start time
-        module_start = clock();
+        jobs = _runner->parallel_jobs;
 
-        // execute module tests
-        if (_runner->modules[i].run_fn)
+        // 0 requests one job per online processor
+        if (jobs == 0)
         {
-            // tree-based test function
-            struct d_test_object* test_results;
+            long online;
 
-            test_results = _runner->modules[i].run_fn();
-
-            if (test_results)
-            {
-                d_test_default_print_object(test_results, 0, &module_counter);
-
-                module_result =
-                    (module_counter.assertions_passed ==
-                     module_counter.assertions_total) &&
-                    (module_counter.tests_passed ==
-                     module_counter.tests_total);
+            online = sysconf(_SC_NPROCESSORS_ONLN);
+            jobs   = (online > 0) ? (size_t)online : 1;
+        }
 
-                d_test_object_free(test_results);
-            }
+        if ( (jobs > 1) &&
+             (_runner->module_count > 1) )
+        {
+            executed = d_test_internal_runner_execute_parallel(_runner, jobs);
         }
-        else if (_runner->modules[i].run_counter)
+    }
+#endif
+
+    // execute each registered module in turn
+    if (!executed)
+    {
+        for (i = 0; i < _runner->module_count; i++)
         {
-            // counter-based test function
-            module_result = _runner->modules[i].run_counter(&module_counter);
+            d_test_internal_runner_run_module(_runner, i, &entries[i]);
         }
+    }
 
-        // record module end time
-        module_end = clock();
+    // merge module results in registration order
+    overall_result = true;
+    modules_passed = 0;
+    d_test_counter_reset(&overall_counter);
 
-        // print module results
-        d_test_sa_create_module_test_results(_runner->modules[i].name,
-                                             &module_counter);
+    _runner->results.cpu_time = 0.0;
 
-        // print module notes if enabled
-        if ( _runner->show_notes              &&
-             _runner->modules[i].notes        &&
-             _runner->modules[i].note_count > 0 )
-        {
-            d_test_sa_create_implementation_notes(
-                _runner->modules[i].note_count,
-                _runner->modules[i].notes);
-        }
+    for (i = 0; i < _runner->module_count; i++)
+    {
+        d_test_counter_add(&overall_counter, &entries[i].counter);
 
-        // update overall counters
-        d_test_counter_add(&overall_counter, &module_counter);
+        _runner->results.cpu_time += entries[i].cpu_time;
 
-        if (module_result)
+        if (entries[i].passed)
         {
             modules_passed++;
         }
 
-        overall_result = overall_result && module_result;
+        overall_result = overall_result && entries[i].passed;
     }
 
-    // record suite end time
-    suite_end = clock();
-
     // build suite results
     _runner->results.modules_total  = _runner->module_count;
     _runner->results.modules_passed = modules_passed;
     _runner->results.totals         = overall_counter;
-    _runner->results.total_time     = d_test_sa_get_elapsed_time(suite_start,
-                                                                  suite_end);
+    _runner->results.total_time     = d_test_sa_get_wall_time() - suite_start;
 
     // print comprehensive results
     d_test_sa_create_comprehensive_results(&_runner->results);
@@ -1791,5 +3583,8 @@ d_test_sa_runner_cleanup
         _runner->results.modules = NULL;
     }
 
+    d_test_filter_free(_runner->filter);
+    _runner->filter = NULL;
+
     return;
 }
\ No newline at end of file
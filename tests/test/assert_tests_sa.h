@@ -75,6 +75,7 @@ struct d_test_object* d_tests_sa_assert_lt(void);
 struct d_test_object* d_tests_sa_assert_lt_eq(void);
 struct d_test_object* d_tests_sa_assert_gt(void);
 struct d_test_object* d_tests_sa_assert_gt_eq(void);
+struct d_test_object* d_tests_sa_assert_cmp_typed(void);
 
 // category runner
 struct d_test_object* d_tests_sa_assert_compare_all(void);
@@ -87,6 +88,7 @@ struct d_test_object* d_tests_sa_assert_compare_all(void);
 // individual tests
 struct d_test_object* d_tests_sa_assert_str_eq(void);
 struct d_test_object* d_tests_sa_assert_str_neq(void);
+struct d_test_object* d_tests_sa_assert_str_diff(void);
 
 // category runner
 struct d_test_object* d_tests_sa_assert_string_all(void);
@@ -111,6 +113,9 @@ struct d_test_object* d_tests_sa_assert_null_all(void);
 // individual tests
 struct d_test_object* d_tests_sa_assert_array_is_valid(void);
 struct d_test_object* d_tests_sa_assert_arrays_eq(void);
+struct d_test_object* d_tests_sa_assert_arrays_eq_bytes(void);
+struct d_test_object* d_tests_sa_assert_mem_eq(void);
+struct d_test_object* d_tests_sa_assert_floats_near(void);
 
 // category runner
 struct d_test_object* d_tests_sa_assert_array_all(void);
@@ -122,6 +127,8 @@ struct d_test_object* d_tests_sa_assert_array_all(void);
 
 // individual tests
 struct d_test_object* d_tests_sa_assert_default_compare(void);
+struct d_test_object* d_tests_sa_assert_describe(void);
+struct d_test_object* d_tests_sa_assert_tally(void);
 
 // category runner
 struct d_test_object* d_tests_sa_assert_utility_all(void);
@@ -2,7 +2,8 @@
 * djinterp [test]                                       assert_tests_sa_array.c
 *
 *   Array function tests for d_assert module.
-*   Tests: d_assert_array_is_valid, d_assert_arrays_eq
+*   Tests: d_assert_array_is_valid, d_assert_arrays_eq, d_assert_mem_eq,
+*          d_assert_floats_near, d_assert_doubles_near
 *
 *
 * link:      TBA
@@ -10,6 +11,7 @@
 * author(s): Samuel 'teer' Neal-Blim                           date: 2025.09.26
 *******************************************************************************/
 
+#include <math.h>
 #include ".\assert_tests_sa.h"
 
 
@@ -194,6 +196,396 @@ d_tests_sa_assert_arrays_eq
 }
 
 
+/*
+d_tests_sa_assert_arrays_eq_bytes
+  Tests the bitwise fast path and mismatch reporting of d_assert_arrays_eq.
+  Tests the following:
+  - NULL comparator compares large equal arrays bitwise
+  - NULL comparator reports the first differing element
+  - a difference in the trailing partial block is located
+  - the comparator path also reports the first differing element, as a copy
+  - passing assertions carry no failure record
+*/
+struct d_test_object*
+d_tests_sa_assert_arrays_eq_bytes
+(
+    void
+)
+{
+    struct d_test_object* group;
+    int                   arr1[1000];
+    int                   arr2[1000];
+    struct d_assert*      assertion;
+    bool                  test_equal;
+    bool                  test_mismatch;
+    bool                  test_tail;
+    bool                  test_comparator;
+    bool                  test_no_mismatch;
+    size_t                idx;
+
+    for (idx = 0; idx < 1000; idx++)
+    {
+        arr1[idx] = (int)idx;
+        arr2[idx] = (int)idx;
+    }
+
+    // test 1: NULL comparator compares large equal arrays bitwise
+    assertion  = d_assert_arrays_eq(arr1, arr2, 1000, sizeof(int), NULL,
+                                    "Arrays equal", "Arrays not equal");
+    test_equal = (assertion != NULL) && (assertion->result == true);
+
+    // test 5: passing assertions carry no failure record
+    test_no_mismatch = (assertion != NULL) &&
+                       (assertion->failure == NULL);
+    d_assert_free(assertion);
+
+    // test 2: NULL comparator reports the first differing element
+    arr2[700] = -1;
+    arr2[900] = -1;
+    assertion = d_assert_arrays_eq(arr1, arr2, 1000, sizeof(int), NULL,
+                                   "Arrays equal", "Arrays not equal");
+    test_mismatch = (assertion != NULL)                                    &&
+                    (assertion->result == false)                           &&
+                    (assertion->failure != NULL)                           &&
+                    (assertion->failure->mismatch.index == 700)            &&
+                    (assertion->failure->mismatch.element_size ==
+                         sizeof(int))                                      &&
+                    (*(const int*)assertion->failure->mismatch.expected
+                         == 700)                                           &&
+                    (*(const int*)assertion->failure->mismatch.actual == -1);
+    d_assert_free(assertion);
+    arr2[700] = 700;
+    arr2[900] = 900;
+
+    // test 3: a difference in the trailing partial block is located
+    arr2[998] = -1;
+    assertion = d_assert_arrays_eq(arr1, arr2, 999, sizeof(int), NULL,
+                                   "Arrays equal", "Arrays not equal");
+    test_tail = (assertion != NULL)                         &&
+                (assertion->result == false)                &&
+                (assertion->failure != NULL)                &&
+                (assertion->failure->mismatch.index == 998);
+    d_assert_free(assertion);
+
+    // test 4: the comparator path also reports the first differing element,
+    //         as a copy that outlives changes to the caller's array
+    assertion = d_assert_arrays_eq(arr1, arr2, 1000, sizeof(int),
+                                   d_test_int_comparator,
+                                   "Arrays equal", "Arrays not equal");
+    arr2[998] = 998;
+    test_comparator = (assertion != NULL)                                  &&
+                      (assertion->result == false)                         &&
+                      (assertion->failure != NULL)                         &&
+                      (assertion->failure->mismatch.index == 998)          &&
+                      (assertion->failure->mismatch.actual != &arr2[998])  &&
+                      (*(const int*)assertion->failure->mismatch.expected
+                           == 998)                                         &&
+                      (*(const int*)assertion->failure->mismatch.actual
+                           == -1);
+    d_assert_free(assertion);
+
+    // build result tree
+    group = d_test_object_new_interior("d_assert_arrays_eq (bitwise)", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("bitwise_equal",
+                                           test_equal,
+                                           "NULL comparator compares equal arrays bitwise");
+    group->elements[idx++] = D_ASSERT_TRUE("bitwise_mismatch",
+                                           test_mismatch,
+                                           "reports the first differing element");
+    group->elements[idx++] = D_ASSERT_TRUE("bitwise_tail",
+                                           test_tail,
+                                           "locates a difference in the trailing block");
+    group->elements[idx++] = D_ASSERT_TRUE("comparator_mismatch",
+                                           test_comparator,
+                                           "comparator path reports the first difference");
+    group->elements[idx++] = D_ASSERT_TRUE("no_mismatch",
+                                           test_no_mismatch,
+                                           "passing assertions carry no failure record");
+
+    return group;
+}
+
+/*
+d_tests_sa_assert_mem_eq
+  Tests d_assert_mem_eq function for raw memory comparison.
+  Tests the following:
+  - equal buffers spanning several chunks pass
+  - reports the first differing byte beyond the first chunk
+  - detail is a hex diff of the differing row only
+  - detail is bounded when many rows differ
+  - handles NULL pointers
+*/
+struct d_test_object*
+d_tests_sa_assert_mem_eq
+(
+    void
+)
+{
+    static unsigned char  buf1[(D_ASSERT_MEM_CHUNK_SIZE * 3) + 5];
+    static unsigned char  buf2[(D_ASSERT_MEM_CHUNK_SIZE * 3) + 5];
+    struct d_test_object* group;
+    struct d_assert*      assertion;
+    bool                  test_equal;
+    bool                  test_mismatch;
+    bool                  test_diff;
+    bool                  test_bounded;
+    bool                  test_null;
+    size_t                first;
+    size_t                lines;
+    size_t                idx;
+    const char*           cursor;
+    const char*           detail;
+
+    for (idx = 0; idx < sizeof(buf1); idx++)
+    {
+        buf1[idx] = (unsigned char)('A' + (idx % 26));
+        buf2[idx] = buf1[idx];
+    }
+
+    // test 1: equal buffers spanning several chunks pass
+    assertion  = D_ASSERT_MEM_EQ(buf1, buf2, sizeof(buf1));
+    test_equal = (assertion != NULL)           &&
+                 (assertion->result == true)   &&
+                 (assertion->failure == NULL);
+    d_assert_free(assertion);
+
+    // test 2: first differing byte beyond the first chunk
+    first       = D_ASSERT_MEM_CHUNK_SIZE + 0x21;
+    buf2[first] = '!';
+    assertion   = D_ASSERT_MEM_EQ(buf1, buf2, sizeof(buf1));
+    test_mismatch = (assertion != NULL)                                    &&
+                    (assertion->result == false)                           &&
+                    (assertion->failure != NULL)                           &&
+                    (assertion->failure->mismatch.index == first)          &&
+                    (assertion->failure->mismatch.actual != &buf2[first])  &&
+                    (*(const unsigned char*)assertion->failure->mismatch.actual
+                         == '!');
+
+    // test 3: one '-' and one '+' row, aligned to the row size
+    detail    = (assertion && assertion->failure)
+                ? assertion->failure->detail
+                : NULL;
+    test_diff = (detail != NULL)                               &&
+                (strstr(detail, "-00010020") != NULL)          &&
+                (strstr(detail, "+00010020") != NULL)          &&
+                (strstr(detail, " 21 ") != NULL)               &&
+                (strstr(detail, "not shown") == NULL);
+    d_assert_free(assertion);
+
+    // test 4: many differing rows produce a bounded detail
+    for (idx = 0; idx < sizeof(buf2); idx += 1000)
+    {
+        buf2[idx] = 0;
+    }
+
+    assertion = D_ASSERT_MEM_EQ(buf1, buf2, sizeof(buf1));
+    detail    = (assertion && assertion->failure)
+                ? assertion->failure->detail
+                : NULL;
+    lines     = 0;
+
+    for (cursor = (detail) ? detail : ""; *cursor; cursor++)
+    {
+        lines += (*cursor == '\n');
+    }
+
+    test_bounded = (detail != NULL)                                    &&
+                   (assertion->failure->mismatch.index == 0)           &&
+                   (lines == 2 + (D_ASSERT_MEM_MAX_ROWS * 2))          &&
+                   (strstr(detail, "not shown") != NULL);
+    d_assert_free(assertion);
+
+    // test 5: NULL handling
+    assertion = d_assert_mem_eq(NULL, NULL, 4, "equal", "not equal");
+    test_null = (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+    assertion = d_assert_mem_eq(buf1, NULL, 4, "equal", "not equal");
+    test_null = test_null && (assertion != NULL) && (assertion->result == false);
+    d_assert_free(assertion);
+
+    // build result tree
+    group = d_test_object_new_interior("d_assert_mem_eq", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("equal",
+                                           test_equal,
+                                           "equal multi-chunk buffers pass");
+    group->elements[idx++] = D_ASSERT_TRUE("mismatch",
+                                           test_mismatch,
+                                           "reports the first differing byte");
+    group->elements[idx++] = D_ASSERT_TRUE("hex_diff",
+                                           test_diff,
+                                           "detail shows the differing row");
+    group->elements[idx++] = D_ASSERT_TRUE("bounded",
+                                           test_bounded,
+                                           "detail is bounded for many differences");
+    group->elements[idx++] = D_ASSERT_TRUE("null_handling",
+                                           test_null,
+                                           "handles NULL pointers");
+
+    return group;
+}
+
+/*
+d_tests_sa_assert_floats_near
+  Tests d_assert_floats_near and d_assert_doubles_near.
+  Tests the following:
+  - arrays within relative tolerance pass with a single assertion
+  - reports violation count, worst error and its index
+  - ULP tolerance accepts neighbouring floats
+  - NaN matches NaN only with D_ASSERT_FLOAT_NAN_EQUAL
+  - D_ASSERT_FLOAT_FINITE_ONLY rejects matching infinities
+*/
+struct d_test_object*
+d_tests_sa_assert_floats_near
+(
+    void
+)
+{
+    struct d_test_object*     group;
+    struct d_assert*          assertion;
+    struct d_assert_tolerance tolerance;
+    double                    exp_d[500];
+    double                    act_d[500];
+    float                     exp_f[4];
+    float                     act_f[4];
+    uint32_t                  bits;
+    bool                      test_within;
+    bool                      test_report;
+    bool                      test_ulps;
+    bool                      test_nan;
+    bool                      test_finite;
+    size_t                    idx;
+
+    for (idx = 0; idx < 500; idx++)
+    {
+        exp_d[idx] = (double)idx * 0.5;
+        act_d[idx] = exp_d[idx] * (1.0 + 1e-9);
+    }
+
+    // test 1: within relative tolerance
+    tolerance.absolute = 0.0;
+    tolerance.relative = 1e-6;
+    tolerance.ulps     = 0;
+    assertion   = d_assert_doubles_near(exp_d, act_d, 500, &tolerance,
+                                        D_ASSERT_FLOAT_DEFAULT,
+                                        "near", "not near");
+    test_within = (assertion != NULL)                   &&
+                  (assertion->result == true)           &&
+                  (assertion->failure == NULL);
+    d_assert_free(assertion);
+
+    // test 2: three violations, the worst at index 300
+    act_d[100] += 1.0;
+    act_d[300] += 5.0;
+    act_d[400] += 2.0;
+    assertion   = d_assert_doubles_near(exp_d, act_d, 500, &tolerance,
+                                        D_ASSERT_FLOAT_DEFAULT,
+                                        "near", "not near");
+    test_report = (assertion != NULL)                                 &&
+                  (assertion->result == false)                        &&
+                  (assertion->failure != NULL)                        &&
+                  (assertion->failure->approx.violations == 3)        &&
+                  (assertion->failure->approx.worst_index == 300)     &&
+                  (assertion->failure->approx.worst_error > 4.9)      &&
+                  (assertion->failure->mismatch.index == 100)         &&
+                  (assertion->failure->detail != NULL);
+    d_assert_free(assertion);
+
+    // test 3: one ULP apart fails exactly, passes with ulps = 1
+    exp_f[0] = 1.0f;
+    memcpy(&bits, &exp_f[0], sizeof(bits));
+    bits++;
+    memcpy(&act_f[0], &bits, sizeof(bits));
+    assertion = d_assert_floats_near(exp_f, act_f, 1, NULL,
+                                     D_ASSERT_FLOAT_DEFAULT,
+                                     "near", "not near");
+    test_ulps = (assertion != NULL) && (assertion->result == false);
+    d_assert_free(assertion);
+
+    tolerance.relative = 0.0;
+    tolerance.ulps     = 1;
+    assertion = d_assert_floats_near(exp_f, act_f, 1, &tolerance,
+                                     D_ASSERT_FLOAT_DEFAULT,
+                                     "near", "not near");
+    test_ulps = test_ulps && (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+
+    // test 4: NaN policy
+    exp_f[1] = NAN;
+    act_f[1] = NAN;
+    assertion = d_assert_floats_near(&exp_f[1], &act_f[1], 1, &tolerance,
+                                     D_ASSERT_FLOAT_DEFAULT,
+                                     "near", "not near");
+    test_nan = (assertion != NULL)                           &&
+               (assertion->result == false)                  &&
+               (assertion->failure != NULL)                  &&
+               (isinf(assertion->failure->approx.worst_error));
+    d_assert_free(assertion);
+    assertion = d_assert_floats_near(&exp_f[1], &act_f[1], 1, &tolerance,
+                                     D_ASSERT_FLOAT_NAN_EQUAL,
+                                     "near", "not near");
+    test_nan = test_nan && (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+
+    // test 5: matching infinities pass by default, fail with FINITE_ONLY
+    exp_f[2] = INFINITY;
+    act_f[2] = INFINITY;
+    assertion = d_assert_floats_near(&exp_f[2], &act_f[2], 1, &tolerance,
+                                     D_ASSERT_FLOAT_DEFAULT,
+                                     "near", "not near");
+    test_finite = (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+    assertion = d_assert_floats_near(&exp_f[2], &act_f[2], 1, &tolerance,
+                                     D_ASSERT_FLOAT_FINITE_ONLY,
+                                     "near", "not near");
+    test_finite = test_finite                               &&
+                  (assertion != NULL)                       &&
+                  (assertion->result == false)              &&
+                  (assertion->failure != NULL)              &&
+                  (assertion->failure->approx.violations == 1);
+    d_assert_free(assertion);
+
+    // build result tree
+    group = d_test_object_new_interior("d_assert_floats_near", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("within_tolerance",
+                                           test_within,
+                                           "arrays within tolerance pass");
+    group->elements[idx++] = D_ASSERT_TRUE("violation_report",
+                                           test_report,
+                                           "reports count, worst error and index");
+    group->elements[idx++] = D_ASSERT_TRUE("ulp_tolerance",
+                                           test_ulps,
+                                           "ULP tolerance accepts neighbours");
+    group->elements[idx++] = D_ASSERT_TRUE("nan_policy",
+                                           test_nan,
+                                           "NaN matches only with NAN_EQUAL");
+    group->elements[idx++] = D_ASSERT_TRUE("finite_only",
+                                           test_finite,
+                                           "FINITE_ONLY rejects infinities");
+
+    return group;
+}
+
 /******************************************************************************
  * CATEGORY RUNNER
  *****************************************************************************/
@@ -211,7 +603,7 @@ d_tests_sa_assert_array_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("Array Functions", 2);
+    group = d_test_object_new_interior("Array Functions", 5);
 
     if (!group)
     {
@@ -221,6 +613,9 @@ d_tests_sa_assert_array_all
     idx = 0;
     group->elements[idx++] = d_tests_sa_assert_array_is_valid();
     group->elements[idx++] = d_tests_sa_assert_arrays_eq();
+    group->elements[idx++] = d_tests_sa_assert_arrays_eq_bytes();
+    group->elements[idx++] = d_tests_sa_assert_mem_eq();
+    group->elements[idx++] = d_tests_sa_assert_floats_near();
 
     return group;
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
 *
 *   Comparison function tests for d_assert module.
 *   Tests: d_assert_eq, d_assert_neq, d_assert_lt, d_assert_lt_eq,
-*          d_assert_gt, d_assert_gt_eq
+*          d_assert_gt, d_assert_gt_eq, D_ASSERT_VALUE_* (d_assert_cmp_*)
 *
 *
 * link:      TBA
@@ -11,6 +11,7 @@
 * author(s): Samuel 'teer' Neal-Blim                           date: 2025.09.26
 *******************************************************************************/
 
+#include <math.h>
 #include ".\assert_tests_sa.h"
 
 
@@ -418,6 +419,180 @@ d_tests_sa_assert_gt_eq
     return group;
 }
 
+/*
+d_tests_sa_assert_cmp_typed
+  Tests the _Generic-dispatched D_ASSERT_VALUE_* macros.
+  Tests the following:
+  - integers compare by value; failures keep both operands
+  - mixed signed/unsigned operands use the common type
+  - floating-point values compare, and NaN only satisfies !=
+  - strings compare by content, pointers by address
+  - failures are not formatted until described, then show both values
+  - failed string comparisons copy their operands; passing ones keep nothing
+*/
+struct d_test_object*
+d_tests_sa_assert_cmp_typed
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_assert*      assertion;
+    const char*           name;
+    char                  buffer[8];
+    int                   values[2];
+    bool                  test_int;
+    bool                  test_mixed;
+    bool                  test_float;
+    bool                  test_str_ptr;
+    bool                  test_detail;
+    bool                  test_str_copy;
+    size_t                idx;
+
+    // test 1: integers; a failure keeps both operands by value
+    assertion = D_ASSERT_VALUE_LT(3, 7);
+    test_int  = (assertion != NULL)                                   &&
+                (assertion->result == true)                           &&
+                (assertion->failure == NULL)                          &&
+                (strcmp(assertion->message, "3 < 7") == 0);
+    d_assert_free(assertion);
+    assertion = D_ASSERT_VALUE_LT(7, 3);
+    test_int  = test_int                                                       &&
+                (assertion != NULL)                                            &&
+                (assertion->result == false)                                   &&
+                (assertion->failure != NULL)                                   &&
+                (assertion->failure->operands.type == D_ASSERT_OPERAND_SIGNED) &&
+                (assertion->failure->operands.op == D_ASSERT_OP_LT)            &&
+                (assertion->failure->operands.lhs.i == 7)                      &&
+                (assertion->failure->operands.rhs.i == 3);
+    d_assert_free(assertion);
+
+    // test 2: int and unsigned long long compare as unsigned
+    assertion  = D_ASSERT_VALUE_EQ(5, 5ULL);
+    test_mixed = (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+    assertion  = D_ASSERT_VALUE_EQ(5, 6ULL);
+    test_mixed = test_mixed                                                &&
+                 (assertion != NULL)                                       &&
+                 (assertion->failure != NULL)                              &&
+                 (assertion->failure->operands.type ==
+                      D_ASSERT_OPERAND_UNSIGNED);
+    d_assert_free(assertion);
+
+    // test 3: floating point and NaN
+    assertion  = D_ASSERT_VALUE_GT_EQ(2.5, 2);
+    test_float = (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+    assertion  = D_ASSERT_VALUE_GT_EQ(1.5, 2);
+    test_float = test_float                                                &&
+                 (assertion != NULL)                                       &&
+                 (assertion->failure != NULL)                              &&
+                 (assertion->failure->operands.type == D_ASSERT_OPERAND_FLOAT);
+    d_assert_free(assertion);
+    assertion  = D_ASSERT_VALUE_EQ(NAN, NAN);
+    test_float = test_float && (assertion != NULL) && (assertion->result == false);
+    d_assert_free(assertion);
+    assertion  = D_ASSERT_VALUE_NEQ(NAN, NAN);
+    test_float = test_float && (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+
+    // test 4: strings by content, other pointers by address
+    strcpy(buffer, "abc");
+    name         = "abc";
+    assertion    = D_ASSERT_VALUE_EQ(buffer, name);
+    test_str_ptr = (assertion != NULL) && (assertion->result == true);
+    d_assert_free(assertion);
+    assertion    = D_ASSERT_VALUE_NEQ(buffer, name);
+    test_str_ptr = test_str_ptr                                             &&
+                   (assertion != NULL)                                      &&
+                   (assertion->failure != NULL)                             &&
+                   (assertion->failure->operands.type ==
+                        D_ASSERT_OPERAND_STRING);
+    d_assert_free(assertion);
+    assertion    = D_ASSERT_VALUE_LT(&values[0], &values[1]);
+    test_str_ptr = test_str_ptr                                             &&
+                   (assertion != NULL)                                      &&
+                   (assertion->result == true);
+    d_assert_free(assertion);
+    assertion    = D_ASSERT_VALUE_LT(&values[1], &values[0]);
+    test_str_ptr = test_str_ptr                                             &&
+                   (assertion != NULL)                                      &&
+                   (assertion->failure != NULL)                             &&
+                   (assertion->failure->operands.type ==
+                        D_ASSERT_OPERAND_POINTER);
+    d_assert_free(assertion);
+
+    // test 5: failures are formatted only when described
+    assertion   = D_ASSERT_VALUE_EQ(-4, 9);
+    test_detail = (assertion != NULL)                                  &&
+                  (assertion->result == false)                         &&
+                  (strcmp(assertion->message, "-4 != 9") == 0)         &&
+                  (assertion->failure != NULL)                         &&
+                  (assertion->failure->detail == NULL)                 &&
+                  (d_assert_describe(assertion) != NULL)               &&
+                  (strncmp(assertion->failure->detail,
+                           "expected -4, got 9 at ", 22) == 0);
+    d_assert_free(assertion);
+    assertion   = D_ASSERT_VALUE_EQ(name, "abd");
+    test_detail = test_detail                                              &&
+                  (assertion != NULL)                                      &&
+                  (assertion->failure != NULL)                             &&
+                  (assertion->failure->detail == NULL)                     &&
+                  (d_assert_describe(assertion) != NULL)                   &&
+                  (strncmp(assertion->failure->detail,
+                           "expected \"abc\", got \"abd\" at ", 28) == 0);
+    d_assert_free(assertion);
+
+    // test 6: a failed string comparison outlives the caller's strings;
+    //         a passing one keeps nothing
+    assertion     = D_ASSERT_VALUE_EQ(buffer, name);
+    test_str_copy = (assertion != NULL)            &&
+                    (assertion->failure == NULL);
+    d_assert_free(assertion);
+    strcpy(buffer, "abd");
+    assertion     = D_ASSERT_VALUE_EQ(name, buffer);
+    strcpy(buffer, "xyz");
+    test_str_copy = test_str_copy                                              &&
+                    (assertion != NULL)                                        &&
+                    (assertion->failure != NULL)                               &&
+                    (assertion->failure->operands.rhs.s != buffer)             &&
+                    (strcmp(assertion->failure->operands.rhs.s, "abd") == 0)   &&
+                    (d_assert_describe(assertion) != NULL)                     &&
+                    (strncmp(assertion->failure->detail,
+                             "expected \"abc\", got \"abd\" at ", 28) == 0);
+    d_assert_free(assertion);
+
+    // build result tree
+    group = d_test_object_new_interior("D_ASSERT_VALUE_*", 6);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("integers",
+                                           test_int,
+                                           "integers compare; failures keep operands");
+    group->elements[idx++] = D_ASSERT_TRUE("mixed_types",
+                                           test_mixed,
+                                           "mixed operands use the common type");
+    group->elements[idx++] = D_ASSERT_TRUE("floating_point",
+                                           test_float,
+                                           "floats compare; NaN only satisfies !=");
+    group->elements[idx++] = D_ASSERT_TRUE("strings_pointers",
+                                           test_str_ptr,
+                                           "strings by content, pointers by address");
+    group->elements[idx++] = D_ASSERT_TRUE("failure_detail",
+                                           test_detail,
+                                           "failures are described lazily with both values");
+    group->elements[idx++] = D_ASSERT_TRUE("string_copies",
+                                           test_str_copy,
+                                           "failed string operands are copied");
+
+    return group;
+}
+
 
 /******************************************************************************
  * CATEGORY RUNNER
@@ -436,7 +611,7 @@ d_tests_sa_assert_compare_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("Comparison Functions", 6);
+    group = d_test_object_new_interior("Comparison Functions", 7);
 
     if (!group)
     {
@@ -450,6 +625,7 @@ d_tests_sa_assert_compare_all
     group->elements[idx++] = d_tests_sa_assert_lt_eq();
     group->elements[idx++] = d_tests_sa_assert_gt();
     group->elements[idx++] = d_tests_sa_assert_gt_eq();
+    group->elements[idx++] = d_tests_sa_assert_cmp_typed();
 
     return group;
 }
\ No newline at end of file
@@ -2,7 +2,8 @@
 * djinterp [test]                                      assert_tests_sa_string.c
 *
 *   String function tests for d_assert module.
-*   Tests: d_assert_str_eq, d_assert_str_neq
+*   Tests: d_assert_str_eq, d_assert_str_neq, d_assert_str_eq_len,
+*          d_assert_str_neq_len
 *
 *
 * link:      TBA
@@ -194,6 +195,111 @@ d_tests_sa_assert_str_neq
 }
 
 
+/*
+d_tests_sa_assert_str_diff
+  Tests the difference report of failing string assertions.
+  Tests the following:
+  - records byte offset, line and column of the first difference
+  - describes the difference with context in `detail`
+  - passing assertions record no detail
+  - length-delimited mode compares past embedded NULs
+  - length-delimited neq detects differences past embedded NULs
+*/
+struct d_test_object*
+d_tests_sa_assert_str_diff
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_assert*      eq_diff;
+    struct d_assert*      eq_same;
+    struct d_assert*      eq_len;
+    struct d_assert*      neq_len;
+    bool                  test_location;
+    bool                  test_detail;
+    bool                  test_no_detail;
+    bool                  test_len_eq;
+    bool                  test_len_neq;
+    size_t                idx;
+
+    // test 1: difference on the second line ("alpha\nbeta" vs "alpha\nbeTa")
+    eq_diff = d_assert_str_eq("alpha\nbeta", 10,
+                              "alpha\nbeTa", 10,
+                              "Strings equal", "Strings not equal");
+    test_location = (eq_diff != NULL)                            &&
+                    (eq_diff->result == false)                   &&
+                    (eq_diff->failure != NULL)                   &&
+                    (eq_diff->failure->mismatch.index == 8)      &&
+                    (eq_diff->failure->mismatch.line == 2)       &&
+                    (eq_diff->failure->mismatch.column == 3)     &&
+                    (*(const char*)eq_diff->failure->mismatch.actual == 'T');
+
+    // test 2: detail names the offset and shows context on one line
+    test_detail = (eq_diff != NULL)                                     &&
+                  (eq_diff->failure != NULL)                            &&
+                  (eq_diff->failure->detail != NULL)                    &&
+                  (strstr(eq_diff->failure->detail, "byte 8") != NULL)  &&
+                  (strstr(eq_diff->failure->detail, "alpha.beTa") != NULL);
+
+    // test 3: passing assertion has no detail
+    eq_same = d_assert_str_eq("same", 4,
+                              "same", 4,
+                              "Strings equal", "Strings not equal");
+    test_no_detail = (eq_same != NULL)          &&
+                     (eq_same->result == true)  &&
+                     (eq_same->failure == NULL);
+
+    // test 4: embedded NUL, difference after it
+    eq_len = d_assert_str_eq_len("ab\0cd", 5,
+                                 "ab\0cx", 5,
+                                 "Strings equal", "Strings not equal");
+    test_len_eq = (eq_len != NULL)                          &&
+                  (eq_len->result == false)                 &&
+                  (eq_len->failure != NULL)                 &&
+                  (eq_len->failure->mismatch.index == 4);
+
+    // test 5: same input through neq (NUL-terminated mode would see "ab")
+    neq_len = d_assert_str_neq_len("ab\0cd", 5,
+                                   "ab\0cx", 5,
+                                   "Strings not equal", "Strings equal");
+    test_len_neq = (neq_len != NULL) && (neq_len->result == true);
+
+    // cleanup
+    d_assert_free(eq_diff);
+    d_assert_free(eq_same);
+    d_assert_free(eq_len);
+    d_assert_free(neq_len);
+
+    // build result tree
+    group = d_test_object_new_interior("d_assert_str_diff", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("location",
+                                           test_location,
+                                           "records offset, line and column");
+    group->elements[idx++] = D_ASSERT_TRUE("detail",
+                                           test_detail,
+                                           "describes difference with context");
+    group->elements[idx++] = D_ASSERT_TRUE("no_detail_on_pass",
+                                           test_no_detail,
+                                           "passing assertion has no detail");
+    group->elements[idx++] = D_ASSERT_TRUE("len_embedded_nul",
+                                           test_len_eq,
+                                           "length mode compares past NULs");
+    group->elements[idx++] = D_ASSERT_TRUE("len_neq",
+                                           test_len_neq,
+                                           "length mode neq sees past NULs");
+
+    return group;
+}
+
+
 /******************************************************************************
  * CATEGORY RUNNER
  *****************************************************************************/
@@ -211,7 +317,7 @@ d_tests_sa_assert_string_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("String Functions", 2);
+    group = d_test_object_new_interior("String Functions", 3);
 
     if (!group)
     {
@@ -221,6 +327,7 @@ d_tests_sa_assert_string_all
     idx = 0;
     group->elements[idx++] = d_tests_sa_assert_str_eq();
     group->elements[idx++] = d_tests_sa_assert_str_neq();
+    group->elements[idx++] = d_tests_sa_assert_str_diff();
 
     return group;
 }
\ No newline at end of file
@@ -2,7 +2,8 @@
 * djinterp [test]                                     assert_tests_sa_utility.c
 *
 *   Utility function tests for d_assert module.
-*   Tests: d_assert_default_compare
+*   Tests: d_assert_default_compare, d_assert_at, d_assert_describe,
+*          D_ASSERT_CHECK (d_assert_tally_fail, d_assert_tally_free)
 *
 *
 * link:      TBA
@@ -83,6 +84,195 @@ d_tests_sa_assert_default_compare
     return group;
 }
 
+/*
+d_tests_sa_assert_describe
+  Tests d_assert_at and d_assert_describe.
+  Tests the following:
+  - d_assert_at stores the file, line and expression as raw pointers
+  - failed assertions are not described until asked
+  - assertions without operands fall back to the expression
+  - equality failures read "expected X, got Y at file:line"
+  - relational failures name the expression and both values
+  - passing assertions have no description
+*/
+struct d_test_object*
+d_tests_sa_assert_describe
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_assert*      assertion;
+    const char*           description;
+    char                  expected[64];
+    int                   line;
+    bool                  test_at;
+    bool                  test_lazy;
+    bool                  test_expression;
+    bool                  test_eq;
+    bool                  test_relational;
+    bool                  test_pass;
+    size_t                idx;
+
+    // test 1: raw fields
+    assertion = d_assert_at(d_assert_true(false, "pass", "fail"),
+                            "dir/foo.c", 120, "x == 3");
+    test_at   = (assertion != NULL)                               &&
+                (strcmp(assertion->file, "dir/foo.c") == 0)       &&
+                (assertion->line == 120)                          &&
+                (strcmp(assertion->expression, "x == 3") == 0);
+
+    // test 2: nothing formatted until described
+    test_lazy = (assertion != NULL)           &&
+                (assertion->failure == NULL);
+
+    // test 3: no operands, so the expression is used
+    description     = d_assert_describe(assertion);
+    test_expression = (description != NULL) &&
+                      (strcmp(description, "expected x == 3 at foo.c:120") == 0);
+    d_assert_free(assertion);
+
+    // test 4: equality failure with captured operands
+    assertion = d_assert_at(d_assert_cmp_signed(3, 5, D_ASSERT_OP_EQ,
+                                                "pass", "fail"),
+                            "foo.c", 120, "3 == x");
+    description = d_assert_describe(assertion);
+    test_eq     = (description != NULL)                                   &&
+                  (strcmp(description,
+                          "expected 3, got 5 at foo.c:120") == 0)           &&
+                  (d_assert_describe(assertion) == description);
+    d_assert_free(assertion);
+
+    // test 5: relational failure through the typed macro (same line)
+    line = __LINE__; assertion = D_ASSERT_VALUE_LT(7, 3);
+    snprintf(expected, sizeof(expected),
+             "expected 7 < 3, got 7 < 3 at assert_tests_sa_utility.c:%d", line);
+    description     = d_assert_describe(assertion);
+    test_relational = (description != NULL) &&
+                      (strcmp(description, expected) == 0);
+    d_assert_free(assertion);
+
+    // test 6: passing assertions are never described
+    assertion = D_ASSERT_VALUE_EQ(4, 4);
+    test_pass = (assertion != NULL)                    &&
+                (d_assert_describe(assertion) == NULL) &&
+                (assertion->failure == NULL);
+    d_assert_free(assertion);
+
+    // build result tree
+    group = d_test_object_new_interior("d_assert_describe", 6);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("raw_fields",
+                                           test_at,
+                                           "stores file, line and expression");
+    group->elements[idx++] = D_ASSERT_TRUE("lazy",
+                                           test_lazy,
+                                           "nothing formatted until described");
+    group->elements[idx++] = D_ASSERT_TRUE("expression_only",
+                                           test_expression,
+                                           "falls back to the expression");
+    group->elements[idx++] = D_ASSERT_TRUE("equality",
+                                           test_eq,
+                                           "expected X, got Y at file:line");
+    group->elements[idx++] = D_ASSERT_TRUE("relational",
+                                           test_relational,
+                                           "names expression and values");
+    group->elements[idx++] = D_ASSERT_TRUE("passing",
+                                           test_pass,
+                                           "passing assertions not described");
+
+    return group;
+}
+
+/*
+d_tests_sa_assert_tally
+  Tests D_ASSERT_CHECK and the d_assert_tally functions.
+  Tests the following:
+  - passing checks only increment `passed`
+  - failures are counted and the first one is kept
+  - the first failure is described with its expression and location
+  - d_assert_tally_free resets the tally
+*/
+struct d_test_object*
+d_tests_sa_assert_tally
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_assert_tally tally = D_ASSERT_TALLY_INIT;
+    const char*           description;
+    int                   i;
+    bool                  test_pass;
+    bool                  test_fail;
+    bool                  test_describe;
+    bool                  test_free;
+    size_t                idx;
+
+    // test 1: passing checks
+    for (i = 0; i < 1000; i++)
+    {
+        D_ASSERT_CHECK(&tally, i >= 0);
+    }
+
+    test_pass = (tally.passed == 1000)       &&
+                (tally.failed == 0)          &&
+                (tally.first_failure == NULL);
+
+    // test 2: failures counted, first one kept
+    for (i = 0; i < 10; i++)
+    {
+        D_ASSERT_CHECK(&tally, i < 7);
+    }
+
+    test_fail = (tally.passed == 1007)        &&
+                (tally.failed == 3)           &&
+                (tally.first_failure != NULL) &&
+                (tally.first_failure->result == false);
+
+    // test 3: described with expression and location
+    description   = d_assert_describe(tally.first_failure);
+    test_describe = (description != NULL)                               &&
+                    (strncmp(description, "expected i < 7 at ", 18) == 0) &&
+                    (strstr(description, "assert_tests_sa_utility.c:") != NULL);
+
+    // test 4: reset
+    d_assert_tally_free(&tally);
+    test_free = (tally.passed == 0)           &&
+                (tally.failed == 0)           &&
+                (tally.first_failure == NULL);
+
+    // build result tree
+    group = d_test_object_new_interior("D_ASSERT_CHECK", 4);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("pass_count",
+                                           test_pass,
+                                           "passing checks only count");
+    group->elements[idx++] = D_ASSERT_TRUE("fail_count",
+                                           test_fail,
+                                           "failures counted, first kept");
+    group->elements[idx++] = D_ASSERT_TRUE("first_failure",
+                                           test_describe,
+                                           "first failure has expression and location");
+    group->elements[idx++] = D_ASSERT_TRUE("free",
+                                           test_free,
+                                           "d_assert_tally_free resets the tally");
+
+    return group;
+}
+
 
 /******************************************************************************
  * CATEGORY RUNNER
@@ -101,7 +291,7 @@ d_tests_sa_assert_utility_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("Utility Functions", 1);
+    group = d_test_object_new_interior("Utility Functions", 3);
 
     if (!group)
     {
@@ -110,6 +300,8 @@ d_tests_sa_assert_utility_all
 
     idx = 0;
     group->elements[idx++] = d_tests_sa_assert_default_compare();
+    group->elements[idx++] = d_tests_sa_assert_describe();
+    group->elements[idx++] = d_tests_sa_assert_tally();
 
     return group;
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+extern "C"
+{
+#include ".\dtest_hpp_tests_sa.h"
+}
+
+
+/*
+d_tests_sa_dtest_hpp_run_all
+  Module-level aggregation function that runs all dtest.hpp tests.
+  Executes tests for all categories:
+  - Check (typed comparisons, session counters, failure records)
+  - Registration (make_session tree, block fixtures)
+*/
+bool
+d_tests_sa_dtest_hpp_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_dtest_hpp_check_all(_counter) && result;
+    result = d_tests_sa_dtest_hpp_registration_all(_counter) && result;
+
+    return result;
+}
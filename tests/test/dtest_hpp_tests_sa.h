@@ -0,0 +1,61 @@
+/******************************************************************************
+* djinterp [test]                                          dtest_hpp_tests_sa.h
+*
+*   Unit test declarations for the `dtest.hpp` C++17 layer.
+*   Covers typed checks (check<> through the D_TEST_EXPECT_* macros), static
+* registration with block<Fixture, ...>, and the tree built by make_session and
+* released by destroy_session.
+*   The tests are C++17 translation units; their entry points keep C linkage
+* so the standalone runner can call them.  dtest.hpp reaches test_stats.h,
+* whose `struct d_test_counter` clashes with the standalone one used here, so
+* only the section files include it and this header does not.
+*
+*
+* path:      \tests\test\dtest_hpp_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_DTEST_HPP_SA_
+#define DJINTERP_TESTS_DTEST_HPP_SA_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "..\..\inc\test\test_standalone.h"
+#include "..\..\inc\string_fn.h"
+
+
+/******************************************************************************
+ * I. CHECK TESTS
+ *****************************************************************************/
+// check<> results for strings, mixed-sign integers and floating point
+bool d_tests_sa_dtest_hpp_check_compare(struct d_test_counter* _counter);
+// check<> counters and failure records inside a session
+bool d_tests_sa_dtest_hpp_check_session(struct d_test_counter* _counter);
+// failure records of string checks outliving the checked strings
+bool d_tests_sa_dtest_hpp_check_string_record(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_dtest_hpp_check_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. REGISTRATION TESTS
+ *****************************************************************************/
+// tree shape built by module<...>::make and make_session
+bool d_tests_sa_dtest_hpp_make_session(struct d_test_counter* _counter);
+// block<Fixture, ...> fixture lifetime around each test
+bool d_tests_sa_dtest_hpp_block_fixture(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_dtest_hpp_registration_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_dtest_hpp_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_DTEST_HPP_SA_
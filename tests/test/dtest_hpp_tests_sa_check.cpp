@@ -0,0 +1,311 @@
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+extern "C"
+{
+#include ".\dtest_hpp_tests_sa.h"
+}
+
+// test_stats.h (reached through dtest.hpp) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\dtest.hpp"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR CHECK TESTS
+ *****************************************************************************/
+
+// operand of the checks below
+static int test_helper_hpp_value = 2;
+
+/*
+test_helper_hpp_mixed
+  Test function making three passing typed checks and one failing one.
+*/
+static bool
+test_helper_hpp_mixed
+(
+    void
+)
+{
+    bool passed;
+
+    passed = true;
+    passed = D_TEST_EXPECT_EQ(test_helper_hpp_value, 2) && passed;
+    passed = D_TEST_EXPECT_LT(-1, 1u) && passed;
+    passed = D_TEST_EXPECT_GT(test_helper_hpp_value, 5) && passed;
+    passed = D_TEST_EXPECT_NEQ(test_helper_hpp_value, 3) && passed;
+
+    return passed;
+}
+
+/*
+test_helper_hpp_strings
+  Test function making one failing string check, then overwriting the string
+it checked.
+*/
+static bool
+test_helper_hpp_strings
+(
+    void
+)
+{
+    char buffer[16];
+    bool passed;
+
+    std::strcpy(buffer, "left");
+
+    passed = D_TEST_EXPECT_EQ(buffer, "right");
+
+    std::memset(buffer, 'X', sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+
+    return passed;
+}
+
+using test_helper_hpp_mixed_module =
+    djinterp::test::module<djinterp::test::tests<test_helper_hpp_mixed>>;
+
+using test_helper_hpp_strings_module =
+    djinterp::test::module<djinterp::test::tests<test_helper_hpp_strings>>;
+
+/*
+test_helper_hpp_run
+  Builds a silent session for `Module`, runs it, and returns it for
+inspection, or nullptr on allocation failure.
+*/
+template<typename Module>
+static struct d_test_session*
+test_helper_hpp_run
+(
+    void
+)
+{
+    struct d_test_session* session;
+
+    session = djinterp::test::make_session<Module>();
+
+    if (session)
+    {
+        d_test_session_set_verbosity(session, D_TEST_VERBOSITY_SILENT);
+        d_test_session_run(session);
+    }
+
+    return session;
+}
+
+
+/******************************************************************************
+ * I. CHECK TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_dtest_hpp_check_compare
+  Tests the comparisons made by check<> with no session running.
+  Tests the following:
+  - C strings compare by content, with NULL below every string
+  - mixed-sign integers compare by value
+  - floating point keeps NaN semantics
+  - no session is made active by a check
+*/
+bool
+d_tests_sa_dtest_hpp_check_compare
+(
+    struct d_test_counter* _counter
+)
+{
+    bool        result;
+    char        first[8];
+    char        second[8];
+    const char* null_string;
+    double      nan;
+
+    result      = true;
+    null_string = nullptr;
+    nan         = std::numeric_limits<double>::quiet_NaN();
+
+    std::strcpy(first, "same");
+    std::strcpy(second, "same");
+
+    // test 1: strings compare by content
+    result = d_assert_standalone(
+        (D_TEST_EXPECT_EQ(first, second))            &&
+        (!D_TEST_EXPECT_NEQ(first, second))          &&
+        (D_TEST_EXPECT_LT(first, "samf"))            &&
+        (D_TEST_EXPECT_EQ(null_string, null_string)) &&
+        (D_TEST_EXPECT_LT(null_string, "")),
+        "check_strings",
+        "C strings should compare by content, NULL first",
+        _counter) && result;
+
+    // test 2: mixed-sign integers compare by value
+    result = d_assert_standalone(
+        (D_TEST_EXPECT_LT(-1, 1u))                                     &&
+        (D_TEST_EXPECT_GT(std::numeric_limits<unsigned>::max(), -1))   &&
+        (!D_TEST_EXPECT_EQ(-1, std::numeric_limits<unsigned>::max())),
+        "check_mixed_sign",
+        "a negative signed operand should be below every unsigned one",
+        _counter) && result;
+
+    // test 3: NaN compares unequal and unordered
+    result = d_assert_standalone(
+        (!D_TEST_EXPECT_EQ(nan, nan))     &&
+        (D_TEST_EXPECT_NEQ(nan, nan))     &&
+        (!D_TEST_EXPECT_LT_EQ(nan, 1.0))  &&
+        (!D_TEST_EXPECT_GT_EQ(nan, 1.0)),
+        "check_nan",
+        "NaN should be unequal to itself and unordered",
+        _counter) && result;
+
+    // test 4: checks outside a session leave no session behind
+    result = d_assert_standalone(
+        d_test_session_active() == nullptr,
+        "check_no_session",
+        "checks outside a run should not activate a session",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dtest_hpp_check_session
+  Tests check<> inside a session built by make_session.
+  Tests the following:
+  - passing and failing typed checks are counted
+  - a failing check leaves one record with its expression and operands
+*/
+bool
+d_tests_sa_dtest_hpp_check_session
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                            result;
+    struct d_test_session*          session;
+    const struct d_test_statistics* stats;
+    const struct d_assert*          record;
+    const char*                     description;
+
+    result  = true;
+    session = test_helper_hpp_run<test_helper_hpp_mixed_module>();
+    stats   = (session) ? d_test_session_get_stats(session) : nullptr;
+
+    // test 1: passes and failures are counted
+    result = d_assert_standalone(
+        (stats != nullptr)           &&
+        (stats->asserts.passed == 3) &&
+        (stats->asserts.failed == 1),
+        "session_counters",
+        "three passing and one failing check should be counted",
+        _counter) && result;
+
+    // test 2: the failure is recorded with its expression and operands
+    record      = d_test_session_get_failure_at(session, 0);
+    description = ( (record) && (record->failure) )
+                  ? record->failure->detail
+                  : nullptr;
+
+    result = d_assert_standalone(
+        (d_test_session_failure_record_count(session) == 1)             &&
+        (record != nullptr)                                             &&
+        (record->expression != nullptr)                                 &&
+        (std::strcmp(record->expression,
+                     "test_helper_hpp_value > 5") == 0)                 &&
+        (record->failure != nullptr)                                    &&
+        (record->failure->operands.type == D_ASSERT_OPERAND_SIGNED)     &&
+        (record->failure->operands.op == D_ASSERT_OP_GT)                &&
+        (record->failure->operands.lhs.i == 2)                          &&
+        (record->failure->operands.rhs.i == 5)                          &&
+        (description != nullptr),
+        "session_record",
+        "a failing check should be recorded with its expression and operands",
+        _counter) && result;
+
+    djinterp::test::destroy_session(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dtest_hpp_check_string_record
+  Tests that a failing string check does not borrow the checked strings.
+  Tests the following:
+  - the record's operands and description still hold the original string
+    after the test function overwrote it and returned
+*/
+bool
+d_tests_sa_dtest_hpp_check_string_record
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_test_session* session;
+    const struct d_assert* record;
+    const char*            description;
+
+    result      = true;
+    session     = test_helper_hpp_run<test_helper_hpp_strings_module>();
+    record      = d_test_session_get_failure_at(session, 0);
+    description = ( (record) && (record->failure) )
+                  ? record->failure->detail
+                  : nullptr;
+
+    // test 1: the record holds its own copy of both strings
+    result = d_assert_standalone(
+        (record != nullptr)                                     &&
+        (record->failure != nullptr)                            &&
+        (record->failure->operands.lhs.s != nullptr)            &&
+        (std::strcmp(record->failure->operands.lhs.s,
+                     "left") == 0)                              &&
+        (description != nullptr)                                &&
+        (std::strstr(description, "left") != nullptr)           &&
+        (std::strstr(description, "right") != nullptr)          &&
+        (std::strstr(description, "XXXX") == nullptr),
+        "string_record_copied",
+        "a string failure record should outlive the checked strings",
+        _counter) && result;
+
+    djinterp::test::destroy_session(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dtest_hpp_check_all
+  Aggregation function that runs all check tests.
+*/
+bool
+d_tests_sa_dtest_hpp_check_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    std::printf("\n  [SECTION] Check\n");
+    std::printf("  ---------------\n");
+
+    result = d_tests_sa_dtest_hpp_check_compare(_counter) && result;
+    result = d_tests_sa_dtest_hpp_check_session(_counter) && result;
+    result = d_tests_sa_dtest_hpp_check_string_record(_counter) && result;
+
+    return result;
+}
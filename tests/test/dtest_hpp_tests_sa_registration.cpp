@@ -0,0 +1,350 @@
+#include <cstdio>
+
+extern "C"
+{
+#include ".\dtest_hpp_tests_sa.h"
+}
+
+// test_stats.h (reached through dtest.hpp) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\dtest.hpp"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR REGISTRATION TESTS
+ *****************************************************************************/
+
+// test_helper_hpp_counting_fixture
+//   struct: fixture counting its constructions and destructions; every fresh
+// instance starts with `value` 7.
+struct test_helper_hpp_counting_fixture
+{
+    static int constructed;
+    static int destroyed;
+
+    int value;
+
+    test_helper_hpp_counting_fixture
+    (
+        void
+    )
+    : value(7)
+    {
+        constructed++;
+    }
+
+    ~test_helper_hpp_counting_fixture
+    (
+        void
+    )
+    {
+        destroyed++;
+    }
+};
+
+int test_helper_hpp_counting_fixture::constructed = 0;
+int test_helper_hpp_counting_fixture::destroyed   = 0;
+
+/*
+test_helper_hpp_pass
+  Test function making one passing check.
+*/
+static bool
+test_helper_hpp_pass
+(
+    void
+)
+{
+    return D_TEST_EXPECT(1 + 1 == 2);
+}
+
+/*
+test_helper_hpp_fixture_write
+  Test function checking a fresh fixture, then changing it.
+*/
+static bool
+test_helper_hpp_fixture_write
+(
+    void
+)
+{
+    test_helper_hpp_counting_fixture& current =
+        djinterp::test::fixture<test_helper_hpp_counting_fixture>();
+    bool                              passed;
+
+    passed        = D_TEST_EXPECT_EQ(current.value, 7);
+    current.value = 99;
+
+    return passed;
+}
+
+/*
+test_helper_hpp_fixture_read
+  Test function checking that its fixture is fresh, not the one the previous
+test changed.
+*/
+static bool
+test_helper_hpp_fixture_read
+(
+    void
+)
+{
+    return D_TEST_EXPECT_EQ(
+        djinterp::test::fixture<test_helper_hpp_counting_fixture>().value,
+        7);
+}
+
+using test_helper_hpp_plain_block =
+    djinterp::test::tests<test_helper_hpp_pass, test_helper_hpp_pass>;
+
+using test_helper_hpp_fixture_block =
+    djinterp::test::block<test_helper_hpp_counting_fixture,
+                          test_helper_hpp_fixture_write,
+                          test_helper_hpp_fixture_read>;
+
+using test_helper_hpp_module =
+    djinterp::test::module<test_helper_hpp_plain_block,
+                           test_helper_hpp_fixture_block>;
+
+using test_helper_hpp_small_module =
+    djinterp::test::module<djinterp::test::tests<test_helper_hpp_pass>>;
+
+/*
+test_helper_hpp_block_at
+  Returns block `_index` of session module `_module`, or nullptr.
+*/
+static struct d_test_block*
+test_helper_hpp_block_at
+(
+    const struct d_test_session* _session,
+    std::size_t                  _module,
+    std::size_t                  _index
+)
+{
+    struct d_test_type* node;
+
+    node = d_test_session_get_child_at(_session, _module);
+    node = (node) ? d_test_module_get_child_at(node->D_KEYWORD_TEST_MODULE,
+                                               _index)
+                  : nullptr;
+
+    return (node) ? node->D_KEYWORD_TEST_BLOCK : nullptr;
+}
+
+/*
+test_helper_hpp_children_are
+  Returns true if every child of `_block` has node type `_type`.
+*/
+static bool
+test_helper_hpp_children_are
+(
+    const struct d_test_block* _block,
+    enum DTestTypeFlag         _type
+)
+{
+    std::size_t i;
+
+    for (i = 0; i < d_test_block_child_count(_block); i++)
+    {
+        if (d_test_block_get_child_at(_block, i)->type != _type)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+ * II. REGISTRATION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_dtest_hpp_make_session
+  Tests the tree built by make_session and released by destroy_session.
+  Tests the following:
+  - the session holds one module per module type, in order
+  - each module holds one block per block type
+  - fixture-less tests are d_test_fn nodes; fixture tests are d_test nodes
+    carrying SETUP and TEAR_DOWN hooks around one d_test_fn
+  - the session runs every test
+*/
+bool
+d_tests_sa_dtest_hpp_make_session
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_test_session* session;
+    struct d_test_block*   plain;
+    struct d_test_block*   fixtured;
+    struct d_test_type*    node;
+    struct d_test*         test;
+
+    result  = true;
+    session = djinterp::test::make_session<test_helper_hpp_module,
+                                           test_helper_hpp_small_module>();
+
+    if (!session)
+    {
+        return d_assert_standalone(false,
+                                   "make_session_created",
+                                   "make_session should build a session",
+                                   _counter);
+    }
+
+    plain    = test_helper_hpp_block_at(session, 0, 0);
+    fixtured = test_helper_hpp_block_at(session, 0, 1);
+
+    // test 1: module and block counts
+    result = d_assert_standalone(
+        (d_test_session_child_count(session) == 2)                      &&
+        (d_test_module_child_count(
+             d_test_session_get_child_at(session, 0)->D_KEYWORD_TEST_MODULE)
+             == 2)                                                      &&
+        (d_test_module_child_count(
+             d_test_session_get_child_at(session, 1)->D_KEYWORD_TEST_MODULE)
+             == 1),
+        "make_session_shape",
+        "the session should hold each module, and each module its blocks",
+        _counter) && result;
+
+    // test 2: fixture-less tests are plain test functions
+    result = d_assert_standalone(
+        (plain != nullptr)                                          &&
+        (d_test_block_child_count(plain) == 2)                      &&
+        (test_helper_hpp_children_are(plain, D_TEST_TYPE_TEST_FN)),
+        "make_session_plain_block",
+        "a tests<...> block should hold one d_test_fn per function",
+        _counter) && result;
+
+    // test 3: fixture tests carry the fixture's hooks
+    node = (fixtured) ? d_test_block_get_child_at(fixtured, 0) : nullptr;
+    test = (node) ? node->D_KEYWORD_TEST_TEST : nullptr;
+
+    result = d_assert_standalone(
+        (fixtured != nullptr)                                          &&
+        (d_test_block_child_count(fixtured) == 2)                      &&
+        (test_helper_hpp_children_are(fixtured, D_TEST_TYPE_TEST))     &&
+        (test != nullptr)                                              &&
+        (d_test_child_count(test) == 1)                                &&
+        (d_test_get_child_at(test, 0)->type == D_TEST_TYPE_TEST_FN)    &&
+        (d_test_get_stage_hook(test, D_TEST_STAGE_SETUP) != nullptr)   &&
+        (d_test_get_stage_hook(test, D_TEST_STAGE_TEAR_DOWN) != nullptr),
+        "make_session_fixture_block",
+        "a fixture block should wrap each function in a hooked d_test",
+        _counter) && result;
+
+    // test 4: every test runs and passes
+    d_test_session_set_verbosity(session, D_TEST_VERBOSITY_SILENT);
+
+    result = d_assert_standalone(
+        (d_test_session_run(session))                               &&
+        (d_test_session_get_stats(session)->asserts.passed == 5)    &&
+        (d_test_session_get_stats(session)->asserts.failed == 0),
+        "make_session_run",
+        "running the session should pass all five checks",
+        _counter) && result;
+
+    djinterp::test::destroy_session(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dtest_hpp_block_fixture
+  Tests the fixture lifetime of a block<Fixture, ...>.
+  Tests the following:
+  - one fixture is constructed and destroyed per test
+  - each test sees a fresh fixture
+  - no fixture is left alive after the run
+*/
+bool
+d_tests_sa_dtest_hpp_block_fixture
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_test_session* session;
+
+    result = true;
+
+    test_helper_hpp_counting_fixture::constructed = 0;
+    test_helper_hpp_counting_fixture::destroyed   = 0;
+
+    session = djinterp::test::make_session<
+                  djinterp::test::module<test_helper_hpp_fixture_block>>();
+
+    if (session)
+    {
+        d_test_session_set_verbosity(session, D_TEST_VERBOSITY_SILENT);
+        d_test_session_run(session);
+    }
+
+    // test 1: one fixture per test
+    result = d_assert_standalone(
+        (session != nullptr)                                  &&
+        (test_helper_hpp_counting_fixture::constructed == 2),
+        "fixture_per_test",
+        "each test of a fixture block should construct its own fixture",
+        _counter) && result;
+
+    // test 2: the second test did not see the first test's change
+    result = d_assert_standalone(
+        (session != nullptr)                                          &&
+        (d_test_session_get_stats(session)->asserts.passed == 2)      &&
+        (d_test_session_get_stats(session)->asserts.failed == 0),
+        "fixture_fresh",
+        "each test should start from a freshly constructed fixture",
+        _counter) && result;
+
+    // test 3: every fixture was torn down
+    result = d_assert_standalone(
+        test_helper_hpp_counting_fixture::destroyed ==
+            test_helper_hpp_counting_fixture::constructed,
+        "fixture_torn_down",
+        "every fixture should be destroyed by TEAR_DOWN",
+        _counter) && result;
+
+    djinterp::test::destroy_session(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dtest_hpp_registration_all
+  Aggregation function that runs all registration tests.
+*/
+bool
+d_tests_sa_dtest_hpp_registration_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    std::printf("\n  [SECTION] Registration\n");
+    std::printf("  ----------------------\n");
+
+    result = d_tests_sa_dtest_hpp_make_session(_counter) && result;
+    result = d_tests_sa_dtest_hpp_block_fixture(_counter) && result;
+
+    return result;
+}
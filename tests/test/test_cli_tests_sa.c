@@ -0,0 +1,28 @@
+#include ".\test_cli_tests_sa.h"
+
+
+/*
+d_tests_sa_test_cli_run_all
+  Module-level aggregation function that runs all test_cli tests.
+  Executes tests for all categories:
+  - Module registry (growth, duplicates, dependency closure, clear)
+  - Dependency scheduler (order, failed dependencies, cycles, jobs)
+  - Argument parsing (-jobs)
+*/
+bool
+d_tests_sa_test_cli_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_test_cli_registry_all(_counter) && result;
+    result = d_tests_sa_test_cli_sched_all(_counter) && result;
+    result = d_tests_sa_test_cli_parse_all(_counter) && result;
+
+    return result;
+}
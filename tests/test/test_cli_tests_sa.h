@@ -0,0 +1,79 @@
+/******************************************************************************
+* djinterp [test]                                            test_cli_tests_sa.h
+*
+*   Unit test declarations for `test_cli.h` module.
+*   Covers the module registry (growth past its initial capacity, hash-index
+* lookups, duplicate-name rejection, dependency closure and clearing) and the
+* dependency scheduler (ordering, skipped dependents, cycles and -jobs) and
+* argument parsing.
+*   test_cli.h defines its functions in the header, so only one translation
+* unit of a program may include it; the tests that need it all live in
+* test_cli_tests_sa_modules.c and this header does not include it.  That file
+* also renames the framework counter from test_stats.h, which clashes with the
+* standalone `struct d_test_counter` used here.
+*
+*
+* path:      \tests\test\test_cli_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_TEST_CLI_SA_
+#define DJINTERP_TESTS_TEST_CLI_SA_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "..\..\inc\test\test_standalone.h"
+#include "..\..\inc\string_fn.h"
+
+
+/******************************************************************************
+ * I. MODULE REGISTRY TESTS
+ *****************************************************************************/
+// d_test_register_module past D_TEST_MAX_MODULES, d_test_find_module_index
+bool d_tests_sa_test_cli_registry_growth(struct d_test_counter* _counter);
+// d_test_register_module duplicate names
+bool d_tests_sa_test_cli_registry_duplicates(struct d_test_counter* _counter);
+// d_test_enable_module_with_deps over a diamond dependency graph
+bool d_tests_sa_test_cli_registry_closure(struct d_test_counter* _counter);
+// d_test_registry_clear followed by re-registration
+bool d_tests_sa_test_cli_registry_clear(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_test_cli_registry_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. SCHEDULER TESTS
+ *****************************************************************************/
+// d_test_run_enabled_modules dependency order
+bool d_tests_sa_test_cli_sched_order(struct d_test_counter* _counter);
+// d_test_run_enabled_modules with a failed dependency
+bool d_tests_sa_test_cli_sched_failed_dependency(struct d_test_counter* _counter);
+// d_test_run_enabled_modules and d_test_execute_command with a cycle
+bool d_tests_sa_test_cli_sched_cycle(struct d_test_counter* _counter);
+// d_test_run_enabled_modules with one worker versus several
+bool d_tests_sa_test_cli_sched_jobs(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_test_cli_sched_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. ARGUMENT PARSING TESTS
+ *****************************************************************************/
+// d_test_parse_args -jobs values
+bool d_tests_sa_test_cli_parse_jobs(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_test_cli_parse_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_test_cli_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_TEST_CLI_SA_
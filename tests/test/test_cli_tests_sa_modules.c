@@ -0,0 +1,1313 @@
+// fork, dup and pipes are used by the scheduler tests
+#if ( !defined(_WIN32) && !defined(_WIN64) &&  \
+      !defined(_POSIX_C_SOURCE) )
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include ".\test_cli_tests_sa.h"
+#include <stdio.h>
+#include <string.h>
+
+// test_stats.h (reached through test_module.h) declares the framework's own
+// `struct d_test_counter`; it is renamed for this translation unit so the
+// standalone counter used by these tests stays the visible one.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+
+// test_cli.h only reads `fn_test_all` from a module's metadata and leaves the
+// type incomplete, so the scheduler tests supply it.
+struct d_test_counter;
+
+struct d_test_module_metadata
+{
+    bool (*fn_test_all)(struct d_test_counter* _info);
+};
+
+#include "..\..\inc\test\test_cli.h"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR MODULE REGISTRY TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_CLI_MANY_MODULES
+//   constant: modules registered by the growth test; several times the
+// initial capacity, so both the module array and the hash index regrow.
+#define TEST_HELPER_CLI_MANY_MODULES (D_TEST_MAX_MODULES * 4 + 3)
+
+/*
+test_helper_cli_module_name
+  Writes the name of the `_index`th generated module to `_buffer`.
+*/
+static void
+test_helper_cli_module_name
+(
+    char*  _buffer,
+    size_t _size,
+    int    _index
+)
+{
+    snprintf(_buffer, _size, "module_%d", _index);
+
+    return;
+}
+
+/*
+test_helper_cli_enabled
+  Returns true if the named module is registered and enabled.
+*/
+static bool
+test_helper_cli_enabled
+(
+    const char* _name
+)
+{
+    int index;
+
+    index = d_test_find_module_index(_name);
+
+    return (index != -1) &&
+           (g_test_registry.enabled[index]);
+}
+
+/*
+test_helper_cli_enabled_count
+  Returns the number of enabled modules.
+*/
+static int
+test_helper_cli_enabled_count
+(
+    void
+)
+{
+    int i;
+    int count;
+
+    count = 0;
+
+    for (i = 0; i < g_test_registry.count; i++)
+    {
+        if (g_test_registry.enabled[i])
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*
+test_helper_cli_register_diamond
+  Registers a diamond: "top" depends on "left" and "right", which both depend
+on "base".  "top" is registered first, so its dependencies are resolved after
+they exist.  An unrelated "other" module is registered last.
+*/
+static bool
+test_helper_cli_register_diamond
+(
+    void
+)
+{
+    const char* top_deps[]  = { "left", "right" };
+    const char* side_deps[] = { "base" };
+
+    return d_test_register_module("top", NULL, top_deps, 2)   &&
+           d_test_register_module("left", NULL, side_deps, 1) &&
+           d_test_register_module("right", NULL, side_deps, 1) &&
+           d_test_register_module("base", NULL, NULL, 0)      &&
+           d_test_register_module("other", NULL, NULL, 0);
+}
+
+
+/******************************************************************************
+ * I. MODULE REGISTRY TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_cli_registry_growth
+  Tests d_test_register_module past D_TEST_MAX_MODULES and
+d_test_find_module_index after the registry and its index have grown.
+  Tests the following:
+  - every registration succeeds past the initial capacity
+  - every name still maps to its own index after rehashing
+  - the hash index stays at most half full
+  - unknown and NULL names are not found
+*/
+bool
+d_tests_sa_test_cli_registry_growth
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+    bool registered;
+    bool found;
+    int  i;
+    char name[D_TEST_MAX_MODULE_NAME];
+
+    result     = true;
+    registered = true;
+
+    d_test_registry_clear();
+
+    for (i = 0; i < TEST_HELPER_CLI_MANY_MODULES; i++)
+    {
+        test_helper_cli_module_name(name, sizeof(name), i);
+        registered = d_test_register_module(name, NULL, NULL, 0) && registered;
+    }
+
+    // test 1: every registration succeeds past the initial capacity
+    result = d_assert_standalone(
+        (registered) &&
+        (g_test_registry.count == TEST_HELPER_CLI_MANY_MODULES) &&
+        (g_test_registry.capacity >= TEST_HELPER_CLI_MANY_MODULES),
+        "registry_growth_registers",
+        "registering past D_TEST_MAX_MODULES should grow the registry",
+        _counter) && result;
+
+    // test 2: every name maps to its own index after rehashing
+    found = true;
+
+    for (i = 0; (found) && (i < TEST_HELPER_CLI_MANY_MODULES); i++)
+    {
+        test_helper_cli_module_name(name, sizeof(name), i);
+        found = (d_test_find_module_index(name) == i) &&
+                (strcmp(g_test_registry.modules[i].name, name) == 0);
+    }
+
+    result = d_assert_standalone(
+        found,
+        "registry_growth_lookups",
+        "every module should be found at its index after rehashing",
+        _counter) && result;
+
+    // test 3: the hash index stays at most half full
+    result = d_assert_standalone(
+        (g_test_registry.index_capacity >= (g_test_registry.count * 2)) &&
+        ((g_test_registry.index_capacity &
+          (g_test_registry.index_capacity - 1)) == 0),
+        "registry_growth_load_factor",
+        "the hash index should be a power of two at most half full",
+        _counter) && result;
+
+    // test 4: unknown and NULL names are not found
+    test_helper_cli_module_name(name, sizeof(name), TEST_HELPER_CLI_MANY_MODULES);
+
+    result = d_assert_standalone(
+        (d_test_find_module_index(name) == -1) &&
+        (d_test_find_module_index("") == -1) &&
+        (d_test_find_module_index(NULL) == -1),
+        "registry_growth_unknown",
+        "unregistered and NULL names should not be found",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_registry_duplicates
+  Tests that d_test_register_module rejects names already registered.
+  Tests the following:
+  - a duplicate name is rejected and the registry is unchanged
+  - the original registration keeps its index and dependencies
+  - invalid arguments are rejected
+*/
+bool
+d_tests_sa_test_cli_registry_duplicates
+(
+    struct d_test_counter* _counter
+)
+{
+    bool        result;
+    bool        first;
+    bool        duplicate;
+    int         index;
+    const char* deps[] = { "base" };
+
+    result = true;
+
+    d_test_registry_clear();
+
+    first     = d_test_register_module("base", NULL, NULL, 0) &&
+                d_test_register_module("alloc", NULL, deps, 1);
+    duplicate = d_test_register_module("alloc", NULL, NULL, 0);
+    index     = d_test_find_module_index("alloc");
+
+    // test 1: a duplicate name is rejected and the registry is unchanged
+    result = d_assert_standalone(
+        (first) &&
+        (!duplicate) &&
+        (g_test_registry.count == 2),
+        "registry_duplicate_rejected",
+        "re-registering a name should fail without adding a module",
+        _counter) && result;
+
+    // test 2: the original registration is kept
+    result = d_assert_standalone(
+        (index == 1) &&
+        (g_test_registry.modules[index].dependency_count == 1) &&
+        (strcmp(g_test_registry.modules[index].dependencies[0], "base") == 0),
+        "registry_duplicate_keeps_original",
+        "the first registration should keep its index and dependencies",
+        _counter) && result;
+
+    // test 3: invalid arguments are rejected
+    result = d_assert_standalone(
+        (!d_test_register_module(NULL, NULL, NULL, 0)) &&
+        (!d_test_register_module("bad", NULL, NULL, -1)) &&
+        (!d_test_register_module("bad", NULL, NULL, 2)) &&
+        (g_test_registry.count == 2),
+        "registry_invalid_args",
+        "NULL names and bad dependency lists should be rejected",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_registry_closure
+  Tests d_test_enable_module_with_deps over a diamond dependency graph.
+  Tests the following:
+  - enabling the top enables both sides and the shared base exactly
+  - enabling one side enables only it and the base
+  - dependencies registered after their dependent are still resolved
+  - unknown dependency names are ignored
+*/
+bool
+d_tests_sa_test_cli_registry_closure
+(
+    struct d_test_counter* _counter
+)
+{
+    bool        result;
+    bool        registered;
+    const char* missing_deps[] = { "missing", "base" };
+
+    result = true;
+
+    d_test_registry_clear();
+
+    registered = test_helper_cli_register_diamond();
+
+    // test 1: the top of the diamond pulls in everything beneath it
+    d_test_reset_modules();
+    d_test_enable_module_with_deps(d_test_find_module_index("top"));
+
+    result = d_assert_standalone(
+        (registered) &&
+        (test_helper_cli_enabled("top")) &&
+        (test_helper_cli_enabled("left")) &&
+        (test_helper_cli_enabled("right")) &&
+        (test_helper_cli_enabled("base")) &&
+        (!test_helper_cli_enabled("other")) &&
+        (test_helper_cli_enabled_count() == 4),
+        "registry_closure_diamond",
+        "the closure of the diamond's top should be the whole diamond",
+        _counter) && result;
+
+    // test 2: one side pulls in only the base
+    d_test_reset_modules();
+    d_test_enable_module_with_deps(d_test_find_module_index("left"));
+
+    result = d_assert_standalone(
+        (test_helper_cli_enabled("left")) &&
+        (test_helper_cli_enabled("base")) &&
+        (test_helper_cli_enabled_count() == 2),
+        "registry_closure_side",
+        "the closure of one side should be that side and the base",
+        _counter) && result;
+
+    // test 3: modules registered later are resolved for earlier dependents
+    d_test_reset_modules();
+
+    result = d_assert_standalone(
+        (d_test_register_module("late", NULL, missing_deps, 2)) &&
+        (d_test_find_module_index("late") == 5),
+        "registry_closure_late_registration",
+        "registering after a closure was computed should succeed",
+        _counter) && result;
+
+    // test 4: unknown dependency names are ignored
+    d_test_enable_module_with_deps(d_test_find_module_index("late"));
+
+    result = d_assert_standalone(
+        (test_helper_cli_enabled("late")) &&
+        (test_helper_cli_enabled("base")) &&
+        (g_test_registry.modules[5].dependency_indices[0] == -1) &&
+        (test_helper_cli_enabled_count() == 2),
+        "registry_closure_unknown_dep",
+        "unknown dependencies should be skipped by the closure",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_registry_clear
+  Tests d_test_registry_clear followed by re-registration.
+  Tests the following:
+  - clearing empties the registry and releases its storage
+  - cleared names are no longer found
+  - the same names can be registered again, from index 0
+  - dependency closure works on the re-registered modules
+*/
+bool
+d_tests_sa_test_cli_registry_clear
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+    bool registered;
+
+    result = true;
+
+    d_test_registry_clear();
+
+    registered = test_helper_cli_register_diamond();
+    d_test_enable_all_modules();
+    d_test_registry_clear();
+
+    // test 1: clearing empties the registry and releases its storage
+    result = d_assert_standalone(
+        (registered) &&
+        (g_test_registry.count == 0) &&
+        (g_test_registry.capacity == 0) &&
+        (g_test_registry.modules == NULL) &&
+        (g_test_registry.enabled == NULL) &&
+        (g_test_registry.index == NULL),
+        "registry_clear_empties",
+        "clearing should empty the registry and free its storage",
+        _counter) && result;
+
+    // test 2: cleared names are no longer found
+    result = d_assert_standalone(
+        (d_test_find_module_index("top") == -1) &&
+        (d_test_find_module_index("base") == -1),
+        "registry_clear_forgets_names",
+        "cleared modules should not be found",
+        _counter) && result;
+
+    // test 3: the same names can be registered again, from index 0
+    registered = d_test_register_module("base", NULL, NULL, 0) &&
+                 test_helper_cli_register_diamond();
+
+    result = d_assert_standalone(
+        (!registered) &&
+        (g_test_registry.count == 4) &&
+        (d_test_find_module_index("base") == 0) &&
+        (d_test_find_module_index("top") == 1),
+        "registry_clear_reregister",
+        "names should register again after a clear (duplicates still fail)",
+        _counter) && result;
+
+    // test 4: closure works on the re-registered modules
+    d_test_reset_modules();
+    d_test_enable_module_with_deps(d_test_find_module_index("top"));
+
+    result = d_assert_standalone(
+        (test_helper_cli_enabled("top")) &&
+        (test_helper_cli_enabled("left")) &&
+        (test_helper_cli_enabled("right")) &&
+        (test_helper_cli_enabled("base")) &&
+        (test_helper_cli_enabled_count() == 4),
+        "registry_clear_closure",
+        "dependency closure should work after re-registration",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_registry_all
+  Aggregation function that runs all module registry tests.
+*/
+bool
+d_tests_sa_test_cli_registry_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Module Registry\n");
+    printf("  -------------------------\n");
+
+    result = d_tests_sa_test_cli_registry_growth(_counter) && result;
+    result = d_tests_sa_test_cli_registry_duplicates(_counter) && result;
+    result = d_tests_sa_test_cli_registry_closure(_counter) && result;
+    result = d_tests_sa_test_cli_registry_clear(_counter) && result;
+
+    return result;
+}
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR SCHEDULER TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_CLI_OUTPUT_SIZE
+//   constant: capacity of the buffers holding captured scheduler output.
+#define TEST_HELPER_CLI_OUTPUT_SIZE 4096
+
+/*
+test_helper_cli_module_pass
+  Module test function that passes.
+*/
+static bool
+test_helper_cli_module_pass
+(
+    struct d_test_stats_counter* _info
+)
+{
+    (void)_info;
+
+    return D_SUCCESS;
+}
+
+/*
+test_helper_cli_module_fail
+  Module test function that fails.
+*/
+static bool
+test_helper_cli_module_fail
+(
+    struct d_test_stats_counter* _info
+)
+{
+    (void)_info;
+
+    return D_FAILURE;
+}
+
+/*
+test_helper_cli_module_slow
+  Module test function that passes after a short delay, so parallel runs
+overlap and finish out of start order.
+*/
+static bool
+test_helper_cli_module_slow
+(
+    struct d_test_stats_counter* _info
+)
+{
+    (void)_info;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    poll(NULL, 0, 30);
+#endif
+
+    return D_SUCCESS;
+}
+
+static const struct d_test_module_metadata test_helper_cli_pass_meta =
+{
+    test_helper_cli_module_pass
+};
+
+static const struct d_test_module_metadata test_helper_cli_fail_meta =
+{
+    test_helper_cli_module_fail
+};
+
+static const struct d_test_module_metadata test_helper_cli_slow_meta =
+{
+    test_helper_cli_module_slow
+};
+
+/*
+test_helper_cli_run_captured
+  Runs the enabled modules with `_jobs` workers while stdout is redirected to
+a temporary file, and copies the captured output to `_output`.  Returns false
+if the output could not be captured.
+*/
+static bool
+test_helper_cli_run_captured
+(
+    int                    _jobs,
+    d_test_sched_totals_t* _totals,
+    char*                  _output,
+    size_t                 _size
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)_output;
+    (void)_size;
+
+    *_totals = d_test_run_enabled_modules(_jobs, false);
+
+    return false;
+#else
+    FILE*  capture;
+    size_t length;
+    int    saved;
+
+    _output[0] = '\0';
+    capture    = tmpfile();
+
+    if (!capture)
+    {
+        return false;
+    }
+
+    fflush(stdout);
+    saved = dup(STDOUT_FILENO);
+
+    if ( (saved < 0) ||
+         (dup2(fileno(capture), STDOUT_FILENO) < 0) )
+    {
+        if (saved >= 0)
+        {
+            close(saved);
+        }
+
+        fclose(capture);
+
+        return false;
+    }
+
+    *_totals = d_test_run_enabled_modules(_jobs, false);
+
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    rewind(capture);
+    length          = fread(_output, 1, _size - 1, capture);
+    _output[length] = '\0';
+
+    fclose(capture);
+
+    return true;
+#endif
+}
+
+/*
+test_helper_cli_position
+  Returns the offset of the line "--- Testing `_name` ---" in `_output`, or
+-1 if the module was not run.
+*/
+static long
+test_helper_cli_position
+(
+    const char* _output,
+    const char* _name
+)
+{
+    char        line[D_TEST_MAX_MODULE_NAME + 32];
+    const char* found;
+
+    snprintf(line, sizeof(line), "--- Testing %s ---\n", _name);
+    found = strstr(_output, line);
+
+    return (found) ? (long)(found - _output) : -1L;
+}
+
+/*
+test_helper_cli_has_line
+  Returns true if a line of `_output` begins with `_line`.
+*/
+static bool
+test_helper_cli_has_line
+(
+    const char* _output,
+    const char* _line
+)
+{
+    const char* found;
+    size_t      length;
+
+    length = strlen(_line);
+    found  = _output;
+
+    while ((found = strstr(found, _line)) != NULL)
+    {
+        if ( (found == _output) ||
+             (found[-1] == '\n') )
+        {
+            return true;
+        }
+
+        found += length;
+    }
+
+    return false;
+}
+
+/*
+test_helper_cli_ordered
+  Returns true if every module in `_output` ran after its dependencies in the
+layered graph registered by test_helper_cli_register_layers.
+*/
+static bool
+test_helper_cli_ordered
+(
+    const char* _output
+)
+{
+    long base;
+    long slow;
+    long left;
+    long right;
+    long top;
+
+    base  = test_helper_cli_position(_output, "base");
+    slow  = test_helper_cli_position(_output, "slow");
+    left  = test_helper_cli_position(_output, "left");
+    right = test_helper_cli_position(_output, "right");
+    top   = test_helper_cli_position(_output, "top");
+
+    return (base  != -1)   &&
+           (slow  != -1)   &&
+           (left  > base)  &&
+           (left  > slow)  &&
+           (right > base)  &&
+           (top   > left)  &&
+           (top   > right);
+}
+
+/*
+test_helper_cli_register_layers
+  Registers a layered graph with metadata: "top" depends on "left" and
+"right"; "left" depends on "base" and "slow"; "right" depends on "base".
+"top" is registered first.  An independent "other" module uses
+`_other_meta`, and "base" uses `_base_meta`.
+*/
+static bool
+test_helper_cli_register_layers
+(
+    const struct d_test_module_metadata* _base_meta,
+    const struct d_test_module_metadata* _other_meta
+)
+{
+    const char* top_deps[]   = { "left", "right" };
+    const char* left_deps[]  = { "base", "slow" };
+    const char* right_deps[] = { "base" };
+
+    d_test_registry_clear();
+
+    return d_test_register_module("top",   &test_helper_cli_pass_meta, top_deps, 2)   &&
+           d_test_register_module("left",  &test_helper_cli_pass_meta, left_deps, 2)  &&
+           d_test_register_module("right", &test_helper_cli_pass_meta, right_deps, 1) &&
+           d_test_register_module("slow",  &test_helper_cli_slow_meta, NULL, 0)      &&
+           d_test_register_module("base",  _base_meta, NULL, 0)                      &&
+           d_test_register_module("other", _other_meta, NULL, 0);
+}
+
+
+/******************************************************************************
+ * II. SCHEDULER TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_cli_sched_order
+  Tests that d_test_run_enabled_modules runs modules in dependency order.
+  Tests the following:
+  - every module runs after its dependencies, serially and in parallel
+  - all modules pass and are counted once
+  - a module left out of the selection is not run
+*/
+bool
+d_tests_sa_test_cli_sched_order
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  captured;
+    int                   jobs;
+    char                  output[TEST_HELPER_CLI_OUTPUT_SIZE];
+    d_test_sched_totals_t totals;
+
+    result = true;
+
+    // test 1 & 2: dependencies first, with one worker and with several
+    for (jobs = 1; jobs <= 4; jobs += 3)
+    {
+        test_helper_cli_register_layers(&test_helper_cli_pass_meta,
+                                        &test_helper_cli_pass_meta);
+        d_test_reset_modules();
+        d_test_enable_all_modules();
+
+        captured = test_helper_cli_run_captured(jobs,
+                                                &totals,
+                                                output,
+                                                sizeof(output));
+
+        result = d_assert_standalone(
+            (captured) &&
+            (test_helper_cli_ordered(output)),
+            (jobs == 1) ? "sched_order_serial" : "sched_order_parallel",
+            "every module should start after its dependencies finish",
+            _counter) && result;
+
+        result = d_assert_standalone(
+            (totals.run == 6) &&
+            (totals.passed == 6) &&
+            (totals.failed == 0) &&
+            (totals.skipped == 0),
+            (jobs == 1) ? "sched_totals_serial" : "sched_totals_parallel",
+            "every module should run and pass exactly once",
+            _counter) && result;
+    }
+
+    // test 3: only the selected closure runs
+    d_test_reset_modules();
+    d_test_enable_module_with_deps(d_test_find_module_index("right"));
+
+    captured = test_helper_cli_run_captured(1, &totals, output, sizeof(output));
+
+    result = d_assert_standalone(
+        (captured) &&
+        (totals.run == 2) &&
+        (test_helper_cli_position(output, "base") <
+         test_helper_cli_position(output, "right")) &&
+        (test_helper_cli_position(output, "top") == -1) &&
+        (test_helper_cli_position(output, "other") == -1),
+        "sched_order_selection",
+        "only the enabled closure should run, dependencies first",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_sched_failed_dependency
+  Tests that modules whose dependency failed are skipped, not run.
+  Tests the following:
+  - dependents of a failed module are skipped, transitively
+  - independent modules still run
+  - a skipped module is counted as skipped, not as run or failed
+*/
+bool
+d_tests_sa_test_cli_sched_failed_dependency
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  captured;
+    char                  output[TEST_HELPER_CLI_OUTPUT_SIZE];
+    d_test_sched_totals_t totals;
+
+    result = true;
+
+    test_helper_cli_register_layers(&test_helper_cli_fail_meta,
+                                    &test_helper_cli_pass_meta);
+    d_test_reset_modules();
+    d_test_enable_all_modules();
+
+    captured = test_helper_cli_run_captured(1, &totals, output, sizeof(output));
+
+    // test 1: dependents of the failed module are skipped, transitively
+    result = d_assert_standalone(
+        (captured) &&
+        (test_helper_cli_has_line(output, "FAIL: base")) &&
+        (test_helper_cli_has_line(output,
+            "SKIP: left (dependency 'base' did not pass)")) &&
+        (test_helper_cli_has_line(output,
+            "SKIP: right (dependency 'base' did not pass)")) &&
+        (test_helper_cli_has_line(output,
+            "SKIP: top (dependency '")) &&
+        (test_helper_cli_position(output, "left") == -1) &&
+        (test_helper_cli_position(output, "top") == -1),
+        "sched_skip_dependents",
+        "modules depending on a failed module should be skipped",
+        _counter) && result;
+
+    // test 2: independent modules still run
+    result = d_assert_standalone(
+        (test_helper_cli_has_line(output, "PASS: other")) &&
+        (test_helper_cli_has_line(output, "PASS: slow")),
+        "sched_skip_independent_run",
+        "modules not depending on the failure should still run",
+        _counter) && result;
+
+    // test 3: skipped modules are counted apart from run ones
+    result = d_assert_standalone(
+        (totals.run == 3) &&
+        (totals.passed == 2) &&
+        (totals.failed == 1) &&
+        (totals.skipped == 3),
+        "sched_skip_totals",
+        "skipped modules should not count as run or failed",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_sched_cycle
+  Tests that modules caught in a dependency cycle fail the run.
+  Tests the following:
+  - every module on a cycle is reported as failed
+  - modules that only wait on a cycle, including one between two cycles,
+    are skipped and name the dependency they wait on
+  - modules outside the cycle still run and pass
+  - d_test_execute_command exits non-zero because of the cycle
+*/
+bool
+d_tests_sa_test_cli_sched_cycle
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  captured;
+    bool                  registered;
+    int                   exit_code;
+    char                  output[TEST_HELPER_CLI_OUTPUT_SIZE];
+    d_test_sched_totals_t totals;
+    d_test_args_t         args;
+    const char*           a_deps[]      = { "b" };
+    const char*           b_deps[]      = { "a" };
+    const char*           c_deps[]      = { "a" };
+    const char*           bridge_deps[] = { "b" };
+    const char*           p_deps[]      = { "bridge", "q" };
+    const char*           q_deps[]      = { "p" };
+
+    result = true;
+
+    d_test_registry_clear();
+
+    // a <-> b is a cycle; c waits on it; bridge waits on it and is waited on
+    // by a second cycle p <-> q; d is independent
+    registered =
+        d_test_register_module("a", &test_helper_cli_pass_meta, a_deps, 1)  &&
+        d_test_register_module("b", &test_helper_cli_pass_meta, b_deps, 1)  &&
+        d_test_register_module("c", &test_helper_cli_pass_meta, c_deps, 1)  &&
+        d_test_register_module("d", &test_helper_cli_pass_meta, NULL, 0)    &&
+        d_test_register_module("bridge",
+                               &test_helper_cli_pass_meta,
+                               bridge_deps,
+                               1)                                            &&
+        d_test_register_module("p", &test_helper_cli_pass_meta, p_deps, 2)  &&
+        d_test_register_module("q", &test_helper_cli_pass_meta, q_deps, 1);
+
+    d_test_reset_modules();
+    d_test_enable_all_modules();
+
+    captured = test_helper_cli_run_captured(1, &totals, output, sizeof(output));
+
+    // test 1: modules on a cycle fail without running
+    result = d_assert_standalone(
+        (registered) &&
+        (captured) &&
+        (test_helper_cli_has_line(output, "FAIL: a (dependency cycle)")) &&
+        (test_helper_cli_has_line(output, "FAIL: b (dependency cycle)")) &&
+        (test_helper_cli_has_line(output, "FAIL: p (dependency cycle)")) &&
+        (test_helper_cli_has_line(output, "FAIL: q (dependency cycle)")) &&
+        (test_helper_cli_position(output, "a") == -1),
+        "sched_cycle_reported",
+        "modules on a cycle should be reported as failed",
+        _counter) && result;
+
+    // test 2: modules that only wait on a cycle are skipped
+    result = d_assert_standalone(
+        (test_helper_cli_has_line(output,
+             "SKIP: c (dependency 'a' did not pass)"))      &&
+        (test_helper_cli_has_line(output,
+             "SKIP: bridge (dependency 'b' did not pass)")) &&
+        (!test_helper_cli_has_line(output, "FAIL: c"))      &&
+        (!test_helper_cli_has_line(output, "FAIL: bridge")),
+        "sched_cycle_dependents_skipped",
+        "modules behind a cycle should be skipped, not reported as a cycle",
+        _counter) && result;
+
+    // test 3: the rest of the graph runs, and the cycle counts as failures
+    result = d_assert_standalone(
+        (test_helper_cli_has_line(output, "PASS: d")) &&
+        (totals.run == 1) &&
+        (totals.passed == 1) &&
+        (totals.failed == 4) &&
+        (totals.skipped == 2),
+        "sched_cycle_totals",
+        "cycle members should be counted as failed, their dependents skipped",
+        _counter) && result;
+
+    // test 4: the command exits non-zero
+    memset(&args, 0, sizeof(args));
+    args.command = D_TEST_CMD_RUN_ALL;
+    args.jobs    = 1;
+
+    exit_code = -1;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    {
+        FILE* capture;
+        int   saved;
+
+        capture = tmpfile();
+        fflush(stdout);
+        saved = dup(STDOUT_FILENO);
+
+        if ( (capture) &&
+             (saved >= 0) &&
+             (dup2(fileno(capture), STDOUT_FILENO) >= 0) )
+        {
+            exit_code = d_test_execute_command(args);
+            fflush(stdout);
+            dup2(saved, STDOUT_FILENO);
+        }
+
+        if (saved >= 0)
+        {
+            close(saved);
+        }
+
+        if (capture)
+        {
+            fclose(capture);
+        }
+    }
+#else
+    exit_code = d_test_execute_command(args);
+#endif
+
+    result = d_assert_standalone(
+        exit_code == 1,
+        "sched_cycle_exit_code",
+        "a dependency cycle should make the command exit non-zero",
+        _counter) && result;
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_sched_jobs
+  Tests that the number of workers does not change the outcome.
+  Tests the following:
+  - -jobs 1 and -jobs N produce the same totals
+  - both report the same verdict for every module
+  - parallel workers are reaped by pid, leaving other children alone
+*/
+bool
+d_tests_sa_test_cli_sched_jobs
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  captured;
+    bool                  same;
+    size_t                i;
+    char                  serial[TEST_HELPER_CLI_OUTPUT_SIZE];
+    char                  parallel[TEST_HELPER_CLI_OUTPUT_SIZE];
+    d_test_sched_totals_t serial_totals;
+    d_test_sched_totals_t parallel_totals;
+    const char*           verdicts[] =
+    {
+        "FAIL: base",
+        "PASS: slow",
+        "FAIL: other",
+        "SKIP: left (dependency 'base' did not pass)",
+        "SKIP: right (dependency 'base' did not pass)",
+        "SKIP: top (dependency '"
+    };
+
+    result = true;
+
+    test_helper_cli_register_layers(&test_helper_cli_fail_meta,
+                                    &test_helper_cli_fail_meta);
+    d_test_reset_modules();
+    d_test_enable_all_modules();
+
+    captured = test_helper_cli_run_captured(1,
+                                            &serial_totals,
+                                            serial,
+                                            sizeof(serial)) &&
+               test_helper_cli_run_captured(4,
+                                            &parallel_totals,
+                                            parallel,
+                                            sizeof(parallel));
+
+    // test 1: the same totals with one worker and with several
+    result = d_assert_standalone(
+        (captured) &&
+        (serial_totals.run == parallel_totals.run) &&
+        (serial_totals.passed == parallel_totals.passed) &&
+        (serial_totals.failed == parallel_totals.failed) &&
+        (serial_totals.skipped == parallel_totals.skipped) &&
+        (serial_totals.run == 3) &&
+        (serial_totals.failed == 2),
+        "sched_jobs_totals",
+        "-jobs 1 and -jobs 4 should produce the same totals",
+        _counter) && result;
+
+    // test 2: the same verdict for every module
+    same = captured;
+
+    for (i = 0; (same) && (i < (sizeof(verdicts) / sizeof(verdicts[0]))); i++)
+    {
+        same = test_helper_cli_has_line(serial, verdicts[i]) &&
+               test_helper_cli_has_line(parallel, verdicts[i]);
+    }
+
+    result = d_assert_standalone(
+        same,
+        "sched_jobs_verdicts",
+        "-jobs 1 and -jobs 4 should report the same verdicts",
+        _counter) && result;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    // test 3: a child of the host process is not reaped by the scheduler
+    {
+        pid_t bystander;
+        pid_t reaped;
+        int   status;
+
+        fflush(stdout);
+        bystander = fork();
+
+        if (bystander == 0)
+        {
+            _exit(7);
+        }
+
+        test_helper_cli_register_layers(&test_helper_cli_pass_meta,
+                                        &test_helper_cli_pass_meta);
+        d_test_reset_modules();
+        d_test_enable_all_modules();
+
+        captured = test_helper_cli_run_captured(4,
+                                                &parallel_totals,
+                                                parallel,
+                                                sizeof(parallel));
+
+        reaped = -1;
+        status = 0;
+
+        if (bystander > 0)
+        {
+            reaped = waitpid(bystander, &status, 0);
+        }
+
+        result = d_assert_standalone(
+            (captured) &&
+            (parallel_totals.passed == 6) &&
+            (reaped == bystander) &&
+            (WIFEXITED(status)) &&
+            (WEXITSTATUS(status) == 7),
+            "sched_jobs_own_children",
+            "the scheduler should reap only its own workers",
+            _counter) && result;
+    }
+#endif
+
+    d_test_registry_clear();
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_sched_all
+  Aggregation function that runs all scheduler tests.
+*/
+bool
+d_tests_sa_test_cli_sched_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Dependency Scheduler\n");
+    printf("  ------------------------------\n");
+
+    result = d_tests_sa_test_cli_sched_order(_counter) && result;
+    result = d_tests_sa_test_cli_sched_failed_dependency(_counter) && result;
+    result = d_tests_sa_test_cli_sched_cycle(_counter) && result;
+    result = d_tests_sa_test_cli_sched_jobs(_counter) && result;
+
+    return result;
+}
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR ARGUMENT PARSING TESTS
+ *****************************************************************************/
+
+/*
+test_helper_cli_parse_jobs
+  Parses "run test all -jobs `_value`" with stdout silenced.
+*/
+static d_test_args_t
+test_helper_cli_parse_jobs
+(
+    const char* _value
+)
+{
+    char*         argv[6];
+    d_test_args_t args;
+
+    argv[0] = (char*)"test_runner";
+    argv[1] = (char*)"run";
+    argv[2] = (char*)"test";
+    argv[3] = (char*)"all";
+    argv[4] = (char*)"-jobs";
+    argv[5] = (char*)_value;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    {
+        FILE* capture;
+        int   saved;
+
+        capture = tmpfile();
+        fflush(stdout);
+        saved = dup(STDOUT_FILENO);
+
+        if ( (capture) &&
+             (saved >= 0) &&
+             (dup2(fileno(capture), STDOUT_FILENO) >= 0) )
+        {
+            args = d_test_parse_args(6, argv);
+            fflush(stdout);
+            dup2(saved, STDOUT_FILENO);
+        }
+        else
+        {
+            args = d_test_parse_args(6, argv);
+        }
+
+        if (saved >= 0)
+        {
+            close(saved);
+        }
+
+        if (capture)
+        {
+            fclose(capture);
+        }
+    }
+#else
+    args = d_test_parse_args(6, argv);
+#endif
+
+    return args;
+}
+
+
+/******************************************************************************
+ * III. ARGUMENT PARSING TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_cli_parse_jobs
+  Tests the -jobs option of d_test_parse_args.
+  Tests the following:
+  - a positive integer is accepted
+  - trailing garbage, non-numeric text, zero, negative and out-of-range
+    values are rejected, leaving no command to run
+*/
+bool
+d_tests_sa_test_cli_parse_jobs
+(
+    struct d_test_counter* _counter
+)
+{
+    bool          result;
+    bool          rejected;
+    size_t        i;
+    d_test_args_t args;
+    const char*   invalid[] =
+    {
+        "4x",
+        "abc",
+        "",
+        "0",
+        "-2",
+        "99999999999999999999"
+    };
+
+    result = true;
+
+    // test 1: a positive integer is accepted
+    args = test_helper_cli_parse_jobs("4");
+
+    result = d_assert_standalone(
+        (args.command == D_TEST_CMD_RUN_ALL) &&
+        (args.jobs == 4),
+        "parse_jobs_valid",
+        "-jobs 4 should run everything with four workers",
+        _counter) && result;
+
+    // test 2: invalid values are rejected
+    rejected = true;
+
+    for (i = 0; i < (sizeof(invalid) / sizeof(invalid[0])); i++)
+    {
+        args     = test_helper_cli_parse_jobs(invalid[i]);
+        rejected = (args.command == D_TEST_CMD_NONE) && rejected;
+    }
+
+    result = d_assert_standalone(
+        rejected,
+        "parse_jobs_invalid",
+        "-jobs should reject values that are not positive integers",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_cli_parse_all
+  Aggregation function that runs all argument parsing tests.
+*/
+bool
+d_tests_sa_test_cli_parse_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Argument Parsing\n");
+    printf("  --------------------------\n");
+
+    result = d_tests_sa_test_cli_parse_jobs(_counter) && result;
+
+    return result;
+}
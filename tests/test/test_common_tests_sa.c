@@ -11,6 +11,9 @@ d_tests_sa_test_common_run_all
   - Test function wrappers (d_test_fn)
   - Lifecycle stages (DTestStage)
   - Type discriminators (DTestTypeFlag)
+  - Name filters (d_test_filter)
+  - Child storage (d_test_children)
+  - Property-based tests (d_test_prng, d_test_gen, d_test_property)
 */
 bool
 d_tests_sa_test_common_run_all
@@ -29,6 +32,9 @@ d_tests_sa_test_common_run_all
     result = d_tests_sa_test_common_fn_wrapper_all(_counter) && result;
     result = d_tests_sa_test_common_lifecycle_all(_counter) && result;
     result = d_tests_sa_test_common_discriminator_all(_counter) && result;
+    result = d_tests_sa_test_common_filter_all(_counter) && result;
+    result = d_tests_sa_test_common_children_all(_counter) && result;
+    result = d_tests_sa_test_common_property_all(_counter) && result;
 
     return result;
 }
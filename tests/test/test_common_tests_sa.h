@@ -99,6 +99,58 @@ bool d_tests_sa_test_common_type_flag_uniqueness(struct d_test_counter* _counter
 bool d_tests_sa_test_common_discriminator_all(struct d_test_counter* _counter);
 
 
+/******************************************************************************
+ * VII. NAME FILTER TESTS
+ *****************************************************************************/
+// d_test_filter_new, d_test_filter_add
+bool d_tests_sa_test_common_filter_compile(struct d_test_counter* _counter);
+// d_test_filter_match, d_test_filter_selects
+bool d_tests_sa_test_common_filter_match(struct d_test_counter* _counter);
+
+// VII. aggregation function
+bool d_tests_sa_test_common_filter_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * VIII. CHILD STORAGE TESTS
+ *****************************************************************************/
+// d_test_children_init, d_test_children_push, d_test_children_at (inline)
+bool d_tests_sa_test_common_children_inline(struct d_test_counter* _counter);
+// d_test_children_push past the inline capacity, d_test_children_clear
+bool d_tests_sa_test_common_children_spill(struct d_test_counter* _counter);
+
+// VIII. aggregation function
+bool d_tests_sa_test_common_children_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * IX. PROPERTY TESTS
+ *****************************************************************************/
+// d_test_prng_seed, d_test_prng_next, d_test_prng_below
+bool d_tests_sa_test_common_property_prng(struct d_test_counter* _counter);
+// D_TEST_GEN_INT, D_TEST_GEN_BYTES, D_TEST_GEN_STRING, D_TEST_GEN_STRUCT
+bool d_tests_sa_test_common_property_gen_bounds(struct d_test_counter* _counter);
+// d_test_property_run shrinking
+bool d_tests_sa_test_common_property_shrink(struct d_test_counter* _counter);
+// d_test_property_run with workers = 1 and workers = 4
+bool d_tests_sa_test_common_property_workers(struct d_test_counter* _counter);
+// d_test_property_describe
+bool d_tests_sa_test_common_property_describe(struct d_test_counter* _counter);
+#if ( !defined(_WIN32) && !defined(_WIN64) )
+// d_test_property_run with a property that crashes its worker
+bool d_tests_sa_test_common_property_worker_crash(struct d_test_counter* _counter);
+// d_test_property_run with a property that hangs its worker
+bool d_tests_sa_test_common_property_worker_timeout(struct d_test_counter* _counter);
+// d_test_property_run keeping its workers across shrink rounds
+bool d_tests_sa_test_common_property_worker_reuse(struct d_test_counter* _counter);
+// d_test_property_run stopping workers past the first failing case
+bool d_tests_sa_test_common_property_worker_cancel(struct d_test_counter* _counter);
+#endif
+
+// IX. aggregation function
+bool d_tests_sa_test_common_property_all(struct d_test_counter* _counter);
+
+
 /******************************************************************************
  * MODULE-LEVEL AGGREGATION
  *****************************************************************************/
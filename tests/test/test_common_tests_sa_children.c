@@ -0,0 +1,196 @@
+#include ".\test_common_tests_sa.h"
+
+
+/******************************************************************************
+ * VIII. CHILD STORAGE TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_common_children_inline
+  Tests d_test_children_init, d_test_children_push and d_test_children_at
+while children fit in the inline buffer.
+  Tests the following:
+  - initialized storage is empty and not spilled
+  - pushed children are copied by value
+  - children stay inline up to D_TEST_CHILDREN_INLINE_CAPACITY
+  - out-of-range indices and NULL arguments are rejected
+*/
+bool
+d_tests_sa_test_common_children_inline
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    bool                   stored;
+    size_t                 i;
+    struct d_test_children children;
+    struct d_test_type     child;
+    struct d_test_type*    at;
+
+    result = true;
+
+    // test 1: initialized storage is empty and not spilled
+    d_test_children_init(&children);
+
+    result = d_assert_standalone(
+        (children.count == 0) &&
+        (children.heap == NULL),
+        "children_init",
+        "initialized child storage should be empty and inline",
+        _counter) && result;
+
+    // test 2: pushed children are copied by value
+    child.type   = D_TEST_TYPE_TEST;
+    child.config = NULL;
+    child.test   = NULL;
+
+    stored     = d_test_children_push(&children, &child);
+    child.type = D_TEST_TYPE_ASSERT;
+    at         = d_test_children_at(&children, 0);
+
+    result = d_assert_standalone(
+        (stored) &&
+        (at == &children.inline_items[0]) &&
+        (at->type == D_TEST_TYPE_TEST),
+        "children_push_copies",
+        "a pushed child should be copied into the inline buffer",
+        _counter) && result;
+
+    // test 3: children stay inline up to the inline capacity
+    for (i = 1; i < D_TEST_CHILDREN_INLINE_CAPACITY; i++)
+    {
+        stored = d_test_children_push(&children, &child) && stored;
+    }
+
+    result = d_assert_standalone(
+        (stored) &&
+        (children.count == D_TEST_CHILDREN_INLINE_CAPACITY) &&
+        (children.heap == NULL),
+        "children_inline_capacity",
+        "children should stay inline up to the inline capacity",
+        _counter) && result;
+
+    // test 4: out-of-range indices and NULL arguments are rejected
+    result = d_assert_standalone(
+        (d_test_children_at(&children, children.count) == NULL) &&
+        (d_test_children_at(NULL, 0) == NULL) &&
+        (!d_test_children_push(&children, NULL)) &&
+        (!d_test_children_push(NULL, &child)),
+        "children_invalid_args",
+        "out-of-range indices and NULL arguments should be rejected",
+        _counter) && result;
+
+    d_test_children_clear(&children);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_children_spill
+  Tests d_test_children_push past the inline capacity and
+d_test_children_clear.
+  Tests the following:
+  - the first push past the inline capacity moves children to the heap
+  - order and values are preserved across the spill and later growth
+  - clearing releases the heap and empties the storage
+*/
+bool
+d_tests_sa_test_common_children_spill
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    bool                   stored;
+    bool                   ordered;
+    size_t                 i;
+    size_t                 total;
+    struct d_test_children children;
+    struct d_test_type     child;
+    struct d_test_type*    at;
+
+    result = true;
+    stored = true;
+    total  = (D_TEST_CHILDREN_INLINE_CAPACITY * 4) + 1;
+
+    d_test_children_init(&children);
+
+    child.config = NULL;
+    child.test   = NULL;
+
+    for (i = 0; i <= D_TEST_CHILDREN_INLINE_CAPACITY; i++)
+    {
+        child.type = (enum DTestTypeFlag)(i % 6);
+        stored     = d_test_children_push(&children, &child) && stored;
+    }
+
+    // test 1: the first push past the inline capacity spills to the heap
+    result = d_assert_standalone(
+        (stored) &&
+        (children.heap != NULL) &&
+        (children.capacity > D_TEST_CHILDREN_INLINE_CAPACITY),
+        "children_spill",
+        "pushing past the inline capacity should move children to the heap",
+        _counter) && result;
+
+    // test 2: order and values are preserved across spill and growth
+    for (; i < total; i++)
+    {
+        child.type = (enum DTestTypeFlag)(i % 6);
+        stored     = d_test_children_push(&children, &child) && stored;
+    }
+
+    ordered = (children.count == total);
+
+    for (i = 0; (ordered) && (i < total); i++)
+    {
+        at      = d_test_children_at(&children, i);
+        ordered = (at != NULL) &&
+                  (at->type == (enum DTestTypeFlag)(i % 6));
+    }
+
+    result = d_assert_standalone(
+        (stored) && (ordered),
+        "children_spill_order",
+        "children should keep their order and values after spilling",
+        _counter) && result;
+
+    // test 3: clearing releases the heap and empties the storage
+    d_test_children_clear(&children);
+
+    result = d_assert_standalone(
+        (children.count == 0) &&
+        (children.heap == NULL) &&
+        (d_test_children_at(&children, 0) == NULL),
+        "children_clear",
+        "clearing should release spilled storage and empty the children",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_children_all
+  Aggregation function that runs all child storage tests.
+*/
+bool
+d_tests_sa_test_common_children_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Child Storage\n");
+    printf("  -----------------------\n");
+
+    result = d_tests_sa_test_common_children_inline(_counter) && result;
+    result = d_tests_sa_test_common_children_spill(_counter) && result;
+
+    return result;
+}
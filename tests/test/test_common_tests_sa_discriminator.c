@@ -134,6 +134,7 @@ d_tests_sa_test_common_type_flag_values
   - D_TEST_TYPE_TEST equals 3
   - D_TEST_TYPE_TEST_BLOCK equals 4
   - D_TEST_TYPE_MODULE equals 5
+  - D_TEST_TYPE_PROPERTY equals 6
   - Values are sequential
 */
 bool
@@ -188,18 +189,26 @@ d_tests_sa_test_common_type_flag_values
         "D_TEST_TYPE_MODULE should equal 5",
         _counter) && result;
 
-    // test 7: values are sequential (no gaps from 0 to 5)
+    // test 7: D_TEST_TYPE_PROPERTY equals 6
+    result = d_assert_standalone(
+        D_TEST_TYPE_PROPERTY == 6,
+        "type_flag_property_value",
+        "D_TEST_TYPE_PROPERTY should equal 6",
+        _counter) && result;
+
+    // test 8: values are sequential (no gaps from 0 to 6)
     result = d_assert_standalone(
         (D_TEST_TYPE_ASSERT == D_TEST_TYPE_UNKNOWN + 1) &&
         (D_TEST_TYPE_TEST_FN == D_TEST_TYPE_ASSERT + 1) &&
         (D_TEST_TYPE_TEST == D_TEST_TYPE_TEST_FN + 1) &&
         (D_TEST_TYPE_TEST_BLOCK == D_TEST_TYPE_TEST + 1) &&
-        (D_TEST_TYPE_MODULE == D_TEST_TYPE_TEST_BLOCK + 1),
+        (D_TEST_TYPE_MODULE == D_TEST_TYPE_TEST_BLOCK + 1) &&
+        (D_TEST_TYPE_PROPERTY == D_TEST_TYPE_MODULE + 1),
         "type_flag_values_sequential",
         "DTestTypeFlag values should be sequential",
         _counter) && result;
 
-    // test 8: values can be used as array indices
+    // test 9: values can be used as array indices
     {
         const char* type_names[6];
         bool        index_ok;
@@ -221,14 +230,14 @@ d_tests_sa_test_common_type_flag_values
             _counter) && result;
     }
 
-    // test 9: there are exactly 6 type flag values (0 through 5)
+    // test 10: there are exactly 7 type flag values (0 through 6)
     result = d_assert_standalone(
-        D_TEST_TYPE_MODULE == 5,
+        D_TEST_TYPE_PROPERTY == 6,
         "type_flag_count",
-        "There should be exactly 6 type flags (0-5)",
+        "There should be exactly 7 type flags (0-6)",
         _counter) && result;
 
-    // test 10: enum fits in minimal storage
+    // test 11: enum fits in minimal storage
     result = d_assert_standalone(
         sizeof(enum DTestTypeFlag) <= sizeof(int),
         "type_flag_size",
@@ -0,0 +1,218 @@
+#include ".\test_common_tests_sa.h"
+
+
+/******************************************************************************
+ * VII. NAME FILTER TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_common_filter_compile
+  Tests d_test_filter_new and d_test_filter_add.
+  Tests the following:
+  - NULL pattern lists compile to an empty filter
+  - patterns are split on the list separator
+  - segments are split on the path separator
+  - literal prefixes and "**" segments are recognised
+  - d_test_filter_add rejects a NULL filter
+*/
+bool
+d_tests_sa_test_common_filter_compile
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_test_filter* filter;
+
+    result = true;
+
+    // test 1: NULL pattern lists compile to an empty filter
+    filter = d_test_filter_new(NULL, NULL);
+
+    result = d_assert_standalone(
+        (filter != NULL) &&
+        (filter->count == 0) &&
+        (filter->include_count == 0),
+        "filter_compile_empty",
+        "NULL patterns should compile to an empty filter",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    // test 2: patterns are split on the list separator
+    filter = d_test_filter_new("alloc/*/resize*,string", "**/slow*");
+
+    result = d_assert_standalone(
+        (filter != NULL) &&
+        (filter->count == 3) &&
+        (filter->include_count == 2) &&
+        (filter->patterns[2].exclude),
+        "filter_compile_list",
+        "include and exclude lists should compile to three patterns",
+        _counter) && result;
+
+    if (filter)
+    {
+        // test 3: segments are split on the path separator
+        result = d_assert_standalone(
+            (filter->patterns[0].count == 3) &&
+            (filter->patterns[1].count == 1),
+            "filter_compile_segments",
+            "patterns should be split into path segments",
+            _counter) && result;
+
+        // test 4: literal prefixes and "**" segments are recognised
+        result = d_assert_standalone(
+            (filter->patterns[0].segments[0].literal) &&
+            (!filter->patterns[0].segments[2].literal) &&
+            (filter->patterns[0].segments[2].prefix_length == 6) &&
+            (filter->patterns[2].segments[0].any_depth),
+            "filter_compile_segment_kinds",
+            "segments should record literal prefixes and any-depth markers",
+            _counter) && result;
+    }
+
+    d_test_filter_free(filter);
+
+    // test 5: d_test_filter_add rejects a NULL filter
+    result = d_assert_standalone(
+        !d_test_filter_add(NULL, "alloc", false),
+        "filter_add_null",
+        "d_test_filter_add(NULL, ...) should return false",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_filter_match
+  Tests d_test_filter_match and d_test_filter_selects.
+  Tests the following:
+  - NULL and empty filters select everything
+  - '*' and '?' wildcards match within one segment
+  - partial paths report PARTIAL so subtrees are not pruned early
+  - "**" matches any number of segments, so any path stays PARTIAL
+  - exclude patterns remove fully matched subtrees only
+  - d_test_filter_selects checks module names
+*/
+bool
+d_tests_sa_test_common_filter_match
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_test_filter* filter;
+    const char*           full[3]     = { "alloc", "vector", "resize_grow" };
+    const char*           other[3]    = { "alloc", "vector", "push_back" };
+    const char*           module[1]   = { "string" };
+    const char*           ancestor[1] = { "alloc" };
+
+    result = true;
+
+    // test 1: NULL and empty filters select everything
+    filter = d_test_filter_new(NULL, NULL);
+
+    result = d_assert_standalone(
+        (d_test_filter_match(NULL, full, 3) == D_TEST_FILTER_MATCH_FULL) &&
+        (d_test_filter_match(filter, full, 3) == D_TEST_FILTER_MATCH_FULL),
+        "filter_match_empty",
+        "NULL and empty filters should select everything",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    // test 2: '*' and '?' wildcards match within one segment
+    filter = d_test_filter_new("alloc/*/resize*,str?ng", NULL);
+
+    result = d_assert_standalone(
+        (filter != NULL) &&
+        (d_test_filter_match(filter, full, 3) == D_TEST_FILTER_MATCH_FULL) &&
+        (d_test_filter_match(filter, other, 3) == D_TEST_FILTER_MATCH_NONE) &&
+        (d_test_filter_match(filter, module, 1) == D_TEST_FILTER_MATCH_FULL),
+        "filter_match_wildcards",
+        "'*' and '?' should match within a segment",
+        _counter) && result;
+
+    // test 3: partial paths report PARTIAL
+    result = d_assert_standalone(
+        (d_test_filter_match(filter, ancestor, 1) ==
+         D_TEST_FILTER_MATCH_PARTIAL) &&
+        (d_test_filter_match(filter, full, 2) ==
+         D_TEST_FILTER_MATCH_PARTIAL),
+        "filter_match_partial",
+        "ancestors of possible matches should be PARTIAL",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    // test 4: "**" matches any number of segments
+    filter = d_test_filter_new("**/resize*,string/**", NULL);
+
+    result = d_assert_standalone(
+        (filter != NULL) &&
+        (d_test_filter_match(filter, full, 3) == D_TEST_FILTER_MATCH_FULL) &&
+        (d_test_filter_match(filter, ancestor, 1) ==
+         D_TEST_FILTER_MATCH_PARTIAL) &&
+        (d_test_filter_match(filter, module, 1) == D_TEST_FILTER_MATCH_FULL),
+        "filter_match_any_depth",
+        "'**' should match zero or more segments",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    // test 5: exclude patterns remove fully matched subtrees only
+    filter = d_test_filter_new(NULL, "alloc/*/push*");
+
+    result = d_assert_standalone(
+        (filter != NULL) &&
+        (d_test_filter_match(filter, other, 3) == D_TEST_FILTER_MATCH_NONE) &&
+        (d_test_filter_match(filter, full, 3) == D_TEST_FILTER_MATCH_FULL) &&
+        (d_test_filter_match(filter, ancestor, 1) ==
+         D_TEST_FILTER_MATCH_FULL),
+        "filter_match_exclude",
+        "excludes should only prune paths they fully match",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    // test 6: d_test_filter_selects checks module names
+    filter = d_test_filter_new("alloc*", NULL);
+
+    result = d_assert_standalone(
+        (d_test_filter_selects(filter, "alloc_pool")) &&
+        (!d_test_filter_selects(filter, "string")) &&
+        (d_test_filter_selects(NULL, "string")),
+        "filter_selects_module",
+        "d_test_filter_selects should match module names",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_filter_all
+  Aggregation function that runs all name filter tests.
+*/
+bool
+d_tests_sa_test_common_filter_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Name Filters\n");
+    printf("  ----------------------\n");
+
+    result = d_tests_sa_test_common_filter_compile(_counter) && result;
+    result = d_tests_sa_test_common_filter_match(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,1002 @@
+#include ".\test_common_tests_sa.h"
+#include "..\..\inc\test\test_property.h"
+
+#if ( !defined(_WIN32) && !defined(_WIN64) )
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR PROPERTY TESTS
+ *****************************************************************************/
+
+// test_helper_property_pair
+//   struct: composite input for the struct generator tests.
+struct test_helper_property_pair
+{
+    int16_t  small;
+    uint8_t  flags;
+};
+
+static const char test_helper_property_alphabet[] = "xyz";
+
+static const struct d_test_gen test_helper_property_int_gen =
+    D_TEST_GEN_INT(int, -5, 5);
+static const struct d_test_gen test_helper_property_wide_gen =
+    D_TEST_GEN_INT(int, 0, 1000);
+static const struct d_test_gen test_helper_property_bytes_gen =
+    D_TEST_GEN_BYTES(2, 6);
+static const struct d_test_gen test_helper_property_string_gen =
+    D_TEST_GEN_STRING(1, 4, test_helper_property_alphabet);
+static const struct d_test_gen test_helper_property_small_gen =
+    D_TEST_GEN_INT(int16_t, -3, 3);
+static const struct d_test_gen test_helper_property_flags_gen =
+    D_TEST_GEN_UINT(uint8_t, 10, 20);
+
+static const struct d_test_gen_field test_helper_property_pair_fields[] =
+{
+    D_TEST_GEN_FIELD(struct test_helper_property_pair,
+                     small,
+                     &test_helper_property_small_gen),
+    D_TEST_GEN_FIELD(struct test_helper_property_pair,
+                     flags,
+                     &test_helper_property_flags_gen)
+};
+
+static const struct d_test_gen test_helper_property_pair_gen =
+    D_TEST_GEN_STRUCT(struct test_helper_property_pair,
+                      test_helper_property_pair_fields);
+
+/*
+test_helper_property_int_in_range
+  Property: the input int lies in [-5, 5].  Counts the cases it sees in
+`_context`.
+*/
+static bool
+test_helper_property_int_in_range
+(
+    const void* _input,
+    void*       _context
+)
+{
+    int value;
+
+    value = *(const int*)_input;
+    (*(size_t*)_context)++;
+
+    return (value >= -5) && (value <= 5);
+}
+
+/*
+test_helper_property_bytes_in_range
+  Property: the input buffer holds 2 to 6 bytes.
+*/
+static bool
+test_helper_property_bytes_in_range
+(
+    const void* _input,
+    void*       _context
+)
+{
+    const struct d_test_bytes* bytes;
+
+    (void)_context;
+
+    bytes = (const struct d_test_bytes*)_input;
+
+    return (bytes->length >= 2) &&
+           (bytes->length <= 6) &&
+           (bytes->data != NULL);
+}
+
+/*
+test_helper_property_string_in_range
+  Property: the input string holds 1 to 4 characters from "xyz".
+*/
+static bool
+test_helper_property_string_in_range
+(
+    const void* _input,
+    void*       _context
+)
+{
+    const char* value;
+    size_t      length;
+
+    (void)_context;
+
+    value = *(const char* const*)_input;
+
+    if (!value)
+    {
+        return false;
+    }
+
+    length = strlen(value);
+
+    return (length >= 1) &&
+           (length <= 4) &&
+           (strspn(value, test_helper_property_alphabet) == length);
+}
+
+/*
+test_helper_property_pair_in_range
+  Property: each member of the input pair lies within its generator's bounds.
+*/
+static bool
+test_helper_property_pair_in_range
+(
+    const void* _input,
+    void*       _context
+)
+{
+    const struct test_helper_property_pair* pair;
+
+    (void)_context;
+
+    pair = (const struct test_helper_property_pair*)_input;
+
+    return (pair->small >= -3) &&
+           (pair->small <= 3)  &&
+           (pair->flags >= 10) &&
+           (pair->flags <= 20);
+}
+
+/*
+test_helper_property_below_100
+  Property: the input int is below 100.
+*/
+static bool
+test_helper_property_below_100
+(
+    const void* _input,
+    void*       _context
+)
+{
+    (void)_context;
+
+    return *(const int*)_input < 100;
+}
+
+/*
+test_helper_property_check
+  Runs `_property` over `_generator` with default settings and the given
+worker count, and returns whether every case passed.
+*/
+static bool
+test_helper_property_check
+(
+    fn_test_property         _property,
+    const struct d_test_gen* _generator,
+    void*                    _context,
+    size_t                   _workers
+)
+{
+    struct d_test_property* property;
+    bool                    passed;
+
+    property = d_test_property_new(_property, _generator, _context);
+
+    if (!property)
+    {
+        return false;
+    }
+
+    property->workers = _workers;
+    passed            = d_test_property_run(property);
+
+    d_test_property_free(property);
+
+    return passed;
+}
+
+#if ( !defined(_WIN32) && !defined(_WIN64) )
+// TEST_HELPER_PROPERTY_LOG
+//   constant: file worker processes append their records to.
+#define TEST_HELPER_PROPERTY_LOG "d_tests_property_log.bin"
+
+// descriptor of TEST_HELPER_PROPERTY_LOG, inherited by every worker
+static int test_helper_property_log_fd = -1;
+
+/*
+test_helper_property_log_open
+  Creates an empty TEST_HELPER_PROPERTY_LOG for appending.
+*/
+static bool
+test_helper_property_log_open
+(
+    void
+)
+{
+    test_helper_property_log_fd = open(TEST_HELPER_PROPERTY_LOG,
+                                       O_WRONLY | O_CREAT | O_TRUNC | O_APPEND,
+                                       0600);
+
+    return (test_helper_property_log_fd >= 0);
+}
+
+/*
+test_helper_property_log_close
+  Closes and removes TEST_HELPER_PROPERTY_LOG and returns its size in bytes.
+*/
+static size_t
+test_helper_property_log_close
+(
+    void
+)
+{
+    struct stat info;
+    size_t      size;
+
+    size = 0;
+
+    if ( (test_helper_property_log_fd >= 0) &&
+         (fstat(test_helper_property_log_fd, &info) == 0) )
+    {
+        size = (size_t)info.st_size;
+    }
+
+    if (test_helper_property_log_fd >= 0)
+    {
+        close(test_helper_property_log_fd);
+    }
+
+    test_helper_property_log_fd = -1;
+    remove(TEST_HELPER_PROPERTY_LOG);
+
+    return size;
+}
+
+/*
+test_helper_property_below_100_logged
+  Property: the input int is below 100.  Each process that evaluates it logs
+its pid once.
+*/
+static bool
+test_helper_property_below_100_logged
+(
+    const void* _input,
+    void*       _context
+)
+{
+    static pid_t logged = 0;
+
+    (void)_context;
+
+    if (logged != getpid())
+    {
+        logged = getpid();
+
+        if (write(test_helper_property_log_fd, &logged, sizeof(logged)) < 0)
+        {
+            logged = 0;
+        }
+    }
+
+    return *(const int*)_input < 100;
+}
+
+/*
+test_helper_property_nonzero_logged
+  Property: the input int is not 0.  Logs one byte per evaluation and spins
+briefly, so the runner can react between evaluations.
+*/
+static bool
+test_helper_property_nonzero_logged
+(
+    const void* _input,
+    void*       _context
+)
+{
+    volatile size_t spin;
+
+    (void)_context;
+
+    for (spin = 0; spin < 20000; spin++)
+    {
+    }
+
+    if (write(test_helper_property_log_fd, "x", 1) < 0)
+    {
+        return true;
+    }
+
+    return *(const int*)_input != 0;
+}
+
+/*
+test_helper_property_hang_from_500
+  Property: blocks forever on any input of 500 or more.
+*/
+static bool
+test_helper_property_hang_from_500
+(
+    const void* _input,
+    void*       _context
+)
+{
+    (void)_context;
+
+    // blocking rather than spinning leaves the other workers their CPU
+    while (*(const int*)_input >= 500)
+    {
+        pause();
+    }
+
+    return true;
+}
+
+/*
+test_helper_property_crash_from_500
+  Property: aborts the process on any input of 500 or more.
+*/
+static bool
+test_helper_property_crash_from_500
+(
+    const void* _input,
+    void*       _context
+)
+{
+    (void)_context;
+
+    if (*(const int*)_input >= 500)
+    {
+        abort();
+    }
+
+    return true;
+}
+#endif
+
+
+/******************************************************************************
+ * IX. PROPERTY TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_common_property_prng
+  Tests d_test_prng_seed, d_test_prng_next and d_test_prng_below.
+  Tests the following:
+  - the same seed yields the same sequence
+  - a different seed yields a different sequence
+  - d_test_prng_below stays below its bound
+*/
+bool
+d_tests_sa_test_common_property_prng
+(
+    struct d_test_counter* _counter
+)
+{
+    bool               result;
+    bool               same;
+    bool               differs;
+    bool               bounded;
+    size_t             i;
+    struct d_test_prng first;
+    struct d_test_prng second;
+    struct d_test_prng other;
+
+    result  = true;
+    same    = true;
+    differs = false;
+    bounded = true;
+
+    d_test_prng_seed(&first, 42);
+    d_test_prng_seed(&second, 42);
+    d_test_prng_seed(&other, 43);
+
+    for (i = 0; i < 64; i++)
+    {
+        uint64_t value;
+
+        value   = d_test_prng_next(&first);
+        same    = (value == d_test_prng_next(&second)) && same;
+        differs = (value != d_test_prng_next(&other)) || differs;
+    }
+
+    // test 1: the same seed yields the same sequence
+    result = d_assert_standalone(
+        same,
+        "prng_deterministic",
+        "two generators with the same seed should agree",
+        _counter) && result;
+
+    // test 2: a different seed yields a different sequence
+    result = d_assert_standalone(
+        differs,
+        "prng_seed_matters",
+        "generators with different seeds should diverge",
+        _counter) && result;
+
+    // test 3: bounded draws stay below the bound
+    for (i = 0; i < 1000; i++)
+    {
+        bounded = (d_test_prng_below(&first, 7) < 7) && bounded;
+    }
+
+    result = d_assert_standalone(
+        (bounded) &&
+        (d_test_prng_below(&first, 1) == 0),
+        "prng_below_bound",
+        "d_test_prng_below should return values below its bound",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_gen_bounds
+  Tests that generated inputs respect their generator's bounds.
+  Tests the following:
+  - D_TEST_GEN_INT values lie in [min, max]
+  - D_TEST_GEN_BYTES lengths lie in [min, max]
+  - D_TEST_GEN_STRING lengths lie in [min, max] and use only the alphabet
+  - D_TEST_GEN_STRUCT members respect their field generators
+*/
+bool
+d_tests_sa_test_common_property_gen_bounds
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    size_t seen;
+
+    result = true;
+    seen   = 0;
+
+    // test 1: ints stay within [min, max]
+    result = d_assert_standalone(
+        (test_helper_property_check(test_helper_property_int_in_range,
+                                    &test_helper_property_int_gen,
+                                    &seen,
+                                    1)) &&
+        (seen == D_TEST_PROPERTY_DEFAULT_CASES),
+        "gen_int_bounds",
+        "every generated int should lie within the generator's range",
+        _counter) && result;
+
+    // test 2: byte buffers stay within the length range
+    result = d_assert_standalone(
+        test_helper_property_check(test_helper_property_bytes_in_range,
+                                   &test_helper_property_bytes_gen,
+                                   NULL,
+                                   1),
+        "gen_bytes_bounds",
+        "every generated buffer length should lie within the range",
+        _counter) && result;
+
+    // test 3: strings stay within the length range and the alphabet
+    result = d_assert_standalone(
+        test_helper_property_check(test_helper_property_string_in_range,
+                                   &test_helper_property_string_gen,
+                                   NULL,
+                                   1),
+        "gen_string_bounds",
+        "every generated string should fit the length range and alphabet",
+        _counter) && result;
+
+    // test 4: struct members follow their field generators
+    result = d_assert_standalone(
+        test_helper_property_check(test_helper_property_pair_in_range,
+                                   &test_helper_property_pair_gen,
+                                   NULL,
+                                   1),
+        "gen_struct_bounds",
+        "every generated struct member should respect its field generator",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_shrink
+  Tests that a falsified property shrinks to its minimal counterexample.
+  Tests the following:
+  - `x < 100` over [0, 1000] is falsified
+  - the counterexample shrinks to exactly 100
+*/
+bool
+d_tests_sa_test_common_property_shrink
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    bool                    passed;
+    struct d_test_property* property;
+    const int*              value;
+
+    result   = true;
+    property = d_test_property_new(test_helper_property_below_100,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if (!property)
+    {
+        return d_assert_standalone(false,
+                                   "shrink_created",
+                                   "d_test_property_new should succeed",
+                                   _counter);
+    }
+
+    passed = d_test_property_run(property);
+    value  = (const int*)d_test_property_counterexample(property);
+
+    // test 1: the property is falsified
+    result = d_assert_standalone(
+        (!passed) &&
+        (property->falsified),
+        "shrink_falsified",
+        "`x < 100` over [0, 1000] should be falsified",
+        _counter) && result;
+
+    // test 2: the counterexample is the smallest failing input
+    result = d_assert_standalone(
+        (value != NULL) &&
+        (*value == 100),
+        "shrink_minimum",
+        "the counterexample should shrink to 100",
+        _counter) && result;
+
+    d_test_property_free(property);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_workers
+  Tests that the worker count does not change a run's result.
+  Tests the following:
+  - workers = 1 and workers = 4 report the same failing case
+  - both report the same counterexample
+*/
+bool
+d_tests_sa_test_common_property_workers
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_property* single;
+    struct d_test_property* parallel;
+    const int*              single_value;
+    const int*              parallel_value;
+
+    result   = true;
+    single   = d_test_property_new(test_helper_property_below_100,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+    parallel = d_test_property_new(test_helper_property_below_100,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if ( (!single) ||
+         (!parallel) )
+    {
+        d_test_property_free(single);
+        d_test_property_free(parallel);
+
+        return d_assert_standalone(false,
+                                   "workers_created",
+                                   "d_test_property_new should succeed",
+                                   _counter);
+    }
+
+    single->workers   = 1;
+    parallel->workers = 4;
+
+    d_test_property_run(single);
+    d_test_property_run(parallel);
+
+    single_value   = (const int*)d_test_property_counterexample(single);
+    parallel_value = (const int*)d_test_property_counterexample(parallel);
+
+    // test 1: the same case fails first
+    result = d_assert_standalone(
+        (single->falsified)   &&
+        (parallel->falsified) &&
+        (single->failing_case == parallel->failing_case),
+        "workers_same_case",
+        "workers = 1 and workers = 4 should report the same failing case",
+        _counter) && result;
+
+    // test 2: the same counterexample is reported
+    result = d_assert_standalone(
+        (single_value != NULL)   &&
+        (parallel_value != NULL) &&
+        (*single_value == *parallel_value),
+        "workers_same_counterexample",
+        "workers = 1 and workers = 4 should shrink to the same value",
+        _counter) && result;
+
+    d_test_property_free(single);
+    d_test_property_free(parallel);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_describe
+  Tests the failure description of a property run.
+  Tests the following:
+  - a property that was not falsified has no description
+  - a falsified run names its failing case, seed, shrink steps and the
+    shrunk counterexample
+  - a short buffer is truncated but the full length is returned
+*/
+bool
+d_tests_sa_test_common_property_describe
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_property* property;
+    size_t                  length;
+    char                    expected[128];
+    char                    text[128];
+    char                    short_text[8];
+
+    result   = true;
+    property = d_test_property_new(test_helper_property_below_100,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if (!property)
+    {
+        return d_assert_standalone(false,
+                                   "describe_created",
+                                   "d_test_property_new should succeed",
+                                   _counter);
+    }
+
+    // test 1: nothing to describe before a falsified run
+    text[0] = 'x';
+    length  = d_test_property_describe(property, text, sizeof(text));
+
+    result = d_assert_standalone(
+        (length == 0)                                  &&
+        (text[0] == '\0')                              &&
+        (d_test_property_describe(NULL, NULL, 0) == 0),
+        "describe_not_falsified",
+        "a property that was not falsified should have no description",
+        _counter) && result;
+
+    // test 2: the description names the case, seed, steps and value
+    d_test_property_run(property);
+    snprintf(expected,
+             sizeof(expected),
+             "case %zu of seed 0x%016llx failed; shrunk in %zu steps to 100",
+             property->failing_case,
+             (unsigned long long)property->seed,
+             property->shrink_steps);
+
+    length = d_test_property_describe(property, text, sizeof(text));
+
+    result = d_assert_standalone(
+        (property->falsified)         &&
+        (strcmp(text, expected) == 0) &&
+        (length == strlen(expected)),
+        "describe_falsified",
+        "a falsified run should describe its case, seed and counterexample",
+        _counter) && result;
+
+    // test 3: a short buffer is truncated, the full length is returned
+    length = d_test_property_describe(property,
+                                      short_text,
+                                      sizeof(short_text));
+
+    result = d_assert_standalone(
+        (length == strlen(expected))                                 &&
+        (strlen(short_text) == sizeof(short_text) - 1)               &&
+        (strncmp(short_text, expected, sizeof(short_text) - 1) == 0),
+        "describe_truncated",
+        "a short buffer should hold a prefix and the full length be returned",
+        _counter) && result;
+
+    d_test_property_free(property);
+
+    return result;
+}
+
+
+#if ( !defined(_WIN32) && !defined(_WIN64) )
+/*
+d_tests_sa_test_common_property_worker_crash
+  Tests a property that crashes the worker evaluating it.
+  Tests the following:
+  - the run returns in the calling process
+  - the crashing input counts as a failure and shrinks to its minimum
+*/
+bool
+d_tests_sa_test_common_property_worker_crash
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    bool                    passed;
+    struct d_test_property* property;
+    const int*              value;
+
+    result   = true;
+    property = d_test_property_new(test_helper_property_crash_from_500,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if (!property)
+    {
+        return d_assert_standalone(false,
+                                   "crash_created",
+                                   "d_test_property_new should succeed",
+                                   _counter);
+    }
+
+    property->workers = 4;
+    passed            = d_test_property_run(property);
+    value             = (const int*)d_test_property_counterexample(property);
+
+    // test 1: a crashing case falsifies the property
+    result = d_assert_standalone(
+        (!passed) &&
+        (property->falsified),
+        "crash_falsified",
+        "an input that crashes a worker should falsify the property",
+        _counter) && result;
+
+    // test 2: the crash shrinks to the smallest crashing input
+    result = d_assert_standalone(
+        (value != NULL) &&
+        (*value == 500),
+        "crash_minimum",
+        "the crashing counterexample should shrink to 500",
+        _counter) && result;
+
+    d_test_property_free(property);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_worker_timeout
+  Tests a property that never returns in the worker evaluating it.
+  Tests the following:
+  - the run returns once the worker exceeds `timeout_ms`
+  - the hanging input counts as a failure and shrinks to its minimum
+*/
+bool
+d_tests_sa_test_common_property_worker_timeout
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    bool                    passed;
+    struct d_test_property* property;
+    const int*              value;
+
+    result   = true;
+    property = d_test_property_new(test_helper_property_hang_from_500,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if (!property)
+    {
+        return d_assert_standalone(false,
+                                   "timeout_created",
+                                   "d_test_property_new should succeed",
+                                   _counter);
+    }
+
+    property->workers    = 4;
+    property->timeout_ms = 50;
+    passed               = d_test_property_run(property);
+    value                = (const int*)d_test_property_counterexample(property);
+
+    // test 1: a hanging case falsifies the property
+    result = d_assert_standalone(
+        (!passed) &&
+        (property->falsified),
+        "timeout_falsified",
+        "an input a worker hangs on should falsify the property",
+        _counter) && result;
+
+    // test 2: the hang shrinks to the smallest hanging input
+    result = d_assert_standalone(
+        (value != NULL) &&
+        (*value == 500),
+        "timeout_minimum",
+        "the hanging counterexample should shrink to 500",
+        _counter) && result;
+
+    d_test_property_free(property);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_worker_reuse
+  Tests that one run keeps its worker processes across searches.
+  Tests the following:
+  - the run is falsified and shrunk over several rounds
+  - no more processes evaluate the property than there are workers
+*/
+bool
+d_tests_sa_test_common_property_worker_reuse
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_property* property;
+    size_t                  processes;
+
+    result   = true;
+    property = d_test_property_new(test_helper_property_below_100_logged,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if ( (!property) ||
+         (!test_helper_property_log_open()) )
+    {
+        d_test_property_free(property);
+
+        return d_assert_standalone(false,
+                                   "reuse_created",
+                                   "the property and its log should be created",
+                                   _counter);
+    }
+
+    property->workers = 4;
+
+    d_test_property_run(property);
+
+    processes = test_helper_property_log_close() / sizeof(pid_t);
+
+    // test 1: the run shrinks over several searches
+    result = d_assert_standalone(
+        (property->falsified) &&
+        (property->shrink_steps > 1),
+        "reuse_shrunk",
+        "the run should be falsified and shrunk over several rounds",
+        _counter) && result;
+
+    // test 2: every search is served by the same workers
+    result = d_assert_standalone(
+        (processes >= 1) &&
+        (processes <= 4),
+        "reuse_processes",
+        "no more processes than workers should evaluate the property",
+        _counter) && result;
+
+    d_test_property_free(property);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_common_property_worker_cancel
+  Tests that workers stop once a lower failing case is known.
+  Tests the following:
+  - workers = 4 finds the case a single in-process scan finds
+  - the workers check few cases past it, rather than each running on to its
+    own first failure
+*/
+bool
+d_tests_sa_test_common_property_worker_cancel
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_property* single;
+    struct d_test_property* parallel;
+    size_t                  checked;
+
+    result   = true;
+    single   = d_test_property_new(test_helper_property_nonzero_logged,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+    parallel = d_test_property_new(test_helper_property_nonzero_logged,
+                                   &test_helper_property_wide_gen,
+                                   NULL);
+
+    if ( (!single)   ||
+         (!parallel) ||
+         (!test_helper_property_log_open()) )
+    {
+        d_test_property_free(single);
+        d_test_property_free(parallel);
+
+        return d_assert_standalone(false,
+                                   "cancel_created",
+                                   "the properties and the log should be created",
+                                   _counter);
+    }
+
+    // only the case search is measured
+    single->case_count    = 5000;
+    single->max_shrinks   = 0;
+    parallel->case_count  = 5000;
+    parallel->max_shrinks = 0;
+    parallel->workers     = 4;
+
+    d_test_property_run(single);
+    test_helper_property_log_close();
+
+    checked = 0;
+
+    if (test_helper_property_log_open())
+    {
+        d_test_property_run(parallel);
+        checked = test_helper_property_log_close();
+    }
+
+    // test 1: the same case is found
+    result = d_assert_standalone(
+        (single->falsified)   &&
+        (parallel->falsified) &&
+        (single->failing_case == parallel->failing_case),
+        "cancel_same_case",
+        "workers = 4 should find the case a single scan finds",
+        _counter) && result;
+
+    // test 2: the scan stops near the failing case
+    result = d_assert_standalone(
+        (checked > parallel->failing_case) &&
+        (checked <= parallel->failing_case + 1 +
+                        (parallel->failing_case / 4)),
+        "cancel_stops",
+        "workers should stop checking cases past the first failure",
+        _counter) && result;
+
+    d_test_property_free(single);
+    d_test_property_free(parallel);
+
+    return result;
+}
+#endif
+
+
+/*
+d_tests_sa_test_common_property_all
+  Aggregation function that runs all property tests.
+*/
+bool
+d_tests_sa_test_common_property_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Property\n");
+    printf("  ------------------\n");
+
+    result = d_tests_sa_test_common_property_prng(_counter) && result;
+    result = d_tests_sa_test_common_property_gen_bounds(_counter) && result;
+    result = d_tests_sa_test_common_property_shrink(_counter) && result;
+    result = d_tests_sa_test_common_property_workers(_counter) && result;
+    result = d_tests_sa_test_common_property_describe(_counter) && result;
+
+#if ( !defined(_WIN32) && !defined(_WIN64) )
+    result = d_tests_sa_test_common_property_worker_crash(_counter) && result;
+    result = d_tests_sa_test_common_property_worker_timeout(_counter) && result;
+    result = d_tests_sa_test_common_property_worker_reuse(_counter) && result;
+    result = d_tests_sa_test_common_property_worker_cancel(_counter) && result;
+#endif
+
+    return result;
+}
@@ -0,0 +1,30 @@
+#include ".\test_config_tests_sa.h"
+
+
+/*
+d_tests_sa_test_config_run_all
+  Module-level aggregation function that runs all test_config tests.
+  Executes tests for all categories:
+  - Sharing (preset cache, copy-on-write, unshare, reference counting)
+  - Registry lookup (direct-index tables, kind separation, fallback scan)
+  - Snapshots (resolve, inherited resolution)
+  - Slots (key bitmask, copies, stage hooks)
+*/
+bool
+d_tests_sa_test_config_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_test_config_sharing_all(_counter) && result;
+    result = d_tests_sa_test_config_registry_all(_counter) && result;
+    result = d_tests_sa_test_config_snapshot_all(_counter) && result;
+    result = d_tests_sa_test_config_slots_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,95 @@
+/******************************************************************************
+* djinterp [test]                                         test_config_tests_sa.h
+*
+*   Unit test declarations for `test_config.h` module.
+*   Covers reference-counted, copy-on-write configs: writes through a shared
+* copy, d_test_config_unshare, reference counting in d_test_config_free, and
+* the shared preset cache of d_test_config_new_preset.  Also covers the
+* registry's flag lookups (test_cvar.h): the direct-index tables built at
+* init, config/metadata kind separation and the fallback scan, and the
+* resolved snapshots nodes run with (d_test_config_resolve and
+* d_test_config_resolve_inherited), and the fixed key and stage-hook slots
+* behind the `present` bitmask.
+*   test_config.h reaches test_stats.h, whose `struct d_test_counter` clashes
+* with the standalone one used here, so only the test files include it, and
+* this header does not.
+*
+*
+* path:      \tests\test\test_config_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_TEST_CONFIG_SA_
+#define DJINTERP_TESTS_TEST_CONFIG_SA_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "..\..\inc\test\test_standalone.h"
+#include "..\..\inc\string_fn.h"
+
+
+/******************************************************************************
+ * I. SHARING TESTS
+ *****************************************************************************/
+// d_test_config_new_preset shared cache and its overflow
+bool d_tests_sa_test_config_preset_cache(struct d_test_counter* _counter);
+// d_test_config_new_copy and writes through either holder
+bool d_tests_sa_test_config_copy_on_write(struct d_test_counter* _counter);
+// d_test_config_unshare
+bool d_tests_sa_test_config_unshare(struct d_test_counter* _counter);
+// d_test_config_free reference counting
+bool d_tests_sa_test_config_free_refcount(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_test_config_sharing_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. REGISTRY LOOKUP TESTS
+ *****************************************************************************/
+// d_test_registry_find, _find_by_flag, _find_config, _find_metadata per row
+bool d_tests_sa_test_config_registry_rows(struct d_test_counter* _counter);
+// config and metadata flags sharing one numeric space
+bool d_tests_sa_test_config_registry_kinds(struct d_test_counter* _counter);
+// flags beyond the direct-index tables
+bool d_tests_sa_test_config_registry_fallback(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_test_config_registry_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. SNAPSHOT TESTS
+ *****************************************************************************/
+// d_test_config_resolve defaults and overrides
+bool d_tests_sa_test_config_snapshot_resolve(struct d_test_counter* _counter);
+// d_test_config_resolve_inherited parent precedence and sharing
+bool d_tests_sa_test_config_snapshot_inherited(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_test_config_snapshot_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * IV. SLOT TESTS
+ *****************************************************************************/
+// DTestConfigKey slots and the `present` bitmask
+bool d_tests_sa_test_config_slots_present(struct d_test_counter* _counter);
+// slots and hooks through d_test_config_new_copy
+bool d_tests_sa_test_config_slots_copy(struct d_test_counter* _counter);
+// per-stage hook slots
+bool d_tests_sa_test_config_slots_stage_hooks(struct d_test_counter* _counter);
+
+// IV.  aggregation function
+bool d_tests_sa_test_config_slots_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_test_config_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_TEST_CONFIG_SA_
@@ -0,0 +1,314 @@
+#include ".\test_config_tests_sa.h"
+#include <stdio.h>
+
+// test_stats.h (reached through test_cvar.h) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\test_cvar.h"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR REGISTRY LOOKUP TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_REGISTRY_FLAG_CAPACITY
+//   constant: flags covered by the registry's direct-index tables
+// (D_INTERNAL_TEST_REGISTRY_FLAG_CAPACITY in test_cvar.c); larger flags take
+// the fallback scan.
+#define TEST_HELPER_REGISTRY_FLAG_CAPACITY 64
+
+/*
+test_helper_registry_scan
+  Reference lookup: returns the first registry row, in table order, with flag
+`_flag` that carries `_kind` (0 = any kind), or NULL.
+*/
+static struct d_test_registry_row*
+test_helper_registry_scan
+(
+    uint32_t _flag,
+    uint16_t _kind
+)
+{
+    struct d_registry*          registry;
+    struct d_test_registry_row* rows;
+    size_t                      i;
+
+    registry = d_test_registry_registry();
+    rows     = (struct d_test_registry_row*)registry->rows;
+
+    for (i = 0; i < registry->count; i++)
+    {
+        if ( (rows[i].flag == _flag) &&
+             ( (!_kind) ||
+               ((rows[i].command_flags & _kind) != 0) ) )
+        {
+            return &rows[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+test_helper_registry_agrees
+  Returns true if every flag lookup for `_flag` finds the row the reference
+scan finds.
+*/
+static bool
+test_helper_registry_agrees
+(
+    uint32_t _flag
+)
+{
+    return (d_test_registry_find_by_flag(_flag) ==
+                test_helper_registry_scan(_flag, 0))                          &&
+           (d_test_registry_find_config(_flag) ==
+                test_helper_registry_scan(_flag,
+                                          D_TEST_REGISTRY_FLAG_IS_CONFIG))    &&
+           (d_test_registry_find_metadata(_flag) ==
+                test_helper_registry_scan(_flag,
+                                          D_TEST_REGISTRY_FLAG_IS_METADATA));
+}
+
+
+/******************************************************************************
+ * II. REGISTRY LOOKUP TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_config_registry_rows
+  Tests the direct-index tables built by d_test_registry_init against every
+registry row.
+  Tests the following:
+  - every row is found by key
+  - every row's flag resolves, for each kind, to the first row of that kind
+    in table order
+  - config and metadata rows are found by their own kind's lookup
+*/
+bool
+d_tests_sa_test_config_registry_rows
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    bool                        by_key;
+    bool                        by_flag;
+    bool                        by_kind;
+    size_t                      i;
+    struct d_registry*          registry;
+    struct d_test_registry_row* rows;
+    struct d_test_registry_row* found;
+
+    result = true;
+
+    d_test_registry_init();
+
+    registry = d_test_registry_registry();
+    rows     = (struct d_test_registry_row*)registry->rows;
+    by_key   = (registry->count > 0);
+    by_flag  = by_key;
+    by_kind  = by_key;
+
+    for (i = 0; i < registry->count; i++)
+    {
+        by_key  = (d_test_registry_find(rows[i].key) == &rows[i]) && by_key;
+        by_flag = test_helper_registry_agrees(rows[i].flag) && by_flag;
+
+        if (rows[i].command_flags & D_TEST_REGISTRY_FLAG_IS_CONFIG)
+        {
+            found   = d_test_registry_find_config(rows[i].flag);
+            by_kind = (found != NULL) &&
+                      ((found->command_flags &
+                        D_TEST_REGISTRY_FLAG_IS_CONFIG) != 0) &&
+                      by_kind;
+        }
+
+        if (rows[i].command_flags & D_TEST_REGISTRY_FLAG_IS_METADATA)
+        {
+            found   = d_test_registry_find_metadata(rows[i].flag);
+            by_kind = (found != NULL) &&
+                      ((found->command_flags &
+                        D_TEST_REGISTRY_FLAG_IS_METADATA) != 0) &&
+                      by_kind;
+        }
+    }
+
+    // test 1: every row is found by key
+    result = d_assert_standalone(
+        by_key,
+        "registry_rows_by_key",
+        "every registry row should be found by its key",
+        _counter) && result;
+
+    // test 2: every flag resolves to the first row in table order
+    result = d_assert_standalone(
+        by_flag,
+        "registry_rows_by_flag",
+        "every flag lookup should match a table-order scan",
+        _counter) && result;
+
+    // test 3: each kind's lookup returns a row of that kind
+    result = d_assert_standalone(
+        by_kind,
+        "registry_rows_by_kind",
+        "config and metadata lookups should return rows of their kind",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_registry_kinds
+  Tests that config and metadata flags, which share one numeric space, are
+looked up separately.
+  Tests the following:
+  - some flag value is used by both a config row and a metadata row
+  - for such flags the config and metadata lookups return different rows
+  - every flag the tables cover, used or not, matches the reference scan
+*/
+bool
+d_tests_sa_test_config_registry_kinds
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    bool                        separated;
+    bool                        agrees;
+    size_t                      shared;
+    uint32_t                    flag;
+    struct d_test_registry_row* config;
+    struct d_test_registry_row* metadata;
+
+    result    = true;
+    separated = true;
+    agrees    = true;
+    shared    = 0;
+
+    for (flag = 0; flag < TEST_HELPER_REGISTRY_FLAG_CAPACITY; flag++)
+    {
+        config   = d_test_registry_find_config(flag);
+        metadata = d_test_registry_find_metadata(flag);
+        agrees   = test_helper_registry_agrees(flag) && agrees;
+
+        if ( (config) &&
+             (metadata) )
+        {
+            shared++;
+            separated = (config != metadata) && separated;
+        }
+    }
+
+    // test 1: the numeric spaces overlap
+    result = d_assert_standalone(
+        shared > 0,
+        "registry_kinds_overlap",
+        "some flag value should name both a config and a metadata row",
+        _counter) && result;
+
+    // test 2: overlapping flags resolve per kind
+    result = d_assert_standalone(
+        separated,
+        "registry_kinds_separated",
+        "a shared flag should resolve to different config and metadata rows",
+        _counter) && result;
+
+    // test 3: every covered flag matches the reference scan
+    result = d_assert_standalone(
+        agrees,
+        "registry_kinds_covered",
+        "every flag in the tables should match a table-order scan",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_registry_fallback
+  Tests flags beyond the direct-index tables.
+  Tests the following:
+  - lookups of flags past the tables match the reference scan
+  - no value can be set for, or read from, a flag without a row
+*/
+bool
+d_tests_sa_test_config_registry_fallback
+(
+    struct d_test_counter* _counter
+)
+{
+    bool               result;
+    bool               agrees;
+    size_t             i;
+    union d_test_value value;
+    const uint32_t     flags[] =
+    {
+        TEST_HELPER_REGISTRY_FLAG_CAPACITY,
+        TEST_HELPER_REGISTRY_FLAG_CAPACITY + 1,
+        1000u,
+        UINT32_MAX
+    };
+
+    result = true;
+    agrees = true;
+
+    for (i = 0; i < (sizeof(flags) / sizeof(flags[0])); i++)
+    {
+        agrees = test_helper_registry_agrees(flags[i]) && agrees;
+    }
+
+    // test 1: fallback lookups match the reference scan
+    result = d_assert_standalone(
+        agrees,
+        "registry_fallback_scan",
+        "flags past the tables should be found by the fallback scan",
+        _counter) && result;
+
+    // test 2: flags without a row hold no value
+    value.ptr = &result;
+
+    result = d_assert_standalone(
+        (!d_test_registry_set(UINT32_MAX, value)) &&
+        (d_test_registry_get(UINT32_MAX).ptr == NULL),
+        "registry_fallback_no_row",
+        "a flag without a row should not be settable or readable",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_registry_all
+  Aggregation function that runs all registry lookup tests.
+*/
+bool
+d_tests_sa_test_config_registry_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Registry Lookup\n");
+    printf("  -------------------------\n");
+
+    result = d_tests_sa_test_config_registry_rows(_counter) && result;
+    result = d_tests_sa_test_config_registry_kinds(_counter) && result;
+    result = d_tests_sa_test_config_registry_fallback(_counter) && result;
+
+    return result;
+}
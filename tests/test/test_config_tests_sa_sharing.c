@@ -0,0 +1,449 @@
+#include ".\test_config_tests_sa.h"
+#include <stdio.h>
+
+// test_stats.h (reached through test_config.h) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\test_config.h"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR SHARING TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_CONFIG_PRESET_CAPACITY
+//   constant: presets d_test_config_new_preset shares before handing out
+// private configs (D_INTERNAL_TEST_CONFIG_PRESET_CAPACITY in test_config.c).
+#define TEST_HELPER_CONFIG_PRESET_CAPACITY 8
+
+// TEST_HELPER_CONFIG_PRESETS
+//   constant: distinct presets requested by the cache test; enough to
+// overflow the cache.
+#define TEST_HELPER_CONFIG_PRESETS (TEST_HELPER_CONFIG_PRESET_CAPACITY + 4)
+
+// TEST_HELPER_CONFIG_PRESET_BASE
+//   constant: message flags of the first preset requested by the cache test;
+// chosen so no other code asks for the same presets.
+#define TEST_HELPER_CONFIG_PRESET_BASE 0x40000000u
+
+/*
+test_helper_config_timeout
+  Returns a config's D_TEST_CONFIG_TIMEOUT_MS override, or 0 if it has none.
+*/
+static size_t
+test_helper_config_timeout
+(
+    const struct d_test_config* _config
+)
+{
+    if (!(_config->present & (1u << D_TEST_CONFIG_TIMEOUT_MS)))
+    {
+        return 0;
+    }
+
+    return (size_t)(uintptr_t)_config->values[D_TEST_CONFIG_TIMEOUT_MS];
+}
+
+/*
+test_helper_config_new_timeout
+  Returns a new private config with a D_TEST_CONFIG_TIMEOUT_MS override.
+*/
+static struct d_test_config*
+test_helper_config_new_timeout
+(
+    size_t _timeout
+)
+{
+    struct d_test_config* config;
+
+    config = d_test_config_new(D_TEST_CONFIG_PRESET_NORMAL);
+
+    if ( (config) &&
+         (!d_test_config_set_size_t(&config,
+                                    D_TEST_CONFIG_TIMEOUT_MS,
+                                    _timeout)) )
+    {
+        d_test_config_free(config);
+
+        return NULL;
+    }
+
+    return config;
+}
+
+
+/******************************************************************************
+ * I. SHARING TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_config_preset_cache
+  Tests the shared preset cache of d_test_config_new_preset.  Must be the
+first test in its process to request presets, so the cache starts empty.
+  Tests the following:
+  - the first 8 distinct presets are each shared by every request
+  - presets past the cache are private configs, new on every request
+  - a shared preset keeps the requested message flags
+  - a write through a preset reference leaves the cached preset unchanged
+*/
+bool
+d_tests_sa_test_config_preset_cache
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  shared;
+    bool                  private_after;
+    bool                  written;
+    size_t                i;
+    uint32_t              flags;
+    struct d_test_config* first[TEST_HELPER_CONFIG_PRESETS];
+    struct d_test_config* second[TEST_HELPER_CONFIG_PRESETS];
+    struct d_test_config* writer;
+    struct d_test_config* again;
+
+    result        = true;
+    shared        = true;
+    private_after = true;
+
+    for (i = 0; i < TEST_HELPER_CONFIG_PRESETS; i++)
+    {
+        flags     = TEST_HELPER_CONFIG_PRESET_BASE | (uint32_t)i;
+        first[i]  = d_test_config_new_preset(flags);
+        second[i] = d_test_config_new_preset(flags);
+
+        if (i < TEST_HELPER_CONFIG_PRESET_CAPACITY)
+        {
+            // the cache holds one reference of its own
+            shared = (first[i]) &&
+                     (first[i] == second[i]) &&
+                     (first[i]->ref_count == 3) &&
+                     (first[i]->flags == flags) &&
+                     shared;
+        }
+        else
+        {
+            private_after = (first[i]) &&
+                            (second[i]) &&
+                            (first[i] != second[i]) &&
+                            (first[i]->ref_count == 1) &&
+                            (second[i]->ref_count == 1) &&
+                            (first[i]->flags == flags) &&
+                            private_after;
+        }
+    }
+
+    // test 1: the first presets are shared
+    result = d_assert_standalone(
+        shared,
+        "config_preset_cache_shared",
+        "the first 8 presets should be shared by every request",
+        _counter) && result;
+
+    // test 2: later presets are private
+    result = d_assert_standalone(
+        private_after,
+        "config_preset_cache_overflow",
+        "presets past the cache should be private configs",
+        _counter) && result;
+
+    // test 3: writing through a preset reference leaves the cache alone
+    writer  = d_test_config_new_preset(TEST_HELPER_CONFIG_PRESET_BASE);
+    written = (writer == first[0]) &&
+              (d_test_config_set_size_t(&writer,
+                                        D_TEST_CONFIG_TIMEOUT_MS,
+                                        250));
+    again   = d_test_config_new_preset(TEST_HELPER_CONFIG_PRESET_BASE);
+
+    result = d_assert_standalone(
+        (written) &&
+        (writer != first[0]) &&
+        (test_helper_config_timeout(writer) == 250) &&
+        (test_helper_config_timeout(first[0]) == 0) &&
+        (again == first[0]) &&
+        (first[0]->ref_count == 4),
+        "config_preset_write_private",
+        "a write through a preset should not change the cached preset",
+        _counter) && result;
+
+    // release every reference taken above; the cache keeps its own
+    d_test_config_free(writer);
+    d_test_config_free(again);
+
+    for (i = 0; i < TEST_HELPER_CONFIG_PRESETS; i++)
+    {
+        d_test_config_free(first[i]);
+        d_test_config_free(second[i]);
+    }
+
+    // test 4: the cached presets survive their holders being released
+    result = d_assert_standalone(
+        (first[0]->ref_count == 1) &&
+        (first[TEST_HELPER_CONFIG_PRESET_CAPACITY - 1]->ref_count == 1),
+        "config_preset_cache_keeps_ref",
+        "the cache should keep one reference to each preset",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_copy_on_write
+  Tests writes through configs shared by d_test_config_new_copy.
+  Tests the following:
+  - a copy is the same object with its reference count raised
+  - a write through the copy does not affect the original holder
+  - a write through the original does not affect the copy
+  - a copy of NULL is NULL
+*/
+bool
+d_tests_sa_test_config_copy_on_write
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_test_config* original;
+    struct d_test_config* copy;
+    struct d_test_config* shared;
+
+    result   = true;
+    original = test_helper_config_new_timeout(100);
+    copy     = d_test_config_new_copy(original);
+
+    // test 1: a copy shares the original
+    result = d_assert_standalone(
+        (original) &&
+        (copy == original) &&
+        (original->ref_count == 2),
+        "config_copy_shares",
+        "d_test_config_new_copy should share the config",
+        _counter) && result;
+
+    if (!original)
+    {
+        return result;
+    }
+
+    // test 2: a write through the copy leaves the original alone
+    shared = copy;
+
+    result = d_assert_standalone(
+        (d_test_config_set_size_t(&copy, D_TEST_CONFIG_TIMEOUT_MS, 200)) &&
+        (copy != shared) &&
+        (test_helper_config_timeout(copy) == 200) &&
+        (test_helper_config_timeout(original) == 100) &&
+        (original->ref_count == 1) &&
+        (copy->ref_count == 1),
+        "config_copy_write_through_copy",
+        "a write through a shared copy should not affect the other holder",
+        _counter) && result;
+
+    d_test_config_free(copy);
+
+    // test 3: a write through the original leaves the copy alone
+    copy   = d_test_config_new_copy(original);
+    shared = original;
+
+    result = d_assert_standalone(
+        (d_test_config_set_bool(&original, D_TEST_CONFIG_SKIP, true)) &&
+        (original != shared) &&
+        (copy == shared) &&
+        (original->present & (1u << D_TEST_CONFIG_SKIP)) &&
+        (!(copy->present & (1u << D_TEST_CONFIG_SKIP))) &&
+        (test_helper_config_timeout(original) == 100) &&
+        (test_helper_config_timeout(copy) == 100),
+        "config_copy_write_through_original",
+        "a write through the original should not affect a shared copy",
+        _counter) && result;
+
+    d_test_config_free(copy);
+    d_test_config_free(original);
+
+    // test 4: a copy of NULL is NULL
+    result = d_assert_standalone(
+        d_test_config_new_copy(NULL) == NULL,
+        "config_copy_null",
+        "d_test_config_new_copy(NULL) should return NULL",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_unshare
+  Tests d_test_config_unshare.
+  Tests the following:
+  - an unshared config is kept in place
+  - a shared config is replaced by a private deep copy
+  - the copy carries every override and stage hook of the original
+  - NULL arguments are rejected
+*/
+bool
+d_tests_sa_test_config_unshare
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_test_config* config;
+    struct d_test_config* other;
+    struct d_test_config* kept;
+
+    result = true;
+    config = test_helper_config_new_timeout(300);
+    kept   = config;
+
+    // test 1: an unshared config is kept in place
+    result = d_assert_standalone(
+        (config) &&
+        (d_test_config_unshare(&config)) &&
+        (config == kept) &&
+        (config->ref_count == 1),
+        "config_unshare_unshared",
+        "unsharing a sole reference should keep the config",
+        _counter) && result;
+
+    if (!config)
+    {
+        return result;
+    }
+
+    // test 2: a shared config is replaced by a private copy
+    other = d_test_config_new_copy(config);
+
+    result = d_assert_standalone(
+        (d_test_config_unshare(&other)) &&
+        (other != config) &&
+        (other->ref_count == 1) &&
+        (config->ref_count == 1),
+        "config_unshare_shared",
+        "unsharing a shared config should give a private copy",
+        _counter) && result;
+
+    // test 3: the copy carries the original's contents
+    result = d_assert_standalone(
+        (other->flags == config->flags) &&
+        (other->present == config->present) &&
+        (test_helper_config_timeout(other) == 300),
+        "config_unshare_contents",
+        "the private copy should carry the original's settings",
+        _counter) && result;
+
+    d_test_config_free(other);
+    d_test_config_free(config);
+
+    // test 4: NULL arguments are rejected
+    config = NULL;
+
+    result = d_assert_standalone(
+        (!d_test_config_unshare(NULL)) &&
+        (!d_test_config_unshare(&config)),
+        "config_unshare_null",
+        "unsharing NULL should fail",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_free_refcount
+  Tests reference counting in d_test_config_free.
+  Tests the following:
+  - each free of a shared config releases one reference
+  - the config stays usable until its last reference is released
+  - the final free releases the config (checked by leak detectors)
+*/
+bool
+d_tests_sa_test_config_free_refcount
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  counted;
+    struct d_test_config* config;
+    struct d_test_config* copy_a;
+    struct d_test_config* copy_b;
+
+    result = true;
+    config = test_helper_config_new_timeout(400);
+    copy_a = d_test_config_new_copy(config);
+    copy_b = d_test_config_new_copy(config);
+
+    counted = (config) &&
+              (config->ref_count == 3);
+
+    // test 1: each free releases one reference
+    if (counted)
+    {
+        d_test_config_free(copy_a);
+        counted = (config->ref_count == 2);
+
+        d_test_config_free(copy_b);
+        counted = (config->ref_count == 1) && counted;
+    }
+
+    result = d_assert_standalone(
+        counted,
+        "config_free_releases_one",
+        "each free of a shared config should release one reference",
+        _counter) && result;
+
+    if (!config)
+    {
+        return result;
+    }
+
+    // test 2: the last holder still sees the config's contents
+    result = d_assert_standalone(
+        test_helper_config_timeout(config) == 400,
+        "config_free_last_holder",
+        "the config should stay intact until its last reference is freed",
+        _counter) && result;
+
+    // final reference: the config itself is freed here
+    d_test_config_free(config);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_sharing_all
+  Aggregation function that runs all sharing tests.
+*/
+bool
+d_tests_sa_test_config_sharing_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Sharing\n");
+    printf("  -----------------\n");
+
+    // the preset cache test needs the cache empty, so it runs first
+    result = d_tests_sa_test_config_preset_cache(_counter) && result;
+    result = d_tests_sa_test_config_copy_on_write(_counter) && result;
+    result = d_tests_sa_test_config_unshare(_counter) && result;
+    result = d_tests_sa_test_config_free_refcount(_counter) && result;
+
+    return result;
+}
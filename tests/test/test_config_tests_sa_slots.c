@@ -0,0 +1,349 @@
+#include ".\test_config_tests_sa.h"
+#include <stdio.h>
+
+// test_stats.h (reached through test_config.h) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\test_config.h"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR SLOT TESTS
+ *****************************************************************************/
+
+/*
+test_helper_slots_hook_a
+  Stage hook stored by the slot tests; never called.
+*/
+static bool
+test_helper_slots_hook_a
+(
+    struct d_test* _test
+)
+{
+    (void)_test;
+
+    return true;
+}
+
+/*
+test_helper_slots_hook_b
+  Second stage hook stored by the slot tests; never called.
+*/
+static bool
+test_helper_slots_hook_b
+(
+    struct d_test* _test
+)
+{
+    (void)_test;
+
+    return false;
+}
+
+
+/******************************************************************************
+ * IV. SLOT TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_config_slots_present
+  Tests the fixed DTestConfigKey slots and their `present` bitmask.
+  Tests the following:
+  - a new config has no slot set
+  - setting a key stores its value in its slot and sets exactly its bit
+  - every key with a config row has its own bit
+  - keys past D_TEST_CONFIG_KEY_COUNT are rejected
+*/
+bool
+d_tests_sa_test_config_slots_present
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  own_bit;
+    uint32_t              key;
+    uint32_t              before;
+    struct d_test_config* config;
+    struct d_test_config* single;
+
+    result = true;
+    config = d_test_config_new(D_TEST_CONFIG_PRESET_NORMAL);
+
+    // test 1: a new config has no slot set
+    result = d_assert_standalone(
+        (config != NULL) &&
+        (config->present == 0),
+        "slots_new_empty",
+        "a new config should have no slot set",
+        _counter) && result;
+
+    if (!config)
+    {
+        return result;
+    }
+
+    // test 2: a write fills its slot and sets exactly its bit
+    result = d_assert_standalone(
+        (d_test_config_set_size_t(&config, D_TEST_CONFIG_MAX_FAILURES, 7)) &&
+        (config->present == (1u << D_TEST_CONFIG_MAX_FAILURES))            &&
+        ((size_t)(uintptr_t)config->values[D_TEST_CONFIG_MAX_FAILURES] == 7) &&
+        (d_test_config_get_size_t(config, D_TEST_CONFIG_MAX_FAILURES) == 7),
+        "slots_set_one",
+        "a write should fill its slot and set only its bit",
+        _counter) && result;
+
+    // test 3: every settable key has its own bit
+    own_bit = true;
+
+    for (key = 0; key < D_TEST_CONFIG_KEY_COUNT; key++)
+    {
+        // keys without a config row (D_TEST_CONFIG_NAME) cannot be set
+        if (!d_test_registry_find_config(key))
+        {
+            continue;
+        }
+
+        single  = d_test_config_new(D_TEST_CONFIG_PRESET_NORMAL);
+        own_bit = (single)                                          &&
+                  (d_test_config_set_ptr(&single, key, &result))    &&
+                  (single->present == (1u << key))                  &&
+                  (single->values[key] == &result)                  &&
+                  own_bit;
+
+        d_test_config_free(single);
+    }
+
+    result = d_assert_standalone(
+        own_bit,
+        "slots_bit_per_key",
+        "every config key should set only its own bit of the mask",
+        _counter) && result;
+
+    // test 4: keys past the slots are rejected
+    before = config->present;
+
+    result = d_assert_standalone(
+        (!d_test_config_set_size_t(&config,
+                                   (uint32_t)D_TEST_CONFIG_KEY_COUNT,
+                                   1)) &&
+        (config->present == before),
+        "slots_out_of_range",
+        "a key past the slots should be rejected",
+        _counter) && result;
+
+    d_test_config_free(config);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_slots_copy
+  Tests that d_test_config_new_copy shares slots and hooks by reference.
+  Tests the following:
+  - reads through a copy see the original's slots and stage hooks
+  - a private copy made on write carries the slots and hooks by value
+*/
+bool
+d_tests_sa_test_config_slots_copy
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_test_config* original;
+    struct d_test_config* copy;
+
+    result   = true;
+    original = d_test_config_new(D_TEST_CONFIG_PRESET_NORMAL);
+
+    if ( (!original) ||
+         (!d_test_config_set_int32(&original, D_TEST_CONFIG_PRIORITY, 4))  ||
+         (!d_test_config_set_stage_hook(&original,
+                                        D_TEST_STAGE_SETUP,
+                                        test_helper_slots_hook_a)) )
+    {
+        d_test_config_free(original);
+
+        return d_assert_standalone(
+            false,
+            "slots_copy_alloc",
+            "config allocation should succeed",
+            _counter) && result;
+    }
+
+    copy = d_test_config_new_copy(original);
+
+    // test 1: reads through the copy see the original's slots
+    result = d_assert_standalone(
+        (copy == original)                                               &&
+        (d_test_config_get_int32(copy, D_TEST_CONFIG_PRIORITY) == 4)     &&
+        (d_test_config_get_stage_hook(copy, D_TEST_STAGE_SETUP) ==
+             test_helper_slots_hook_a),
+        "slots_copy_shared",
+        "a copy should read the original's slots and hooks",
+        _counter) && result;
+
+    // test 2: a private copy carries the slots and hooks
+    result = d_assert_standalone(
+        (d_test_config_set_stage_hook(&copy,
+                                      D_TEST_STAGE_TEAR_DOWN,
+                                      test_helper_slots_hook_b))           &&
+        (copy != original)                                                 &&
+        (copy->present == original->present)                               &&
+        (d_test_config_get_int32(copy, D_TEST_CONFIG_PRIORITY) == 4)       &&
+        (d_test_config_get_stage_hook(copy, D_TEST_STAGE_SETUP) ==
+             test_helper_slots_hook_a)                                     &&
+        (d_test_config_get_stage_hook(original, D_TEST_STAGE_TEAR_DOWN) ==
+             NULL),
+        "slots_copy_private",
+        "a private copy should carry the slots and hooks by value",
+        _counter) && result;
+
+    d_test_config_free(copy);
+    d_test_config_free(original);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_slots_stage_hooks
+  Tests the per-stage hook slots.
+  Tests the following:
+  - a new config has no hooks
+  - each stage holds its own hook
+  - a NULL hook clears its slot
+  - stages past D_TEST_STAGE_COUNT and NULL configs are rejected
+*/
+bool
+d_tests_sa_test_config_slots_stage_hooks
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    bool                  empty;
+    bool                  own_slot;
+    size_t                stage;
+    struct d_test_config* config;
+
+    result = true;
+    config = d_test_config_new(D_TEST_CONFIG_PRESET_NORMAL);
+
+    if (!config)
+    {
+        return d_assert_standalone(
+            false,
+            "slots_hooks_alloc",
+            "config allocation should succeed",
+            _counter) && result;
+    }
+
+    // test 1: a new config has no hooks
+    empty = true;
+
+    for (stage = 0; stage < D_TEST_STAGE_COUNT; stage++)
+    {
+        empty = (d_test_config_get_stage_hook(config,
+                                              (enum DTestStage)stage) == NULL) &&
+                empty;
+    }
+
+    result = d_assert_standalone(
+        empty,
+        "slots_hooks_empty",
+        "a new config should have no stage hooks",
+        _counter) && result;
+
+    // test 2: each stage holds its own hook
+    own_slot = true;
+
+    for (stage = 0; stage < D_TEST_STAGE_COUNT; stage++)
+    {
+        own_slot = (d_test_config_set_stage_hook(&config,
+                                                 (enum DTestStage)stage,
+                                                 (stage % 2)
+                                                     ? test_helper_slots_hook_b
+                                                     : test_helper_slots_hook_a)) &&
+                   own_slot;
+    }
+
+    for (stage = 0; stage < D_TEST_STAGE_COUNT; stage++)
+    {
+        own_slot = (config->stage_hooks[stage] ==
+                        ((stage % 2) ? test_helper_slots_hook_b
+                                     : test_helper_slots_hook_a)) &&
+                   own_slot;
+    }
+
+    result = d_assert_standalone(
+        (own_slot) &&
+        (config->present == 0),
+        "slots_hooks_per_stage",
+        "each stage should hold its own hook, apart from the key slots",
+        _counter) && result;
+
+    // test 3: a NULL hook clears its slot
+    result = d_assert_standalone(
+        (d_test_config_set_stage_hook(&config, D_TEST_STAGE_BEFORE, NULL)) &&
+        (d_test_config_get_stage_hook(config, D_TEST_STAGE_BEFORE) == NULL) &&
+        (d_test_config_get_stage_hook(config, D_TEST_STAGE_AFTER) ==
+             test_helper_slots_hook_b),
+        "slots_hooks_clear",
+        "a NULL hook should clear only its own slot",
+        _counter) && result;
+
+    // test 4: out-of-range stages and NULL configs are rejected
+    result = d_assert_standalone(
+        (!d_test_config_set_stage_hook(&config,
+                                       (enum DTestStage)D_TEST_STAGE_COUNT,
+                                       test_helper_slots_hook_a))           &&
+        (d_test_config_get_stage_hook(config,
+                                      (enum DTestStage)D_TEST_STAGE_COUNT)
+             == NULL)                                                       &&
+        (d_test_config_get_stage_hook(NULL, D_TEST_STAGE_SETUP) == NULL),
+        "slots_hooks_invalid",
+        "out-of-range stages and NULL configs should be rejected",
+        _counter) && result;
+
+    d_test_config_free(config);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_slots_all
+  Aggregation function that runs all slot tests.
+*/
+bool
+d_tests_sa_test_config_slots_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Slots\n");
+    printf("  ---------------\n");
+
+    result = d_tests_sa_test_config_slots_present(_counter) && result;
+    result = d_tests_sa_test_config_slots_copy(_counter) && result;
+    result = d_tests_sa_test_config_slots_stage_hooks(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,234 @@
+#include ".\test_config_tests_sa.h"
+#include <stdio.h>
+
+// test_stats.h (reached through test_config.h) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\test_config.h"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR SNAPSHOT TESTS
+ *****************************************************************************/
+
+/*
+test_helper_snapshot_new_config
+  Returns a new private config that skips, stops after `_max_failures`
+failures and times out after `_timeout` milliseconds, or NULL.
+*/
+static struct d_test_config*
+test_helper_snapshot_new_config
+(
+    size_t _max_failures,
+    size_t _timeout
+)
+{
+    struct d_test_config* config;
+
+    config = d_test_config_new(D_TEST_CONFIG_PRESET_NORMAL);
+
+    if ( (config) &&
+         ( (!d_test_config_set_bool(&config, D_TEST_CONFIG_SKIP, true))   ||
+           (!d_test_config_set_size_t(&config,
+                                      D_TEST_CONFIG_MAX_FAILURES,
+                                      _max_failures))                     ||
+           (!d_test_config_set_size_t(&config,
+                                      D_TEST_CONFIG_TIMEOUT_MS,
+                                      _timeout)) ) )
+    {
+        d_test_config_free(config);
+
+        return NULL;
+    }
+
+    return config;
+}
+
+
+/******************************************************************************
+ * III. SNAPSHOT TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_config_snapshot_resolve
+  Tests d_test_config_resolve.
+  Tests the following:
+  - a NULL config yields the registry defaults
+  - a config's overrides are read into the snapshot
+  - settings the config does not override fall back to the defaults
+*/
+bool
+d_tests_sa_test_config_snapshot_resolve
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                          result;
+    struct d_test_config*         config;
+    struct d_test_resolved_config defaults;
+    struct d_test_resolved_config resolved;
+
+    result = true;
+
+    // test 1: a NULL config yields the registry defaults
+    d_test_config_resolve(&defaults, NULL);
+
+    result = d_assert_standalone(
+        (defaults.source == NULL)                              &&
+        (defaults.timeout_ms == D_TEST_DEFAULT_TIMEOUT)        &&
+        (defaults.max_failures == D_TEST_DEFAULT_MAX_FAILURES) &&
+        (!defaults.skip),
+        "snapshot_resolve_defaults",
+        "a NULL config should resolve to the registry defaults",
+        _counter) && result;
+
+    config = test_helper_snapshot_new_config(3, 250);
+
+    if (!config)
+    {
+        return d_assert_standalone(
+            false,
+            "snapshot_resolve_alloc",
+            "config allocation should succeed",
+            _counter) && result;
+    }
+
+    // test 2: overrides are read into the snapshot
+    d_test_config_resolve(&resolved, config);
+
+    result = d_assert_standalone(
+        (resolved.source == config)   &&
+        (resolved.timeout_ms == 250)  &&
+        (resolved.max_failures == 3)  &&
+        (resolved.skip),
+        "snapshot_resolve_overrides",
+        "a config's overrides should be read into the snapshot",
+        _counter) && result;
+
+    // test 3: settings without an override keep their defaults
+    result = d_assert_standalone(
+        (resolved.priority == defaults.priority)                 &&
+        (resolved.indent_max_level == defaults.indent_max_level) &&
+        (resolved.enabled == defaults.enabled),
+        "snapshot_resolve_fallback",
+        "settings without an override should keep the registry defaults",
+        _counter) && result;
+
+    d_test_config_free(config);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_snapshot_inherited
+  Tests d_test_config_resolve_inherited.
+  Tests the following:
+  - a parent snapshot takes precedence and is shared by pointer
+  - without a parent, the node's own config is resolved into the storage
+  - without either, or without storage, no snapshot is returned
+*/
+bool
+d_tests_sa_test_config_snapshot_inherited
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                                 result;
+    struct d_test_config*                parent_config;
+    struct d_test_config*                own_config;
+    struct d_test_resolved_config        parent;
+    struct d_test_resolved_config        storage;
+    const struct d_test_resolved_config* effective;
+
+    result        = true;
+    parent_config = test_helper_snapshot_new_config(1, 100);
+    own_config    = test_helper_snapshot_new_config(5, 500);
+
+    if ( (!parent_config) ||
+         (!own_config) )
+    {
+        d_test_config_free(parent_config);
+        d_test_config_free(own_config);
+
+        return d_assert_standalone(
+            false,
+            "snapshot_inherited_alloc",
+            "config allocation should succeed",
+            _counter) && result;
+    }
+
+    d_test_config_resolve(&parent, parent_config);
+
+    // test 1: a parent snapshot is shared, not copied or re-resolved
+    storage.timeout_ms = 0;
+    effective          = d_test_config_resolve_inherited(&storage,
+                                                         &parent,
+                                                         own_config);
+
+    result = d_assert_standalone(
+        (effective == &parent)          &&
+        (effective->timeout_ms == 100)  &&
+        (storage.timeout_ms == 0),
+        "snapshot_inherited_parent",
+        "a parent snapshot should take precedence and be shared by pointer",
+        _counter) && result;
+
+    // test 2: without a parent, the own config is resolved into storage
+    effective = d_test_config_resolve_inherited(&storage, NULL, own_config);
+
+    result = d_assert_standalone(
+        (effective == &storage)          &&
+        (storage.source == own_config)   &&
+        (storage.timeout_ms == 500)      &&
+        (storage.max_failures == 5),
+        "snapshot_inherited_own",
+        "without a parent, the node's own config should be resolved",
+        _counter) && result;
+
+    // test 3: nothing to resolve yields no snapshot
+    result = d_assert_standalone(
+        (d_test_config_resolve_inherited(&storage, NULL, NULL) == NULL) &&
+        (d_test_config_resolve_inherited(NULL, NULL, own_config) == NULL),
+        "snapshot_inherited_none",
+        "without a parent and an own config (or storage) no snapshot is used",
+        _counter) && result;
+
+    d_test_config_free(parent_config);
+    d_test_config_free(own_config);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_config_snapshot_all
+  Aggregation function that runs all snapshot tests.
+*/
+bool
+d_tests_sa_test_config_snapshot_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Snapshots\n");
+    printf("  -------------------\n");
+
+    result = d_tests_sa_test_config_snapshot_resolve(_counter) && result;
+    result = d_tests_sa_test_config_snapshot_inherited(_counter) && result;
+
+    return result;
+}
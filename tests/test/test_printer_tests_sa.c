@@ -0,0 +1,26 @@
+#include ".\test_printer_tests_sa.h"
+
+
+/*
+d_tests_sa_test_printer_run_all
+  Module-level aggregation function that runs all test_printer tests.
+  Executes tests for all categories:
+  - File output (prepend order, permissions, failure handling)
+  - Buffers (capacity reuse, render forms, stdout scratch buffer)
+*/
+bool
+d_tests_sa_test_printer_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_test_printer_file_all(_counter) && result;
+    result = d_tests_sa_test_printer_buffer_all(_counter) && result;
+
+    return result;
+}
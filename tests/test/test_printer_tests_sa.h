@@ -0,0 +1,62 @@
+/******************************************************************************
+* djinterp [test]                                        test_printer_tests_sa.h
+*
+*   Unit test declarations for `test_printer.h` module.
+*   Covers file output, in particular prepending through a temporary file:
+* content order, preserved permissions, and leaving the original untouched
+* when the prepend fails.  Also covers the string buffers every layout is
+* rendered through: capacity reuse, the *_to_buffer / *_to_stream forms and
+* the stdout scratch buffer.
+*
+*
+* path:      \tests\test\test_printer_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_TEST_PRINTER_SA_
+#define DJINTERP_TESTS_TEST_PRINTER_SA_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "..\..\inc\test\test_standalone.h"
+#include "..\..\inc\test\test_printer.h"
+#include "..\..\inc\string_fn.h"
+
+
+/******************************************************************************
+ * I. FILE OUTPUT TESTS
+ *****************************************************************************/
+// d_test_prepend_to_file content order
+bool d_tests_sa_test_printer_prepend_order(struct d_test_counter* _counter);
+// d_test_prepend_to_file permission preservation
+bool d_tests_sa_test_printer_prepend_permissions(struct d_test_counter* _counter);
+// d_test_prepend_to_file failure handling
+bool d_tests_sa_test_printer_prepend_failure(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_test_printer_file_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. BUFFER TESTS
+ *****************************************************************************/
+// d_test_string_buffer_init, _clear, _reserve, _flush, _release
+bool d_tests_sa_test_printer_buffer_reuse(struct d_test_counter* _counter);
+// *_to_buffer, *_to_stream and *_to_string agreement
+bool d_tests_sa_test_printer_buffer_render(struct d_test_counter* _counter);
+// d_test_print_scratch_capacity, d_test_print_scratch_release
+bool d_tests_sa_test_printer_buffer_scratch(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_test_printer_buffer_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_test_printer_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_TEST_PRINTER_SA_
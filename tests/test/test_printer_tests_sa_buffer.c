@@ -0,0 +1,320 @@
+#include ".\test_printer_tests_sa.h"
+#include <stdio.h>
+#include <string.h>
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR BUFFER TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_PRINTER_READ_SIZE
+//   constant: largest stream the buffer tests read back.
+#define TEST_HELPER_PRINTER_READ_SIZE 16384
+
+/*
+test_helper_printer_read_back
+  Rewinds `_file` and reads its whole contents into `_text`, terminated.
+*/
+static size_t
+test_helper_printer_read_back
+(
+    FILE*  _file,
+    char*  _text,
+    size_t _size
+)
+{
+    size_t length;
+
+    rewind(_file);
+
+    length        = fread(_text, 1, _size - 1, _file);
+    _text[length] = '\0';
+
+    return length;
+}
+
+
+/******************************************************************************
+ * II. BUFFER TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_printer_buffer_reuse
+  Tests the caller-owned buffer functions.
+  Tests the following:
+  - d_test_string_buffer_init allocates the requested capacity
+  - d_test_string_buffer_clear empties the buffer and keeps its storage
+  - d_test_string_buffer_reserve grows only when the text does not fit
+  - d_test_string_buffer_flush writes the text and keeps the storage
+  - d_test_string_buffer_release frees the storage
+*/
+bool
+d_tests_sa_test_printer_buffer_reuse
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    bool                        flushed;
+    struct d_test_string_buffer buffer;
+    char*                       storage;
+    FILE*                       file;
+    char                        text[64];
+
+    result = true;
+
+    // test 1: init allocates the requested capacity
+    result = d_assert_standalone(
+        (d_test_string_buffer_init(&buffer, 32)) &&
+        (buffer.data != NULL)                    &&
+        (buffer.size == 0)                       &&
+        (buffer.capacity == 32)                  &&
+        (buffer.data[0] == '\0'),
+        "buffer_init",
+        "init should allocate an empty buffer of the requested capacity",
+        _counter) && result;
+
+    if (!buffer.data)
+    {
+        return result;
+    }
+
+    // test 2: clearing keeps the storage for the next render
+    storage = buffer.data;
+
+    d_test_string_buffer_append_format(&buffer, "%s-%d", "render", 1);
+    d_test_string_buffer_clear(&buffer);
+    d_test_string_buffer_append(&buffer, "again");
+
+    result = d_assert_standalone(
+        (buffer.data == storage)             &&
+        (buffer.capacity == 32)              &&
+        (buffer.size == 5)                   &&
+        (strcmp(buffer.data, "again") == 0),
+        "buffer_clear_reuses",
+        "clearing should keep the storage and capacity",
+        _counter) && result;
+
+    // test 3: reserve grows only past the capacity
+    result = d_assert_standalone(
+        (d_test_string_buffer_reserve(&buffer, 26)) &&
+        (buffer.capacity == 32)                      &&
+        (d_test_string_buffer_reserve(&buffer, 27)) &&
+        (buffer.capacity == 64)                      &&
+        (strcmp(buffer.data, "again") == 0),
+        "buffer_reserve_grows",
+        "reserve should grow geometrically only when the text won't fit",
+        _counter) && result;
+
+    // test 4: flushing writes the text and keeps the storage
+    storage = buffer.data;
+    file    = tmpfile();
+    flushed = (file != NULL) && (d_test_string_buffer_flush(&buffer, file));
+
+    if (file)
+    {
+        test_helper_printer_read_back(file, text, sizeof(text));
+        fclose(file);
+    }
+
+    result = d_assert_standalone(
+        (flushed)                          &&
+        (strcmp(text, "again") == 0)       &&
+        (buffer.size == 0)                 &&
+        (buffer.data == storage)           &&
+        (buffer.capacity == 64),
+        "buffer_flush",
+        "flushing should write the text, then empty the buffer in place",
+        _counter) && result;
+
+    // test 5: release frees the storage
+    d_test_string_buffer_release(&buffer);
+
+    result = d_assert_standalone(
+        (buffer.data == NULL) &&
+        (buffer.size == 0)    &&
+        (buffer.capacity == 0),
+        "buffer_release",
+        "release should free the storage and reset the buffer",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_printer_buffer_render
+  Tests that every output form renders the same layout.
+  Tests the following:
+  - *_to_buffer appends to existing text and matches *_to_string
+  - d_test_generate_full_report_to_stream writes what *_to_string returns
+  - rendering into a NULL buffer fails
+*/
+bool
+d_tests_sa_test_printer_buffer_render
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    bool                        rendered;
+    bool                        streamed;
+    struct d_test_string_buffer buffer;
+    struct d_test_counter       counter;
+    char*                       expected;
+    char*                       report;
+    char*                       text;
+    FILE*                       file;
+
+    result = true;
+
+    memset(&counter, 0, sizeof(counter));
+
+    // test 1: a buffer render appends and matches the string form
+    expected = d_test_print_section_header_to_string("Buffer");
+    rendered = (d_test_string_buffer_init(&buffer, 0))            &&
+               (d_test_string_buffer_append(&buffer, "> "))       &&
+               (d_test_print_section_header_to_buffer(&buffer, "Buffer"));
+
+    result = d_assert_standalone(
+        (rendered)                                  &&
+        (expected != NULL)                          &&
+        (strncmp(buffer.data, "> ", 2) == 0)        &&
+        (strcmp(buffer.data + 2, expected) == 0),
+        "render_buffer_matches_string",
+        "a buffer render should append the same text as the string form",
+        _counter) && result;
+
+    free(expected);
+    d_test_string_buffer_release(&buffer);
+
+    // test 2: the streamed report matches the string report
+    report   = d_test_generate_full_report_to_string("dtest",
+                                                     "buffer tests",
+                                                     &counter,
+                                                     false,
+                                                     2,
+                                                     1);
+    text     = malloc(TEST_HELPER_PRINTER_READ_SIZE);
+    file     = tmpfile();
+    streamed = (file != NULL) &&
+               (d_test_generate_full_report_to_stream(file,
+                                                      "dtest",
+                                                      "buffer tests",
+                                                      &counter,
+                                                      false,
+                                                      2,
+                                                      1));
+
+    if ( (file) &&
+         (text) )
+    {
+        test_helper_printer_read_back(file, text, TEST_HELPER_PRINTER_READ_SIZE);
+    }
+
+    result = d_assert_standalone(
+        (streamed)               &&
+        (report != NULL)         &&
+        (text != NULL)           &&
+        (strcmp(text, report) == 0),
+        "render_stream_matches_string",
+        "a streamed report should match the string report",
+        _counter) && result;
+
+    if (file)
+    {
+        fclose(file);
+    }
+
+    free(text);
+    free(report);
+
+    // test 3: a NULL buffer is rejected
+    result = d_assert_standalone(
+        (!d_test_print_section_header_to_buffer(NULL, "Buffer")) &&
+        (!d_test_print_separator_to_buffer(NULL, '-', 10)),
+        "render_null_buffer",
+        "rendering into a NULL buffer should fail",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_printer_buffer_scratch
+  Tests the per-thread scratch buffer behind the stdout printers.
+  Tests the following:
+  - printing allocates the scratch buffer once
+  - further prints reuse it without growing
+  - d_test_print_scratch_release frees it
+*/
+bool
+d_tests_sa_test_printer_buffer_scratch
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    size_t capacity;
+
+    result = true;
+
+    d_test_print_scratch_release();
+
+    // test 1: the first print allocates the scratch buffer
+    d_test_print_separator('-', 10);
+    capacity = d_test_print_scratch_capacity();
+
+    result = d_assert_standalone(
+        capacity > 0,
+        "scratch_allocated",
+        "printing should allocate the scratch buffer",
+        _counter) && result;
+
+    // test 2: later prints of the same size reuse it
+    d_test_print_separator('=', 10);
+    d_test_print_separator('-', 10);
+
+    result = d_assert_standalone(
+        d_test_print_scratch_capacity() == capacity,
+        "scratch_reused",
+        "printing again should reuse the scratch buffer",
+        _counter) && result;
+
+    // test 3: release frees it
+    d_test_print_scratch_release();
+
+    result = d_assert_standalone(
+        d_test_print_scratch_capacity() == 0,
+        "scratch_released",
+        "releasing should free the scratch buffer",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_printer_buffer_all
+  Aggregation function that runs all buffer tests.
+*/
+bool
+d_tests_sa_test_printer_buffer_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Buffers\n");
+    printf("  -----------------\n");
+
+    result = d_tests_sa_test_printer_buffer_reuse(_counter) && result;
+    result = d_tests_sa_test_printer_buffer_render(_counter) && result;
+    result = d_tests_sa_test_printer_buffer_scratch(_counter) && result;
+
+    return result;
+}
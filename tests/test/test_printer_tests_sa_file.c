@@ -0,0 +1,492 @@
+// mkdtemp and the directory functions used below are POSIX.1-2008
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include ".\test_printer_tests_sa.h"
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <dirent.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR FILE OUTPUT TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_PRINTER_PATH_SIZE
+//   constant: buffer size for scratch paths used by the file tests.
+#define TEST_HELPER_PRINTER_PATH_SIZE 512
+
+/*
+test_helper_scratch_dir
+  Creates an empty scratch directory for one test and writes its path to
+`_path`.  Where no private directory can be made the current directory is
+used, so `_path` is left empty.
+*/
+static bool
+test_helper_scratch_dir
+(
+    char*  _path,
+    size_t _size
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)_size;
+
+    _path[0] = '\0';
+
+    return true;
+#else
+    const char* base;
+
+    base = getenv("TMPDIR");
+
+    if ( (!base) ||
+         (!base[0]) )
+    {
+        base = "/tmp";
+    }
+
+    if (snprintf(_path, _size, "%s/d_tests_printer_XXXXXX", base) >= (int)_size)
+    {
+        return false;
+    }
+
+    return (mkdtemp(_path) != NULL);
+#endif
+}
+
+/*
+test_helper_scratch_path
+  Joins a scratch directory and a file name.
+*/
+static void
+test_helper_scratch_path
+(
+    char*       _path,
+    size_t      _size,
+    const char* _dir,
+    const char* _name
+)
+{
+    if (_dir[0])
+    {
+        snprintf(_path, _size, "%s/%s", _dir, _name);
+    }
+    else
+    {
+        snprintf(_path, _size, "%s", _name);
+    }
+}
+
+/*
+test_helper_read_file
+  Reads up to `_size` - 1 bytes of a file into `_buffer` and null-terminates
+it.  Returns false if the file cannot be opened.
+*/
+static bool
+test_helper_read_file
+(
+    const char* _filename,
+    char*       _buffer,
+    size_t      _size
+)
+{
+    FILE*  file;
+    size_t length;
+
+    file = fopen(_filename, "rb");
+
+    if (!file)
+    {
+        return false;
+    }
+
+    length          = fread(_buffer, 1, _size - 1, file);
+    _buffer[length] = '\0';
+
+    fclose(file);
+
+    return true;
+}
+
+/*
+test_helper_write_file
+  Replaces a file's content with `_content`.
+*/
+static bool
+test_helper_write_file
+(
+    const char* _filename,
+    const char* _content
+)
+{
+    FILE*  file;
+    size_t length;
+    bool   written;
+
+    file = fopen(_filename, "wb");
+
+    if (!file)
+    {
+        return false;
+    }
+
+    length  = strlen(_content);
+    written = (fwrite(_content, 1, length, file) == length);
+
+    return (fclose(file) == 0) && written;
+}
+
+/*
+test_helper_scratch_entries
+  Counts the entries (other than "." and "..") of a scratch directory, or
+returns (size_t)-1 when it cannot be listed.
+*/
+static size_t
+test_helper_scratch_entries
+(
+    const char* _dir
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)_dir;
+
+    return (size_t)-1;
+#else
+    DIR*           dir;
+    struct dirent* entry;
+    size_t         count;
+
+    dir = opendir(_dir);
+
+    if (!dir)
+    {
+        return (size_t)-1;
+    }
+
+    count = 0;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if ( (strcmp(entry->d_name, ".") != 0) &&
+             (strcmp(entry->d_name, "..") != 0) )
+        {
+            count++;
+        }
+    }
+
+    closedir(dir);
+
+    return count;
+#endif
+}
+
+/*
+test_helper_scratch_remove
+  Removes a scratch directory created by test_helper_scratch_dir.
+*/
+static void
+test_helper_scratch_remove
+(
+    const char* _dir
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)_dir;
+#else
+    if (_dir[0])
+    {
+        rmdir(_dir);
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * I. FILE OUTPUT TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_printer_prepend_order
+  Tests the content order produced by d_test_prepend_to_file.
+  Tests the following:
+  - prepending to a missing file creates it with the new content
+  - new content is placed before the existing content
+  - repeated prepends stack newest first
+  - prepending to a large file keeps every original byte after the new ones
+  - no temporary file is left beside the original
+*/
+bool
+d_tests_sa_test_printer_prepend_order
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    bool   ok;
+    char   dir[TEST_HELPER_PRINTER_PATH_SIZE];
+    char   path[TEST_HELPER_PRINTER_PATH_SIZE];
+    char   content[256];
+    char*  large;
+    char*  read_back;
+    size_t large_size;
+    size_t i;
+
+    result = true;
+
+    if (!test_helper_scratch_dir(dir, sizeof(dir)))
+    {
+        return d_assert_standalone(false,
+                                   "prepend_scratch_dir",
+                                   "a scratch directory should be creatable",
+                                   _counter);
+    }
+
+    test_helper_scratch_path(path, sizeof(path), dir, "d_tests_prepend.txt");
+    remove(path);
+
+    // test 1: prepending to a missing file creates it
+    ok = d_test_prepend_to_file(path, "first\n") &&
+         test_helper_read_file(path, content, sizeof(content));
+
+    result = d_assert_standalone(
+        (ok) &&
+        (strcmp(content, "first\n") == 0),
+        "prepend_creates_file",
+        "prepending to a missing file should create it with the content",
+        _counter) && result;
+
+    // test 2: new content is placed before the existing content
+    ok = d_test_prepend_to_file(path, "second\n") &&
+         test_helper_read_file(path, content, sizeof(content));
+
+    result = d_assert_standalone(
+        (ok) &&
+        (strcmp(content, "second\nfirst\n") == 0),
+        "prepend_before_existing",
+        "new content should precede the existing content",
+        _counter) && result;
+
+    // test 3: repeated prepends stack newest first
+    ok = d_test_prepend_to_file(path, "third\n") &&
+         d_test_write_to_file_mode(path, "fourth\n", D_TEST_FILE_PREPEND) &&
+         test_helper_read_file(path, content, sizeof(content));
+
+    result = d_assert_standalone(
+        (ok) &&
+        (strcmp(content, "fourth\nthird\nsecond\nfirst\n") == 0),
+        "prepend_stacks",
+        "repeated prepends should stack newest first",
+        _counter) && result;
+
+    // test 4: a file larger than one copy chunk is kept intact
+    large_size = (D_TEST_PRINT_COPY_CHUNK_SIZE * 2) + 17;
+    large      = malloc(large_size + 1);
+    read_back  = malloc(large_size + 16);
+    ok         = (large != NULL) && (read_back != NULL);
+
+    if (ok)
+    {
+        for (i = 0; i < large_size; i++)
+        {
+            large[i] = (char)('a' + (i % 26));
+        }
+
+        large[large_size] = '\0';
+
+        ok = test_helper_write_file(path, large) &&
+             d_test_prepend_to_file(path, "HEAD") &&
+             test_helper_read_file(path, read_back, large_size + 16);
+    }
+
+    result = d_assert_standalone(
+        (ok) &&
+        (strncmp(read_back, "HEAD", 4) == 0) &&
+        (strcmp(read_back + 4, large) == 0),
+        "prepend_large_file",
+        "every byte of a large original should follow the new content",
+        _counter) && result;
+
+    free(large);
+    free(read_back);
+
+    // test 5: no temporary file is left beside the original
+    if (dir[0])
+    {
+        result = d_assert_standalone(
+            test_helper_scratch_entries(dir) == 1,
+            "prepend_no_temp_left",
+            "only the destination file should remain after prepending",
+            _counter) && result;
+    }
+
+    remove(path);
+    test_helper_scratch_remove(dir);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_printer_prepend_permissions
+  Tests that d_test_prepend_to_file keeps the destination's permissions.
+  Tests the following:
+  - the mode bits of the original survive the rename of the temporary file
+*/
+bool
+d_tests_sa_test_printer_prepend_permissions
+(
+    struct d_test_counter* _counter
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    // Windows files carry no POSIX mode bits to preserve
+    (void)_counter;
+
+    return true;
+#else
+    bool        result;
+    bool        ok;
+    char        dir[TEST_HELPER_PRINTER_PATH_SIZE];
+    char        path[TEST_HELPER_PRINTER_PATH_SIZE];
+    struct stat info;
+
+    result = true;
+
+    if (!test_helper_scratch_dir(dir, sizeof(dir)))
+    {
+        return d_assert_standalone(false,
+                                   "prepend_scratch_dir",
+                                   "a scratch directory should be creatable",
+                                   _counter);
+    }
+
+    test_helper_scratch_path(path, sizeof(path), dir, "d_tests_mode.txt");
+
+    // test 1: mode bits are kept (mkstemp alone would leave 0600)
+    ok = test_helper_write_file(path, "body\n") &&
+         (chmod(path, 0644) == 0) &&
+         d_test_prepend_to_file(path, "head\n") &&
+         (stat(path, &info) == 0);
+
+    result = d_assert_standalone(
+        (ok) &&
+        ((info.st_mode & 07777) == 0644),
+        "prepend_keeps_mode",
+        "prepending should keep the original file's permissions",
+        _counter) && result;
+
+    remove(path);
+    test_helper_scratch_remove(dir);
+
+    return result;
+#endif
+}
+
+
+/*
+d_tests_sa_test_printer_prepend_failure
+  Tests d_test_prepend_to_file when the prepend cannot complete.
+  Tests the following:
+  - NULL arguments are rejected without touching the file
+  - a destination that cannot be read (a directory) fails, stays in place,
+    and leaves no temporary file behind
+*/
+bool
+d_tests_sa_test_printer_prepend_failure
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    char   dir[TEST_HELPER_PRINTER_PATH_SIZE];
+    char   path[TEST_HELPER_PRINTER_PATH_SIZE];
+    char   content[64];
+
+    result = true;
+
+    if (!test_helper_scratch_dir(dir, sizeof(dir)))
+    {
+        return d_assert_standalone(false,
+                                   "prepend_scratch_dir",
+                                   "a scratch directory should be creatable",
+                                   _counter);
+    }
+
+    test_helper_scratch_path(path, sizeof(path), dir, "d_tests_fail.txt");
+
+    // test 1: NULL arguments are rejected without touching the file
+    result = d_assert_standalone(
+        (test_helper_write_file(path, "original\n")) &&
+        (!d_test_prepend_to_file(path, NULL)) &&
+        (!d_test_prepend_to_file(NULL, "x")) &&
+        (test_helper_read_file(path, content, sizeof(content))) &&
+        (strcmp(content, "original\n") == 0),
+        "prepend_null_args",
+        "NULL arguments should fail and leave the file unchanged",
+        _counter) && result;
+
+    remove(path);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    // test 2: an unreadable original fails and is left in place
+    {
+        char inner[TEST_HELPER_PRINTER_PATH_SIZE];
+        bool failed;
+
+        test_helper_scratch_path(path, sizeof(path), dir, "d_tests_fail.d");
+        test_helper_scratch_path(inner, sizeof(inner), path, "keep.txt");
+
+        failed = (mkdir(path, 0755) == 0) &&
+                 (test_helper_write_file(inner, "kept\n")) &&
+                 (!d_test_prepend_to_file(path, "x"));
+
+        result = d_assert_standalone(
+            (failed) &&
+            (test_helper_read_file(inner, content, sizeof(content))) &&
+            (strcmp(content, "kept\n") == 0) &&
+            (test_helper_scratch_entries(dir) == 1),
+            "prepend_failure_keeps_original",
+            "a failed prepend should keep the original and remove its temp file",
+            _counter) && result;
+
+        remove(inner);
+        rmdir(path);
+    }
+#endif
+
+    test_helper_scratch_remove(dir);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_printer_file_all
+  Aggregation function that runs all file output tests.
+*/
+bool
+d_tests_sa_test_printer_file_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] File Output\n");
+    printf("  ---------------------\n");
+
+    result = d_tests_sa_test_printer_prepend_order(_counter) && result;
+    result = d_tests_sa_test_printer_prepend_permissions(_counter) && result;
+    result = d_tests_sa_test_printer_prepend_failure(_counter) && result;
+
+    return result;
+}
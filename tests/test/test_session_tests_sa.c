@@ -0,0 +1,24 @@
+#include ".\test_session_tests_sa.h"
+
+
+/*
+d_tests_sa_test_session_run_all
+  Module-level aggregation function that runs all test_session tests.
+  Executes tests for all categories:
+  - Check (count-only derivation, counters, failure records, nested runs)
+*/
+bool
+d_tests_sa_test_session_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_test_session_check_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,56 @@
+/******************************************************************************
+* djinterp [test]                                        test_session_tests_sa.h
+*
+*   Unit test declarations for `test_session.h` module.
+*   Covers D_TEST_SESSION_CHECK and its recorders: the count-only derivation
+* of D_TEST_MSG_IS_COUNT_ONLY, the pass/fail counters, failure records, and
+* restoring the active session after a nested d_test_session_run.
+*   test_session.h reaches test_stats.h, whose `struct d_test_counter` clashes
+* with the standalone one used here, so only test_session_tests_sa_check.c
+* includes it and this header does not.
+*
+*
+* path:      \tests\test\test_session_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_TEST_SESSION_SA_
+#define DJINTERP_TESTS_TEST_SESSION_SA_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "..\..\inc\test\test_standalone.h"
+#include "..\..\inc\string_fn.h"
+
+
+/******************************************************************************
+ * I. CHECK TESTS
+ *****************************************************************************/
+// D_TEST_MSG_IS_COUNT_ONLY and d_test_session_is_count_only
+bool d_tests_sa_test_session_count_only_flags(struct d_test_counter* _counter);
+// D_TEST_SESSION_CHECK with no session running
+bool d_tests_sa_test_session_check_inactive(struct d_test_counter* _counter);
+// assertion pass/fail counters in count-only and printing sessions
+bool d_tests_sa_test_session_check_counters(struct d_test_counter* _counter);
+// passes and failures printed by a session that prints every check
+bool d_tests_sa_test_session_check_printed(struct d_test_counter* _counter);
+// d_test_session_report_property for a falsified property
+bool d_tests_sa_test_session_check_property(struct d_test_counter* _counter);
+// d_test_session_failure_record_count and d_test_session_get_failure_at
+bool d_tests_sa_test_session_failure_records(struct d_test_counter* _counter);
+// d_test_session_active across a nested d_test_session_run
+bool d_tests_sa_test_session_nested_restore(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_test_session_check_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_test_session_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_TEST_SESSION_SA_
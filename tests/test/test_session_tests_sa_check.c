@@ -0,0 +1,901 @@
+#include ".\test_session_tests_sa.h"
+#include <stdio.h>
+#include <string.h>
+
+// test_stats.h (reached through test_session.h) declares the framework's own
+// `struct d_test_counter`; see test_cli_tests_sa_modules.c.
+#define d_test_counter            d_test_stats_counter
+#define d_test_counter_reset      d_test_stats_counter_reset
+#define d_test_counter_add        d_test_stats_counter_add
+#define d_test_counter_total      d_test_stats_counter_total
+#define d_test_counter_pass_rate  d_test_stats_counter_pass_rate
+#include "..\..\inc\test\dtest"
+#include "..\..\inc\test\test_session.h"
+#undef d_test_counter
+#undef d_test_counter_reset
+#undef d_test_counter_add
+#undef d_test_counter_total
+#undef d_test_counter_pass_rate
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR CHECK TESTS
+ *****************************************************************************/
+
+// TEST_HELPER_SESSION_COUNT_ONLY
+//   constant: message flags that count everything and print nothing.
+#define TEST_HELPER_SESSION_COUNT_ONLY  D_TEST_MSG_COUNT_ALL
+
+// TEST_HELPER_SESSION_PRINTING
+//   constant: message flags that count everything and print module failures,
+// so checks take the printing path without printing them.
+#define TEST_HELPER_SESSION_PRINTING                                         \
+    (D_TEST_MSG_COUNT_ALL | D_TEST_MSG_FLAG_PRINT_MODULES_FAIL)
+
+// TEST_HELPER_SESSION_PRINT_CHECKS
+//   constant: message flags that count and print every check.
+#define TEST_HELPER_SESSION_PRINT_CHECKS                                     \
+    (D_TEST_MSG_COUNT_ALL                |                                   \
+     D_TEST_MSG_FLAG_PRINT_ASSERTS_PASS  |                                   \
+     D_TEST_MSG_FLAG_PRINT_ASSERTS_FAIL)
+
+// TEST_HELPER_SESSION_PRINT_TESTS
+//   constant: message flags that count everything and print failed tests,
+// falsified properties among them.
+#define TEST_HELPER_SESSION_PRINT_TESTS                                      \
+    (D_TEST_MSG_COUNT_ALL | D_TEST_MSG_FLAG_PRINT_TESTS_FAIL)
+
+// TEST_HELPER_SESSION_OUTPUT
+//   constant: file the printing tests send session output to.
+#define TEST_HELPER_SESSION_OUTPUT "d_tests_session_check.txt"
+
+// TEST_HELPER_SESSION_READ_SIZE
+//   constant: largest session output the printing tests read back.
+#define TEST_HELPER_SESSION_READ_SIZE 4096
+
+// operand of every check below; checks against 2 pass, the rest fail
+static int test_helper_session_value = 2;
+
+// input generator of the property run by test_helper_session_falsified
+static const struct d_test_gen test_helper_session_gen =
+    D_TEST_GEN_INT(int, 0, 1000);
+
+// property run, and reported, by test_helper_session_falsified
+static struct d_test_property* test_helper_session_property;
+
+// sessions observed by the nested-run test functions
+static struct d_test_session* test_helper_session_inner;
+static struct d_test_session* test_helper_session_seen_inner;
+static struct d_test_session* test_helper_session_seen_after;
+
+/*
+test_helper_session_mixed
+  Test function making three passing and two failing session checks.
+*/
+static bool
+test_helper_session_mixed
+(
+    void
+)
+{
+    bool passed;
+
+    passed = true;
+    passed = D_TEST_SESSION_CHECK(test_helper_session_value == 2) && passed;
+    passed = D_TEST_SESSION_CHECK(test_helper_session_value > 0) && passed;
+    passed = D_TEST_SESSION_CHECK(test_helper_session_value == 3) && passed;
+    passed = D_TEST_SESSION_CHECK(test_helper_session_value < 3) && passed;
+    passed = D_TEST_SESSION_CHECK(test_helper_session_value < 0) && passed;
+
+    return passed;
+}
+
+/*
+test_helper_session_below_100
+  Property: the input int is below 100.
+*/
+static bool
+test_helper_session_below_100
+(
+    const void* _input,
+    void*       _context
+)
+{
+    (void)_context;
+
+    return *(const int*)_input < 100;
+}
+
+/*
+test_helper_session_falsified
+  Test function that runs test_helper_session_property and reports it when
+falsified, as a test or block running a property child does.
+*/
+static bool
+test_helper_session_falsified
+(
+    void
+)
+{
+    if (d_test_property_run(test_helper_session_property))
+    {
+        return true;
+    }
+
+    d_test_session_report_property(test_helper_session_property);
+
+    return false;
+}
+
+/*
+test_helper_session_inner_fn
+  Test function of the nested session; notes the active session and makes one
+failing check.
+*/
+static bool
+test_helper_session_inner_fn
+(
+    void
+)
+{
+    test_helper_session_seen_inner = d_test_session_active();
+
+    return D_TEST_SESSION_CHECK(test_helper_session_value == 3);
+}
+
+/*
+test_helper_session_outer_fn
+  Test function of the enclosing session; runs the nested session, then notes
+the active session and makes one passing check.
+*/
+static bool
+test_helper_session_outer_fn
+(
+    void
+)
+{
+    d_test_session_run(test_helper_session_inner);
+
+    test_helper_session_seen_after = d_test_session_active();
+
+    return D_TEST_SESSION_CHECK(test_helper_session_value == 2);
+}
+
+/*
+test_helper_session_new
+  Returns a new session with message flags `_flags` holding one module whose
+only block runs `_fn`, or NULL on allocation failure.
+*/
+static struct d_test_session*
+test_helper_session_new
+(
+    uint32_t _flags,
+    fn_test  _fn
+)
+{
+    struct d_test_session* session;
+    struct d_test_config*  config;
+    struct d_test_type*    block;
+    struct d_test_type*    node;
+
+    config = d_test_config_new(_flags);
+
+    if (!config)
+    {
+        return NULL;
+    }
+
+    session = d_test_session_new_with_config(config);
+
+    if (!session)
+    {
+        d_test_config_free(config);
+
+        return NULL;
+    }
+
+    // keep the session's own report out of the standalone output
+    d_test_session_set_verbosity(session, D_TEST_VERBOSITY_SILENT);
+
+    // a block frees the wrapper it is given; a module copies it and leaves
+    // the wrapper to the caller
+    node  = d_test_type_new(D_TEST_TYPE_TEST_FN, d_test_fn_new(_fn));
+    block = d_test_type_new(D_TEST_TYPE_TEST_BLOCK, d_test_block_new(&node, 1));
+    node  = d_test_type_new(D_TEST_TYPE_MODULE, d_test_module_new(&block, 1));
+
+    d_test_type_free(block);
+
+    if ( (!node)                         ||
+         (!node->D_KEYWORD_TEST_MODULE)  ||
+         (!d_test_session_add_child(session, node)) )
+    {
+        if (node)
+        {
+            d_test_module_free(node->D_KEYWORD_TEST_MODULE);
+            d_test_type_free(node);
+        }
+
+        d_test_session_free(session);
+
+        return NULL;
+    }
+
+    return session;
+}
+
+/*
+test_helper_session_free
+  Frees a session from test_helper_session_new together with its tree; the
+session, module and block release only their own storage, not their
+children's elements.
+*/
+static void
+test_helper_session_free
+(
+    struct d_test_session* _session
+)
+{
+    struct d_test_type*   child;
+    struct d_test_module* module;
+    struct d_test_block*  block;
+    struct d_test_fn*     fn;
+    size_t                i;
+
+    if (!_session)
+    {
+        return;
+    }
+
+    for (i = 0; i < d_test_session_child_count(_session); i++)
+    {
+        child  = d_test_session_get_child_at(_session, i);
+        module = child->D_KEYWORD_TEST_MODULE;
+        block  = d_test_module_get_child_at(module, 0)->D_KEYWORD_TEST_BLOCK;
+        fn     = d_test_block_get_child_at(block, 0)->D_KEYWORD_TEST_TEST_FN;
+
+        d_test_fn_free(fn);
+        d_test_block_free(block);
+        d_test_module_free(module);
+        d_test_type_free(child);
+    }
+
+    d_test_session_free(_session);
+
+    return;
+}
+
+
+/*
+test_helper_session_read_output
+  Reads TEST_HELPER_SESSION_OUTPUT into `_text`, terminated, and removes it.
+*/
+static bool
+test_helper_session_read_output
+(
+    char*  _text,
+    size_t _size
+)
+{
+    FILE*  file;
+    size_t length;
+
+    file = fopen(TEST_HELPER_SESSION_OUTPUT, "rb");
+
+    if (!file)
+    {
+        return false;
+    }
+
+    length        = fread(_text, 1, _size - 1, file);
+    _text[length] = '\0';
+
+    fclose(file);
+    remove(TEST_HELPER_SESSION_OUTPUT);
+
+    return true;
+}
+
+/*
+test_helper_session_print_run
+  Runs `_fn` in a new session with message flags `_flags` that writes to
+TEST_HELPER_SESSION_OUTPUT, then reads that output into `_text`.
+*/
+static bool
+test_helper_session_print_run
+(
+    uint32_t _flags,
+    fn_test  _fn,
+    char*    _text,
+    size_t   _size
+)
+{
+    struct d_test_session* session;
+
+    session = test_helper_session_new(_flags, _fn);
+
+    if (!session)
+    {
+        return false;
+    }
+
+    d_test_session_set_verbosity(session, D_TEST_VERBOSITY_NORMAL);
+
+    if (d_test_session_set_output_file(session, TEST_HELPER_SESSION_OUTPUT))
+    {
+        d_test_session_run(session);
+    }
+
+    // freeing the session closes its output file
+    test_helper_session_free(session);
+
+    return test_helper_session_read_output(_text, _size);
+}
+
+
+/******************************************************************************
+ * I. CHECK TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_test_session_count_only_flags
+  Tests the count-only derivation of D_TEST_MSG_IS_COUNT_ONLY.
+  Tests the following:
+  - counters without print flags are count-only, even a single counter
+  - any print flag, no flags at all, or print flags alone are not
+  - d_test_session_is_count_only reports the flags of the last run
+  - a printing session is not count-only
+*/
+bool
+d_tests_sa_test_session_count_only_flags
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    bool                   before;
+    struct d_test_session* session;
+
+    result = true;
+
+    // test 1: counters without print flags
+    result = d_assert_standalone(
+        (D_TEST_MSG_IS_COUNT_ONLY(D_TEST_MSG_COUNT_ALL)) &&
+        (D_TEST_MSG_IS_COUNT_ONLY(D_TEST_MSG_FLAG_COUNT_ASSERTS_FAIL)),
+        "count_only_counters",
+        "counter flags without print flags should be count-only",
+        _counter) && result;
+
+    // test 2: printing or silent flags
+    result = d_assert_standalone(
+        (!D_TEST_MSG_IS_COUNT_ONLY(D_TEST_MODE_NORMAL))                   &&
+        (!D_TEST_MSG_IS_COUNT_ONLY(D_TEST_MSG_COUNT_ALL |
+                                   D_TEST_MSG_FLAG_PRINT_ASSERTS_PASS))   &&
+        (!D_TEST_MSG_IS_COUNT_ONLY(D_TEST_MODE_SILENT))                   &&
+        (!D_TEST_MSG_IS_COUNT_ONLY(D_TEST_MSG_PRINT_ALL)),
+        "count_only_printing",
+        "any print flag, or no counter flag, should not be count-only",
+        _counter) && result;
+
+    // test 3: a session takes the derivation when it runs
+    session = test_helper_session_new(TEST_HELPER_SESSION_COUNT_ONLY,
+                                      (fn_test)test_helper_session_mixed);
+    before  = d_test_session_is_count_only(session);
+
+    if (session)
+    {
+        d_test_session_run(session);
+    }
+
+    result = d_assert_standalone(
+        (session != NULL)                        &&
+        (!before)                                &&
+        (d_test_session_is_count_only(session))  &&
+        (!d_test_session_is_count_only(NULL)),
+        "count_only_session",
+        "a session should become count-only when it runs with such flags",
+        _counter) && result;
+
+    test_helper_session_free(session);
+
+    // test 4: a printing session is not count-only
+    session = test_helper_session_new(TEST_HELPER_SESSION_PRINTING,
+                                      (fn_test)test_helper_session_mixed);
+
+    if (session)
+    {
+        d_test_session_run(session);
+    }
+
+    result = d_assert_standalone(
+        (session != NULL) &&
+        (!d_test_session_is_count_only(session)),
+        "count_only_session_printing",
+        "a session with print flags should not be count-only",
+        _counter) && result;
+
+    test_helper_session_free(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_check_inactive
+  Tests D_TEST_SESSION_CHECK when no session is running.
+  Tests the following:
+  - no session is active outside d_test_session_run
+  - a check still evaluates to its condition
+  - recording a failure without a session is harmless
+*/
+bool
+d_tests_sa_test_session_check_inactive
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: no session is active
+    result = d_assert_standalone(
+        d_test_session_active() == NULL,
+        "inactive_none",
+        "no session should be active outside a run",
+        _counter) && result;
+
+    // test 2: the check evaluates to its condition
+    result = d_assert_standalone(
+        (D_TEST_SESSION_CHECK(test_helper_session_value == 2)) &&
+        (!D_TEST_SESSION_CHECK(test_helper_session_value == 3)),
+        "inactive_result",
+        "a check should evaluate to its condition without a session",
+        _counter) && result;
+
+    // test 3: a failure recorded without a session is freed and reported
+    result = d_assert_standalone(
+        (!d_test_session_record_fail(NULL)) &&
+        (!d_test_session_record_fail(d_assert_new(false, NULL, NULL))),
+        "inactive_record_fail",
+        "recording without a session should return false",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_check_counters
+  Tests the assertion counters fed by D_TEST_SESSION_CHECK.
+  Tests the following:
+  - a count-only session counts passes and failures
+  - a repeated run resets the counters instead of adding to them
+  - a printing session counts the same checks identically
+*/
+bool
+d_tests_sa_test_session_check_counters
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                            result;
+    struct d_test_session*          session;
+    const struct d_test_statistics* stats;
+
+    result = true;
+
+    // test 1: count-only session
+    session = test_helper_session_new(TEST_HELPER_SESSION_COUNT_ONLY,
+                                      (fn_test)test_helper_session_mixed);
+    stats   = NULL;
+
+    if (session)
+    {
+        d_test_session_run(session);
+
+        stats = d_test_session_get_stats(session);
+    }
+
+    result = d_assert_standalone(
+        (stats != NULL)              &&
+        (stats->asserts.passed == 3) &&
+        (stats->asserts.failed == 2) &&
+        (stats->asserts.run == 5),
+        "counters_count_only",
+        "a count-only session should count 3 passes and 2 failures",
+        _counter) && result;
+
+    // test 2: a second run starts from zero
+    if (session)
+    {
+        d_test_session_run(session);
+    }
+
+    result = d_assert_standalone(
+        (stats != NULL)              &&
+        (stats->asserts.passed == 3) &&
+        (stats->asserts.failed == 2),
+        "counters_rerun",
+        "running a session again should reset its counters",
+        _counter) && result;
+
+    test_helper_session_free(session);
+
+    // test 3: printing session
+    session = test_helper_session_new(TEST_HELPER_SESSION_PRINTING,
+                                      (fn_test)test_helper_session_mixed);
+    stats   = NULL;
+
+    if (session)
+    {
+        d_test_session_run(session);
+
+        stats = d_test_session_get_stats(session);
+    }
+
+    result = d_assert_standalone(
+        (stats != NULL)              &&
+        (stats->asserts.passed == 3) &&
+        (stats->asserts.failed == 2) &&
+        (stats->asserts.run == 5),
+        "counters_printing",
+        "a printing session should count the same checks",
+        _counter) && result;
+
+    test_helper_session_free(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_check_printed
+  Tests D_TEST_SESSION_CHECK in a session that prints every check.
+  Tests the following:
+  - only failures are kept as records
+  - passing checks are printed by their expression
+  - failing checks are printed with their description and location
+*/
+bool
+d_tests_sa_test_session_check_printed
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    bool                   written;
+    struct d_test_session* session;
+    char                   text[TEST_HELPER_SESSION_READ_SIZE];
+
+    result  = true;
+    session = test_helper_session_new(TEST_HELPER_SESSION_PRINT_CHECKS,
+                                      (fn_test)test_helper_session_mixed);
+
+    if (session)
+    {
+        d_test_session_set_verbosity(session, D_TEST_VERBOSITY_NORMAL);
+
+        if (d_test_session_set_output_file(session,
+                                           TEST_HELPER_SESSION_OUTPUT))
+        {
+            d_test_session_run(session);
+        }
+    }
+
+    // test 1: only failures are kept as records
+    result = d_assert_standalone(
+        (session != NULL) &&
+        (d_test_session_failure_record_count(session) == 2),
+        "printed_records",
+        "a printing session should keep only the two failures",
+        _counter) && result;
+
+    // freeing the session closes its output file
+    test_helper_session_free(session);
+
+    written = test_helper_session_read_output(text, sizeof(text));
+
+    // test 2: passes are printed by their expression
+    result = d_assert_standalone(
+        (written)                                                          &&
+        (strstr(text, "test_helper_session_value == 2") != NULL)           &&
+        (strstr(text, "test_helper_session_value > 0") != NULL)            &&
+        (strstr(text, "test_helper_session_value < 3") != NULL),
+        "printed_passes",
+        "every passing check should be printed by its expression",
+        _counter) && result;
+
+    // test 3: failures are printed with their description
+    result = d_assert_standalone(
+        (written)                                                          &&
+        (strstr(text, "expected test_helper_session_value == 3 at "
+                      "test_session_tests_sa_check.c:") != NULL)           &&
+        (strstr(text, "expected test_helper_session_value < 0 at "
+                      "test_session_tests_sa_check.c:") != NULL),
+        "printed_failures",
+        "every failing check should be printed with its location",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_check_property
+  Tests the report of a falsified property.
+  Tests the following:
+  - a session that prints failed tests prints the property's failing case,
+    seed and shrunk counterexample
+  - a count-only session prints nothing for it
+*/
+bool
+d_tests_sa_test_session_check_property
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+    bool written;
+    char expected[128];
+    char text[TEST_HELPER_SESSION_READ_SIZE];
+
+    result                       = true;
+    test_helper_session_property = d_test_property_new(
+                                       test_helper_session_below_100,
+                                       &test_helper_session_gen,
+                                       NULL);
+
+    if (!test_helper_session_property)
+    {
+        return d_assert_standalone(false,
+                                   "property_created",
+                                   "d_test_property_new should succeed",
+                                   _counter);
+    }
+
+    written = test_helper_session_print_run(
+                  TEST_HELPER_SESSION_PRINT_TESTS,
+                  (fn_test)test_helper_session_falsified,
+                  text,
+                  sizeof(text));
+
+    d_test_property_describe(test_helper_session_property,
+                             expected,
+                             sizeof(expected));
+
+    // test 1: the counterexample is printed with its case and seed
+    result = d_assert_standalone(
+        (written)                                   &&
+        (test_helper_session_property->falsified)   &&
+        (strstr(expected, " steps to 100") != NULL) &&
+        (strstr(text, "property") != NULL)          &&
+        (strstr(text, expected) != NULL),
+        "property_printed",
+        "a falsified property should print its case, seed and counterexample",
+        _counter) && result;
+
+    // test 2: count-only sessions print no report
+    written = test_helper_session_print_run(
+                  TEST_HELPER_SESSION_COUNT_ONLY,
+                  (fn_test)test_helper_session_falsified,
+                  text,
+                  sizeof(text));
+
+    result = d_assert_standalone(
+        (written) &&
+        (strstr(text, expected) == NULL),
+        "property_count_only",
+        "a count-only session should not print the property report",
+        _counter) && result;
+
+    d_test_property_free(test_helper_session_property);
+    test_helper_session_property = NULL;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_failure_records
+  Tests the failure records kept by a session.
+  Tests the following:
+  - each failing check is recorded once, in order, in count-only mode
+  - a record carries the check's expression, file and line
+  - out-of-range and NULL lookups return NULL
+  - a repeated run replaces the previous run's records
+*/
+bool
+d_tests_sa_test_session_failure_records
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_test_session* session;
+    const struct d_assert* first;
+    const struct d_assert* second;
+
+    result  = true;
+    session = test_helper_session_new(TEST_HELPER_SESSION_COUNT_ONLY,
+                                      (fn_test)test_helper_session_mixed);
+
+    if (session)
+    {
+        d_test_session_run(session);
+    }
+
+    first  = d_test_session_get_failure_at(session, 0);
+    second = d_test_session_get_failure_at(session, 1);
+
+    // test 1: one record per failing check
+    result = d_assert_standalone(
+        (d_test_session_failure_record_count(session) == 2) &&
+        (first != NULL)                                     &&
+        (second != NULL)                                    &&
+        (!first->result)                                    &&
+        (!second->result),
+        "records_count",
+        "each failing check should leave one failed record",
+        _counter) && result;
+
+    // test 2: records carry the source of the check, in order
+    result = d_assert_standalone(
+        (first != NULL)                                                    &&
+        (second != NULL)                                                   &&
+        (first->expression != NULL)                                        &&
+        (second->expression != NULL)                                       &&
+        (strcmp(first->expression, "test_helper_session_value == 3") == 0) &&
+        (strcmp(second->expression, "test_helper_session_value < 0") == 0) &&
+        (first->file != NULL)                                              &&
+        (strstr(first->file, "test_session_tests_sa_check.c") != NULL)     &&
+        (first->line > 0)                                                  &&
+        (second->line > first->line),
+        "records_source",
+        "records should hold each failing check's expression, file and line",
+        _counter) && result;
+
+    // test 3: lookups outside the records
+    result = d_assert_standalone(
+        (d_test_session_get_failure_at(session, 2) == NULL) &&
+        (d_test_session_get_failure_at(NULL, 0) == NULL)    &&
+        (d_test_session_failure_record_count(NULL) == 0),
+        "records_bounds",
+        "out-of-range and NULL lookups should return NULL or 0",
+        _counter) && result;
+
+    // test 4: a second run replaces the records
+    if (session)
+    {
+        d_test_session_run(session);
+    }
+
+    result = d_assert_standalone(
+        d_test_session_failure_record_count(session) == 2,
+        "records_rerun",
+        "running a session again should replace its failure records",
+        _counter) && result;
+
+    test_helper_session_free(session);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_nested_restore
+  Tests the active session across a nested d_test_session_run.
+  Tests the following:
+  - the nested session is active while its tests run
+  - the enclosing session is active again once the nested run returns
+  - checks after the nested run are counted by the enclosing session only
+  - no session is active after the enclosing run
+*/
+bool
+d_tests_sa_test_session_nested_restore
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                            result;
+    struct d_test_session*          outer;
+    const struct d_test_statistics* inner_stats;
+    const struct d_test_statistics* outer_stats;
+
+    result = true;
+
+    test_helper_session_inner      = test_helper_session_new(
+                                         TEST_HELPER_SESSION_COUNT_ONLY,
+                                         (fn_test)test_helper_session_inner_fn);
+    outer                          = test_helper_session_new(
+                                         TEST_HELPER_SESSION_COUNT_ONLY,
+                                         (fn_test)test_helper_session_outer_fn);
+    test_helper_session_seen_inner = NULL;
+    test_helper_session_seen_after = NULL;
+
+    if ( (!test_helper_session_inner) ||
+         (!outer) )
+    {
+        test_helper_session_free(test_helper_session_inner);
+        test_helper_session_free(outer);
+
+        return d_assert_standalone(false,
+                                   "nested_sessions",
+                                   "the nested sessions should be creatable",
+                                   _counter);
+    }
+
+    d_test_session_run(outer);
+
+    inner_stats = d_test_session_get_stats(test_helper_session_inner);
+    outer_stats = d_test_session_get_stats(outer);
+
+    // test 1: the nested session is active during its run
+    result = d_assert_standalone(
+        test_helper_session_seen_inner == test_helper_session_inner,
+        "nested_inner_active",
+        "the nested session should be active while its tests run",
+        _counter) && result;
+
+    // test 2: the enclosing session is restored
+    result = d_assert_standalone(
+        test_helper_session_seen_after == outer,
+        "nested_outer_restored",
+        "the enclosing session should be active after the nested run",
+        _counter) && result;
+
+    // test 3: each check was counted by the session running it
+    result = d_assert_standalone(
+        (inner_stats->asserts.failed == 1)                                &&
+        (inner_stats->asserts.passed == 0)                                &&
+        (d_test_session_failure_record_count(test_helper_session_inner)
+             == 1)                                                        &&
+        (outer_stats->asserts.passed == 1)                                &&
+        (outer_stats->asserts.failed == 0)                                &&
+        (d_test_session_failure_record_count(outer) == 0),
+        "nested_counters",
+        "checks should be counted by the session that ran them",
+        _counter) && result;
+
+    // test 4: nothing is active once the enclosing run returns
+    result = d_assert_standalone(
+        d_test_session_active() == NULL,
+        "nested_none_after",
+        "no session should be active after the enclosing run",
+        _counter) && result;
+
+    test_helper_session_free(outer);
+    test_helper_session_free(test_helper_session_inner);
+
+    test_helper_session_inner = NULL;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_test_session_check_all
+  Aggregation function that runs all check tests.
+*/
+bool
+d_tests_sa_test_session_check_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Check\n");
+    printf("  ---------------\n");
+
+    result = d_tests_sa_test_session_count_only_flags(_counter) && result;
+    result = d_tests_sa_test_session_check_inactive(_counter) && result;
+    result = d_tests_sa_test_session_check_counters(_counter) && result;
+    result = d_tests_sa_test_session_check_printed(_counter) && result;
+    result = d_tests_sa_test_session_check_property(_counter) && result;
+    result = d_tests_sa_test_session_failure_records(_counter) && result;
+    result = d_tests_sa_test_session_nested_restore(_counter) && result;
+
+    return result;
+}
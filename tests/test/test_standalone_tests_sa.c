@@ -8,15 +8,19 @@ d_tests_sa_standalone_run_all
   - Assertion macros (TRUE, FALSE, NULL, NOT_NULL, EQUAL, STR_EQUAL)
   - Constant macros (LEAF, INTERIOR, LINE_WIDTH, separators, MAX_MODULES)
   - Test counter operations (struct, reset, add)
-  - Test object operations (struct, new_leaf, new_interior, add_child, free)
+  - Test object operations (struct, new_leaf, new_interior, add_child, free,
+    pool)
   - Results structures (module_results, suite_results)
   - Note structures (note_item, note_section)
   - Module entry and runner structures
   - Function pointer types (fn_print_object, fn_print_object_file)
   - Assertion function (d_assert_standalone)
-  - Template substitution (d_test_substitute_template)
-  - Runner functions (init, add_module, set_wait, set_notes, cleanup)
-  - Utility functions (get_elapsed_time)
+  - Template substitution (d_test_substitute_template, compiled templates)
+  - Runner functions (init, add_module, add_module_stream, set_wait,
+    set_notes, set_parallel, set_filter, cleanup)
+  - Utility functions (get_elapsed_time, get_wall_time,
+    get_thread_cpu_time)
+  - Streaming (init, open/leaf/close events, filter)
 */
 bool
 d_tests_sa_standalone_run_all
@@ -41,6 +45,7 @@ d_tests_sa_standalone_run_all
     result = d_tests_sa_standalone_template_all(_counter) && result;
     result = d_tests_sa_standalone_runner_fn_all(_counter) && result;
     result = d_tests_sa_standalone_utility_all(_counter) && result;
+    result = d_tests_sa_standalone_stream_all(_counter) && result;
 
     return result;
 }
@@ -5,7 +5,8 @@
 *   Provides comprehensive testing of all test_standalone functions including
 * assertion macros, test object constants, test counter operations, test object
 * creation/destruction, template substitution, print functions, output
-* functions, formatting functions, unified test runner, and utility functions.
+* functions, formatting functions, unified test runner, utility functions,
+* and streaming test events.
 *
 *
 * path:      \tests\test\test_standalone_tests_sa.h
@@ -86,6 +87,8 @@ bool d_tests_sa_standalone_object_new_interior(struct d_test_counter* _counter);
 bool d_tests_sa_standalone_object_add_child(struct d_test_counter* _counter);
 // d_test_object_free function
 bool d_tests_sa_standalone_object_free(struct d_test_counter* _counter);
+// d_test_object_pool functions
+bool d_tests_sa_standalone_object_pool(struct d_test_counter* _counter);
 
 // IV.  aggregation function
 bool d_tests_sa_standalone_object_all(struct d_test_counter* _counter);
@@ -158,6 +161,8 @@ bool d_tests_sa_standalone_assert_fn_all(struct d_test_counter* _counter);
  *****************************************************************************/
 // d_test_substitute_template function
 bool d_tests_sa_standalone_substitute_template(struct d_test_counter* _counter);
+// d_test_template_compile and render functions
+bool d_tests_sa_standalone_template_compile(struct d_test_counter* _counter);
 
 // X.   aggregation function
 bool d_tests_sa_standalone_template_all(struct d_test_counter* _counter);
@@ -172,10 +177,18 @@ bool d_tests_sa_standalone_runner_init(struct d_test_counter* _counter);
 bool d_tests_sa_standalone_runner_add_module(struct d_test_counter* _counter);
 // d_test_sa_runner_add_module_counter function
 bool d_tests_sa_standalone_runner_add_module_counter(struct d_test_counter* _counter);
+// d_test_sa_runner_add_module_stream function
+bool d_tests_sa_standalone_runner_add_module_stream(struct d_test_counter* _counter);
 // d_test_sa_runner_set_wait_for_input function
 bool d_tests_sa_standalone_runner_set_wait(struct d_test_counter* _counter);
 // d_test_sa_runner_set_show_notes function
 bool d_tests_sa_standalone_runner_set_notes(struct d_test_counter* _counter);
+// d_test_sa_runner_set_parallel function
+bool d_tests_sa_standalone_runner_set_parallel(struct d_test_counter* _counter);
+// d_test_sa_runner_execute with parallel jobs
+bool d_tests_sa_standalone_runner_execute_parallel(struct d_test_counter* _counter);
+// d_test_sa_runner_set_filter function
+bool d_tests_sa_standalone_runner_set_filter(struct d_test_counter* _counter);
 // d_test_sa_runner_cleanup function
 bool d_tests_sa_standalone_runner_cleanup(struct d_test_counter* _counter);
 
@@ -188,11 +201,29 @@ bool d_tests_sa_standalone_runner_fn_all(struct d_test_counter* _counter);
  *****************************************************************************/
 // d_test_sa_get_elapsed_time function
 bool d_tests_sa_standalone_get_elapsed_time(struct d_test_counter* _counter);
+// d_test_sa_get_wall_time and d_test_sa_get_thread_cpu_time functions
+bool d_tests_sa_standalone_get_wall_time(struct d_test_counter* _counter);
 
 // XII. aggregation function
 bool d_tests_sa_standalone_utility_all(struct d_test_counter* _counter);
 
 
+/******************************************************************************
+ * XIII. STREAMING TESTS
+ *****************************************************************************/
+// d_test_stream_init function
+bool d_tests_sa_standalone_stream_init(struct d_test_counter* _counter);
+// d_test_stream_open, d_test_stream_leaf, d_test_stream_close functions
+bool d_tests_sa_standalone_stream_events(struct d_test_counter* _counter);
+// d_test_stream_set_filter, d_test_stream_selects functions
+bool d_tests_sa_standalone_stream_filter(struct d_test_counter* _counter);
+// d_test_stream_open, d_test_stream_close past D_TEST_STREAM_MAX_DEPTH
+bool d_tests_sa_standalone_stream_overflow(struct d_test_counter* _counter);
+
+// XIII. aggregation function
+bool d_tests_sa_standalone_stream_all(struct d_test_counter* _counter);
+
+
 /******************************************************************************
  * MODULE-LEVEL AGGREGATION
  *****************************************************************************/
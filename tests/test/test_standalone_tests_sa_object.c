@@ -468,6 +468,129 @@ d_tests_sa_standalone_object_free
 }
 
 
+/*
+d_tests_sa_standalone_object_pool
+  Tests the d_test_object_pool functions.
+  Tests the following:
+  - NULL pool is handled safely
+  - objects created while a pool is active come from the pool
+  - pooled interior nodes have zeroed element arrays
+  - oversized element arrays are served
+  - d_test_object_free leaves pooled nodes for the pool
+  - d_test_object_pool_end restores heap allocation
+  - d_test_object_pool_release empties the pool
+*/
+bool
+d_tests_sa_standalone_object_pool
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                       result;
+    size_t                     i;
+    bool                       all_null;
+    struct d_test_object_pool  pool;
+    struct d_test_object_pool* previous;
+    struct d_test_object*      interior;
+    struct d_test_object*      large;
+    struct d_test_object*      leaf;
+    struct d_test_object*      heap_leaf;
+
+    result = true;
+
+    // test 1: NULL pool is handled safely
+    d_test_object_pool_init(NULL);
+    d_test_object_pool_release(NULL);
+
+    result = d_assert_standalone(
+        true,
+        "pool_null_safe",
+        "pool functions should handle NULL safely",
+        _counter) && result;
+
+    // test 2: objects come from the active pool
+    d_test_object_pool_init(&pool);
+    previous = d_test_object_pool_begin(&pool);
+
+    interior = d_test_object_new_interior("group", 3);
+    leaf     = d_test_object_new_leaf("leaf", "message", true);
+    d_test_object_add_child(interior, leaf, 0);
+
+    result = d_assert_standalone(
+        (interior != NULL) &&
+        (leaf != NULL) &&
+        interior->pooled &&
+        leaf->pooled &&
+        (pool.object_count == 2) &&
+        (pool.chunks != NULL),
+        "pool_allocates_objects",
+        "objects should be allocated from the active pool",
+        _counter) && result;
+
+    // test 3: element arrays are zeroed
+    result = d_assert_standalone(
+        (interior != NULL) &&
+        (interior->count == 3) &&
+        (interior->elements[0] == leaf) &&
+        (interior->elements[1] == NULL) &&
+        (interior->elements[2] == NULL),
+        "pool_interior_elements",
+        "pooled element arrays should be zeroed",
+        _counter) && result;
+
+    // test 4: oversized element arrays are served
+    large    = d_test_object_new_interior("large",
+                                          D_TEST_OBJECT_POOL_CHUNK_SIZE);
+    all_null = (large != NULL);
+
+    for (i = 0; all_null && (i < large->count); i++)
+    {
+        all_null = (large->elements[i] == NULL);
+    }
+
+    result = d_assert_standalone(
+        all_null &&
+        (d_test_object_new_leaf("after", "message", true) != NULL),
+        "pool_oversized_interior",
+        "interiors larger than a chunk should be allocated",
+        _counter) && result;
+
+    // test 5: freeing a pooled tree leaves it to the pool
+    d_test_object_free(interior);
+
+    result = d_assert_standalone(
+        pool.object_count == 4,
+        "pool_free_deferred",
+        "d_test_object_free should not free pooled nodes",
+        _counter) && result;
+
+    // test 6: ending the pool restores heap allocation
+    d_test_object_pool_end(previous);
+    heap_leaf = d_test_object_new_leaf("heap", "message", true);
+
+    result = d_assert_standalone(
+        (heap_leaf != NULL) &&
+        (!heap_leaf->pooled),
+        "pool_end_restores_heap",
+        "objects after pool_end should come from the heap",
+        _counter) && result;
+
+    d_test_object_free(heap_leaf);
+
+    // test 7: release empties the pool
+    d_test_object_pool_release(&pool);
+
+    result = d_assert_standalone(
+        (pool.chunks == NULL) &&
+        (pool.object_count == 0),
+        "pool_release_empties",
+        "release should free every chunk and reset the pool",
+        _counter) && result;
+
+    return result;
+}
+
+
 /*
 d_tests_sa_standalone_object_all
   Aggregation function that runs all test object tests.
@@ -490,6 +613,7 @@ d_tests_sa_standalone_object_all
     result = d_tests_sa_standalone_object_new_interior(_counter) && result;
     result = d_tests_sa_standalone_object_add_child(_counter) && result;
     result = d_tests_sa_standalone_object_free(_counter) && result;
+    result = d_tests_sa_standalone_object_pool(_counter) && result;
 
     return result;
 }
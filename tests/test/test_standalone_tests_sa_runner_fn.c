@@ -1,5 +1,21 @@
+// fork, pipes and nanosleep are used by the parallel runner tests
+#if ( !defined(_WIN32) && !defined(_WIN64) &&  \
+      !defined(_POSIX_C_SOURCE) )
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
 #include ".\test_standalone_tests_sa.h"
 
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <signal.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <time.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
 
 /******************************************************************************
  * HELPER FUNCTIONS FOR RUNNER TESTS
@@ -39,6 +55,229 @@ helper_runner_module_counter
 }
 
 
+/*
+helper_runner_module_stream
+  Helper function that emits stream events for runner testing.
+*/
+static bool
+helper_runner_module_stream
+(
+    struct d_test_stream* _stream
+)
+{
+    return d_test_stream_leaf(_stream, "runner_test", "runner message", true);
+}
+
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+/*
+helper_runner_sleep_ms
+  Sleeps for `_ms` milliseconds so parallel modules finish out of order.
+*/
+static void
+helper_runner_sleep_ms
+(
+    long _ms
+)
+{
+    struct timespec delay;
+
+    delay.tv_sec  = _ms / 1000;
+    delay.tv_nsec = (_ms % 1000) * 1000000L;
+
+    nanosleep(&delay, NULL);
+
+    return;
+}
+
+
+/*
+helper_runner_parallel_first
+  Slowest counter module: 3 of 3 assertions, 1 of 1 tests.
+*/
+static bool
+helper_runner_parallel_first
+(
+    struct d_test_counter* _counter
+)
+{
+    helper_runner_sleep_ms(120);
+    printf("<module-first>\n");
+
+    _counter->assertions_total  += 3;
+    _counter->assertions_passed += 3;
+    _counter->tests_total       += 1;
+    _counter->tests_passed      += 1;
+
+    return true;
+}
+
+
+/*
+helper_runner_parallel_second
+  Counter module with a failure: 2 of 4 assertions, 1 of 2 tests.
+*/
+static bool
+helper_runner_parallel_second
+(
+    struct d_test_counter* _counter
+)
+{
+    helper_runner_sleep_ms(60);
+    printf("<module-second>\n");
+
+    _counter->assertions_total  += 4;
+    _counter->assertions_passed += 2;
+    _counter->tests_total       += 2;
+    _counter->tests_passed      += 1;
+
+    return false;
+}
+
+
+/*
+helper_runner_parallel_third
+  Fastest counter module: 5 of 5 assertions, 2 of 2 tests.
+*/
+static bool
+helper_runner_parallel_third
+(
+    struct d_test_counter* _counter
+)
+{
+    printf("<module-third>\n");
+
+    _counter->assertions_total  += 5;
+    _counter->assertions_passed += 5;
+    _counter->tests_total       += 2;
+    _counter->tests_passed      += 2;
+
+    return true;
+}
+
+
+/*
+helper_runner_parallel_abort
+  Module that kills its own process before reporting.
+*/
+static bool
+helper_runner_parallel_abort
+(
+    struct d_test_counter* _counter
+)
+{
+    _counter->assertions_total += 1;
+
+    abort();
+}
+
+
+/*
+helper_runner_parallel_exit
+  Module that exits its process before reporting.
+*/
+static bool
+helper_runner_parallel_exit
+(
+    struct d_test_counter* _counter
+)
+{
+    _counter->assertions_total += 1;
+
+    _exit(0);
+}
+
+
+/*
+helper_runner_execute_captured
+  Executes `_runner` with stdout redirected to a temporary file and returns
+the captured output (caller frees), or NULL if it could not be captured.
+*/
+static char*
+helper_runner_execute_captured
+(
+    struct d_test_sa_runner* _runner
+)
+{
+    FILE*  capture;
+    char*  output;
+    long   length;
+    int    saved;
+
+    capture = tmpfile();
+
+    if (!capture)
+    {
+        return NULL;
+    }
+
+    fflush(stdout);
+    saved = dup(STDOUT_FILENO);
+
+    if ( (saved < 0) ||
+         (dup2(fileno(capture), STDOUT_FILENO) < 0) )
+    {
+        if (saved >= 0)
+        {
+            close(saved);
+        }
+
+        fclose(capture);
+
+        return NULL;
+    }
+
+    d_test_sa_runner_execute(_runner);
+
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    output = NULL;
+    length = ftell(capture);
+
+    if (length >= 0)
+    {
+        output = malloc((size_t)length + 1);
+    }
+
+    if (output)
+    {
+        rewind(capture);
+        output[fread(output, 1, (size_t)length, capture)] = '\0';
+    }
+
+    fclose(capture);
+
+    return output;
+}
+
+
+/*
+helper_runner_add_parallel_modules
+  Registers the three well-behaved counter modules, in order.
+*/
+static void
+helper_runner_add_parallel_modules
+(
+    struct d_test_sa_runner* _runner
+)
+{
+    d_test_sa_runner_set_wait_for_input(_runner, false);
+    d_test_sa_runner_add_module_counter(_runner, "first", "slowest",
+                                        helper_runner_parallel_first, 0, NULL);
+    d_test_sa_runner_add_module_counter(_runner, "second", "failing",
+                                        helper_runner_parallel_second, 0, NULL);
+    d_test_sa_runner_add_module_counter(_runner, "third", "fastest",
+                                        helper_runner_parallel_third, 0, NULL);
+
+    return;
+}
+
+#endif  // !_WIN32 && !_WIN64
+
+
 /******************************************************************************
  * XI. RUNNER FUNCTION TESTS
  *****************************************************************************/
@@ -299,6 +538,73 @@ d_tests_sa_standalone_runner_add_module_counter
 }
 
 
+/*
+d_tests_sa_standalone_runner_add_module_stream
+  Tests the d_test_sa_runner_add_module_stream function.
+  Tests the following:
+  - NULL runner is handled safely
+  - NULL run_fn is handled safely
+  - Module is added correctly with stream-based function
+*/
+bool
+d_tests_sa_standalone_runner_add_module_stream
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_sa_runner runner;
+
+    result = true;
+
+    // test 1: NULL runner is handled safely
+    d_test_sa_runner_add_module_stream(NULL, "test", "desc",
+                                        helper_runner_module_stream, 0, NULL);
+
+    result = d_assert_standalone(
+        true,
+        "runner_add_stream_null_runner_safe",
+        "add_module_stream with NULL runner should not crash",
+        _counter) && result;
+
+    // test 2: NULL run_fn is handled safely
+    d_test_sa_runner_init(&runner, "Test", "Desc");
+    d_test_sa_runner_add_module_stream(&runner, "test", "desc", NULL, 0, NULL);
+
+    result = d_assert_standalone(
+        runner.module_count == 0,
+        "runner_add_stream_null_fn_safe",
+        "add_module_stream with NULL run_fn should not add module",
+        _counter) && result;
+
+    // test 3: module is added correctly
+    d_test_sa_runner_add_module_stream(&runner, "stream_module", "Stream Module",
+                                        helper_runner_module_stream, 0, NULL);
+
+    result = d_assert_standalone(
+        runner.module_count == 1,
+        "runner_add_stream_count",
+        "module_count should be 1 after adding stream module",
+        _counter) && result;
+
+    // test 4: only run_stream is set
+    result = d_assert_standalone(
+        (runner.modules[0].run_fn == NULL) &&
+        (runner.modules[0].run_counter == NULL),
+        "runner_add_stream_other_fns_null",
+        "run_fn and run_counter should be NULL for stream-based module",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        runner.modules[0].run_stream == helper_runner_module_stream,
+        "runner_add_stream_run_stream",
+        "run_stream should be stored",
+        _counter) && result;
+
+    return result;
+}
+
+
 /*
 d_tests_sa_standalone_runner_set_wait
   Tests the d_test_sa_runner_set_wait_for_input function.
@@ -401,6 +707,278 @@ d_tests_sa_standalone_runner_set_notes
 }
 
 
+/*
+d_tests_sa_standalone_runner_set_parallel
+  Tests the d_test_sa_runner_set_parallel function.
+  Tests the following:
+  - NULL runner is handled safely
+  - runners default to serial execution
+  - job count is stored, including 0 (one per processor)
+*/
+bool
+d_tests_sa_standalone_runner_set_parallel
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_sa_runner runner;
+
+    result = true;
+
+    // test 1: NULL runner is handled safely
+    d_test_sa_runner_set_parallel(NULL, 4);
+
+    result = d_assert_standalone(
+        true,
+        "runner_set_parallel_null_safe",
+        "set_parallel with NULL runner should not crash",
+        _counter) && result;
+
+    // test 2: runners default to serial execution
+    d_test_sa_runner_init(&runner, "Test", "Desc");
+
+    result = d_assert_standalone(
+        runner.parallel_jobs == 1,
+        "runner_set_parallel_default",
+        "parallel_jobs should default to 1",
+        _counter) && result;
+
+    // test 3: job count is stored
+    d_test_sa_runner_set_parallel(&runner, 8);
+
+    result = d_assert_standalone(
+        runner.parallel_jobs == 8,
+        "runner_set_parallel_stored",
+        "parallel_jobs should be stored",
+        _counter) && result;
+
+    d_test_sa_runner_set_parallel(&runner, 0);
+
+    result = d_assert_standalone(
+        runner.parallel_jobs == 0,
+        "runner_set_parallel_auto",
+        "0 (one job per processor) should be stored",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_standalone_runner_execute_parallel
+  Tests d_test_sa_runner_execute with more than one job.
+  Tests the following:
+  - module output is printed in registration order, not completion order
+  - merged totals and module counts equal those of a serial run
+  - a module that aborts or calls _exit counts as one failed module
+  - children the host started itself are not reaped by the runner
+*/
+bool
+d_tests_sa_standalone_runner_execute_parallel
+(
+    struct d_test_counter* _counter
+)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    // parallel execution forks; Windows always runs modules serially
+    (void)_counter;
+
+    return true;
+#else
+    bool                    result;
+    struct d_test_sa_runner serial;
+    struct d_test_sa_runner parallel;
+    struct d_test_sa_runner crashing;
+    char*                   output;
+    const char*             first;
+    const char*             second;
+    const char*             third;
+    pid_t                   bystander;
+    pid_t                   reaped;
+    int                     status;
+
+    result = true;
+
+    // serial reference run
+    d_test_sa_runner_init(&serial, "Serial", "reference");
+    helper_runner_add_parallel_modules(&serial);
+    output = helper_runner_execute_captured(&serial);
+    free(output);
+
+    // a child of the host process that the runner must not reap
+    fflush(stdout);
+    bystander = fork();
+
+    if (bystander == 0)
+    {
+        _exit(7);
+    }
+
+    // test 1: output is printed in registration order
+    d_test_sa_runner_init(&parallel, "Parallel", "three jobs");
+    helper_runner_add_parallel_modules(&parallel);
+    d_test_sa_runner_set_parallel(&parallel, 3);
+
+    output = helper_runner_execute_captured(&parallel);
+    first  = (output) ? strstr(output, "<module-first>") : NULL;
+    second = (output) ? strstr(output, "<module-second>") : NULL;
+    third  = (output) ? strstr(output, "<module-third>") : NULL;
+
+    result = d_assert_standalone(
+        (first != NULL) &&
+        (second != NULL) &&
+        (third != NULL) &&
+        (first < second) &&
+        (second < third),
+        "runner_parallel_output_order",
+        "parallel module output should appear in registration order",
+        _counter) && result;
+
+    free(output);
+
+    // test 2: merged totals equal the serial run
+    result = d_assert_standalone(
+        (parallel.results.modules_total == 3) &&
+        (parallel.results.modules_passed == serial.results.modules_passed) &&
+        (parallel.results.totals.assertions_total ==
+         serial.results.totals.assertions_total) &&
+        (parallel.results.totals.assertions_passed ==
+         serial.results.totals.assertions_passed) &&
+        (parallel.results.totals.tests_total ==
+         serial.results.totals.tests_total) &&
+        (parallel.results.totals.tests_passed ==
+         serial.results.totals.tests_passed) &&
+        (serial.results.totals.assertions_total == 12) &&
+        (serial.results.modules_passed == 2),
+        "runner_parallel_totals_match_serial",
+        "parallel totals should equal the serial run's totals",
+        _counter) && result;
+
+    // test 3: a module that aborts or exits counts as one failed module
+    d_test_sa_runner_init(&crashing, "Crashing", "dying modules");
+    helper_runner_add_parallel_modules(&crashing);
+    d_test_sa_runner_add_module_counter(&crashing, "abort", "aborts",
+                                        helper_runner_parallel_abort, 0, NULL);
+    d_test_sa_runner_add_module_counter(&crashing, "exit", "exits",
+                                        helper_runner_parallel_exit, 0, NULL);
+    d_test_sa_runner_set_parallel(&crashing, 4);
+
+    output = helper_runner_execute_captured(&crashing);
+    free(output);
+
+    result = d_assert_standalone(
+        (crashing.results.modules_total == 5) &&
+        (crashing.results.modules_passed == serial.results.modules_passed) &&
+        (!crashing.results.modules[3].passed) &&
+        (!crashing.results.modules[4].passed) &&
+        (crashing.results.modules[3].counter.assertions_total == 0) &&
+        (crashing.results.totals.assertions_total ==
+         serial.results.totals.assertions_total),
+        "runner_parallel_crash_is_failure",
+        "a module that dies before reporting should count as one failure",
+        _counter) && result;
+
+    // test 4: the host's own child is still there to be reaped
+    reaped = (bystander > 0) ? waitpid(bystander, &status, 0) : -1;
+
+    result = d_assert_standalone(
+        (reaped == bystander) &&
+        (WIFEXITED(status)) &&
+        (WEXITSTATUS(status) == 7),
+        "runner_parallel_leaves_other_children",
+        "the runner should only reap the children it started",
+        _counter) && result;
+
+    d_test_sa_runner_cleanup(&serial);
+    d_test_sa_runner_cleanup(&parallel);
+    d_test_sa_runner_cleanup(&crashing);
+
+    return result;
+#endif
+}
+
+
+/*
+d_tests_sa_standalone_runner_set_filter
+  Tests the d_test_sa_runner_set_filter function.
+  Tests the following:
+  - NULL runner is handled safely
+  - runners default to no filter
+  - registered modules that cannot match are dropped in order
+  - later registrations that cannot match are ignored
+  - NULL patterns remove the filter
+*/
+bool
+d_tests_sa_standalone_runner_set_filter
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_sa_runner runner;
+
+    result = true;
+
+    // test 1: NULL runner is handled safely
+    result = d_assert_standalone(
+        !d_test_sa_runner_set_filter(NULL, "alloc", NULL),
+        "runner_set_filter_null_safe",
+        "set_filter with NULL runner should return false",
+        _counter) && result;
+
+    // test 2: runners default to no filter
+    d_test_sa_runner_init(&runner, "Test", "Desc");
+
+    result = d_assert_standalone(
+        runner.filter == NULL,
+        "runner_set_filter_default",
+        "filter should default to NULL",
+        _counter) && result;
+
+    // test 3: registered modules that cannot match are dropped
+    d_test_sa_runner_add_module(&runner, "alloc", "A",
+                                helper_runner_module_tree, 0, NULL);
+    d_test_sa_runner_add_module_counter(&runner, "string", "S",
+                                        helper_runner_module_counter, 0, NULL);
+    d_test_sa_runner_add_module_stream(&runner, "alloc_pool", "P",
+                                       helper_runner_module_stream, 0, NULL);
+
+    result = d_assert_standalone(
+        d_test_sa_runner_set_filter(&runner, "alloc*/*/resize*", "alloc_pool") &&
+        (runner.module_count == 1) &&
+        (strcmp(runner.modules[0].name, "alloc") == 0),
+        "runner_set_filter_drops_registered",
+        "only modules that can match should remain registered",
+        _counter) && result;
+
+    // test 4: later registrations that cannot match are ignored
+    d_test_sa_runner_add_module_counter(&runner, "string", "S",
+                                        helper_runner_module_counter, 0, NULL);
+    d_test_sa_runner_add_module_counter(&runner, "alloc_arena", "R",
+                                        helper_runner_module_counter, 0, NULL);
+
+    result = d_assert_standalone(
+        (runner.module_count == 2) &&
+        (strcmp(runner.modules[1].name, "alloc_arena") == 0),
+        "runner_set_filter_skips_registration",
+        "registrations outside the filter should be ignored",
+        _counter) && result;
+
+    // test 5: NULL patterns remove the filter
+    result = d_assert_standalone(
+        d_test_sa_runner_set_filter(&runner, NULL, NULL) &&
+        (runner.filter == NULL),
+        "runner_set_filter_cleared",
+        "NULL patterns should clear the filter",
+        _counter) && result;
+
+    d_test_sa_runner_cleanup(&runner);
+
+    return result;
+}
+
+
 /*
 d_tests_sa_standalone_runner_cleanup
   Tests the d_test_sa_runner_cleanup function.
@@ -469,8 +1047,12 @@ d_tests_sa_standalone_runner_fn_all
     result = d_tests_sa_standalone_runner_init(_counter) && result;
     result = d_tests_sa_standalone_runner_add_module(_counter) && result;
     result = d_tests_sa_standalone_runner_add_module_counter(_counter) && result;
+    result = d_tests_sa_standalone_runner_add_module_stream(_counter) && result;
     result = d_tests_sa_standalone_runner_set_wait(_counter) && result;
     result = d_tests_sa_standalone_runner_set_notes(_counter) && result;
+    result = d_tests_sa_standalone_runner_set_parallel(_counter) && result;
+    result = d_tests_sa_standalone_runner_execute_parallel(_counter) && result;
+    result = d_tests_sa_standalone_runner_set_filter(_counter) && result;
     result = d_tests_sa_standalone_runner_cleanup(_counter) && result;
 
     return result;
@@ -0,0 +1,497 @@
+#include ".\test_standalone_tests_sa.h"
+
+
+/******************************************************************************
+ * HELPER FUNCTIONS FOR STREAM TESTS
+ *****************************************************************************/
+
+// helper_stream_log
+//   struct: records stream events for inspection by the tests.
+struct helper_stream_log
+{
+    size_t      opens;
+    size_t      leaves;
+    size_t      closes;
+    size_t      max_depth;
+    const char* last_closed;
+    bool        last_passed;
+};
+
+/*
+helper_stream_on_open
+  Records an open event.
+*/
+static void
+helper_stream_on_open
+(
+    void*       _context,
+    const char* _name,
+    size_t      _depth
+)
+{
+    struct helper_stream_log* log = (struct helper_stream_log*)_context;
+
+    (void)_name;
+
+    log->opens++;
+
+    if (_depth > log->max_depth)
+    {
+        log->max_depth = _depth;
+    }
+
+    return;
+}
+
+/*
+helper_stream_on_leaf
+  Records a leaf event.
+*/
+static void
+helper_stream_on_leaf
+(
+    void*       _context,
+    const char* _name,
+    const char* _message,
+    bool        _result,
+    size_t      _depth
+)
+{
+    struct helper_stream_log* log = (struct helper_stream_log*)_context;
+
+    (void)_name;
+    (void)_message;
+    (void)_result;
+
+    log->leaves++;
+
+    if (_depth > log->max_depth)
+    {
+        log->max_depth = _depth;
+    }
+
+    return;
+}
+
+/*
+helper_stream_on_close
+  Records a close event.
+*/
+static void
+helper_stream_on_close
+(
+    void*       _context,
+    const char* _name,
+    bool        _passed,
+    size_t      _depth
+)
+{
+    struct helper_stream_log* log = (struct helper_stream_log*)_context;
+
+    (void)_depth;
+
+    log->closes++;
+    log->last_closed = _name;
+    log->last_passed = _passed;
+
+    return;
+}
+
+
+/******************************************************************************
+ * XIII. STREAMING TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_standalone_stream_init
+  Tests the d_test_stream_init function.
+  Tests the following:
+  - NULL stream is handled safely
+  - counter and depth are initialized
+  - NULL sink installs the default print handlers
+  - provided sink is copied
+*/
+bool
+d_tests_sa_standalone_stream_init
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_test_counter     counter;
+    struct d_test_stream      stream;
+    struct d_test_stream_sink sink;
+    struct helper_stream_log  log;
+
+    result = true;
+
+    // test 1: NULL stream is handled safely
+    d_test_stream_init(NULL, &counter, NULL);
+
+    result = d_assert_standalone(
+        true,
+        "stream_init_null_safe",
+        "d_test_stream_init(NULL) should not crash",
+        _counter) && result;
+
+    // test 2: counter and depth are initialized
+    d_test_counter_reset(&counter);
+    d_test_stream_init(&stream, &counter, NULL);
+
+    result = d_assert_standalone(
+        (stream.counter == &counter) &&
+        (stream.depth == 0),
+        "stream_init_fields",
+        "counter should be stored and depth should be 0",
+        _counter) && result;
+
+    // test 3: NULL sink installs the default print handlers
+    result = d_assert_standalone(
+        (stream.sink.on_open != NULL) &&
+        (stream.sink.on_leaf != NULL),
+        "stream_init_default_sink",
+        "NULL sink should install default print handlers",
+        _counter) && result;
+
+    // test 4: provided sink is copied
+    sink.on_open  = helper_stream_on_open;
+    sink.on_leaf  = helper_stream_on_leaf;
+    sink.on_close = helper_stream_on_close;
+    sink.context  = &log;
+
+    d_test_stream_init(&stream, NULL, &sink);
+
+    result = d_assert_standalone(
+        (stream.sink.on_open == helper_stream_on_open) &&
+        (stream.sink.on_close == helper_stream_on_close) &&
+        (stream.sink.context == &log),
+        "stream_init_custom_sink",
+        "provided sink should be copied into the stream",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_standalone_stream_events
+  Tests the d_test_stream_open, d_test_stream_leaf and d_test_stream_close
+  functions.
+  Tests the following:
+  - events reach the sink with the correct depth
+  - leaves update the counter
+  - groups count as tests and pass only if their direct leaves pass
+  - a failure in a nested group does not fail its parent
+  - closing with no open group returns false
+  - D_STREAM_ASSERT_* macros emit leaves
+*/
+bool
+d_tests_sa_standalone_stream_events
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    bool                      inner_passed;
+    bool                      outer_passed;
+    struct d_test_counter     counter;
+    struct d_test_stream      stream;
+    struct d_test_stream_sink sink;
+    struct helper_stream_log  log = { 0 };
+
+    result = true;
+
+    sink.on_open  = helper_stream_on_open;
+    sink.on_leaf  = helper_stream_on_leaf;
+    sink.on_close = helper_stream_on_close;
+    sink.context  = &log;
+
+    d_test_counter_reset(&counter);
+    d_test_stream_init(&stream, &counter, &sink);
+
+    // outer { pass, inner { pass, fail }, pass }
+    d_test_stream_open(&stream, "outer");
+    d_test_stream_leaf(&stream, "a", "a passes", true);
+    d_test_stream_open(&stream, "inner");
+    d_test_stream_leaf(&stream, "b", "b passes", true);
+    d_test_stream_leaf(&stream, "c", "c fails", false);
+    inner_passed = d_test_stream_close(&stream);
+
+    result = d_assert_standalone(
+        (!inner_passed) &&
+        (log.last_passed == false) &&
+        (log.last_closed != NULL) &&
+        (strcmp(log.last_closed, "inner") == 0),
+        "stream_events_inner_fails",
+        "group with a failing leaf should close as failed",
+        _counter) && result;
+
+    D_STREAM_ASSERT_TRUE(&stream, "d", true, "d passes");
+    outer_passed = d_test_stream_close(&stream);
+
+    // test 1: nested failure does not fail the parent
+    result = d_assert_standalone(
+        outer_passed,
+        "stream_events_outer_passes",
+        "nested failure should not fail the parent group",
+        _counter) && result;
+
+    // test 2: events reach the sink
+    result = d_assert_standalone(
+        (log.opens == 2) &&
+        (log.leaves == 4) &&
+        (log.closes == 2) &&
+        (log.max_depth == 2) &&
+        (stream.depth == 0),
+        "stream_events_sink",
+        "sink should receive every event at the correct depth",
+        _counter) && result;
+
+    // test 3: counter matches the equivalent tree
+    result = d_assert_standalone(
+        (counter.assertions_total == 4) &&
+        (counter.assertions_passed == 3) &&
+        (counter.tests_total == 2) &&
+        (counter.tests_passed == 1),
+        "stream_events_counter",
+        "counter should match the equivalent d_test_object tree",
+        _counter) && result;
+
+    // test 4: closing with no open group returns false
+    result = d_assert_standalone(
+        !d_test_stream_close(&stream) &&
+        (stream.depth == 0),
+        "stream_events_close_empty",
+        "close with no open group should return false",
+        _counter) && result;
+
+    // test 5: leaf returns its result and macros emit leaves
+    result = d_assert_standalone(
+        !D_STREAM_ASSERT_FALSE(&stream, "e", true, "e fails") &&
+        D_STREAM_ASSERT_NULL(&stream, "f", NULL, "f passes") &&
+        D_STREAM_ASSERT_STR_EQUAL(&stream, "g", "x", "x", "g passes") &&
+        (counter.assertions_total == 7),
+        "stream_events_macros",
+        "D_STREAM_ASSERT_* should emit leaves and return the result",
+        _counter) && result;
+
+    // test 6: NULL stream is handled safely
+    result = d_assert_standalone(
+        d_test_stream_leaf(NULL, "h", "h", true) &&
+        !d_test_stream_close(NULL),
+        "stream_events_null_safe",
+        "NULL stream should be handled safely",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_standalone_stream_filter
+  Tests the d_test_stream_set_filter and d_test_stream_selects functions.
+  Tests the following:
+  - streams without a filter select everything
+  - group paths are prefixed with the root name
+  - unselected siblings are rejected before they are opened
+  - NULL stream is handled safely
+*/
+bool
+d_tests_sa_standalone_stream_filter
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_test_stream      stream;
+    struct d_test_stream_sink sink;
+    struct d_test_filter*     filter;
+
+    result = true;
+    filter = d_test_filter_new("alloc/*/resize*", NULL);
+
+    // silent sink
+    sink.on_open  = NULL;
+    sink.on_leaf  = NULL;
+    sink.on_close = NULL;
+    sink.context  = NULL;
+
+    d_test_stream_init(&stream, NULL, &sink);
+
+    // test 1: streams without a filter select everything
+    result = d_assert_standalone(
+        (stream.filter == NULL) &&
+        d_test_stream_selects(&stream, "anything"),
+        "stream_filter_default",
+        "a stream without a filter should select everything",
+        _counter) && result;
+
+    // test 2: group paths are prefixed with the root name
+    d_test_stream_set_filter(&stream, filter, "alloc");
+
+    result = d_assert_standalone(
+        (filter != NULL) &&
+        d_test_stream_selects(&stream, "vector"),
+        "stream_filter_group_partial",
+        "a group that may contain matches should be selected",
+        _counter) && result;
+
+    // test 3: unselected siblings are rejected before they are opened
+    d_test_stream_open(&stream, "vector");
+
+    result = d_assert_standalone(
+        d_test_stream_selects(&stream, "resize_grow") &&
+        !d_test_stream_selects(&stream, "push_back"),
+        "stream_filter_leaf",
+        "only leaves matching the last segment should be selected",
+        _counter) && result;
+
+    d_test_stream_close(&stream);
+
+    d_test_stream_set_filter(&stream, filter, "string");
+
+    result = d_assert_standalone(
+        !d_test_stream_selects(&stream, "vector"),
+        "stream_filter_root_mismatch",
+        "groups under an unselected root should be rejected",
+        _counter) && result;
+
+    // test 4: NULL stream is handled safely
+    d_test_stream_set_filter(NULL, filter, NULL);
+
+    result = d_assert_standalone(
+        d_test_stream_selects(NULL, "x"),
+        "stream_filter_null_safe",
+        "NULL stream should select everything",
+        _counter) && result;
+
+    d_test_filter_free(filter);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_standalone_stream_overflow
+  Tests groups nested deeper than D_TEST_STREAM_MAX_DEPTH.
+  Tests the following:
+  - an overflowed group closes without a name
+  - a failure inside it fails that group only
+  - a sibling overflowed group starts from a passing status
+  - the deepest tracked group keeps its own name and status
+*/
+bool
+d_tests_sa_standalone_stream_overflow
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    bool                      first_passed;
+    bool                      second_passed;
+    bool                      deepest_passed;
+    size_t                    i;
+    struct d_test_counter     counter;
+    struct d_test_stream      stream;
+    struct d_test_stream_sink sink;
+    struct helper_stream_log  log = { 0 };
+
+    result = true;
+
+    sink.on_open  = helper_stream_on_open;
+    sink.on_leaf  = helper_stream_on_leaf;
+    sink.on_close = helper_stream_on_close;
+    sink.context  = &log;
+
+    d_test_counter_reset(&counter);
+    d_test_stream_init(&stream, &counter, &sink);
+
+    for (i = 1; i < D_TEST_STREAM_MAX_DEPTH; i++)
+    {
+        d_test_stream_open(&stream, "level");
+    }
+
+    d_test_stream_open(&stream, "deepest");
+    d_test_stream_leaf(&stream, "a", "a passes", true);
+
+    // first overflowed group holds a failure
+    d_test_stream_open(&stream, "first");
+    d_test_stream_leaf(&stream, "b", "b fails", false);
+    first_passed = d_test_stream_close(&stream);
+
+    // test 1: the overflowed group fails and has no name
+    result = d_assert_standalone(
+        (!first_passed)            &&
+        (log.last_closed == NULL)  &&
+        (!log.last_passed),
+        "stream_overflow_fails",
+        "an overflowed group with a failure should close failed and unnamed",
+        _counter) && result;
+
+    // second overflowed group only passes
+    d_test_stream_open(&stream, "second");
+    d_test_stream_leaf(&stream, "c", "c passes", true);
+    second_passed = d_test_stream_close(&stream);
+
+    // test 2: a sibling overflowed group is judged on its own
+    result = d_assert_standalone(
+        (second_passed)            &&
+        (log.last_closed == NULL),
+        "stream_overflow_sibling",
+        "a sibling overflowed group should not inherit an earlier failure",
+        _counter) && result;
+
+    deepest_passed = d_test_stream_close(&stream);
+
+    // test 3: the deepest tracked group is not affected by overflowed ones
+    result = d_assert_standalone(
+        (deepest_passed)                        &&
+        (log.last_closed != NULL)               &&
+        (strcmp(log.last_closed, "deepest") == 0),
+        "stream_overflow_deepest",
+        "the deepest tracked group should keep its name and status",
+        _counter) && result;
+
+    while (stream.depth > 0)
+    {
+        d_test_stream_close(&stream);
+    }
+
+    // test 4: every group counted once, only the failing one failed
+    result = d_assert_standalone(
+        (counter.tests_total == D_TEST_STREAM_MAX_DEPTH + 2)      &&
+        (counter.tests_passed == D_TEST_STREAM_MAX_DEPTH + 1)     &&
+        (counter.assertions_total == 3)                           &&
+        (counter.assertions_passed == 2),
+        "stream_overflow_counts",
+        "overflowed groups should be counted like any other group",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_standalone_stream_all
+  Aggregation function that runs all streaming tests.
+*/
+bool
+d_tests_sa_standalone_stream_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Streaming\n");
+    printf("  -------------------\n");
+
+    result = d_tests_sa_standalone_stream_init(_counter) && result;
+    result = d_tests_sa_standalone_stream_events(_counter) && result;
+    result = d_tests_sa_standalone_stream_filter(_counter) && result;
+    result = d_tests_sa_standalone_stream_overflow(_counter) && result;
+
+    return result;
+}
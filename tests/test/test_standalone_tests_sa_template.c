@@ -261,6 +261,152 @@ d_tests_sa_standalone_substitute_template
     return result;
 }
 
+/*
+d_tests_sa_standalone_template_compile
+  Tests the compiled template functions (d_test_template_compile,
+  d_test_template_render_length, d_test_template_render,
+  d_test_template_render_to_string, d_test_template_free).
+  Tests the following:
+  - NULL template and empty delimiters are rejected
+  - placeholders are split into literal and slot segments
+  - unknown keys are kept as literal text
+  - render_length reports the exact output length
+  - render writes the full output into an exact-size buffer
+  - render truncates and null-terminates a short buffer
+  - a compiled template can be re-rendered with new values
+  - NULL values render as empty
+*/
+bool
+d_tests_sa_standalone_template_compile
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_test_template* compiled;
+    const char*             delimiters[2];
+    const char*             keys[1];
+    const char*             values[1];
+    char                    buffer[64];
+    char*                   output;
+    size_t                  length;
+
+    result = true;
+
+    delimiters[0] = "{{";
+    delimiters[1] = "}}";
+    keys[0]       = "name";
+
+    // test 1: NULL template is rejected
+    compiled = d_test_template_compile(NULL, delimiters, 1, keys);
+
+    result = d_assert_standalone(
+        compiled == NULL,
+        "template_compile_null_template",
+        "NULL template should not compile",
+        _counter) && result;
+
+    // test 2: empty delimiter is rejected
+    {
+        const char* empty_delims[2];
+
+        empty_delims[0] = "";
+        empty_delims[1] = "}}";
+
+        compiled = d_test_template_compile("test", empty_delims, 1, keys);
+
+        result = d_assert_standalone(
+            compiled == NULL,
+            "template_compile_empty_delimiter",
+            "Empty delimiter should not compile",
+            _counter) && result;
+    }
+
+    // test 3: valid template compiles into segments
+    compiled = d_test_template_compile("Hello {{name}}, {{name}}! {{other}}",
+                                       delimiters,
+                                       1,
+                                       keys);
+
+    result = d_assert_standalone(
+        compiled != NULL,
+        "template_compile_valid",
+        "Valid template should compile",
+        _counter) && result;
+
+    if (!compiled)
+    {
+        return result;
+    }
+
+    result = d_assert_standalone(
+        compiled->segment_count == 5,
+        "template_compile_segments",
+        "Template should split into 5 literal/slot segments",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        compiled->segments[1].is_slot &&
+        compiled->segments[1].key_index == 0,
+        "template_compile_key_index",
+        "Slot should be resolved to its key index",
+        _counter) && result;
+
+    // test 4: render length is exact
+    values[0] = "Bob";
+    length    = d_test_template_render_length(compiled, values);
+
+    result = d_assert_standalone(
+        length == strlen("Hello Bob, Bob! {{other}}"),
+        "template_render_length",
+        "Render length should match the rendered output",
+        _counter) && result;
+
+    // test 5: render into exact-size buffer
+    d_test_template_render(compiled, values, buffer, length + 1);
+
+    result = d_assert_standalone(
+        strcmp(buffer, "Hello Bob, Bob! {{other}}") == 0,
+        "template_render_exact",
+        "Render should substitute all known slots and keep unknown keys",
+        _counter) && result;
+
+    // test 6: short buffer is truncated and terminated
+    result = d_assert_standalone(
+        (d_test_template_render(compiled, values, buffer, 8) == length) &&
+        (strcmp(buffer, "Hello B") == 0),
+        "template_render_truncated",
+        "Render should truncate, terminate and report the full length",
+        _counter) && result;
+
+    // test 7: re-render with a different value
+    values[0] = "Alexandra";
+    output    = d_test_template_render_to_string(compiled, values);
+
+    result = d_assert_standalone(
+        (output != NULL) &&
+        (strcmp(output, "Hello Alexandra, Alexandra! {{other}}") == 0),
+        "template_render_reuse",
+        "Compiled template should re-render with new values",
+        _counter) && result;
+
+    free(output);
+
+    // test 8: NULL value renders as empty
+    values[0] = NULL;
+    d_test_template_render(compiled, values, buffer, sizeof(buffer));
+
+    result = d_assert_standalone(
+        strcmp(buffer, "Hello , ! {{other}}") == 0,
+        "template_render_null_value",
+        "NULL value should render as empty",
+        _counter) && result;
+
+    d_test_template_free(compiled);
+
+    return result;
+}
+
 /*
 d_tests_sa_standalone_template_all
   Aggregation function that runs all template substitution tests.
@@ -279,6 +425,7 @@ d_tests_sa_standalone_template_all
     printf("  ---------------------------------\n");
 
     result = d_tests_sa_standalone_substitute_template(_counter) && result;
+    result = d_tests_sa_standalone_template_compile(_counter) && result;
 
     return result;
 }
@@ -106,6 +106,69 @@ d_tests_sa_standalone_get_elapsed_time
 }
 
 
+/*
+d_tests_sa_standalone_get_wall_time
+  Tests the d_test_sa_get_wall_time and d_test_sa_get_thread_cpu_time
+  functions.
+  Tests the following:
+  - wall time is monotonic
+  - thread CPU time is non-negative and monotonic
+  - busy work advances CPU time no faster than wall time
+*/
+bool
+d_tests_sa_standalone_get_wall_time
+(
+    struct d_test_counter* _counter
+)
+{
+    bool         result;
+    double       wall_start;
+    double       wall_end;
+    double       cpu_start;
+    double       cpu_end;
+    volatile int i;
+
+    result = true;
+
+    wall_start = d_test_sa_get_wall_time();
+    cpu_start  = d_test_sa_get_thread_cpu_time();
+
+    // busy wait to consume some time
+    for (i = 0; i < 1000000; i++)
+    {
+        // empty loop
+    }
+
+    cpu_end  = d_test_sa_get_thread_cpu_time();
+    wall_end = d_test_sa_get_wall_time();
+
+    // test 1: wall time is monotonic
+    result = d_assert_standalone(
+        wall_end >= wall_start,
+        "wall_time_monotonic",
+        "Wall time should never go backwards",
+        _counter) && result;
+
+    // test 2: thread CPU time is non-negative and monotonic
+    result = d_assert_standalone(
+        (cpu_start >= 0.0) &&
+        (cpu_end >= cpu_start),
+        "thread_cpu_time_monotonic",
+        "Thread CPU time should be non-negative and never go backwards",
+        _counter) && result;
+
+    // test 3: a single thread cannot use more CPU than wall time (allowing
+    // for clock granularity)
+    result = d_assert_standalone(
+        (cpu_end - cpu_start) <= (wall_end - wall_start) + 0.02,
+        "thread_cpu_time_bounded",
+        "Thread CPU time should not exceed wall time",
+        _counter) && result;
+
+    return result;
+}
+
+
 /*
 d_tests_sa_standalone_utility_all
   Aggregation function that runs all utility function tests.
@@ -124,6 +187,7 @@ d_tests_sa_standalone_utility_all
     printf("  ----------------------------\n");
 
     result = d_tests_sa_standalone_get_elapsed_time(_counter) && result;
+    result = d_tests_sa_standalone_get_wall_time(_counter) && result;
 
     return result;
 }